@@ -56,16 +56,22 @@ POSSIBILITY OF SUCH DAMAGE.
 // Pointers are a peculiar case...typically 16-bit on AVR boards,
 // 32 bits elsewhere.  Try to accommodate both...
 
-#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
- #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
-#else
- #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+#ifndef pgm_read_pointer
+ #if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
+  #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+ #else
+  #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+ #endif
 #endif
 
 #ifndef min
 #define min(a,b) (((a) < (b)) ? (a) : (b))
 #endif
 
+#ifndef max
+#define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
 #ifndef _swap_int16_t
 #define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
 #endif
@@ -89,6 +95,7 @@ WIDTH(w), HEIGHT(h)
     wrap      = true;
     _cp437    = false;
     gfxFont   = NULL;
+    resetClipRect();
 }
 
 /**************************************************************************/
@@ -397,9 +404,20 @@ void Adafruit_GFX::drawCircleHelper( int16_t x0, int16_t y0,
     }
 }
 
+// Span table of the most recently filled circle, see fillCircle().
+// Circles with a larger radius use the midpoint algorithm on every call.
+#ifndef GFX_CIRCLE_CACHE_RADIUS
+ #define GFX_CIRCLE_CACHE_RADIUS 16
+#endif
+
+static int16_t circleCacheRadius = -1;
+static uint8_t circleCache[GFX_CIRCLE_CACHE_RADIUS + 1];
+
 /**************************************************************************/
 /*!
-   @brief    Draw a circle with filled color
+   @brief    Draw a circle with filled color. Circles with a radius up to
+             GFX_CIRCLE_CACHE_RADIUS are drawn from a span table that is
+             only recomputed when the radius differs from the previous call.
     @param    x0   Center-point x coordinate
     @param    y0   Center-point y coordinate
     @param    r   Radius of circle
@@ -408,12 +426,66 @@ void Adafruit_GFX::drawCircleHelper( int16_t x0, int16_t y0,
 /**************************************************************************/
 void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
         uint16_t color) {
+    if((r < 0) || (r > GFX_CIRCLE_CACHE_RADIUS)) {
+        startWrite();
+        writeFastVLine(x0, y0-r, 2*r+1, color);
+        fillCircleHelper(x0, y0, r, 3, 0, color);
+        endWrite();
+        return;
+    }
+
+    if(r != circleCacheRadius) {
+        // Same walk as fillCircleHelper(), but recording the widest
+        // span of every row instead of drawing columns.
+        int16_t f = 1 - r;
+        int16_t x = 0;
+        int16_t y = r;
+
+        memset(circleCache, 0, r + 1);
+        while(x <= y) {
+            if(y > circleCache[x]) circleCache[x] = y;
+            if(x > circleCache[y]) circleCache[y] = x;
+            if(f >= 0) {
+                y--;
+                f -= 2 * y;
+            }
+            x++;
+            f += 2 * x + 1;
+        }
+        // A row is at least as wide as any row further from the center.
+        for(int16_t d=r; d>0; d--) {
+            if(circleCache[d] > circleCache[d-1]) {
+                circleCache[d-1] = circleCache[d];
+            }
+        }
+        circleCacheRadius = r;
+    }
+
     startWrite();
-    writeFastVLine(x0, y0-r, 2*r+1, color);
-    fillCircleHelper(x0, y0, r, 3, 0, color);
+    writeCircleSpans(x0, y0, r, circleCache, color);
     endWrite();
 }
 
+/**************************************************************************/
+/*!
+   @brief    Write a filled circle as horizontal spans (must have a
+             transaction in progress)
+    @param    x0   Center-point x coordinate
+    @param    y0   Center-point y coordinate
+    @param    r   Radius of circle
+    @param    spans  Array of r+1 half-widths, one per row
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeCircleSpans(int16_t x0, int16_t y0, int16_t r,
+        const uint8_t *spans, uint16_t color) {
+    for(int16_t d=0; d<=r; d++) {
+        int16_t w = spans[d];
+        writeFastHLine(x0-w, y0-d, 2*w+1, color);
+        if(d) writeFastHLine(x0-w, y0+d, 2*w+1, color);
+    }
+}
+
 
 /**************************************************************************/
 /*!
@@ -1009,6 +1081,18 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
 
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
+/**************************************************************************/
+/*!
+   @brief   Locate a character of the 'classic' built-in font
+    @param    c   The 8-bit font-indexed character (likely ascii)
+    @returns  Pointer to the 5 column bytes of the character, in PROGMEM
+*/
+/**************************************************************************/
+const unsigned char *Adafruit_GFX::classicGlyph(unsigned char c) const {
+    if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+    return &font[c * 5];
+}
+
 // Draw a character
 /**************************************************************************/
 /*!
@@ -1032,11 +1116,11 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
            ((y + 8 * size - 1) < 0))   // Clip top
             return;
 
-        if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+        const unsigned char *glyph = classicGlyph(c);
 
         startWrite();
         for(int8_t i=0; i<5; i++ ) { // Char bitmap = 5 columns
-            uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+            uint8_t line = pgm_read_byte(&glyph[i]);
             for(int8_t j=0; j<8; j++, line >>= 1) {
                 if(line & 1) {
                     if(size == 1)
@@ -1099,20 +1183,59 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
         // implemented this yet.
 
         startWrite();
-        for(yy=0; yy<h; yy++) {
-            for(xx=0; xx<w; xx++) {
-                if(!(bit++ & 7)) {
+        if(pgm_read_byte(&gfxFont->compressed)) {
+            // Run-length encoded glyph, see gfxfont.h.  Runs of set
+            // pixels are drawn as horizontal lines, split at row ends.
+            uint16_t left = (uint16_t)w * h;
+            boolean  set  = false;
+            xx = yy = 0;
+            while(left) {
+                uint8_t n;
+                if(!(bit++ & 1)) {
                     bits = pgm_read_byte(&bitmap[bo++]);
+                    n    = bits >> 4;
+                } else {
+                    n    = bits & 0x0F;
                 }
-                if(bits & 0x80) {
-                    if(size == 1) {
-                        writePixel(x+xo+xx, y+yo+yy, color);
-                    } else {
-                        writeFillRect(x+(xo16+xx)*size, y+(yo16+yy)*size,
-                          size, size, color);
+                if(n > left) n = left;
+                left -= n;
+                boolean toggle = (n != 15);
+                while(n) {
+                    uint8_t span = w - xx;
+                    if(span > n) span = n;
+                    if(set) {
+                        if(size == 1) {
+                            writeFastHLine(x+xo+xx, y+yo+yy, span, color);
+                        } else {
+                            writeFillRect(x+(xo16+xx)*size, y+(yo16+yy)*size,
+                              span*size, size, color);
+                        }
+                    }
+                    n  -= span;
+                    xx += span;
+                    if(xx == w) {
+                        xx = 0;
+                        yy++;
                     }
                 }
-                bits <<= 1;
+                if(toggle) set = !set;
+            }
+        } else {
+            for(yy=0; yy<h; yy++) {
+                for(xx=0; xx<w; xx++) {
+                    if(!(bit++ & 7)) {
+                        bits = pgm_read_byte(&bitmap[bo++]);
+                    }
+                    if(bits & 0x80) {
+                        if(size == 1) {
+                            writePixel(x+xo+xx, y+yo+yy, color);
+                        } else {
+                            writeFillRect(x+(xo16+xx)*size, y+(yo16+yy)*size,
+                              size, size, color);
+                        }
+                    }
+                    bits <<= 1;
+                }
             }
         }
         endWrite();
@@ -1477,6 +1600,34 @@ void Adafruit_GFX::getTextBounds(const __FlashStringHelper *str,
     }
 }
 
+/**************************************************************************/
+/*!
+    @brief   Limit all drawing to a rectangle of the display. Primitives clip
+             whole spans against it, so the pixels outside of it cost nothing.
+             The display edges still apply, also after a rotation.
+    @param   x   Left edge
+    @param   y   Top edge
+    @param   w   Width in pixels
+    @param   h   Height in pixels
+*/
+/**************************************************************************/
+void Adafruit_GFX::setClipRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    _clipX1 = (x < 0) ? 0 : x;
+    _clipY1 = (y < 0) ? 0 : y;
+    _clipX2 = x + w;
+    _clipY2 = y + h;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Let drawing reach the whole display again
+*/
+/**************************************************************************/
+void Adafruit_GFX::resetClipRect(void) {
+    _clipX1 = _clipY1 = 0;
+    _clipX2 = _clipY2 = 0x7FFF;
+}
+
 /**************************************************************************/
 /*!
     @brief      Get width of the display, accounting for the current rotation
@@ -1505,6 +1656,7 @@ int16_t Adafruit_GFX::height(void) const {
 /**************************************************************************/
 void Adafruit_GFX::invertDisplay(boolean i) {
     // Do nothing, must be subclassed if supported by hardware
+    (void)i;
 }
 
 /***************************************************************************/
@@ -1723,7 +1875,7 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
 #endif
 
     if(buffer) {
-        if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+        if(!clipPixel(x, y)) return;
 
         int16_t t;
         switch(rotation) {
@@ -1767,6 +1919,93 @@ void GFXcanvas1::fillScreen(uint16_t color) {
     }
 }
 
+/**************************************************************************/
+/*!
+   @brief    Start an empty list of changed rectangles
+*/
+/**************************************************************************/
+GFXdirty::GFXdirty(void) : _count(0) {
+}
+
+/**************************************************************************/
+/*!
+   @brief    Forget all changed rectangles
+*/
+/**************************************************************************/
+void GFXdirty::clear(void) {
+    _count = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Add a changed rectangle. It is merged with every rectangle in
+             the list that it overlaps or touches, so the list never holds
+             a pixel twice. When the list is full, it is merged with the
+             rectangle whose bounding box grows the least.
+    @param    x   Left edge
+    @param    y   Top edge
+    @param    w   Width in pixels
+    @param    h   Height in pixels
+*/
+/**************************************************************************/
+void GFXdirty::add(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if((w <= 0) || (h <= 0)) return;
+
+    // Drawing mostly stays within what already changed
+    uint8_t i;
+    for(i=0; i<_count; i++) {
+        GFXrect *r = &_rects[i];
+        if((x >= r->x) && (y >= r->y) &&
+           (x + w <= r->x + r->w) && (y + h <= r->y + r->h)) return;
+    }
+
+    int16_t x2 = x + w, y2 = y + h; // Exclusive
+    for(i=0; i<_count; ) {
+        GFXrect *r = &_rects[i];
+        if((x <= r->x + r->w) && (r->x <= x2) &&
+           (y <= r->y + r->h) && (r->y <= y2)) {
+            if(r->x + r->w > x2) x2 = r->x + r->w;
+            if(r->y + r->h > y2) y2 = r->y + r->h;
+            if(r->x < x) x = r->x;
+            if(r->y < y) y = r->y;
+            *r = _rects[--_count];
+            i  = 0; // The grown rectangle may touch one it missed before
+        } else {
+            i++;
+        }
+    }
+
+    if(_count == GFX_DIRTY_RECTS) {
+        uint8_t  best = 0;
+        uint32_t bestGrowth = 0xFFFFFFFF;
+        for(i=0; i<_count; i++) {
+            GFXrect *r = &_rects[i];
+            int16_t  ux  = min(x, r->x), uy = min(y, r->y),
+                     ux2 = max(x2, r->x + r->w), uy2 = max(y2, r->y + r->h);
+            uint32_t growth = (uint32_t)(ux2 - ux) * (uy2 - uy) -
+                              (uint32_t)r->w * r->h;
+            if(growth < bestGrowth) {
+                best       = i;
+                bestGrowth = growth;
+            }
+        }
+        GFXrect r = _rects[best];
+        _rects[best] = _rects[--_count];
+        x  = min(x, r.x);
+        y  = min(y, r.y);
+        x2 = max(x2, r.x + r.w);
+        y2 = max(y2, r.y + r.h);
+        add(x, y, x2 - x, y2 - y); // May touch others now
+        return;
+    }
+
+    GFXrect *r = &_rects[_count++];
+    r->x = x;
+    r->y = y;
+    r->w = x2 - x;
+    r->h = y2 - y;
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX 8-bit canvas context for graphics
@@ -1811,7 +2050,7 @@ uint8_t* GFXcanvas8::getBuffer(void) {
 /**************************************************************************/
 void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if(buffer) {
-        if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+        if(!clipPixel(x, y)) return;
 
         int16_t t;
         switch(rotation) {
@@ -1832,6 +2071,7 @@ void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
         }
 
         buffer[x + y * WIDTH] = color;
+        dirty.add(x, y, 1, 1);
     }
 }
 
@@ -1844,22 +2084,15 @@ void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
 void GFXcanvas8::fillScreen(uint16_t color) {
     if(buffer) {
         memset(buffer, color, WIDTH * HEIGHT);
+        dirty.add(0, 0, WIDTH, HEIGHT);
     }
 }
 
 void GFXcanvas8::writeFastHLine(int16_t x, int16_t y,
   int16_t w, uint16_t color) {
 
-    if((x >= _width) || (y < 0) || (y >= _height)) return;
-    int16_t x2 = x + w - 1;
-    if(x2 < 0) return;
-
-    // Clip left/right
-    if(x < 0) {
-        x = 0;
-        w = x2 + 1;
-    }
-    if(x2 >= _width) w = _width - x;
+    int16_t h = 1;
+    if(!clipRect(&x, &y, &w, &h)) return;
 
     int16_t t;
     switch(rotation) {
@@ -1880,6 +2113,7 @@ void GFXcanvas8::writeFastHLine(int16_t x, int16_t y,
     }
 
     memset(buffer + y * WIDTH + x, color, w);
+    dirty.add(x, y, w, 1);
 }
 
 /**************************************************************************/
@@ -1925,7 +2159,7 @@ uint16_t* GFXcanvas16::getBuffer(void) {
 /**************************************************************************/
 void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if(buffer) {
-        if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+        if(!clipPixel(x, y)) return;
 
         int16_t t;
         switch(rotation) {
@@ -1946,6 +2180,7 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
         }
 
         buffer[x + y * WIDTH] = color;
+        dirty.add(x, y, 1, 1);
     }
 }
 
@@ -1964,6 +2199,30 @@ void GFXcanvas16::fillScreen(uint16_t color) {
             uint32_t i, pixels = WIDTH * HEIGHT;
             for(i=0; i<pixels; i++) buffer[i] = color;
         }
+        dirty.add(0, 0, WIDTH, HEIGHT);
     }
 }
 
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly horizontal line into the framebuffer
+    @param    x   Left-most x coordinate
+    @param    y   Left-most y coordinate
+    @param    w   Width in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::writeFastHLine(int16_t x, int16_t y,
+  int16_t w, uint16_t color) {
+    if(!buffer || rotation) { // Rotated lines run across the buffer
+        Adafruit_GFX::writeFastHLine(x, y, w, color);
+        return;
+    }
+
+    int16_t h = 1;
+    if(!clipRect(&x, &y, &w, &h)) return;
+
+    uint16_t *pixel = buffer + y * WIDTH + x;
+    for(int16_t i=0; i<w; i++) pixel[i] = color;
+    dirty.add(x, y, w, 1);
+}
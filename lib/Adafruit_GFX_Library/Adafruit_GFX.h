@@ -8,6 +8,7 @@
  #include "WProgram.h"
 #endif
 #include "gfxfont.h"
+#include "gfxcircle.h"
 
 /// A generic graphics superclass that can handle all sorts of drawing. At a minimum you can subclass and provide drawPixel(). At a maximum you can do a ton of overriding to optimize. Used for any/all Adafruit displays!
 class Adafruit_GFX : public Print {
@@ -47,7 +48,10 @@ class Adafruit_GFX : public Print {
     fillScreen(uint16_t color),
     // Optional and probably not necessary to change
     drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color),
-    drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
+    // Overridden by SPI displays to blit opaque glyphs in one address window
+    drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+      uint16_t bg, uint8_t size);
 
   // These exist only with Adafruit_GFX (no subclass overrides)
   void
@@ -93,8 +97,8 @@ class Adafruit_GFX : public Print {
       int16_t w, int16_t h),
     drawRGBBitmap(int16_t x, int16_t y,
       uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h),
-    drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
-      uint16_t bg, uint8_t size),
+    setClipRect(int16_t x, int16_t y, int16_t w, int16_t h),
+    resetClipRect(void),
     setCursor(int16_t x, int16_t y),
     setTextColor(uint16_t c),
     setTextColor(uint16_t c, uint16_t bg),
@@ -119,6 +123,33 @@ class Adafruit_GFX : public Print {
   int16_t height(void) const;
   int16_t width(void) const;
 
+  /// Clip a rectangle to the display and the clip rectangle (see setClipRect()).
+  /// @returns False if nothing of it is left
+  /// @param x Left edge, updated @param y Top edge, updated
+  /// @param w Width, updated @param h Height, updated
+  inline boolean clipRect(int16_t *x, int16_t *y, int16_t *w, int16_t *h) const {
+    int16_t x1 = *x, y1 = *y, x2 = *x + *w, y2 = *y + *h; // Exclusive
+    if(x1 < _clipX1) x1 = _clipX1;
+    if(y1 < _clipY1) y1 = _clipY1;
+    if(x2 > _clipX2) x2 = _clipX2;
+    if(y2 > _clipY2) y2 = _clipY2;
+    if(x2 > _width)  x2 = _width;
+    if(y2 > _height) y2 = _height;
+    if((x1 >= x2) || (y1 >= y2)) return false;
+    *x = x1;
+    *y = y1;
+    *w = x2 - x1;
+    *h = y2 - y1;
+    return true;
+  }
+
+  /// @returns True if a pixel is on the display and within the clip rectangle
+  /// @param x x coordinate @param y y coordinate
+  inline boolean clipPixel(int16_t x, int16_t y) const {
+    return (x >= _clipX1) && (y >= _clipY1) && (x < _clipX2) && (y < _clipY2) &&
+      (x < _width) && (y < _height);
+  }
+
   uint8_t getRotation(void) const;
 
   // get current cursor position (get rotation safe maximum values, using: width() for x, height() for y)
@@ -127,8 +158,12 @@ class Adafruit_GFX : public Print {
 
  protected:
   void
+    writeCircleSpans(int16_t x0, int16_t y0, int16_t r,
+      const uint8_t *spans, uint16_t color),
     charBounds(char c, int16_t *x, int16_t *y,
       int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
+  const unsigned char
+    *classicGlyph(unsigned char c) const;
   const int16_t
     WIDTH,          ///< This is the 'raw' display width - never changes
     HEIGHT;         ///< This is the 'raw' display height - never changes
@@ -136,7 +171,11 @@ class Adafruit_GFX : public Print {
     _width,         ///< Display width as modified by current rotation
     _height,        ///< Display height as modified by current rotation
     cursor_x,       ///< x location to start print()ing text
-    cursor_y;       ///< y location to start print()ing text
+    cursor_y,       ///< y location to start print()ing text
+    _clipX1,        ///< Left edge of the clip rectangle, never negative
+    _clipY1,        ///< Top edge of the clip rectangle, never negative
+    _clipX2,        ///< Right edge of the clip rectangle (exclusive)
+    _clipY2;        ///< Bottom edge of the clip rectangle (exclusive)
   uint16_t
     textcolor,      ///< 16-bit background color for print()
     textbgcolor;    ///< 16-bit text color for print()
@@ -184,6 +223,34 @@ class Adafruit_GFX_Button {
 };
 
 
+#ifndef GFX_DIRTY_RECTS
+#define GFX_DIRTY_RECTS 4 ///< Changed rectangles a canvas keeps apart before it merges them
+#endif
+
+class Adafruit_SPITFT; // Canvases flush to it, see Adafruit_SPITFT.cpp
+
+/// A rectangle of canvas memory
+typedef struct {
+  int16_t x;  ///< Left edge
+  int16_t y;  ///< Top edge
+  int16_t w;  ///< Width in pixels
+  int16_t h;  ///< Height in pixels
+} GFXrect;
+
+/// A bounded list of the parts of a canvas that changed since its last flush
+class GFXdirty {
+ public:
+  GFXdirty(void);
+  void     add(int16_t x, int16_t y, int16_t w, int16_t h),
+           clear(void);
+  uint8_t  count(void) const { return _count; } ///< @returns Number of rectangles in the list
+  const GFXrect &rect(uint8_t i) const { return _rects[i]; } ///< @returns Rectangle i of the list @param i Index below count()
+ private:
+  GFXrect  _rects[GFX_DIRTY_RECTS];
+  uint8_t  _count;
+};
+
+
 /// A GFX 1-bit canvas context for graphics
 class GFXcanvas1 : public Adafruit_GFX {
  public:
@@ -197,7 +264,8 @@ class GFXcanvas1 : public Adafruit_GFX {
 };
 
 
-/// A GFX 8-bit canvas context for graphics
+/// A GFX 8-bit canvas context for graphics. The pixels are RGB 3-3-2 colors
+/// as far as flush() is concerned; the canvas itself stores any 8-bit value.
 class GFXcanvas8 : public Adafruit_GFX {
  public:
   GFXcanvas8(uint16_t w, uint16_t h);
@@ -207,8 +275,13 @@ class GFXcanvas8 : public Adafruit_GFX {
            writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 
   uint8_t *getBuffer(void);
+  const GFXdirty &getDirty(void) const { return dirty; } ///< @returns The parts changed since the last flush()
+#if !defined(__AVR_ATtiny85__)
+  void     flush(Adafruit_SPITFT &display, int16_t x = 0, int16_t y = 0); ///< Send the changed parts, expanding RGB 3-3-2 to 5-6-5 (in Adafruit_SPITFT.cpp)
+#endif
  private:
   uint8_t *buffer;
+  GFXdirty dirty;
 };
 
 
@@ -218,10 +291,16 @@ class GFXcanvas16 : public Adafruit_GFX {
   GFXcanvas16(uint16_t w, uint16_t h);
   ~GFXcanvas16(void);
   void      drawPixel(int16_t x, int16_t y, uint16_t color),
-            fillScreen(uint16_t color);
+            fillScreen(uint16_t color),
+            writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   uint16_t *getBuffer(void);
+  const GFXdirty &getDirty(void) const { return dirty; } ///< @returns The parts changed since the last flush()
+#if !defined(__AVR_ATtiny85__)
+  void      flush(Adafruit_SPITFT &display, int16_t x = 0, int16_t y = 0); ///< Send the changed parts (in Adafruit_SPITFT.cpp)
+#endif
  private:
   uint16_t *buffer;
+  GFXdirty  dirty;
 };
 
 #endif // _ADAFRUIT_GFX_H
@@ -45,6 +45,11 @@
 
 #include "Adafruit_SPITFT_Macros.h"
 
+#ifdef RENDER_PROFILE
+uint32_t Adafruit_SPITFT::profileBytes   = 0;
+uint16_t Adafruit_SPITFT::profileWindows = 0;
+uint16_t Adafruit_SPITFT::profileElided  = 0;
+#endif
 
 /**************************************************************************/
 /*!
@@ -321,6 +326,18 @@ void Adafruit_SPITFT::pushColor(uint16_t color) {
 */
 /**************************************************************************/
 void Adafruit_SPITFT::writePixels(uint16_t * colors, uint32_t len){
+#if defined(__AVR__) && defined(SPITFT_AVR_PIPELINE)
+    if((_sclk < 0) && HSPI_AVR_PIPELINE()){ // Pipelined, see Adafruit_SPITFT_Macros.h
+        while(len){
+            uint16_t n = (len > 0xFFFF) ? 0xFFFF : len;
+            _avr_spi_stream((uint8_t *)colors, n);
+            SPI_PROFILE_BYTES(2UL * n);
+            colors += n;
+            len    -= n;
+        }
+        return;
+    }
+#endif
     SPI_WRITE_PIXELS((uint8_t*)colors , len * 2);
 }
 
@@ -355,6 +372,17 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len){
 #else
     uint8_t hi = color >> 8, lo = color;
     if(_sclk < 0){ //AVR Optimization
+#if defined(__AVR__) && defined(SPITFT_AVR_PIPELINE)
+        if(HSPI_AVR_PIPELINE()){ // Pipelined, see Adafruit_SPITFT_Macros.h
+            while(len){
+                uint16_t n = (len > 0xFFFF) ? 0xFFFF : len;
+                _avr_spi_fill(hi, lo, n);
+                SPI_PROFILE_BYTES(2UL * n);
+                len -= n;
+            }
+            return;
+        }
+#endif
         for (uint32_t t=len; t; t--){
             HSPI_WRITE(hi);
             HSPI_WRITE(lo);
@@ -377,7 +405,7 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len){
 */
 /**************************************************************************/
 void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color) {
-    if((x < 0) ||(x >= _width) || (y < 0) || (y >= _height)) return;
+    if(!clipPixel(x, y)) return;
     setAddrWindow(x,y,1,1);
     writePixel(color);
 }
@@ -393,23 +421,7 @@ void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color) {
 */
 /**************************************************************************/
 void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
-    if((x >= _width) || (y >= _height)) return;
-    int16_t x2 = x + w - 1, y2 = y + h - 1;
-    if((x2 < 0) || (y2 < 0)) return;
-
-    // Clip left/top
-    if(x < 0) {
-        x = 0;
-        w = x2 + 1;
-    }
-    if(y < 0) {
-        y = 0;
-        h = y2 + 1;
-    }
-
-    // Clip right/bottom
-    if(x2 >= _width)  w = _width  - x;
-    if(y2 >= _height) h = _height - y;
+    if(!clipRect(&x, &y, &w, &h)) return;
 
     int32_t len = (int32_t)w * h;
     setAddrWindow(x, y, w, h);
@@ -506,6 +518,58 @@ void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 }
 
 
+/**************************************************************************/
+/*!
+   @brief   Draw a single character. Opaque characters of the 'classic' font
+            that fit within the clip rectangle (see setClipRect()) are
+            streamed through one address window,
+            with every run of same-colored pixels sent as a single color.
+            Everything else is drawn by Adafruit_GFX::drawChar().
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    c   The 8-bit font-indexed character (likely ascii)
+    @param    color 16-bit 5-6-5 Color to draw chraracter with
+    @param    bg 16-bit 5-6-5 Color to fill background with (if same as color, no background)
+    @param    size  Font magnification level, 1 is 'original' size
+*/
+/**************************************************************************/
+void Adafruit_SPITFT::drawChar(int16_t x, int16_t y, unsigned char c,
+        uint16_t color, uint16_t bg, uint8_t size) {
+    int16_t cx = x, cy = y, cw = 6 * size, ch = 8 * size;
+    if(gfxFont || (bg == color) || !size ||
+       !clipRect(&cx, &cy, &cw, &ch) || (cw != 6 * size) || (ch != 8 * size)) {
+        Adafruit_GFX::drawChar(x, y, c, color, bg, size);
+        return;
+    }
+
+    const unsigned char *glyph = classicGlyph(c);
+    uint8_t lines[5];
+    for(int8_t i=0; i<5; i++) lines[i] = pgm_read_byte(&glyph[i]);
+
+    startWrite();
+    setAddrWindow(x, y, 6 * size, 8 * size);
+
+    // The end of one row and the start of the next are adjacent in the
+    // window, so runs carry over from row to row.
+    uint16_t runColor = bg;
+    uint32_t run      = 0;
+    for(int8_t j=0; j<8; j++) {
+        for(uint8_t s=0; s<size; s++) {
+            for(int8_t i=0; i<6; i++) { // Last column is always background
+                uint16_t pixel = ((i < 5) && (lines[i] & (1 << j))) ? color : bg;
+                if(pixel != runColor) {
+                    if(run) writeColor(runColor, run);
+                    runColor = pixel;
+                    run      = 0;
+                }
+                run += size;
+            }
+        }
+    }
+    writeColor(runColor, run);
+    endWrite();
+}
+
 /**************************************************************************/
 /*!
     @brief      Invert the display using built-in hardware command
@@ -539,28 +603,11 @@ void Adafruit_SPITFT::invertDisplay(boolean i) {
 void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y,
   uint16_t *pcolors, int16_t w, int16_t h) {
 
-    int16_t x2, y2; // Lower-right coord
-    if(( x             >= _width ) ||      // Off-edge right
-       ( y             >= _height) ||      // " top
-       ((x2 = (x+w-1)) <  0      ) ||      // " left
-       ((y2 = (y+h-1)) <  0)     ) return; // " bottom
-
-    int16_t bx1=0, by1=0, // Clipped top-left within bitmap
-            saveW=w;      // Save original bitmap width value
-    if(x < 0) { // Clip left
-        w  +=  x;
-        bx1 = -x;
-        x   =  0;
-    }
-    if(y < 0) { // Clip top
-        h  +=  y;
-        by1 = -y;
-        y   =  0;
-    }
-    if(x2 >= _width ) w = _width  - x; // Clip right
-    if(y2 >= _height) h = _height - y; // Clip bottom
+    int16_t bx=x, by=y, // Unclipped top-left of the bitmap
+            saveW=w;    // Save original bitmap width value
+    if(!clipRect(&x, &y, &w, &h)) return;
 
-    pcolors += by1 * saveW + bx1; // Offset bitmap ptr to clipped top-left
+    pcolors += (y - by) * saveW + (x - bx); // Offset bitmap ptr to clipped top-left
     startWrite();
     setAddrWindow(x, y, w, h); // Clipped area
     while(h--) { // For each (clipped) scanline...
@@ -570,4 +617,98 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y,
     endWrite();
 }
 
+// Clip a changed rectangle of a canvas at (x, y) to a display of w x h.
+// Returns false if nothing of it is on the display.
+static bool gfxClipFlush(GFXrect *r, int16_t x, int16_t y, int16_t w,
+  int16_t h) {
+    if(x + r->x < 0) {
+        r->w += x + r->x;
+        r->x  = -x;
+    }
+    if(y + r->y < 0) {
+        r->h += y + r->y;
+        r->y  = -y;
+    }
+    if(x + r->x + r->w > w) r->w = w - x - r->x;
+    if(y + r->y + r->h > h) r->h = h - y - r->y;
+    return (r->w > 0) && (r->h > 0);
+}
+
+// Expand an RGB 3-3-2 color to 5-6-5.
+static inline uint16_t gfxColor332(uint8_t c) {
+    uint8_t r = c >> 5, g = (c >> 2) & 7, b = c & 3;
+    return ((uint16_t)((r << 2) | (r >> 1)) << 11) |
+           ((uint16_t)((g << 3) | g) << 5) |
+           ((b << 3) | (b << 1) | (b >> 1));
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send the parts of the canvas that changed since the last flush
+             to a display, one address window per changed rectangle, and
+             forget them. Pixels are taken as RGB 3-3-2 and sent as 5-6-5.
+             The buffer is sent as it is laid out in memory, without the
+             rotation of the canvas.
+    @param    display  The display to draw on
+    @param    x   Display x coordinate of the top left corner of the canvas
+    @param    y   Display y coordinate of the top left corner of the canvas
+*/
+/**************************************************************************/
+void GFXcanvas8::flush(Adafruit_SPITFT &display, int16_t x, int16_t y) {
+    if(buffer) {
+        display.startWrite();
+        for(uint8_t i=0; i<dirty.count(); i++) {
+            GFXrect r = dirty.rect(i);
+            if(!gfxClipFlush(&r, x, y, display.width(), display.height()))
+                continue;
+            display.setAddrWindow(x + r.x, y + r.y, r.w, r.h);
+
+            // Runs of one color are sent as one, also across rows
+            uint8_t  color = buffer[r.y * WIDTH + r.x];
+            uint32_t run   = 0;
+            for(int16_t row=r.y; row<r.y + r.h; row++) {
+                uint8_t *pixel = &buffer[row * WIDTH + r.x];
+                for(int16_t col=0; col<r.w; col++, pixel++) {
+                    if(*pixel != color) {
+                        display.writeColor(gfxColor332(color), run);
+                        color = *pixel;
+                        run   = 0;
+                    }
+                    run++;
+                }
+            }
+            display.writeColor(gfxColor332(color), run);
+        }
+        display.endWrite();
+    }
+    dirty.clear();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send the parts of the canvas that changed since the last flush
+             to a display, one address window per changed rectangle, and
+             forget them. The buffer is sent as it is laid out in memory,
+             without the rotation of the canvas.
+    @param    display  The display to draw on
+    @param    x   Display x coordinate of the top left corner of the canvas
+    @param    y   Display y coordinate of the top left corner of the canvas
+*/
+/**************************************************************************/
+void GFXcanvas16::flush(Adafruit_SPITFT &display, int16_t x, int16_t y) {
+    if(buffer) {
+        display.startWrite();
+        for(uint8_t i=0; i<dirty.count(); i++) {
+            GFXrect r = dirty.rect(i);
+            if(!gfxClipFlush(&r, x, y, display.width(), display.height()))
+                continue;
+            display.setAddrWindow(x + r.x, y + r.y, r.w, r.h);
+            for(int16_t row=r.y; row<r.y + r.h; row++)
+                display.writePixels(&buffer[row * WIDTH + r.x], r.w);
+        }
+        display.endWrite();
+    }
+    dirty.clear();
+}
+
 #endif // !__AVR_ATtiny85__
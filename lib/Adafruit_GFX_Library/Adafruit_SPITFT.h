@@ -11,6 +11,7 @@
 #endif
 #include <SPI.h>
 #include "Adafruit_GFX.h"
+#include "gfxstatic.h"
 
 #define USE_FAST_PINIO
 
@@ -81,6 +82,8 @@ class Adafruit_SPITFT : public Adafruit_GFX {
         void      drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
         void      drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
         void      fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+        void      drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                    uint16_t bg, uint8_t size);
 
         using     Adafruit_GFX::drawRGBBitmap; // Check base class first
         void      drawRGBBitmap(int16_t x, int16_t y,
@@ -89,6 +92,12 @@ class Adafruit_SPITFT : public Adafruit_GFX {
 
         uint16_t  color565(uint8_t r, uint8_t g, uint8_t b);
 
+#ifdef RENDER_PROFILE
+        static uint32_t profileBytes;   ///< Bytes sent over AVR hardware SPI (only with RENDER_PROFILE)
+        static uint16_t profileWindows; ///< Address windows set (only with RENDER_PROFILE)
+        static uint16_t profileElided;  ///< Address commands left out because the controller already had them (only with RENDER_PROFILE)
+#endif
+
     protected:
 	SPIClass *_spi;         ///< The SPI device we want to use (set in constructor)
         uint32_t _freq;         ///< SPI clock frequency (for hardware SPI)
@@ -42,6 +42,20 @@
 #define SSPI_WRITE32(l)         SSPI_WRITE((l) >> 24); SSPI_WRITE((l) >> 16); SSPI_WRITE((l) >> 8); SSPI_WRITE(l)
 #define SSPI_WRITE_PIXELS(c,l)  for(uint32_t i=0; i<(l); i+=2){ SSPI_WRITE(((uint8_t*)(c))[i+1]); SSPI_WRITE(((uint8_t*)(c))[i]); }
 
+/*
+ * Profiling counters, see Adafruit_SPITFT::profileBytes
+ * */
+
+#ifdef RENDER_PROFILE
+#define SPI_PROFILE_BYTES(n)    profileBytes += (n)
+#define SPI_PROFILE_WINDOW()    profileWindows++
+#define SPI_PROFILE_ELIDED()    profileElided++
+#else
+#define SPI_PROFILE_BYTES(n)
+#define SPI_PROFILE_WINDOW()
+#define SPI_PROFILE_ELIDED()
+#endif
+
 /*
  * Hardware SPI Macros
  * */
@@ -95,12 +109,76 @@ static inline uint8_t _avr_spi_read(void) {
     r = SPDR;
     return r;
 }
-        #define HSPI_WRITE(b)            {SPDR = (b); while(!(SPSR & _BV(SPIF)));}
+        #define HSPI_WRITE(b)            {SPI_PROFILE_BYTES(1); SPDR = (b); while(!(SPSR & _BV(SPIF)));}
         #define HSPI_READ()              _avr_spi_read()
     #else
         #define HSPI_WRITE(b)            _spi->transfer((uint8_t)(b))
         #define HSPI_READ()              HSPI_WRITE(0)
     #endif
+    #if defined (__AVR__) && defined(SPITFT_AVR_PIPELINE)
+// At SPI_CLOCK_DIV2 (SPI2X set, SPR1:0 clear) a byte is shifted out in 16 CPU
+// cycles, so the next byte can be loaded after a fixed delay instead of
+// polling SPIF. The loops below write SPDR every 18 cycles (two cycles of
+// margin), prepare the next byte while the current one is on the bus and never
+// wait for a flag. Any other clock rate falls back to the polled writes.
+// The timing has not been checked on the bus yet, so the loops are only built
+// when SPITFT_AVR_PIPELINE is defined; without it every write is polled.
+#define HSPI_AVR_PIPELINE()      ((SPSR & _BV(SPI2X)) && !(SPCR & (_BV(SPR1) | _BV(SPR0))))
+#define _AVR_SPI_DELAY_1         "nop\n\t"
+#define _AVR_SPI_DELAY_2         "rjmp .+0\n\t"
+#define _AVR_SPI_DELAY_4         _AVR_SPI_DELAY_2 _AVR_SPI_DELAY_2
+#define _AVR_SPI_DELAY_8         _AVR_SPI_DELAY_4 _AVR_SPI_DELAY_4
+#define _AVR_SPI_DELAY_9         _AVR_SPI_DELAY_8 _AVR_SPI_DELAY_1
+#define _AVR_SPI_DELAY_13        _AVR_SPI_DELAY_8 _AVR_SPI_DELAY_4 _AVR_SPI_DELAY_1
+#define _AVR_SPI_DELAY_17        _AVR_SPI_DELAY_8 _AVR_SPI_DELAY_8 _AVR_SPI_DELAY_1
+
+// SPIF stays set when the bytes are clocked out blind. Clear it, so the next
+// HSPI_WRITE() waits for its own byte again.
+static inline void _avr_spi_clear(void) __attribute__((always_inline));
+static inline void _avr_spi_clear(void) {
+    (void)SPSR;
+    (void)SPDR;
+}
+
+// Write one color 'count' (1-65535) times, high byte first.
+static inline void _avr_spi_fill(uint8_t hi, uint8_t lo, uint16_t count) __attribute__((always_inline));
+static inline void _avr_spi_fill(uint8_t hi, uint8_t lo, uint16_t count) {
+    asm volatile(
+        "1:\n\t"
+        "out %[spdr], %[hi]\n\t"    // 1
+        _AVR_SPI_DELAY_17
+        "out %[spdr], %[lo]\n\t"    // 1
+        _AVR_SPI_DELAY_13
+        "sbiw %[count], 1\n\t"      // 2
+        "brne 1b\n\t"               // 2, 1 when done
+        _AVR_SPI_DELAY_1             // Let the last byte finish
+        : [count] "+w" (count)
+        : [spdr] "I" (_SFR_IO_ADDR(SPDR)), [hi] "r" (hi), [lo] "r" (lo));
+    _avr_spi_clear();
+}
+
+// Write 'count' (1-65535) little-endian 16-bit colors, high byte first.
+static inline void _avr_spi_stream(const uint8_t *colors, uint16_t count) __attribute__((always_inline));
+static inline void _avr_spi_stream(const uint8_t *colors, uint16_t count) {
+    uint8_t hi, lo;
+    asm volatile(
+        "1:\n\t"
+        "ld %[lo], %a[colors]+\n\t" // 2
+        "ld %[hi], %a[colors]+\n\t" // 2
+        "out %[spdr], %[hi]\n\t"    // 1
+        _AVR_SPI_DELAY_17
+        "out %[spdr], %[lo]\n\t"    // 1
+        _AVR_SPI_DELAY_9
+        "sbiw %[count], 1\n\t"      // 2
+        "brne 1b\n\t"               // 2, 1 when done
+        _AVR_SPI_DELAY_4 _AVR_SPI_DELAY_1 // Let the last byte finish
+        : [colors] "+e" (colors), [count] "+w" (count),
+          [hi] "=&r" (hi), [lo] "=&r" (lo)
+        : [spdr] "I" (_SFR_IO_ADDR(SPDR))
+        : "memory");
+    _avr_spi_clear();
+}
+    #endif
     #define HSPI_WRITE16(s)          HSPI_WRITE((s) >> 8); HSPI_WRITE(s)
     #define HSPI_WRITE32(l)          HSPI_WRITE((l) >> 24); HSPI_WRITE((l) >> 16); HSPI_WRITE((l) >> 8); HSPI_WRITE(l)
     #define HSPI_WRITE_PIXELS(c,l)   for(uint32_t i=0; i<(l); i+=2){ HSPI_WRITE(((uint8_t*)(c))[i+1]); HSPI_WRITE(((uint8_t*)(c))[i]); }
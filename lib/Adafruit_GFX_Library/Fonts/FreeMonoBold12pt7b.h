@@ -245,6 +245,6 @@ const GFXglyph FreeMonoBold12pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeMonoBold12pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold12pt7bBitmaps,
   (GFXglyph *)FreeMonoBold12pt7bGlyphs,
-  0x20, 0x7E, 24 };
+  0x20, 0x7E, 24, 0 };
 
 // Approx. 2402 bytes
@@ -1,423 +1,320 @@
 const uint8_t FreeMonoBold18pt7bBitmaps[] PROGMEM = {
-  0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x9C, 0xE7, 0x39, 0xC4, 0x03, 0xBF,
-  0xFF, 0xB8, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1E, 0xC1, 0x98, 0x33,
-  0x06, 0x60, 0xCC, 0x18, 0x0E, 0x1C, 0x0F, 0x3C, 0x1F, 0x3C, 0x1E, 0x3C,
-  0x1E, 0x3C, 0x1E, 0x78, 0x1E, 0x78, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x7F, 0xFE, 0x7F, 0xFE,
-  0x7F, 0xFE, 0x7F, 0xFE, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0xF0,
-  0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x03, 0x00, 0x1E, 0x00, 0x78, 0x01,
-  0xE0, 0x1F, 0xF1, 0xFF, 0xE7, 0xFF, 0xBE, 0x1E, 0xF0, 0x3B, 0xC0, 0xCF,
-  0xE0, 0x3F, 0xF8, 0x7F, 0xF0, 0x7F, 0xE0, 0x1F, 0xF0, 0x0F, 0xE0, 0x3F,
-  0x80, 0xFF, 0x87, 0xFF, 0xFE, 0xFF, 0xF3, 0x7F, 0x80, 0x78, 0x01, 0xE0,
-  0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xC0, 0x1E, 0x00, 0xFF, 0x03, 0x86,
-  0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x38, 0x70, 0x3F, 0xC2, 0x1E, 0x3E,
-  0x03, 0xF8, 0x3F, 0x83, 0xF8, 0x0F, 0x8F, 0x18, 0x7F, 0x01, 0xC7, 0x03,
-  0x06, 0x06, 0x0C, 0x0C, 0x18, 0x1C, 0x70, 0x1F, 0xC0, 0x0F, 0x00, 0x03,
-  0xD0, 0x1F, 0xF0, 0x7F, 0xE1, 0xFF, 0xC3, 0xE6, 0x07, 0x80, 0x0F, 0x00,
-  0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0xFE, 0x03, 0xFE, 0xFF, 0xBD, 0xFE,
-  0x3F, 0xFC, 0x3F, 0x7C, 0x7C, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF8, 0x7E,
-  0xF0, 0xFF, 0xFF, 0xF6, 0x66, 0x66, 0x07, 0x0F, 0x1F, 0x1E, 0x3E, 0x3C,
-  0x78, 0x78, 0x78, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-  0x78, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1F, 0x0F, 0x07, 0xE0, 0xF0, 0xF8,
-  0x78, 0x7C, 0x3C, 0x3E, 0x1E, 0x1E, 0x1E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x0E, 0x1E, 0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0xF8, 0xF0, 0xE0,
-  0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x7F, 0xFE, 0x1F, 0xF8, 0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF8,
-  0x1E, 0x78, 0x1C, 0x38, 0x18, 0x18, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x3E, 0x78, 0xF3, 0xC7,
-  0x8E, 0x1C, 0x70, 0xE1, 0x80, 0x7F, 0xFF, 0xDF, 0xFF, 0xF9, 0xFF, 0xFF,
-  0x3F, 0xFF, 0xE0, 0x77, 0xFF, 0xF7, 0x00, 0x00, 0x0E, 0x00, 0x3C, 0x00,
-  0x78, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0xF0,
-  0x01, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x03,
-  0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80,
-  0x1E, 0x00, 0x3C, 0x00, 0x70, 0x01, 0xE0, 0x03, 0x80, 0x03, 0x00, 0x00,
-  0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x7C, 0x3E, 0x78, 0x1E,
-  0xF8, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F, 0x78, 0x1E,
-  0x7C, 0x3E, 0x3F, 0xFC, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x07, 0xC0,
-  0x1F, 0x80, 0xFF, 0x03, 0xFE, 0x0F, 0xBC, 0x0C, 0x78, 0x00, 0xF0, 0x01,
-  0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78,
-  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x81, 0xFF, 0xFB, 0xFF, 0xF7,
-  0xFF, 0xE7, 0xFF, 0x80, 0x0F, 0xC0, 0x7F, 0xE1, 0xFF, 0xE3, 0xFF, 0xEF,
-  0x87, 0xDE, 0x07, 0xF8, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x01,
-  0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
-  0x78, 0x03, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-  0x0F, 0xC0, 0x7F, 0xF0, 0xFF, 0xF8, 0xFF, 0xFC, 0x70, 0x3E, 0x00, 0x1E,
-  0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x03, 0xFC, 0x03, 0xF0, 0x03, 0xF0,
-  0x03, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
-  0xE0, 0x3F, 0xFF, 0xFE, 0xFF, 0xFC, 0x7F, 0xF8, 0x1F, 0xE0, 0x00, 0xF8,
-  0x03, 0xF0, 0x07, 0xE0, 0x1F, 0xC0, 0x77, 0x80, 0xEF, 0x03, 0x9E, 0x0F,
-  0x3C, 0x1C, 0x78, 0x70, 0xF1, 0xE1, 0xE3, 0x83, 0xCF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0,
-  0x1F, 0xC0, 0x3F, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0xC0,
-  0x01, 0xE0, 0x00, 0xF0, 0x00, 0x7B, 0xE0, 0x3F, 0xFC, 0x1F, 0xFF, 0x0F,
-  0xFF, 0xC3, 0x83, 0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F,
-  0x00, 0x0F, 0xB8, 0x0F, 0xBF, 0xFF, 0xCF, 0xFF, 0xC3, 0xFF, 0xC0, 0x7F,
-  0x80, 0x00, 0xFC, 0x07, 0xFC, 0x3F, 0xF8, 0xFF, 0xF1, 0xF8, 0x07, 0xC0,
-  0x1F, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE7, 0xC3, 0xDF, 0xC7, 0x7F, 0xCF,
-  0xFF, 0xDF, 0x8F, 0xFC, 0x07, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3D, 0xE0,
-  0xFB, 0xFF, 0xE3, 0xFF, 0xC3, 0xFF, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x1E,
-  0x00, 0x38, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
-  0x78, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x38,
-  0x00, 0x70, 0x00, 0x07, 0xC0, 0x3F, 0xE0, 0xFF, 0xE3, 0xFF, 0xEF, 0x83,
-  0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1E, 0xF0, 0x78, 0xFF, 0xE0,
-  0xFF, 0x81, 0xFF, 0x0F, 0xFF, 0x9E, 0x0F, 0x78, 0x0F, 0xF0, 0x1F, 0xE0,
-  0x3F, 0xE0, 0xFB, 0xFF, 0xE7, 0xFF, 0xC7, 0xFF, 0x03, 0xF8, 0x00, 0x0F,
-  0xC0, 0x3F, 0xE0, 0xFF, 0xE3, 0xFF, 0xEF, 0xC3, 0xDF, 0x03, 0xBC, 0x07,
-  0xF8, 0x0F, 0xF0, 0x1F, 0xF0, 0x3D, 0xF1, 0xFB, 0xFF, 0xF3, 0xFE, 0xE3,
-  0xFB, 0xC3, 0xE7, 0x80, 0x1E, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xE7, 0xFF,
-  0x8F, 0xFE, 0x1F, 0xF0, 0x1F, 0x80, 0x00, 0x77, 0xFF, 0xF7, 0x00, 0x00,
-  0x00, 0x00, 0xEF, 0xFF, 0xEE, 0x1C, 0x7C, 0xF9, 0xF1, 0xC0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF3, 0xC7, 0x8E, 0x3C, 0x70, 0xE1, 0x87, 0x0C, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFE,
-  0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-  0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7C, 0x00,
-  0x07, 0x7F, 0xFF, 0xDF, 0xFF, 0xF9, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0xFF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFF,
-  0xF8, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0,
-  0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0x80,
-  0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x0F, 0x80, 0x03, 0x80,
-  0x00, 0x1F, 0xC0, 0xFF, 0xE3, 0xFF, 0xF7, 0xFF, 0xEF, 0x07, 0xFE, 0x03,
-  0xDC, 0x07, 0x80, 0x0F, 0x00, 0x7C, 0x03, 0xF8, 0x1F, 0xC0, 0x1E, 0x00,
-  0x30, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x3E,
-  0x00, 0x7C, 0x00, 0x70, 0x00, 0x07, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xE1,
-  0xC7, 0x83, 0xCE, 0x03, 0xBC, 0x07, 0x70, 0x0E, 0xE0, 0x7D, 0xC3, 0xFB,
-  0x8F, 0xF7, 0x3C, 0xEE, 0x71, 0xDC, 0xE3, 0xB9, 0xC7, 0x73, 0xCE, 0xE3,
-  0xFF, 0xC3, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1E, 0x02,
-  0x1E, 0x1E, 0x3F, 0xFC, 0x1F, 0xF0, 0x1F, 0x80, 0x0F, 0xF8, 0x00, 0x7F,
-  0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF8,
-  0x00, 0x1C, 0xF0, 0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x1E, 0x1E, 0x00,
-  0x78, 0x78, 0x03, 0xC0, 0xF0, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x01, 0xFF,
-  0xFE, 0x07, 0xFF, 0xF8, 0x3C, 0x00, 0xF3, 0xFC, 0x1F, 0xEF, 0xF8, 0x7F,
-  0xFF, 0xE1, 0xFF, 0x7F, 0x03, 0xF8, 0x7F, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF,
-  0xFF, 0x8F, 0xFF, 0xF8, 0x3C, 0x07, 0xC3, 0xC0, 0x3C, 0x3C, 0x03, 0xC3,
-  0xC0, 0x7C, 0x3F, 0xFF, 0x83, 0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xFF, 0xFE,
-  0x3C, 0x03, 0xE3, 0xC0, 0x1F, 0x3C, 0x00, 0xF3, 0xC0, 0x0F, 0x3C, 0x01,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0x7F, 0xFF, 0x00, 0x01,
-  0xF8, 0xC1, 0xFF, 0xFC, 0x7F, 0xFF, 0x9F, 0xFF, 0xF7, 0xE0, 0x7E, 0xF8,
-  0x07, 0xFE, 0x00, 0x7F, 0x80, 0x0E, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
-  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-  0x07, 0x7F, 0x03, 0xE7, 0xFF, 0xFC, 0x7F, 0xFF, 0x03, 0xFF, 0xC0, 0x1F,
-  0xE0, 0xFF, 0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xE3, 0xFF, 0xFC, 0x78, 0x1F,
-  0x9E, 0x03, 0xE7, 0x80, 0x79, 0xE0, 0x0F, 0x78, 0x03, 0xDE, 0x00, 0xF7,
-  0x80, 0x3D, 0xE0, 0x0F, 0x78, 0x03, 0xDE, 0x00, 0xF7, 0x80, 0x7D, 0xE0,
-  0x1E, 0x78, 0x1F, 0xBF, 0xFF, 0xCF, 0xFF, 0xF3, 0xFF, 0xF0, 0x7F, 0xF0,
-  0x00, 0x7F, 0xFF, 0xDF, 0xFF, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xE3, 0xC0,
-  0x3C, 0x78, 0x07, 0x8F, 0x1C, 0xF1, 0xE3, 0xCC, 0x3F, 0xF8, 0x07, 0xFF,
-  0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xC7, 0x80, 0x78, 0xF1, 0x8F, 0x0C,
-  0x79, 0xE0, 0x0F, 0x3C, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF7, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF3, 0xC0, 0x1E, 0x78, 0x63, 0xCF, 0x1E, 0x79, 0xE3, 0xC6, 0x3F, 0xF8,
-  0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xC7, 0x80, 0x78, 0xE0,
-  0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80,
-  0x7F, 0xF0, 0x07, 0xFC, 0x00, 0x01, 0xFC, 0xE0, 0x7F, 0xFE, 0x1F, 0xFF,
-  0xE3, 0xFF, 0xFE, 0x7F, 0x03, 0xE7, 0xC0, 0x1E, 0xF8, 0x00, 0xEF, 0x00,
-  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x03, 0xFE, 0xF0,
-  0x3F, 0xFF, 0x03, 0xFF, 0xF8, 0x3F, 0xF7, 0x80, 0x1E, 0x7E, 0x01, 0xE3,
-  0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0xFF, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x0F,
-  0xE3, 0xFC, 0x7F, 0x9F, 0xE3, 0xFC, 0x7F, 0x1F, 0xC1, 0xE0, 0x3C, 0x0F,
-  0x01, 0xE0, 0x78, 0x0F, 0x03, 0xC0, 0x78, 0x1E, 0x03, 0xC0, 0xFF, 0xFE,
-  0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x0F, 0x01, 0xE0, 0x78,
-  0x0F, 0x03, 0xC0, 0x78, 0x1E, 0x03, 0xC3, 0xFC, 0x7F, 0xBF, 0xE3, 0xFF,
-  0xFF, 0x1F, 0xF7, 0xF0, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00,
-  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x83,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0x01, 0xFF, 0xE0, 0x3F, 0xFC,
-  0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
-  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x38, 0x07, 0x8F,
-  0x00, 0xF1, 0xE0, 0x1E, 0x3C, 0x03, 0xC7, 0x80, 0xF8, 0xF8, 0x3F, 0x1F,
-  0xFF, 0xC3, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x7E, 0x00, 0xFF, 0x0F, 0xCF,
-  0xF9, 0xFE, 0xFF, 0x9F, 0xEF, 0xF8, 0xFC, 0x3C, 0x1F, 0x03, 0xC3, 0xE0,
-  0x3C, 0x7C, 0x03, 0xCF, 0x80, 0x3D, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xF8,
-  0x03, 0xFF, 0x80, 0x3E, 0x7C, 0x03, 0xC3, 0xE0, 0x3C, 0x1E, 0x03, 0xC0,
-  0xF0, 0x3C, 0x0F, 0x0F, 0xF8, 0x7E, 0xFF, 0x87, 0xFF, 0xF8, 0x7F, 0x7F,
-  0x03, 0xE0, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x1E,
-  0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80,
-  0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x01, 0x87, 0x80, 0xF1, 0xE0, 0x3C,
-  0x78, 0x0F, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-  0xFF, 0xC0, 0x3E, 0x00, 0xF8, 0xFC, 0x01, 0xF9, 0xFC, 0x07, 0xF3, 0xF8,
-  0x0F, 0xE3, 0xF8, 0x3F, 0x87, 0xF0, 0x7F, 0x0F, 0xF1, 0xFE, 0x1F, 0xE3,
-  0xFC, 0x3D, 0xE7, 0x78, 0x7B, 0xDE, 0xF0, 0xF7, 0xBD, 0xE1, 0xE7, 0xF3,
-  0xC3, 0xCF, 0xE7, 0x87, 0x8F, 0x8F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1E, 0x3C,
-  0x3C, 0x00, 0x79, 0xFF, 0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x1F, 0xF7,
-  0xF0, 0x1F, 0xC0, 0xFC, 0x1F, 0xEF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xF1,
-  0xFF, 0x3F, 0x83, 0xC3, 0xF8, 0x3C, 0x3F, 0xC3, 0xC3, 0xFC, 0x3C, 0x3D,
-  0xE3, 0xC3, 0xDE, 0x3C, 0x3C, 0xF3, 0xC3, 0xC7, 0xBC, 0x3C, 0x7B, 0xC3,
-  0xC3, 0xFC, 0x3C, 0x3F, 0xC3, 0xC1, 0xFC, 0x3C, 0x1F, 0xCF, 0xF8, 0xFC,
-  0xFF, 0x87, 0xCF, 0xF8, 0x7C, 0x7F, 0x03, 0xC0, 0x01, 0xF8, 0x00, 0x7F,
-  0xE0, 0x0F, 0xFF, 0x81, 0xFF, 0xFC, 0x3F, 0x0F, 0xC7, 0xC0, 0x3E, 0x78,
-  0x01, 0xEF, 0x80, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x1F, 0x78, 0x01, 0xE7, 0xC0, 0x3E,
-  0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x1F, 0xFF, 0x00, 0x7F, 0xE0, 0x01, 0xF8,
-  0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3C, 0x0F,
-  0xCF, 0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x0F, 0x3C, 0x03, 0xCF, 0x03, 0xF3,
-  0xFF, 0xF8, 0xFF, 0xFC, 0x3F, 0xFE, 0x0F, 0xFE, 0x03, 0xC0, 0x00, 0xF0,
-  0x00, 0x3C, 0x00, 0x3F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x7F, 0xC0,
-  0x00, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F,
-  0x0F, 0xC7, 0xC0, 0x3E, 0x78, 0x01, 0xEF, 0x80, 0x1F, 0xF0, 0x00, 0xFF,
-  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x1F,
-  0x78, 0x01, 0xE7, 0xC0, 0x3E, 0x3F, 0x0F, 0xC1, 0xFF, 0xF8, 0x0F, 0xFF,
-  0x00, 0x7F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0x8E, 0x07, 0xFF, 0xF0, 0xFF,
-  0xFF, 0x0F, 0xFF, 0xE0, 0x60, 0x78, 0x7F, 0xF8, 0x07, 0xFF, 0xF0, 0x3F,
-  0xFF, 0xE0, 0xFF, 0xFF, 0x01, 0xE0, 0x7C, 0x0F, 0x01, 0xE0, 0x78, 0x0F,
-  0x03, 0xC0, 0x78, 0x1E, 0x0F, 0xC0, 0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x3F,
-  0xF8, 0x01, 0xFF, 0xE0, 0x0F, 0x0F, 0x80, 0x78, 0x3C, 0x03, 0xC0, 0xF0,
-  0x1E, 0x07, 0xC3, 0xFE, 0x1F, 0xBF, 0xF0, 0x7F, 0xFF, 0x83, 0xF7, 0xF8,
-  0x0F, 0x00, 0x07, 0xE7, 0x07, 0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0xE7, 0xC1,
-  0xF3, 0xC0, 0x79, 0xE0, 0x3C, 0xF8, 0x00, 0x7F, 0x80, 0x1F, 0xFC, 0x07,
-  0xFF, 0x81, 0xFF, 0xE0, 0x0F, 0xFB, 0x00, 0x7F, 0xC0, 0x1F, 0xE0, 0x0F,
-  0xFC, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0x8D, 0xFF, 0x80, 0x3F, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1F, 0xE1,
-  0xE3, 0xFC, 0x3C, 0x7F, 0x87, 0x8F, 0x60, 0xF0, 0xC0, 0x1E, 0x00, 0x03,
-  0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07,
-  0x80, 0x00, 0xF0, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0x7F,
-  0xE0, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xFF, 0xE3, 0xFE, 0xFF, 0x1F, 0xF3,
-  0xC0, 0x1E, 0x1E, 0x00, 0xF0, 0xF0, 0x07, 0x87, 0x80, 0x3C, 0x3C, 0x01,
-  0xE1, 0xE0, 0x0F, 0x0F, 0x00, 0x78, 0x78, 0x03, 0xC3, 0xC0, 0x1E, 0x1E,
-  0x00, 0xF0, 0xF0, 0x07, 0x87, 0xC0, 0x7C, 0x1F, 0x07, 0xC0, 0xFF, 0xFE,
-  0x03, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x03, 0xFD,
-  0xFF, 0x07, 0xFF, 0xFE, 0x0F, 0xFB, 0xF8, 0x1F, 0xE1, 0xC0, 0x07, 0x03,
-  0xC0, 0x1E, 0x07, 0x80, 0x3C, 0x07, 0x80, 0xF0, 0x0F, 0x01, 0xE0, 0x0F,
-  0x03, 0x80, 0x1E, 0x0F, 0x00, 0x3E, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0x78,
-  0xF0, 0x00, 0x7B, 0xC0, 0x00, 0xF7, 0x80, 0x01, 0xFF, 0x00, 0x01, 0xFC,
-  0x00, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0xFF, 0x0F,
-  0xF7, 0xFC, 0x7F, 0xFF, 0xE3, 0xFF, 0xFE, 0x0F, 0xF7, 0x80, 0x0F, 0x3C,
-  0x38, 0x78, 0xE3, 0xE3, 0x87, 0x1F, 0x1C, 0x38, 0xF8, 0xE1, 0xEF, 0xE7,
-  0x0F, 0x7F, 0x78, 0x7B, 0xBB, 0xC3, 0xFD, 0xFE, 0x0F, 0xEF, 0xF0, 0x7E,
-  0x3F, 0x03, 0xF1, 0xF8, 0x1F, 0x8F, 0xC0, 0xFC, 0x3E, 0x07, 0xC1, 0xF0,
-  0x3E, 0x0F, 0x81, 0xF0, 0x7C, 0x00, 0x7E, 0x0F, 0xDF, 0xE3, 0xFF, 0xFC,
-  0x7F, 0xBF, 0x07, 0xE1, 0xE0, 0xF8, 0x3E, 0x3E, 0x03, 0xEF, 0x80, 0x3D,
-  0xE0, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0x3F,
-  0x80, 0x0F, 0x78, 0x03, 0xC7, 0x80, 0xF8, 0x78, 0x3E, 0x0F, 0x8F, 0xE3,
-  0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xF7, 0xE0, 0xFC, 0x7E, 0x07, 0xEF, 0xF0,
-  0xFF, 0xFF, 0x0F, 0xF7, 0xE0, 0x7E, 0x1E, 0x07, 0x81, 0xF0, 0xF8, 0x0F,
-  0x0F, 0x00, 0x79, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x00,
-  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-  0x00, 0xF0, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x07, 0xFE,
-  0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xF0, 0x3C, 0xF0,
-  0x78, 0xF0, 0xF0, 0x70, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0x80, 0x07,
-  0x00, 0x0F, 0x00, 0x1E, 0x0E, 0x1C, 0x0F, 0x38, 0x0F, 0x78, 0x0F, 0x7F,
-  0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF0,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xFF, 0xFE, 0xE0, 0x01,
-  0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x0E,
-  0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0,
-  0x00, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80,
-  0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00,
-  0x38, 0x00, 0x70, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x07, 0x00, 0x1F, 0x00,
-  0x7F, 0x00, 0xFE, 0x03, 0xDE, 0x0F, 0x1E, 0x3E, 0x3E, 0xF8, 0x3F, 0xE0,
-  0x3F, 0x80, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF0, 0xC3, 0x87, 0x0E, 0x1C, 0x30, 0x01, 0xFC, 0x01, 0xFF, 0xC0,
-  0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x78, 0x0F, 0xFF, 0x07, 0xFF, 0xE1,
-  0xFF, 0xFC, 0x7F, 0xFF, 0x9F, 0x80, 0xF3, 0xC0, 0x1E, 0x78, 0x0F, 0xCF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xCF, 0xFF, 0xF8, 0x7F, 0x3E, 0x7C, 0x00, 0x1F,
-  0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F,
-  0x3F, 0x01, 0xFF, 0xF8, 0x3F, 0xFF, 0x87, 0xFF, 0xF0, 0xFC, 0x1F, 0x1F,
-  0x01, 0xF3, 0xC0, 0x1E, 0x78, 0x03, 0xCF, 0x00, 0x79, 0xE0, 0x0F, 0x3E,
-  0x03, 0xE7, 0xE0, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xCF, 0xFF, 0xF0, 0xF9,
-  0xF8, 0x00, 0x03, 0xF3, 0x87, 0xFF, 0xCF, 0xFF, 0xEF, 0xFF, 0xF7, 0xE0,
-  0xFF, 0xC0, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3E,
-  0x00, 0x4F, 0x80, 0xF7, 0xFF, 0xF9, 0xFF, 0xF8, 0x7F, 0xF8, 0x0F, 0xF0,
-  0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03,
-  0xC0, 0x00, 0x3C, 0x03, 0xF3, 0xC0, 0xFF, 0xBC, 0x1F, 0xFF, 0xC3, 0xFF,
-  0xFC, 0x7E, 0x0F, 0xC7, 0x80, 0x7C, 0xF0, 0x03, 0xCF, 0x00, 0x3C, 0xF0,
-  0x03, 0xCF, 0x00, 0x3C, 0xF8, 0x07, 0xC7, 0xE0, 0xFC, 0x7F, 0xFF, 0xF3,
-  0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x3F, 0x3E, 0x03, 0xF0, 0x03, 0xFF, 0x01,
-  0xFF, 0xE0, 0xFF, 0xFC, 0x7E, 0x0F, 0x9E, 0x01, 0xEF, 0x00, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xE0, 0x00, 0x7F, 0xFF,
-  0xCF, 0xFF, 0xF1, 0xFF, 0xF8, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFF, 0x0F,
-  0xFF, 0x1F, 0xFF, 0x1E, 0x00, 0x1E, 0x00, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF,
-  0xFC, 0xFF, 0xF8, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
-  0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
-  0xF8, 0xFF, 0xF8, 0x07, 0xE7, 0xC3, 0xFF, 0xFC, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xF7, 0xC1, 0xF9, 0xF0, 0x1F, 0x3C, 0x01, 0xE7, 0x80, 0x3C, 0xF0, 0x07,
-  0x9E, 0x00, 0xF3, 0xE0, 0x3E, 0x3E, 0x0F, 0xC7, 0xFF, 0xF8, 0x7F, 0xFF,
-  0x07, 0xFD, 0xE0, 0x3F, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3E,
-  0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0xFE, 0x00, 0x3E, 0x00,
-  0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x01, 0xE0, 0x00, 0x0F,
-  0x00, 0x00, 0x78, 0xF8, 0x03, 0xDF, 0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFE,
-  0x07, 0xE1, 0xF0, 0x3E, 0x07, 0x81, 0xE0, 0x3C, 0x0F, 0x01, 0xE0, 0x78,
-  0x0F, 0x03, 0xC0, 0x78, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x1F, 0xC1, 0xFD,
-  0xFE, 0x0F, 0xFF, 0xF0, 0x7F, 0xBF, 0x01, 0xF8, 0x03, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-  0x3F, 0xC0, 0x3F, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x7F, 0xFE, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00, 0x00,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-  0x0F, 0x00, 0xF0, 0x0F, 0x01, 0xFF, 0xFE, 0xFF, 0xEF, 0xFC, 0x7F, 0x00,
-  0x7C, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
-  0x00, 0x03, 0xC7, 0xF0, 0xF3, 0xFC, 0x3C, 0xFF, 0x0F, 0x3F, 0x83, 0xDF,
-  0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0xF7, 0x80,
-  0x3C, 0xF0, 0x0F, 0x1F, 0x0F, 0xC3, 0xFB, 0xF1, 0xFF, 0xFC, 0x7F, 0xDF,
-  0x0F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x3D, 0xE3,
-  0xC1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3E, 0x3C, 0x78,
-  0xF0, 0xF1, 0xE3, 0xC3, 0xC7, 0x8F, 0x0F, 0x1E, 0x3C, 0x3C, 0x78, 0xF0,
-  0xF1, 0xE3, 0xC3, 0xC7, 0x8F, 0x0F, 0x1E, 0xFE, 0x3E, 0x7F, 0xF8, 0xF9,
-  0xFF, 0xE3, 0xE7, 0xDF, 0x0F, 0x1E, 0x1E, 0x7C, 0x03, 0xEF, 0xF0, 0x3F,
-  0xFF, 0x83, 0xFF, 0xFC, 0x1F, 0x87, 0xC1, 0xE0, 0x3C, 0x1E, 0x03, 0xC1,
-  0xE0, 0x3C, 0x1E, 0x03, 0xC1, 0xE0, 0x3C, 0x1E, 0x03, 0xC1, 0xE0, 0x3C,
-  0x7F, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xF7, 0xE0, 0x7E, 0x03, 0xF8,
-  0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC7, 0xE0, 0xFD, 0xF0, 0x07,
-  0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xE0, 0x0F,
-  0xBF, 0x07, 0xE3, 0xFF, 0xF8, 0x3F, 0xFE, 0x03, 0xFF, 0x80, 0x1F, 0xC0,
-  0x3E, 0x7E, 0x03, 0xF7, 0xFC, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xF8,
-  0x3F, 0x0F, 0x80, 0x7C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x78,
-  0xF0, 0x03, 0xC7, 0xC0, 0x3E, 0x3F, 0x07, 0xE1, 0xFF, 0xFE, 0x0F, 0xFF,
-  0xE0, 0x7B, 0xFE, 0x03, 0xCF, 0xC0, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07,
-  0x80, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFE, 0x00,
-  0x00, 0x03, 0xF3, 0xE0, 0x7F, 0xDF, 0x87, 0xFF, 0xFC, 0x7F, 0xFF, 0xE7,
-  0xE0, 0xFC, 0x7C, 0x03, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x78, 0xF0, 0x03,
-  0xC7, 0x80, 0x1E, 0x3E, 0x01, 0xF0, 0xFC, 0x1F, 0x83, 0xFF, 0xFC, 0x1F,
-  0xFF, 0xE0, 0x3F, 0xEF, 0x00, 0x7E, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E,
-  0x00, 0x00, 0xF0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
-  0x3F, 0xC0, 0x7E, 0x1E, 0x7F, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0xFE,
-  0x00, 0xFC, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07,
-  0x80, 0x03, 0xC0, 0x0F, 0xFF, 0x87, 0xFF, 0xC3, 0xFF, 0xE1, 0xFF, 0xE0,
-  0x07, 0xE6, 0x1F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x78, 0x1E, 0x78, 0x0E,
-  0x7F, 0xE0, 0x3F, 0xFC, 0x03, 0xFE, 0x60, 0x1F, 0xE0, 0x0F, 0xF8, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFC, 0x07, 0xE0, 0x0C, 0x00, 0x0F, 0x00,
-  0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x07, 0xFF, 0xF3, 0xFF, 0xF9, 0xFF,
-  0xFC, 0xFF, 0xFC, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
-  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x07, 0x8F, 0xFF, 0xC3, 0xFF,
-  0xC1, 0xFF, 0xC0, 0x3F, 0x80, 0xFC, 0x1F, 0xBF, 0x0F, 0xEF, 0xC3, 0xFB,
-  0xF0, 0xFE, 0x3C, 0x07, 0x8F, 0x01, 0xE3, 0xC0, 0x78, 0xF0, 0x1E, 0x3C,
-  0x07, 0x8F, 0x01, 0xE3, 0xC0, 0x78, 0xF8, 0x7E, 0x3F, 0xFF, 0xC7, 0xFF,
-  0xF0, 0xFF, 0x7C, 0x0F, 0x9E, 0x7F, 0x07, 0xF7, 0xFC, 0x7F, 0xFF, 0xE3,
-  0xFE, 0xFE, 0x0F, 0xE1, 0xE0, 0x3C, 0x0F, 0x01, 0xE0, 0x3C, 0x1E, 0x01,
-  0xE0, 0xF0, 0x07, 0x8F, 0x00, 0x3E, 0x78, 0x00, 0xF7, 0x80, 0x07, 0xFC,
-  0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x7E,
-  0x03, 0xF7, 0xF8, 0x3F, 0xFF, 0xC1, 0xFE, 0xFC, 0x07, 0xF3, 0xC7, 0x0F,
-  0x1E, 0x7C, 0xF0, 0x73, 0xE7, 0x83, 0x9F, 0x7C, 0x1F, 0xFF, 0xC0, 0xFF,
-  0xFE, 0x03, 0xF7, 0xF0, 0x1F, 0xBF, 0x80, 0xFC, 0xF8, 0x07, 0xC7, 0xC0,
-  0x1E, 0x3E, 0x00, 0xE0, 0xE0, 0x7E, 0x0F, 0xDF, 0xE3, 0xFF, 0xFC, 0x7F,
-  0xBF, 0x07, 0xE1, 0xF1, 0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xC0,
-  0x07, 0xF8, 0x01, 0xFF, 0xC0, 0x7E, 0xFC, 0x1F, 0x8F, 0xC7, 0xE0, 0xFD,
-  0xFE, 0x3F, 0xFF, 0xC7, 0xFF, 0xF0, 0x7F, 0x7E, 0x0F, 0xDF, 0xE3, 0xFF,
-  0xFC, 0x7F, 0xBF, 0x07, 0xE3, 0xC0, 0x78, 0x3C, 0x0E, 0x07, 0x83, 0xC0,
-  0x78, 0x70, 0x0F, 0x1E, 0x00, 0xE3, 0x80, 0x1E, 0xF0, 0x01, 0xDC, 0x00,
-  0x3F, 0x80, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00,
-  0x38, 0x00, 0x0F, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x1F,
-  0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF9, 0xC7,
-  0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x81, 0xF0, 0xFC, 0x7E, 0x1F,
-  0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xF8, 0xFC, 0x3E, 0x0F,
-  0x83, 0xF0, 0x3E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xF0, 0x7E,
-  0x0F, 0xC3, 0xF0, 0x38, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x70, 0x3E, 0x0F, 0xC1, 0xF8, 0x3E,
-  0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x7C, 0x0F, 0xC1, 0xF0,
-  0x7C, 0x3F, 0x1F, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x83, 0xE1, 0xF8,
-  0xFC, 0x3F, 0x07, 0x00, 0x1E, 0x00, 0x1F, 0xC0, 0x1F, 0xF0, 0xDF, 0xFC,
-  0xFF, 0x3F, 0xFB, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x78 };
+  0x13, 0x1F, 0xFA, 0x13, 0x23, 0x23, 0x23, 0x23, 0x23, 0x31, 0x83, 0x1F,
+  0x01, 0x31, 0x04, 0x38, 0x38, 0x38, 0x38, 0x34, 0x12, 0x52, 0x22, 0x52,
+  0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x10, 0x43, 0x43, 0x64, 0x24, 0x55,
+  0x24, 0x54, 0x34, 0x54, 0x34, 0x54, 0x24, 0x64, 0x24, 0x3F, 0x01, 0xFF,
+  0xF2, 0x44, 0x24, 0x64, 0x24, 0x64, 0x24, 0x4E, 0x2E, 0x2E, 0x2E, 0x34,
+  0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64,
+  0x24, 0x40, 0x62, 0xB4, 0xA4, 0xA4, 0x89, 0x3C, 0x2C, 0x15, 0x44, 0x14,
+  0x63, 0x14, 0x62, 0x27, 0x7B, 0x4B, 0x5A, 0x89, 0x87, 0x77, 0x79, 0x4F,
+  0x31, 0xC2, 0x21, 0x88, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x26, 0x34, 0x98,
+  0x63, 0x42, 0x62, 0x62, 0x52, 0x62, 0x52, 0x62, 0x53, 0x43, 0x68, 0x41,
+  0x44, 0x35, 0x77, 0x57, 0x57, 0x75, 0x34, 0x32, 0x47, 0x73, 0x33, 0x62,
+  0x52, 0x62, 0x52, 0x62, 0x52, 0x63, 0x33, 0x77, 0xA4, 0x30, 0x64, 0x11,
+  0x79, 0x5A, 0x4B, 0x45, 0x22, 0x64, 0xB4, 0xC4, 0xB5, 0xA5, 0x97, 0x79,
+  0x19, 0x14, 0x18, 0x3C, 0x46, 0x15, 0x35, 0x2F, 0x01, 0xE2, 0xD4, 0x61,
+  0x40, 0x0F, 0x51, 0x22, 0x22, 0x22, 0x22, 0x21, 0x53, 0x44, 0x35, 0x34,
+  0x35, 0x34, 0x34, 0x44, 0x44, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x54, 0x44, 0x44, 0x54, 0x44, 0x54, 0x45, 0x44, 0x53, 0x03,
+  0x54, 0x45, 0x44, 0x45, 0x44, 0x45, 0x44, 0x44, 0x44, 0x54, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x43, 0x44, 0x44, 0x44, 0x34, 0x44, 0x34, 0x35,
+  0x34, 0x43, 0x50, 0x72, 0xD4, 0xC4, 0xC4, 0xC4, 0x6F, 0xF2, 0x1E, 0x4A,
+  0x86, 0x98, 0x7A, 0x64, 0x24, 0x63, 0x43, 0x62, 0x62, 0x30, 0x73, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0xFF, 0xF4, 0x64, 0xC4, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xD2, 0x70, 0x25, 0x24, 0x34, 0x24, 0x34, 0x33, 0x43,
+  0x33, 0x43, 0x42, 0x50, 0x1F, 0x21, 0xF3, 0x2F, 0x22, 0xF2, 0x10, 0x13,
+  0x1F, 0x01, 0x31, 0xC3, 0xB4, 0xB4, 0xA4, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4,
+  0xB3, 0xB4, 0xB4, 0xA4, 0xB4, 0xA4, 0xB4, 0xA4, 0xB4, 0xA4, 0xB4, 0xA4,
+  0xB4, 0xA4, 0xB4, 0xB3, 0xB4, 0xB3, 0xD2, 0xC0, 0x56, 0x8A, 0x5C, 0x4C,
+  0x35, 0x45, 0x24, 0x64, 0x15, 0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x89, 0x65, 0x14, 0x64, 0x25, 0x45, 0x3C, 0x4C, 0x5A, 0x86,
+  0x50, 0x55, 0x96, 0x78, 0x69, 0x55, 0x14, 0x62, 0x34, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x6E, 0x1E, 0x1E,
+  0x2C, 0x10, 0x46, 0x7A, 0x4C, 0x3D, 0x15, 0x45, 0x14, 0x68, 0x84, 0xB4,
+  0xB4, 0xA5, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x95, 0x6F,
+  0xFF, 0xF4, 0x46, 0x7B, 0x4D, 0x3E, 0x33, 0x65, 0xC4, 0xC4, 0xC4, 0xB4,
+  0x88, 0x86, 0xA6, 0xA8, 0xC5, 0xC5, 0xC4, 0xC4, 0xC7, 0x7F, 0x61, 0xE3,
+  0xC6, 0x85, 0x85, 0x96, 0x96, 0x87, 0x73, 0x14, 0x73, 0x14, 0x63, 0x24,
+  0x54, 0x24, 0x53, 0x34, 0x43, 0x44, 0x34, 0x44, 0x33, 0x54, 0x2F, 0xFF,
+  0xEA, 0x48, 0x96, 0x96, 0x97, 0x71, 0x2C, 0x5C, 0x5C, 0x5C, 0x54, 0xD4,
+  0xD4, 0xD4, 0x15, 0x7C, 0x5D, 0x4E, 0x43, 0x55, 0xD5, 0xD4, 0xD4, 0xD4,
+  0xC5, 0x13, 0x75, 0x1F, 0x12, 0xE4, 0xC7, 0x85, 0x86, 0x79, 0x4B, 0x3C,
+  0x36, 0x85, 0x95, 0xA4, 0xA4, 0xB4, 0x25, 0x44, 0x17, 0x33, 0x19, 0x2E,
+  0x16, 0x3A, 0x77, 0x88, 0x78, 0x74, 0x14, 0x55, 0x1D, 0x3C, 0x4A, 0x76,
+  0x40, 0x0F, 0xFF, 0xF3, 0x84, 0xB3, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4, 0xA4,
+  0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xB3, 0xC3, 0x60, 0x55,
+  0x89, 0x5B, 0x3D, 0x15, 0x59, 0x78, 0x78, 0x78, 0x74, 0x14, 0x54, 0x3B,
+  0x59, 0x69, 0x4D, 0x24, 0x54, 0x14, 0x78, 0x78, 0x79, 0x55, 0x1D, 0x2D,
+  0x3B, 0x67, 0x40, 0x46, 0x89, 0x5B, 0x3D, 0x16, 0x44, 0x15, 0x63, 0x14,
+  0x78, 0x78, 0x79, 0x64, 0x15, 0x36, 0x1E, 0x29, 0x13, 0x37, 0x14, 0x45,
+  0x24, 0xA4, 0xA5, 0x95, 0x96, 0x2C, 0x3B, 0x49, 0x76, 0x80, 0x13, 0x1F,
+  0x01, 0x3F, 0xF2, 0x31, 0xF0, 0x13, 0x10, 0x33, 0x35, 0x25, 0x25, 0x33,
+  0xFF, 0xF1, 0x42, 0x43, 0x43, 0x33, 0x43, 0x34, 0x34, 0x24, 0x34, 0x2C,
+  0xF1, 0x1F, 0x04, 0xC6, 0xA7, 0x97, 0x97, 0x97, 0x97, 0xA7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD5, 0xF0, 0x30, 0x1F, 0x21, 0xF3, 0x2F, 0x22, 0xF2,
+  0xFF, 0xAF, 0x21, 0xF3, 0x2F, 0x22, 0xF2, 0x10, 0xF3, 0x4E, 0x6D, 0x7D,
+  0x7D, 0x7D, 0x7D, 0x7C, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7B, 0x5D, 0x3F,
+  0x37, 0x6B, 0x3E, 0x1E, 0x14, 0x5A, 0x74, 0x13, 0x74, 0xB4, 0x95, 0x87,
+  0x67, 0x94, 0xB2, 0xD2, 0xFF, 0xC3, 0xB5, 0xA5, 0xA5, 0xB3, 0x70, 0x56,
+  0x88, 0x6A, 0x44, 0x43, 0x34, 0x54, 0x23, 0x73, 0x14, 0x73, 0x13, 0x83,
+  0x13, 0x65, 0x13, 0x47, 0x13, 0x38, 0x13, 0x24, 0x23, 0x13, 0x23, 0x33,
+  0x13, 0x23, 0x33, 0x13, 0x23, 0x33, 0x13, 0x24, 0x23, 0x13, 0x3C, 0x4B,
+  0x5A, 0xD3, 0xC3, 0xC4, 0x71, 0x44, 0x44, 0x3C, 0x59, 0x76, 0x40, 0x49,
+  0xCB, 0xBB, 0xCA, 0xF0, 0x8E, 0x8E, 0x32, 0x4C, 0x42, 0x4C, 0x42, 0x4B,
+  0x44, 0x4A, 0x44, 0x49, 0x46, 0x48, 0xE8, 0xE7, 0xF1, 0x6F, 0x15, 0x4A,
+  0x42, 0x85, 0x81, 0x94, 0xF3, 0x49, 0x17, 0x67, 0x10, 0x1D, 0x6F, 0x14,
+  0xF2, 0x3F, 0x25, 0x47, 0x54, 0x48, 0x44, 0x48, 0x44, 0x47, 0x54, 0xF0,
+  0x5E, 0x6F, 0x05, 0xF2, 0x34, 0x85, 0x34, 0x95, 0x24, 0xA4, 0x24, 0xA4,
+  0x24, 0x9F, 0x91, 0xF4, 0x1F, 0x33, 0xF0, 0x40, 0x76, 0x32, 0x5F, 0x03,
+  0xF1, 0x2F, 0x21, 0x66, 0x61, 0x58, 0xAA, 0x8B, 0x31, 0x4F, 0x04, 0xF0,
+  0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x5F, 0x05, 0xA3, 0x17, 0x65, 0x2F,
+  0x23, 0xF0, 0x6C, 0x98, 0x40, 0x0C, 0x6E, 0x4F, 0x03, 0xF1, 0x34, 0x66,
+  0x24, 0x75, 0x24, 0x84, 0x24, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x94,
+  0x14, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x85, 0x14, 0x84, 0x24, 0x66,
+  0x1F, 0x12, 0xF1, 0x2E, 0x5B, 0x60, 0x1F, 0x21, 0xF3, 0x1F, 0x31, 0xF3,
+  0x34, 0x84, 0x34, 0x84, 0x34, 0x33, 0x24, 0x34, 0x34, 0x22, 0x4B, 0x8B,
+  0x8B, 0x8B, 0x84, 0x34, 0x84, 0x34, 0x32, 0x34, 0x42, 0x34, 0x24, 0x94,
+  0x24, 0x9F, 0xFF, 0xF1, 0x1F, 0x30, 0x1F, 0xFF, 0xFF, 0x02, 0x49, 0x42,
+  0x44, 0x23, 0x42, 0x43, 0x42, 0x42, 0x43, 0x43, 0x23, 0xB8, 0xB8, 0xB8,
+  0xB8, 0x43, 0x48, 0x43, 0x39, 0x4F, 0x04, 0xF0, 0x4D, 0xB8, 0xB8, 0xB9,
+  0x99, 0x77, 0x23, 0x6E, 0x4F, 0x13, 0xF2, 0x27, 0x65, 0x25, 0x94, 0x15,
+  0xB3, 0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0x69, 0x14, 0x6E, 0x6F,
+  0x05, 0xA1, 0x4A, 0x42, 0x68, 0x43, 0xF2, 0x4F, 0x15, 0xDA, 0x85, 0x17,
+  0x47, 0x38, 0x38, 0x28, 0x38, 0x37, 0x37, 0x54, 0x74, 0x64, 0x74, 0x64,
+  0x74, 0x64, 0x74, 0x64, 0x74, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x64,
+  0x74, 0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x48, 0x38, 0x19, 0x3F, 0x33,
+  0x91, 0x75, 0x71, 0x0F, 0xFF, 0xB5, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x45, 0xFF, 0xC1, 0xC1, 0x7C, 0x7C,
+  0x7C, 0x7C, 0xC4, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04,
+  0x43, 0x84, 0x34, 0x84, 0x34, 0x84, 0x34, 0x84, 0x34, 0x75, 0x35, 0x56,
+  0x3F, 0x04, 0xE7, 0xBB, 0x68, 0x08, 0x46, 0x29, 0x28, 0x19, 0x28, 0x19,
+  0x36, 0x44, 0x55, 0x64, 0x45, 0x74, 0x35, 0x84, 0x25, 0x94, 0x15, 0xA9,
+  0xBB, 0x9B, 0x95, 0x25, 0x84, 0x45, 0x74, 0x54, 0x74, 0x64, 0x64, 0x64,
+  0x49, 0x46, 0x19, 0x4F, 0x14, 0x71, 0x76, 0x51, 0x0A, 0x8A, 0x8A, 0x8A,
+  0xB4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x82, 0x44, 0x74,
+  0x34, 0x74, 0x34, 0x74, 0x34, 0x7F, 0xFF, 0xD1, 0xF2, 0x25, 0x95, 0x36,
+  0x96, 0x27, 0x77, 0x27, 0x77, 0x37, 0x57, 0x47, 0x57, 0x48, 0x38, 0x48,
+  0x38, 0x44, 0x14, 0x23, 0x14, 0x44, 0x14, 0x14, 0x14, 0x44, 0x14, 0x14,
+  0x14, 0x44, 0x27, 0x24, 0x44, 0x27, 0x24, 0x44, 0x35, 0x34, 0x44, 0x35,
+  0x34, 0x44, 0x44, 0x34, 0x44, 0xB4, 0x29, 0x5F, 0x35, 0xF3, 0x59, 0x17,
+  0x77, 0x10, 0x06, 0x58, 0x17, 0x4F, 0x14, 0xF2, 0x39, 0x27, 0x54, 0x47,
+  0x54, 0x48, 0x44, 0x48, 0x44, 0x44, 0x14, 0x34, 0x44, 0x14, 0x34, 0x44,
+  0x24, 0x24, 0x44, 0x34, 0x14, 0x44, 0x34, 0x14, 0x44, 0x48, 0x44, 0x48,
+  0x44, 0x57, 0x44, 0x57, 0x29, 0x36, 0x29, 0x45, 0x29, 0x45, 0x37, 0x64,
+  0x20, 0x76, 0xCA, 0x9D, 0x6F, 0x04, 0x64, 0x63, 0x58, 0x52, 0x4A, 0x41,
+  0x5A, 0x9C, 0x8C, 0x8C, 0x8C, 0x8C, 0x9A, 0x51, 0x4A, 0x42, 0x58, 0x53,
+  0x64, 0x65, 0xE6, 0xD9, 0xAC, 0x67, 0x1C, 0x5F, 0x03, 0xF1, 0x2F, 0x23,
+  0x46, 0x62, 0x48, 0x42, 0x48, 0x42, 0x48, 0x42, 0x48, 0x42, 0x46, 0x62,
+  0xF0, 0x3E, 0x4D, 0x5B, 0x74, 0xE4, 0xE4, 0xCB, 0x7B, 0x7B, 0x89, 0x80,
+  0x76, 0xCA, 0x9C, 0x7E, 0x56, 0x46, 0x35, 0x85, 0x24, 0xA4, 0x15, 0xA9,
+  0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xA5, 0x14, 0xA4, 0x25, 0x85, 0x36, 0x46,
+  0x5E, 0x7C, 0x9A, 0xB7, 0xD7, 0x33, 0x6F, 0x04, 0xF1, 0x4F, 0x06, 0x26,
+  0x43, 0x1C, 0x8F, 0x06, 0xF2, 0x5F, 0x17, 0x46, 0x56, 0x47, 0x46, 0x47,
+  0x46, 0x47, 0x46, 0x45, 0x66, 0xE7, 0xD8, 0xBA, 0xC9, 0x44, 0x58, 0x45,
+  0x48, 0x46, 0x47, 0x46, 0x54, 0x94, 0x61, 0xA5, 0xF1, 0x56, 0x18, 0x74,
+  0x10, 0x56, 0x23, 0x5C, 0x3E, 0x3E, 0x25, 0x55, 0x24, 0x74, 0x24, 0x74,
+  0x25, 0xC8, 0xAB, 0x7C, 0x6C, 0x99, 0x12, 0x99, 0x98, 0x9A, 0x5F, 0x71,
+  0xF0, 0x32, 0x1A, 0x96, 0x50, 0x0F, 0xFF, 0xFF, 0x54, 0x43, 0x84, 0x43,
+  0x84, 0x43, 0x84, 0x43, 0x41, 0x25, 0x44, 0x29, 0x4F, 0x04, 0xF0, 0x4F,
+  0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xBC, 0x7C, 0x7C, 0x8A, 0x40,
+  0x08, 0x48, 0x19, 0x3F, 0x33, 0x91, 0x83, 0x92, 0x49, 0x44, 0x49, 0x44,
+  0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x44,
+  0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x57, 0x55, 0x55, 0x56, 0xF0, 0x7D,
+  0x9B, 0xC7, 0x70, 0x08, 0x68, 0x19, 0x5F, 0x35, 0x91, 0x76, 0x84, 0x3B,
+  0x36, 0x49, 0x46, 0x49, 0x47, 0x47, 0x48, 0x47, 0x49, 0x46, 0x3A, 0x45,
+  0x4A, 0x54, 0x4B, 0x43, 0x4C, 0x43, 0x4D, 0x41, 0x4E, 0x41, 0x4E, 0x9F,
+  0x07, 0xF1, 0x7F, 0x25, 0xF3, 0x59, 0x08, 0x48, 0x19, 0x3F, 0x33, 0xF2,
+  0x58, 0x14, 0xB4, 0x24, 0x43, 0x44, 0x33, 0x35, 0x33, 0x43, 0x35, 0x33,
+  0x43, 0x35, 0x33, 0x44, 0x17, 0x23, 0x44, 0x17, 0x14, 0x44, 0x13, 0x13,
+  0x14, 0x48, 0x18, 0x57, 0x18, 0x56, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66,
+  0x45, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x30, 0x16, 0x56, 0x18, 0x3F,
+  0x13, 0x81, 0x65, 0x64, 0x45, 0x55, 0x53, 0x57, 0x51, 0x59, 0x41, 0x4B,
+  0x7D, 0x5F, 0x04, 0xE5, 0xD7, 0xB4, 0x14, 0x94, 0x34, 0x75, 0x44, 0x55,
+  0x55, 0x37, 0x3F, 0x13, 0xF1, 0x38, 0x16, 0x56, 0x10, 0x16, 0x66, 0x18,
+  0x4F, 0x14, 0x81, 0x66, 0x64, 0x46, 0x46, 0x54, 0x57, 0x44, 0x49, 0x42,
+  0x4A, 0xAB, 0x8D, 0x6F, 0x04, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0xF1,
+  0x4C, 0xB9, 0xC8, 0xC9, 0xA5, 0x0E, 0x2E, 0x2E, 0x2E, 0x24, 0x64, 0x24,
+  0x54, 0x34, 0x44, 0x53, 0x43, 0xC4, 0xB4, 0xC3, 0xC3, 0xC4, 0xB4, 0x53,
+  0x43, 0x64, 0x23, 0x74, 0x14, 0x74, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0,
+  0x07, 0x1F, 0x81, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x71, 0xF8,
+  0x10, 0x03, 0xC4, 0xB4, 0xC4, 0xB4, 0xC3, 0xC4, 0xC3, 0xC4, 0xC3, 0xC4,
+  0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4,
+  0xB4, 0xC3, 0xC4, 0xC3, 0xC3, 0x1F, 0xF1, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x1F, 0xF1, 0x71, 0xD3, 0xB5, 0x97, 0x87, 0x74, 0x14, 0x54,
+  0x34, 0x35, 0x35, 0x15, 0x59, 0x77, 0x93, 0x0F, 0xFF, 0xFF, 0x90, 0x02,
+  0x43, 0x43, 0x43, 0x43, 0x42, 0x77, 0x9B, 0x8C, 0x7D, 0xF0, 0x47, 0xC5,
+  0xE4, 0xF0, 0x3F, 0x12, 0x67, 0x42, 0x49, 0x42, 0x47, 0x62, 0xF4, 0x1F,
+  0x32, 0xF2, 0x47, 0x25, 0x10, 0x15, 0xD6, 0xD6, 0xD6, 0xF0, 0x4F, 0x04,
+  0xF0, 0x42, 0x67, 0xE5, 0xF0, 0x4F, 0x04, 0x65, 0x53, 0x57, 0x52, 0x49,
+  0x42, 0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x57, 0x52, 0x65, 0x51, 0xF3,
+  0x1F, 0x22, 0xF1, 0x45, 0x26, 0x50, 0x66, 0x23, 0x4D, 0x2F, 0x01, 0xF1,
+  0x16, 0x5A, 0x88, 0xA7, 0xD4, 0xD4, 0xD5, 0xA1, 0x25, 0x74, 0x1F, 0x12,
+  0xE4, 0xC7, 0x84, 0xC6, 0xE6, 0xE6, 0xE6, 0xF1, 0x4F, 0x14, 0x86, 0x24,
+  0x69, 0x14, 0x5F, 0x04, 0xF1, 0x36, 0x56, 0x34, 0x85, 0x24, 0xA4, 0x24,
+  0xA4, 0x24, 0xA4, 0x24, 0xA4, 0x25, 0x85, 0x36, 0x56, 0x3F, 0x42, 0xF3,
+  0x4F, 0x16, 0x62, 0x51, 0x66, 0xAA, 0x7C, 0x5E, 0x36, 0x55, 0x24, 0x84,
+  0x14, 0xAF, 0xFF, 0xFF, 0x11, 0x4E, 0xF2, 0x2F, 0x13, 0xE7, 0x84, 0x68,
+  0x7B, 0x4C, 0x3D, 0x34, 0xC4, 0x9D, 0x3E, 0x2E, 0x2D, 0x64, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9D, 0x3D, 0x3D, 0x3D, 0x30, 0x56, 0x25,
+  0x4F, 0x12, 0xF2, 0x1F, 0x31, 0x55, 0x62, 0x57, 0x52, 0x49, 0x42, 0x49,
+  0x42, 0x49, 0x42, 0x49, 0x42, 0x57, 0x53, 0x55, 0x63, 0xF1, 0x4F, 0x05,
+  0x91, 0x47, 0x62, 0x4F, 0x04, 0xF0, 0x4E, 0x57, 0xB8, 0xB8, 0xAA, 0x76,
+  0x25, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x24, 0xF2, 0x4F, 0x24, 0x35, 0x94,
+  0x18, 0x8E, 0x7F, 0x06, 0x64, 0x56, 0x56, 0x46, 0x47, 0x46, 0x47, 0x46,
+  0x47, 0x46, 0x47, 0x46, 0x47, 0x46, 0x47, 0x44, 0x75, 0x71, 0x85, 0xF1,
+  0x58, 0x16, 0x76, 0x10, 0x64, 0xC4, 0xC4, 0xC4, 0xFF, 0xA8, 0x88, 0x88,
+  0x88, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0x01, 0xFF,
+  0x21, 0xE1, 0x64, 0x84, 0x84, 0x84, 0xFC, 0xFF, 0x51, 0xB8, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47,
+  0xF1, 0x1B, 0x1A, 0x37, 0x40, 0x15, 0xC6, 0xC6, 0xC6, 0xE4, 0xE4, 0xE4,
+  0x37, 0x44, 0x28, 0x44, 0x28, 0x44, 0x27, 0x54, 0x15, 0x89, 0x98, 0xA7,
+  0xB8, 0xA4, 0x14, 0x94, 0x24, 0x84, 0x35, 0x46, 0x47, 0x16, 0x3F, 0x03,
+  0x91, 0x54, 0x71, 0x28, 0x88, 0x88, 0x88, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0x01, 0xFF,
+  0x21, 0xE1, 0x24, 0x14, 0x34, 0x5F, 0x43, 0xF4, 0x3F, 0x53, 0x53, 0x43,
+  0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x43, 0x44, 0x43,
+  0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x41, 0x73, 0x52,
+  0xC3, 0x52, 0xC3, 0x52, 0x51, 0x54, 0x43, 0x41, 0x34, 0x25, 0x85, 0x18,
+  0x6F, 0x05, 0xF1, 0x56, 0x45, 0x54, 0x74, 0x54, 0x74, 0x54, 0x74, 0x54,
+  0x74, 0x54, 0x74, 0x54, 0x74, 0x54, 0x74, 0x37, 0x4F, 0x14, 0xF1, 0x48,
+  0x16, 0x66, 0x10, 0x67, 0xAB, 0x7D, 0x5F, 0x03, 0x65, 0x61, 0x59, 0x9B,
+  0x8B, 0x8B, 0x8B, 0x99, 0x51, 0x65, 0x63, 0xF0, 0x5D, 0x7B, 0xA7, 0x60,
+  0x25, 0x26, 0x76, 0x19, 0x5F, 0x24, 0xF3, 0x56, 0x56, 0x45, 0x85, 0x34,
+  0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x35, 0x85, 0x36, 0x56, 0x4F,
+  0x15, 0xF0, 0x64, 0x19, 0x74, 0x26, 0x94, 0xF2, 0x4F, 0x24, 0xF0, 0x9B,
+  0xAB, 0xAC, 0x8C, 0x66, 0x25, 0x69, 0x16, 0x4F, 0x23, 0xF3, 0x26, 0x56,
+  0x35, 0x85, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x35, 0x85,
+  0x46, 0x56, 0x5F, 0x15, 0xF1, 0x79, 0x14, 0x96, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4E, 0x9C, 0xAB, 0xAC, 0x81, 0x16, 0x44, 0x27, 0x2F, 0x01, 0xFB,
+  0x38, 0x96, 0xB5, 0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0xAD, 0x4D, 0x4D, 0x4C,
+  0x50, 0x56, 0x22, 0x4C, 0x2E, 0x2E, 0x24, 0x64, 0x24, 0x73, 0x2A, 0x7C,
+  0x89, 0x22, 0x88, 0x99, 0x6F, 0xF6, 0x2D, 0x76, 0x50, 0x42, 0xE4, 0xD4,
+  0xD4, 0xD4, 0xAF, 0x02, 0xF0, 0x2F, 0x02, 0xE6, 0x4D, 0x4D, 0x4D, 0x4D,
+  0x4D, 0x4D, 0x4D, 0x46, 0x43, 0xE4, 0xC5, 0xB8, 0x74, 0x06, 0x56, 0x16,
+  0x47, 0x16, 0x47, 0x16, 0x47, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34,
+  0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x35, 0x46, 0x3F, 0x13, 0xF0,
+  0x48, 0x15, 0x65, 0x24, 0x10, 0x17, 0x57, 0x19, 0x3F, 0x33, 0x91, 0x75,
+  0x74, 0x47, 0x46, 0x47, 0x47, 0x45, 0x48, 0x45, 0x49, 0x43, 0x4A, 0x52,
+  0x4B, 0x41, 0x4C, 0x9D, 0x7E, 0x7F, 0x05, 0xF1, 0x58, 0x16, 0x76, 0x18,
+  0x5F, 0x15, 0x81, 0x67, 0x72, 0x43, 0x34, 0x43, 0x42, 0x52, 0x45, 0x32,
+  0x52, 0x45, 0x32, 0x51, 0x55, 0xF0, 0x6F, 0x07, 0x61, 0x77, 0x61, 0x77,
+  0x62, 0x58, 0x53, 0x59, 0x43, 0x59, 0x35, 0x35, 0x16, 0x56, 0x18, 0x3F,
+  0x13, 0x81, 0x65, 0x64, 0x53, 0x57, 0xB9, 0x9B, 0x7B, 0x8A, 0xB7, 0x61,
+  0x65, 0x63, 0x63, 0x65, 0x61, 0x83, 0xF1, 0x3F, 0x05, 0x70, 0x16, 0x56,
+  0x18, 0x3F, 0x13, 0x81, 0x65, 0x63, 0x47, 0x45, 0x46, 0x36, 0x45, 0x47,
+  0x44, 0x38, 0x43, 0x49, 0x33, 0x3A, 0x41, 0x4B, 0x31, 0x3C, 0x7D, 0x5E,
+  0x5F, 0x03, 0xF0, 0x4F, 0x03, 0xF0, 0x4A, 0xA8, 0xC7, 0xC8, 0xA8, 0x0F,
+  0xFF, 0xF0, 0x45, 0x23, 0x35, 0x85, 0x85, 0x85, 0x84, 0x94, 0x94, 0x6F,
+  0xFF, 0xE0, 0x63, 0x65, 0x46, 0x36, 0x45, 0x54, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x55, 0x36, 0x45, 0x55, 0x56, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x65, 0x56, 0x56, 0x46, 0x63, 0x10, 0x12, 0x1F, 0xFF, 0xFF, 0xFE, 0x13,
+  0x65, 0x56, 0x56, 0x55, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x66,
+  0x55, 0x55, 0x46, 0x35, 0x54, 0x64, 0x64, 0x64, 0x64, 0x55, 0x46, 0x36,
+  0x46, 0x53, 0x60, 0x34, 0xC7, 0x99, 0x42, 0x1B, 0x28, 0x2B, 0x12, 0x49,
+  0x97, 0xC4, 0x30 };
 
 const GFXglyph FreeMonoBold18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
   {     0,   5,  22,  21,    8,  -21 },   // 0x21 '!'
   {    14,  11,  10,  21,    5,  -20 },   // 0x22 '"'
-  {    28,  16,  25,  21,    3,  -22 },   // 0x23 '#'
-  {    78,  14,  28,  21,    4,  -23 },   // 0x24 '$'
-  {   127,  15,  21,  21,    3,  -20 },   // 0x25 '%'
-  {   167,  15,  20,  21,    3,  -19 },   // 0x26 '&'
-  {   205,   4,  10,  21,    8,  -20 },   // 0x27 '''
-  {   210,   8,  27,  21,    9,  -21 },   // 0x28 '('
-  {   237,   8,  27,  21,    4,  -21 },   // 0x29 ')'
-  {   264,  16,  15,  21,    3,  -21 },   // 0x2A '*'
-  {   294,  16,  19,  21,    3,  -18 },   // 0x2B '+'
-  {   332,   7,  10,  21,    5,   -3 },   // 0x2C ','
-  {   341,  19,   4,  21,    1,  -11 },   // 0x2D '-'
-  {   351,   5,   5,  21,    8,   -4 },   // 0x2E '.'
-  {   355,  15,  28,  21,    3,  -23 },   // 0x2F '/'
-  {   408,  16,  23,  21,    3,  -22 },   // 0x30 '0'
-  {   454,  15,  22,  21,    3,  -21 },   // 0x31 '1'
-  {   496,  15,  23,  21,    3,  -22 },   // 0x32 '2'
-  {   540,  16,  23,  21,    3,  -22 },   // 0x33 '3'
-  {   586,  15,  21,  21,    3,  -20 },   // 0x34 '4'
-  {   626,  17,  22,  21,    2,  -21 },   // 0x35 '5'
-  {   673,  15,  23,  21,    4,  -22 },   // 0x36 '6'
-  {   717,  15,  22,  21,    3,  -21 },   // 0x37 '7'
-  {   759,  15,  23,  21,    3,  -22 },   // 0x38 '8'
-  {   803,  15,  23,  21,    4,  -22 },   // 0x39 '9'
-  {   847,   5,  16,  21,    8,  -15 },   // 0x3A ':'
-  {   857,   7,  22,  21,    5,  -15 },   // 0x3B ';'
-  {   877,  18,  16,  21,    1,  -17 },   // 0x3C '<'
-  {   913,  19,  10,  21,    1,  -14 },   // 0x3D '='
-  {   937,  18,  16,  21,    2,  -17 },   // 0x3E '>'
-  {   973,  15,  21,  21,    4,  -20 },   // 0x3F '?'
-  {  1013,  15,  27,  21,    3,  -21 },   // 0x40 '@'
-  {  1064,  22,  21,  21,   -1,  -20 },   // 0x41 'A'
-  {  1122,  20,  21,  21,    1,  -20 },   // 0x42 'B'
-  {  1175,  19,  21,  21,    1,  -20 },   // 0x43 'C'
-  {  1225,  18,  21,  21,    2,  -20 },   // 0x44 'D'
-  {  1273,  19,  21,  21,    1,  -20 },   // 0x45 'E'
-  {  1323,  19,  21,  21,    1,  -20 },   // 0x46 'F'
-  {  1373,  20,  21,  21,    1,  -20 },   // 0x47 'G'
-  {  1426,  21,  21,  21,    0,  -20 },   // 0x48 'H'
-  {  1482,  14,  21,  21,    4,  -20 },   // 0x49 'I'
-  {  1519,  19,  21,  21,    2,  -20 },   // 0x4A 'J'
-  {  1569,  20,  21,  21,    1,  -20 },   // 0x4B 'K'
-  {  1622,  18,  21,  21,    2,  -20 },   // 0x4C 'L'
-  {  1670,  23,  21,  21,   -1,  -20 },   // 0x4D 'M'
-  {  1731,  20,  21,  21,    1,  -20 },   // 0x4E 'N'
-  {  1784,  20,  21,  21,    1,  -20 },   // 0x4F 'O'
-  {  1837,  18,  21,  21,    1,  -20 },   // 0x50 'P'
-  {  1885,  20,  26,  21,    1,  -20 },   // 0x51 'Q'
-  {  1950,  21,  21,  21,    0,  -20 },   // 0x52 'R'
-  {  2006,  17,  21,  21,    2,  -20 },   // 0x53 'S'
-  {  2051,  19,  21,  21,    1,  -20 },   // 0x54 'T'
-  {  2101,  21,  21,  21,    0,  -20 },   // 0x55 'U'
-  {  2157,  23,  21,  21,   -1,  -20 },   // 0x56 'V'
-  {  2218,  21,  21,  21,    0,  -20 },   // 0x57 'W'
-  {  2274,  19,  21,  21,    1,  -20 },   // 0x58 'X'
-  {  2324,  20,  21,  21,    1,  -20 },   // 0x59 'Y'
-  {  2377,  16,  21,  21,    3,  -20 },   // 0x5A 'Z'
-  {  2419,   8,  27,  21,    9,  -21 },   // 0x5B '['
-  {  2446,  15,  28,  21,    3,  -23 },   // 0x5C '\'
-  {  2499,   8,  27,  21,    4,  -21 },   // 0x5D ']'
-  {  2526,  15,  11,  21,    3,  -21 },   // 0x5E '^'
-  {  2547,  21,   4,  21,    0,    4 },   // 0x5F '_'
-  {  2558,   6,   6,  21,    6,  -22 },   // 0x60 '`'
-  {  2563,  19,  16,  21,    1,  -15 },   // 0x61 'a'
-  {  2601,  19,  22,  21,    1,  -21 },   // 0x62 'b'
-  {  2654,  17,  16,  21,    2,  -15 },   // 0x63 'c'
-  {  2688,  20,  22,  21,    1,  -21 },   // 0x64 'd'
-  {  2743,  18,  16,  21,    1,  -15 },   // 0x65 'e'
-  {  2779,  16,  22,  21,    4,  -21 },   // 0x66 'f'
-  {  2823,  19,  23,  21,    1,  -15 },   // 0x67 'g'
-  {  2878,  21,  22,  21,    0,  -21 },   // 0x68 'h'
-  {  2936,  16,  22,  21,    3,  -21 },   // 0x69 'i'
-  {  2980,  12,  29,  21,    5,  -21 },   // 0x6A 'j'
-  {  3024,  18,  22,  21,    2,  -21 },   // 0x6B 'k'
-  {  3074,  16,  22,  21,    3,  -21 },   // 0x6C 'l'
-  {  3118,  22,  16,  21,   -1,  -15 },   // 0x6D 'm'
-  {  3162,  20,  16,  21,    0,  -15 },   // 0x6E 'n'
-  {  3202,  19,  16,  21,    1,  -15 },   // 0x6F 'o'
-  {  3240,  21,  23,  21,    0,  -15 },   // 0x70 'p'
-  {  3301,  21,  23,  22,    1,  -15 },   // 0x71 'q'
-  {  3362,  17,  16,  21,    3,  -15 },   // 0x72 'r'
-  {  3396,  16,  16,  21,    3,  -15 },   // 0x73 's'
-  {  3428,  17,  21,  21,    1,  -20 },   // 0x74 't'
-  {  3473,  18,  16,  21,    1,  -15 },   // 0x75 'u'
-  {  3509,  21,  16,  21,    0,  -15 },   // 0x76 'v'
-  {  3551,  21,  16,  21,    0,  -15 },   // 0x77 'w'
-  {  3593,  19,  16,  21,    1,  -15 },   // 0x78 'x'
-  {  3631,  19,  23,  21,    1,  -15 },   // 0x79 'y'
-  {  3686,  14,  16,  21,    3,  -15 },   // 0x7A 'z'
-  {  3714,  10,  27,  21,    6,  -21 },   // 0x7B '{'
-  {  3748,   4,  27,  21,    9,  -21 },   // 0x7C '|'
-  {  3762,  10,  27,  21,    6,  -21 },   // 0x7D '}'
-  {  3796,  17,   8,  21,    2,  -13 } }; // 0x7E '~'
+  {    31,  16,  25,  21,    3,  -22 },   // 0x23 '#'
+  {    74,  14,  28,  21,    4,  -23 },   // 0x24 '$'
+  {   106,  15,  21,  21,    3,  -20 },   // 0x25 '%'
+  {   142,  15,  20,  21,    3,  -19 },   // 0x26 '&'
+  {   169,   4,  10,  21,    8,  -20 },   // 0x27 '''
+  {   176,   8,  27,  21,    9,  -21 },   // 0x28 '('
+  {   203,   8,  27,  21,    4,  -21 },   // 0x29 ')'
+  {   231,  16,  15,  21,    3,  -21 },   // 0x2A '*'
+  {   250,  16,  19,  21,    3,  -18 },   // 0x2B '+'
+  {   269,   7,  10,  21,    5,   -3 },   // 0x2C ','
+  {   280,  19,   4,  21,    1,  -11 },   // 0x2D '-'
+  {   287,   5,   5,  21,    8,   -4 },   // 0x2E '.'
+  {   291,  15,  28,  21,    3,  -23 },   // 0x2F '/'
+  {   320,  16,  23,  21,    3,  -22 },   // 0x30 '0'
+  {   349,  15,  22,  21,    3,  -21 },   // 0x31 '1'
+  {   374,  15,  23,  21,    3,  -22 },   // 0x32 '2'
+  {   398,  16,  23,  21,    3,  -22 },   // 0x33 '3'
+  {   422,  15,  21,  21,    3,  -20 },   // 0x34 '4'
+  {   450,  17,  22,  21,    2,  -21 },   // 0x35 '5'
+  {   476,  15,  23,  21,    4,  -22 },   // 0x36 '6'
+  {   505,  15,  22,  21,    3,  -21 },   // 0x37 '7'
+  {   527,  15,  23,  21,    3,  -22 },   // 0x38 '8'
+  {   555,  15,  23,  21,    4,  -22 },   // 0x39 '9'
+  {   586,   5,  16,  21,    8,  -15 },   // 0x3A ':'
+  {   595,   7,  22,  21,    5,  -15 },   // 0x3B ';'
+  {   612,  18,  16,  21,    1,  -17 },   // 0x3C '<'
+  {   630,  19,  10,  21,    1,  -14 },   // 0x3D '='
+  {   644,  18,  16,  21,    2,  -17 },   // 0x3E '>'
+  {   660,  15,  21,  21,    4,  -20 },   // 0x3F '?'
+  {   683,  15,  27,  21,    3,  -21 },   // 0x40 '@'
+  {   731,  22,  21,  21,   -1,  -20 },   // 0x41 'A'
+  {   765,  20,  21,  21,    1,  -20 },   // 0x42 'B'
+  {   800,  19,  21,  21,    1,  -20 },   // 0x43 'C'
+  {   833,  18,  21,  21,    2,  -20 },   // 0x44 'D'
+  {   870,  19,  21,  21,    1,  -20 },   // 0x45 'E'
+  {   906,  19,  21,  21,    1,  -20 },   // 0x46 'F'
+  {   937,  20,  21,  21,    1,  -20 },   // 0x47 'G'
+  {   971,  21,  21,  21,    0,  -20 },   // 0x48 'H'
+  {  1011,  14,  21,  21,    4,  -20 },   // 0x49 'I'
+  {  1030,  19,  21,  21,    2,  -20 },   // 0x4A 'J'
+  {  1061,  20,  21,  21,    1,  -20 },   // 0x4B 'K'
+  {  1100,  18,  21,  21,    2,  -20 },   // 0x4C 'L'
+  {  1125,  23,  21,  21,   -1,  -20 },   // 0x4D 'M'
+  {  1178,  20,  21,  21,    1,  -20 },   // 0x4E 'N'
+  {  1225,  20,  21,  21,    1,  -20 },   // 0x4F 'O'
+  {  1254,  18,  21,  21,    1,  -20 },   // 0x50 'P'
+  {  1284,  20,  26,  21,    1,  -20 },   // 0x51 'Q'
+  {  1321,  21,  21,  21,    0,  -20 },   // 0x52 'R'
+  {  1357,  17,  21,  21,    2,  -20 },   // 0x53 'S'
+  {  1385,  19,  21,  21,    1,  -20 },   // 0x54 'T'
+  {  1416,  21,  21,  21,    0,  -20 },   // 0x55 'U'
+  {  1455,  23,  21,  21,   -1,  -20 },   // 0x56 'V'
+  {  1494,  21,  21,  21,    0,  -20 },   // 0x57 'W'
+  {  1544,  19,  21,  21,    1,  -20 },   // 0x58 'X'
+  {  1581,  20,  21,  21,    1,  -20 },   // 0x59 'Y'
+  {  1613,  16,  21,  21,    3,  -20 },   // 0x5A 'Z'
+  {  1644,   8,  27,  21,    9,  -21 },   // 0x5B '['
+  {  1669,  15,  28,  21,    3,  -23 },   // 0x5C '\'
+  {  1697,   8,  27,  21,    4,  -21 },   // 0x5D ']'
+  {  1720,  15,  11,  21,    3,  -21 },   // 0x5E '^'
+  {  1735,  21,   4,  21,    0,    4 },   // 0x5F '_'
+  {  1739,   6,   6,  21,    6,  -22 },   // 0x60 '`'
+  {  1745,  19,  16,  21,    1,  -15 },   // 0x61 'a'
+  {  1769,  19,  22,  21,    1,  -21 },   // 0x62 'b'
+  {  1806,  17,  16,  21,    2,  -15 },   // 0x63 'c'
+  {  1827,  20,  22,  21,    1,  -21 },   // 0x64 'd'
+  {  1864,  18,  16,  21,    1,  -15 },   // 0x65 'e'
+  {  1883,  16,  22,  21,    4,  -21 },   // 0x66 'f'
+  {  1906,  19,  23,  21,    1,  -15 },   // 0x67 'g'
+  {  1944,  21,  22,  21,    0,  -21 },   // 0x68 'h'
+  {  1984,  16,  22,  21,    3,  -21 },   // 0x69 'i'
+  {  2006,  12,  29,  21,    5,  -21 },   // 0x6A 'j'
+  {  2033,  18,  22,  21,    2,  -21 },   // 0x6B 'k'
+  {  2067,  16,  22,  21,    3,  -21 },   // 0x6C 'l'
+  {  2090,  22,  16,  21,   -1,  -15 },   // 0x6D 'm'
+  {  2132,  20,  16,  21,    0,  -15 },   // 0x6E 'n'
+  {  2163,  19,  16,  21,    1,  -15 },   // 0x6F 'o'
+  {  2184,  21,  23,  21,    0,  -15 },   // 0x70 'p'
+  {  2223,  21,  23,  22,    1,  -15 },   // 0x71 'q'
+  {  2262,  17,  16,  21,    3,  -15 },   // 0x72 'r'
+  {  2281,  16,  16,  21,    3,  -15 },   // 0x73 's'
+  {  2301,  17,  21,  21,    1,  -20 },   // 0x74 't'
+  {  2325,  18,  16,  21,    1,  -15 },   // 0x75 'u'
+  {  2357,  21,  16,  21,    0,  -15 },   // 0x76 'v'
+  {  2385,  21,  16,  21,    0,  -15 },   // 0x77 'w'
+  {  2420,  19,  16,  21,    1,  -15 },   // 0x78 'x'
+  {  2446,  19,  23,  21,    1,  -15 },   // 0x79 'y'
+  {  2483,  14,  16,  21,    3,  -15 },   // 0x7A 'z'
+  {  2498,  10,  27,  21,    6,  -21 },   // 0x7B '{'
+  {  2526,   4,  27,  21,    9,  -21 },   // 0x7C '|'
+  {  2531,  10,  27,  21,    6,  -21 },   // 0x7D '}'
+  {  2559,  17,   8,  21,    2,  -13 } }; // 0x7E '~'
 
 const GFXfont FreeMonoBold18pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold18pt7bBitmaps,
   (GFXglyph *)FreeMonoBold18pt7bGlyphs,
-  0x20, 0x7E, 35 };
+  0x20, 0x7E, 35, 1 };
 
-// Approx. 4485 bytes
+// Approx. 3243 bytes
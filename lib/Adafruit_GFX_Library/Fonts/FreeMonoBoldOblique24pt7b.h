@@ -1,742 +1,443 @@
 const uint8_t FreeMonoBoldOblique24pt7bBitmaps[] PROGMEM = {
-  0x01, 0xE0, 0x3F, 0x07, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xE0, 0xFE,
-  0x0F, 0xE0, 0xFE, 0x0F, 0xC0, 0xFC, 0x1F, 0xC1, 0xF8, 0x1F, 0x81, 0xF8,
-  0x1F, 0x81, 0xF0, 0x1F, 0x01, 0xF0, 0x1E, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xC0, 0x7E, 0x0F, 0xE0, 0xFE, 0x0F, 0xC0, 0x78, 0x00, 0x7E,
-  0x1F, 0xBF, 0x0F, 0xDF, 0x87, 0xCF, 0x83, 0xE7, 0xC1, 0xF3, 0xE0, 0xF1,
-  0xE0, 0xF8, 0xF0, 0x7C, 0x78, 0x3C, 0x38, 0x1E, 0x1C, 0x0F, 0x0E, 0x07,
-  0x0E, 0x03, 0x83, 0x01, 0x80, 0x00, 0x1C, 0x1C, 0x00, 0x3E, 0x3E, 0x00,
-  0x3E, 0x3E, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x7C, 0x00,
-  0x7C, 0x7C, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x0F,
-  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F,
-  0xFF, 0xFE, 0x03, 0xE3, 0xE0, 0x03, 0xE3, 0xE0, 0x03, 0xC3, 0xC0, 0x07,
-  0xC7, 0xC0, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF,
-  0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0x0F, 0x0F, 0x00, 0x1F, 0x1F, 0x00, 0x1F,
-  0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x3E, 0x1E, 0x00, 0x3E, 0x3E, 0x00, 0x3E,
-  0x3E, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x7C, 0x00, 0x38, 0x38, 0x00, 0x00,
-  0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-  0x01, 0xFF, 0xFF, 0x81, 0xFC, 0x1F, 0xC1, 0xF8, 0x03, 0xC0, 0xF8, 0x01,
-  0xE0, 0x7C, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF,
-  0x80, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-  0x7F, 0xC0, 0x00, 0x07, 0xE0, 0xE0, 0x01, 0xF0, 0xF0, 0x00, 0xF8, 0xF8,
-  0x00, 0xFC, 0x7E, 0x00, 0xFC, 0x3F, 0x81, 0xFE, 0x1F, 0xFF, 0xFE, 0x0F,
-  0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-  0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF8,
-  0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xC3, 0xC0, 0x0E, 0x07, 0x00,
-  0x70, 0x1C, 0x01, 0xC0, 0x70, 0x07, 0x01, 0xC0, 0x1C, 0x0E, 0x00, 0x78,
-  0x78, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x1F, 0x03, 0xE3, 0xFC, 0x00, 0x7F,
-  0xC0, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xF8, 0x7C, 0x0F,
-  0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xE1, 0xE0, 0x07, 0x03, 0x80, 0x38,
-  0x0E, 0x00, 0xE0, 0x38, 0x03, 0x80, 0xE0, 0x0E, 0x07, 0x00, 0x3C, 0x3C,
-  0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-  0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF, 0xE0, 0x1F, 0xFE, 0x01, 0xF1,
-  0xE0, 0x1F, 0x04, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01,
-  0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xE3,
-  0xE7, 0xFF, 0x3F, 0x7E, 0xFF, 0xFB, 0xE7, 0xFF, 0x9E, 0x1F, 0xF1, 0xF0,
-  0xFF, 0x8F, 0x83, 0xF8, 0x7C, 0x1F, 0xC3, 0xF0, 0xFF, 0x9F, 0xFF, 0xFC,
-  0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x0F, 0xFD, 0xF0, 0x1F, 0x80, 0x00, 0x7E,
-  0xFD, 0xF3, 0xE7, 0xCF, 0x3E, 0x7C, 0xF1, 0xE3, 0xC7, 0x0E, 0x18, 0x00,
-  0x00, 0x18, 0x00, 0xF0, 0x07, 0xC0, 0x3F, 0x01, 0xF8, 0x07, 0xC0, 0x3E,
-  0x01, 0xF8, 0x07, 0xC0, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x00, 0xF8,
-  0x03, 0xE0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x3E, 0x00, 0xF8,
-  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E,
-  0x00, 0xFC, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x80, 0x7E, 0x00, 0xFC, 0x03,
-  0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x3F, 0x00, 0xFC,
-  0x03, 0xF0, 0x07, 0xE0, 0x1F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xF0, 0x07,
-  0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01,
-  0xF0, 0x07, 0xC0, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0x7C, 0x01,
-  0xF0, 0x0F, 0x80, 0x3E, 0x01, 0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF0, 0x0F,
-  0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-  0x00, 0x01, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x08,
-  0x3C, 0x09, 0xF9, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-  0x87, 0xFF, 0xE0, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x00, 0x7F,
-  0xF8, 0x07, 0xE7, 0xE0, 0x3E, 0x3F, 0x01, 0xE0, 0xF8, 0x0E, 0x07, 0x80,
-  0x00, 0x07, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7C, 0x00,
-  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-  0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF0, 0x7E, 0x07, 0xC0, 0xFC,
-  0x0F, 0x81, 0xF0, 0x1E, 0x03, 0xE0, 0x3C, 0x07, 0x80, 0x78, 0x0F, 0x00,
-  0xE0, 0x0C, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3C, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-  0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-  0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x1F, 0xFF,
-  0xE0, 0x7F, 0xFF, 0xC0, 0xFC, 0x1F, 0x83, 0xF0, 0x1F, 0x8F, 0xC0, 0x1F,
-  0x1F, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0xF8, 0x00, 0xF9, 0xF0, 0x01, 0xF3,
-  0xC0, 0x07, 0xCF, 0x80, 0x0F, 0x9F, 0x00, 0x1E, 0x3E, 0x00, 0x3C, 0x78,
-  0x00, 0xF8, 0xF0, 0x01, 0xF3, 0xE0, 0x03, 0xE7, 0xC0, 0x07, 0x8F, 0x80,
-  0x1F, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0xF8, 0x7C, 0x01, 0xF0, 0xFC, 0x07,
-  0xC1, 0xFC, 0x3F, 0x81, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xE0,
-  0x03, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x7E,
-  0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFB, 0xE0, 0x1F,
-  0x9E, 0x00, 0xF1, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0,
-  0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
-  0xC0, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-  0x03, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C,
-  0x01, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-  0xFF, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xF0,
-  0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0x07, 0xF0, 0x1F, 0x00,
-  0xFC, 0x0F, 0x80, 0x1F, 0x03, 0xE0, 0x07, 0xC0, 0xF0, 0x01, 0xF0, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF8,
-  0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x70, 0x3F, 0x80, 0x3E, 0x1F,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x1F,
-  0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x0F, 0x81, 0xFC, 0x07,
-  0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0,
-  0x00, 0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-  0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-  0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x3C, 0x01,
-  0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x03, 0xFF,
-  0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-  0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-  0x80, 0x1F, 0xBE, 0x00, 0x7C, 0xF0, 0x03, 0xE7, 0xC0, 0x1F, 0x1F, 0x00,
-  0xF8, 0x7C, 0x07, 0xE1, 0xE0, 0x3F, 0x07, 0x81, 0xF8, 0x3E, 0x07, 0xC0,
-  0xF8, 0x3E, 0x03, 0xC1, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x3F, 0xF8, 0x01,
-  0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x3F,
-  0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03,
-  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0xFF, 0xFE, 0x00,
-  0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x0F, 0x01, 0xFC,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07,
-  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0xF8, 0x3C, 0x03, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF,
-  0xFC, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-  0x01, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x00,
-  0xFF, 0xFE, 0x01, 0xFE, 0x1C, 0x03, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x0F,
-  0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x3E,
-  0xFF, 0x80, 0x7D, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0x7F,
-  0x87, 0xF0, 0xFF, 0x03, 0xF0, 0xFC, 0x01, 0xF0, 0xF8, 0x01, 0xF0, 0xF8,
-  0x01, 0xF0, 0xF8, 0x01, 0xF0, 0xF8, 0x03, 0xE0, 0xF8, 0x03, 0xE0, 0xFC,
-  0x07, 0xC0, 0xFE, 0x0F, 0xC0, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x3F,
-  0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0xFF,
-  0xFF, 0xE7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xE0, 0x07,
-  0xCF, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00,
-  0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01,
-  0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
-  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00,
-  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-  0x00, 0x1F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF,
-  0xE0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0xFC, 0x1F,
-  0xC3, 0xF0, 0x1F, 0x8F, 0xC0, 0x1F, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x7C,
-  0x7C, 0x01, 0xF0, 0xFC, 0x07, 0xE0, 0xFC, 0x1F, 0x81, 0xFF, 0xFE, 0x01,
-  0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0xFE,
-  0x0F, 0xC3, 0xF0, 0x0F, 0xC7, 0xC0, 0x0F, 0x9F, 0x00, 0x1F, 0x3E, 0x00,
-  0x3E, 0x7C, 0x00, 0xFC, 0xFC, 0x03, 0xF1, 0xFC, 0x1F, 0xE3, 0xFF, 0xFF,
-  0x83, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x01, 0xFC, 0x00,
-  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xFC, 0x01, 0xFF,
-  0xFE, 0x03, 0xFF, 0xFE, 0x03, 0xF0, 0x7F, 0x07, 0xE0, 0x3F, 0x07, 0xC0,
-  0x1F, 0x0F, 0xC0, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80,
-  0x3F, 0x0F, 0xC0, 0x7F, 0x0F, 0xE1, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0xFF,
-  0xFE, 0x03, 0xFF, 0xBE, 0x01, 0xFF, 0x7C, 0x00, 0xFC, 0x7C, 0x00, 0x00,
-  0xFC, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-  0xE0, 0x00, 0x1F, 0xC0, 0x38, 0x7F, 0x80, 0x7F, 0xFF, 0x00, 0xFF, 0xFE,
-  0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x07, 0x83,
-  0xF1, 0xFC, 0x7F, 0x1F, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x8F, 0xE3, 0xF8, 0xFC,
-  0x1E, 0x00, 0x00, 0x3C, 0x00, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xC0,
-  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x0F, 0xC0,
-  0x1F, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x38,
-  0x00, 0xF0, 0x01, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-  0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F,
-  0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-  0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0,
-  0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07,
-  0x80, 0x1F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0xFF,
-  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-  0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-  0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x07, 0xFC,
-  0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x80,
-  0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x01, 0xFF,
-  0xE1, 0xFF, 0xFE, 0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE, 0x00,
-  0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F,
-  0xE0, 0x07, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xE0,
-  0x01, 0xF0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-  0x3F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xF0, 0x01,
-  0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x3F, 0x07, 0xE0, 0x7C, 0x07, 0xC1, 0xE0,
-  0x07, 0x87, 0xC0, 0x0F, 0x0F, 0x00, 0x1C, 0x3C, 0x00, 0x78, 0x78, 0x07,
-  0xF1, 0xE0, 0x3F, 0xE3, 0xC1, 0xFF, 0x87, 0x87, 0xFF, 0x0E, 0x1F, 0x9E,
-  0x3C, 0x7C, 0x3C, 0x78, 0xF0, 0x78, 0xF3, 0xC0, 0xE1, 0xC7, 0x83, 0xC3,
-  0x8F, 0x07, 0x8F, 0x1E, 0x0F, 0x1E, 0x3E, 0x1C, 0x3C, 0x7F, 0xFC, 0x78,
-  0x7F, 0xFC, 0xF0, 0x7F, 0xF1, 0xE0, 0x3F, 0xE3, 0xC0, 0x00, 0x07, 0x80,
-  0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0x01,
-  0xC0, 0x7F, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x80,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0,
-  0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-  0x00, 0x7F, 0xF0, 0x00, 0x01, 0xE7, 0xC0, 0x00, 0x0F, 0x9F, 0x00, 0x00,
-  0x7C, 0x7C, 0x00, 0x01, 0xE1, 0xF8, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x7C,
-  0x0F, 0x80, 0x01, 0xF0, 0x3E, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x3F, 0xFF,
-  0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC,
-  0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xC0, 0x07, 0xE0, 0x3E, 0x00, 0x0F, 0x87,
-  0xFF, 0x03, 0xFF, 0xBF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-  0xC1, 0xFF, 0xEF, 0xFE, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x3F,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-  0xFF, 0x80, 0x7C, 0x00, 0xFC, 0x03, 0xE0, 0x03, 0xE0, 0x1E, 0x00, 0x1F,
-  0x01, 0xF0, 0x00, 0xF8, 0x0F, 0x80, 0x0F, 0x80, 0x7C, 0x01, 0xF8, 0x03,
-  0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-  0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x03, 0xC0, 0x0F, 0xF0, 0x3E, 0x00, 0x1F,
-  0x81, 0xF0, 0x00, 0x7C, 0x0F, 0x80, 0x03, 0xE0, 0x78, 0x00, 0x1F, 0x03,
-  0xC0, 0x03, 0xF1, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-  0xFF, 0x87, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xF0,
-  0x00, 0x03, 0xFF, 0xE6, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x03,
-  0xFF, 0xFF, 0xF0, 0x7F, 0x81, 0xFF, 0x0F, 0xE0, 0x07, 0xE1, 0xF8, 0x00,
-  0x3E, 0x1F, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x3C, 0x3E, 0x00, 0x03, 0xC7,
-  0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-  0x00, 0x70, 0x7E, 0x00, 0x1F, 0x07, 0xF8, 0x07, 0xF0, 0x3F, 0xFF, 0xFF,
-  0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF,
-  0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0x00, 0xFE,
-  0x01, 0xF0, 0x07, 0xE0, 0x1E, 0x00, 0x3F, 0x01, 0xE0, 0x01, 0xF0, 0x3E,
-  0x00, 0x1F, 0x03, 0xE0, 0x01, 0xF0, 0x3E, 0x00, 0x1F, 0x03, 0xC0, 0x01,
-  0xF0, 0x7C, 0x00, 0x1F, 0x07, 0xC0, 0x03, 0xF0, 0x7C, 0x00, 0x3E, 0x07,
-  0x80, 0x03, 0xE0, 0x78, 0x00, 0x7E, 0x0F, 0x80, 0x07, 0xC0, 0xF8, 0x00,
-  0xFC, 0x0F, 0x80, 0x1F, 0x80, 0xF0, 0x07, 0xF0, 0x7F, 0xFF, 0xFE, 0x07,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-  0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-  0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0x78, 0x00, 0xF8,
-  0x07, 0xC0, 0x07, 0xC0, 0x3E, 0x00, 0x3E, 0x01, 0xF0, 0xF1, 0xE0, 0x0F,
-  0x0F, 0x8E, 0x00, 0x78, 0x7C, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFE,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00,
-  0x07, 0xC3, 0xC0, 0x00, 0x3E, 0x1E, 0x1E, 0x01, 0xE0, 0xE0, 0xF0, 0x0F,
-  0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7C, 0x07, 0xC0, 0x03, 0xE1, 0xFF, 0xFF,
-  0xFE, 0x1F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF8,
-  0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,
-  0x1F, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x7C, 0x00,
-  0xF0, 0x70, 0xF8, 0x03, 0xE1, 0xF0, 0xE0, 0x07, 0xC3, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF,
-  0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x07, 0x87,
-  0xC0, 0x00, 0x1F, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80,
-  0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x07, 0xF8, 0x60, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0,
-  0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x7F, 0x80, 0xFE, 0x0F, 0xE0,
-  0x03, 0xE0, 0xF8, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00,
-  0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7F, 0xFC, 0xF8, 0x0F, 0xFF,
-  0xEF, 0x80, 0xFF, 0xFE, 0xF8, 0x0F, 0xFF, 0xCF, 0x80, 0x7F, 0xF8, 0xF8,
-  0x00, 0x1F, 0x0F, 0xC0, 0x01, 0xF0, 0xFE, 0x00, 0x1F, 0x07, 0xF8, 0x07,
-  0xE0, 0x7F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x00,
-  0x7F, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x0F,
-  0xFC, 0x7F, 0xF0, 0x7F, 0xF1, 0xFF, 0xC1, 0xFF, 0xC7, 0xFE, 0x03, 0xFE,
-  0x1F, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0x00,
-  0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C,
-  0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00,
-  0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0x80, 0x1F, 0x00, 0x1E,
-  0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
-  0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x07, 0xFE, 0x1F, 0xF8, 0x3F, 0xF8, 0xFF,
-  0xF0, 0xFF, 0xE3, 0xFF, 0xC3, 0xFF, 0x8F, 0xFE, 0x0F, 0xFC, 0x3F, 0xF8,
-  0x00, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFF,
-  0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00,
-  0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x01, 0xFF, 0xFF,
-  0xC1, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF,
-  0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F,
-  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01,
-  0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F,
-  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0x00, 0x0F, 0x80,
-  0x1F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x78, 0x01,
-  0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F,
-  0x80, 0x3F, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF,
-  0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F,
-  0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xFE, 0x0F, 0xFF, 0x8F, 0xFC, 0x1F,
-  0xFF, 0x3F, 0xF8, 0x3F, 0xFE, 0x7F, 0xF0, 0x7F, 0xF8, 0x7F, 0xC0, 0x1F,
-  0x01, 0xFC, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x78, 0x3F, 0x80, 0x01, 0xF0,
-  0xFE, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x07, 0xDF, 0xC0, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFE,
-  0x00, 0x01, 0xFC, 0xFC, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x0F, 0x81, 0xF8,
-  0x00, 0x1F, 0x01, 0xF8, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x78, 0x03, 0xE0,
-  0x00, 0xF0, 0x07, 0xE0, 0x1F, 0xFE, 0x0F, 0xF8, 0x7F, 0xFC, 0x1F, 0xF8,
-  0xFF, 0xF8, 0x1F, 0xF1, 0xFF, 0xF0, 0x3F, 0xE1, 0xFF, 0xC0, 0x7F, 0x80,
-  0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
-  0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x01, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00,
-  0x3E, 0x00, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0xF0, 0x01, 0xE0, 0x3E, 0x00,
-  0x7C, 0x07, 0xC0, 0x0F, 0x80, 0xF8, 0x01, 0xF0, 0x1E, 0x00, 0x7C, 0x07,
-  0xC0, 0x0F, 0x9F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0x9F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-  0xC1, 0xFF, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x07, 0xFC, 0x1F, 0xF0, 0x03,
-  0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xE0,
-  0x3F, 0xE0, 0x0F, 0xF8, 0x1F, 0xF0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0xF7,
-  0xC3, 0xFF, 0x00, 0x7D, 0xF1, 0xF7, 0xC0, 0x1F, 0x7C, 0xFD, 0xF0, 0x07,
-  0xDF, 0xBE, 0x78, 0x01, 0xE3, 0xFF, 0x3E, 0x00, 0x78, 0xFF, 0xCF, 0x80,
-  0x3E, 0x3F, 0xE3, 0xE0, 0x0F, 0x87, 0xF0, 0xF8, 0x03, 0xE1, 0xFC, 0x3C,
-  0x00, 0xF0, 0x7E, 0x1F, 0x00, 0x7C, 0x1F, 0x07, 0xC0, 0x1F, 0x00, 0x01,
-  0xF0, 0x07, 0xC0, 0x00, 0x78, 0x07, 0xFE, 0x01, 0xFF, 0x83, 0xFF, 0xC0,
-  0xFF, 0xF0, 0xFF, 0xF0, 0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xFE, 0x0F, 0xFC,
-  0x03, 0xFF, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0x0F, 0xFC, 0x0F, 0xFF, 0x0F,
-  0xFC, 0x0F, 0xFF, 0x0F, 0xFC, 0x0F, 0xFF, 0x0F, 0xFE, 0x0F, 0xFE, 0x01,
-  0xFE, 0x00, 0xF8, 0x01, 0xFF, 0x00, 0xF0, 0x01, 0xFF, 0x01, 0xF0, 0x03,
-  0xFF, 0x81, 0xF0, 0x03, 0xFF, 0x81, 0xF0, 0x03, 0xEF, 0xC1, 0xF0, 0x03,
-  0xCF, 0xC1, 0xE0, 0x07, 0xC7, 0xE3, 0xE0, 0x07, 0xC7, 0xE3, 0xE0, 0x07,
-  0xC3, 0xF3, 0xE0, 0x07, 0xC3, 0xF3, 0xC0, 0x07, 0x81, 0xF7, 0xC0, 0x0F,
-  0x81, 0xFF, 0xC0, 0x0F, 0x80, 0xFF, 0xC0, 0x0F, 0x80, 0xFF, 0xC0, 0x0F,
-  0x00, 0xFF, 0x80, 0x0F, 0x00, 0x7F, 0x80, 0x7F, 0xF0, 0x7F, 0x80, 0xFF,
-  0xF0, 0x3F, 0x80, 0xFF, 0xF0, 0x3F, 0x00, 0xFF, 0xF0, 0x1F, 0x00, 0x7F,
-  0xE0, 0x1F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF,
-  0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x0F, 0xF0, 0x7F, 0x83,
-  0xF8, 0x03, 0xF0, 0xFC, 0x00, 0x7E, 0x1F, 0x00, 0x07, 0xE7, 0xE0, 0x00,
-  0x7C, 0xF8, 0x00, 0x0F, 0xBE, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x3E, 0xF0,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3E, 0xF8, 0x00, 0x07,
-  0xDF, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x3E, 0x7C, 0x00, 0x0F, 0xCF, 0xC0,
-  0x01, 0xF0, 0xF8, 0x00, 0x7E, 0x1F, 0x80, 0x3F, 0x83, 0xFC, 0x1F, 0xE0,
-  0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF,
-  0x80, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8,
-  0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0F,
-  0x80, 0x7F, 0x00, 0xF8, 0x01, 0xF0, 0x0F, 0x00, 0x1F, 0x01, 0xF0, 0x01,
-  0xF0, 0x1F, 0x00, 0x1F, 0x01, 0xF0, 0x03, 0xE0, 0x1E, 0x00, 0x7E, 0x01,
-  0xE0, 0x0F, 0xC0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-  0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0x00,
-  0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0xFF,
-  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-  0x7F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x03,
-  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x0F, 0xF0, 0x7F,
-  0x83, 0xF8, 0x03, 0xF0, 0xFC, 0x00, 0x3F, 0x1F, 0x00, 0x07, 0xE7, 0xC0,
-  0x00, 0x7D, 0xF8, 0x00, 0x0F, 0xBE, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x3F,
-  0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3E, 0xF8, 0x00,
-  0x07, 0xDF, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x3E, 0x7E, 0x00, 0x0F, 0x8F,
-  0xC0, 0x03, 0xF0, 0xFC, 0x01, 0xFC, 0x1F, 0xE0, 0xFF, 0x01, 0xFF, 0xFF,
-  0xC0, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0xF8, 0x38, 0x0F, 0xFF, 0xFF,
-  0x81, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0xF0,
-  0x1F, 0x80, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF,
-  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7C, 0x03,
-  0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x1E, 0x00, 0x3E, 0x00, 0xF0, 0x01, 0xF0,
-  0x0F, 0x80, 0x1F, 0x80, 0x7C, 0x01, 0xF8, 0x03, 0xE0, 0x3F, 0x80, 0x1F,
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1E, 0x07, 0xF0, 0x01, 0xF0, 0x1F, 0xC0,
-  0x0F, 0x80, 0x7E, 0x00, 0x7C, 0x03, 0xF8, 0x03, 0xC0, 0x0F, 0xC0, 0xFF,
-  0xE0, 0x7F, 0xCF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0,
-  0x3F, 0xDF, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xE1, 0x80, 0x0F, 0xFF, 0xF0,
-  0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC1, 0xFC, 0x0F,
-  0xE0, 0x7C, 0x01, 0xF8, 0x3E, 0x00, 0x3E, 0x0F, 0x80, 0x0F, 0x03, 0xE0,
-  0x03, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x01,
-  0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0xF8, 0xF8, 0x00,
-  0x3E, 0x3E, 0x00, 0x1F, 0x8F, 0xC0, 0x0F, 0xC3, 0xFC, 0x0F, 0xF0, 0xFF,
-  0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x03, 0x9F, 0xFE, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0x07, 0x83, 0xE7,
-  0x83, 0xE0, 0xFB, 0xE0, 0xF8, 0x3E, 0xF8, 0x3E, 0x0F, 0x3E, 0x0F, 0x07,
-  0xCF, 0x07, 0xC1, 0xF3, 0x81, 0xF0, 0x38, 0x00, 0x7C, 0x00, 0x00, 0x1E,
-  0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-  0x3E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-  0x00, 0x7C, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-  0x80, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x7F, 0xE7,
-  0xFF, 0x8F, 0xFF, 0x7F, 0xF9, 0xFF, 0xF7, 0xFF, 0x1F, 0xFE, 0x7F, 0xF0,
-  0xFF, 0xC1, 0xE0, 0x01, 0xF0, 0x1E, 0x00, 0x1F, 0x03, 0xE0, 0x01, 0xF0,
-  0x3E, 0x00, 0x1F, 0x03, 0xE0, 0x01, 0xE0, 0x3C, 0x00, 0x3E, 0x07, 0xC0,
-  0x03, 0xE0, 0x7C, 0x00, 0x3E, 0x07, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C,
-  0x07, 0x80, 0x07, 0xC0, 0xF8, 0x00, 0x7C, 0x0F, 0x80, 0x07, 0xC0, 0xF8,
-  0x00, 0x78, 0x0F, 0x80, 0x0F, 0x80, 0xFC, 0x01, 0xF8, 0x0F, 0xC0, 0x3F,
-  0x00, 0xFF, 0x07, 0xE0, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x03,
-  0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0xF0,
-  0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F,
-  0xFF, 0x7F, 0xE0, 0x3F, 0xF8, 0x7C, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0xF8,
-  0x07, 0xC0, 0x03, 0xE0, 0x1F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0xF8, 0x00,
-  0xF8, 0x03, 0xE0, 0x03, 0xE0, 0x1F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x1F,
-  0x03, 0xE0, 0x00, 0x7C, 0x1F, 0x00, 0x01, 0xF0, 0xFC, 0x00, 0x07, 0xC3,
-  0xE0, 0x00, 0x1F, 0x9F, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0xFB, 0xE0,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-  0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-  0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0x1E, 0x00,
-  0x01, 0xE0, 0xF0, 0x7C, 0x1F, 0x0F, 0x87, 0xE0, 0xF0, 0x7C, 0x3F, 0x0F,
-  0x83, 0xE3, 0xF8, 0x7C, 0x1F, 0x1F, 0xE3, 0xC0, 0xF9, 0xFF, 0x3E, 0x07,
-  0xCF, 0xF9, 0xF0, 0x3E, 0xFF, 0xCF, 0x01, 0xF7, 0xBE, 0xF8, 0x0F, 0xFD,
-  0xF7, 0xC0, 0x7B, 0xCF, 0xFC, 0x03, 0xFE, 0x7F, 0xE0, 0x3F, 0xE3, 0xFF,
-  0x01, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0x7F, 0x80, 0x7F, 0x83, 0xFC, 0x03,
-  0xF8, 0x1F, 0xC0, 0x1F, 0xC0, 0xFE, 0x00, 0xFC, 0x07, 0xF0, 0x07, 0xE0,
-  0x3F, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0x03, 0xFF,
-  0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFE, 0x07, 0xFE, 0x03, 0xFC,
-  0x03, 0xFC, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x7E,
-  0x1F, 0xC0, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
-  0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07,
-  0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F,
-  0xF8, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x03, 0xF0,
-  0x7E, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x7F, 0xE0,
-  0x7F, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
-  0xFF, 0xE0, 0x7F, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xFF, 0xF0, 0x3F,
-  0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0x7F, 0x80, 0xFF, 0x87, 0xC0,
-  0x1F, 0x01, 0xF8, 0x0F, 0x80, 0x3E, 0x07, 0xC0, 0x0F, 0xC3, 0xE0, 0x01,
-  0xF1, 0xF0, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01,
-  0xE0, 0x00, 0x00, 0x78, 0x00, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x00,
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-  0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0,
-  0x3F, 0xFF, 0xFC, 0x07, 0xC0, 0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x1F, 0x03,
-  0xF0, 0x03, 0xC0, 0xFC, 0x00, 0xF8, 0x3F, 0x00, 0x0E, 0x0F, 0xC0, 0x00,
-  0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-  0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0E, 0x00, 0x7E, 0x03, 0xE0, 0x1F,
-  0x80, 0x7C, 0x07, 0xE0, 0x0F, 0x01, 0xF8, 0x03, 0xE0, 0x7E, 0x00, 0x7C,
-  0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x0F, 0xFF,
-  0xFF, 0x81, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F,
-  0xFC, 0x07, 0xFF, 0x01, 0xFF, 0x80, 0x7C, 0x00, 0x1E, 0x00, 0x07, 0x80,
-  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01,
-  0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-  0x00, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-  0x1F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
-  0x80, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
-  0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x20, 0x03, 0xC0, 0x3E, 0x01, 0xF0,
-  0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x3E, 0x01, 0xF0, 0x0F, 0x80,
-  0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x03,
-  0xE0, 0x1F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0x7C, 0x03, 0xE0, 0x1F,
-  0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x00, 0xF8,
-  0x07, 0xC0, 0x3E, 0x00, 0xF0, 0x07, 0x80, 0x38, 0x00, 0xFF, 0xC0, 0x7F,
-  0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0xF0,
-  0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00,
-  0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F,
-  0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01,
-  0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x7F, 0xE0, 0x3F, 0xF8,
-  0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x01,
-  0xC0, 0x00, 0x3C, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x03,
-  0xFF, 0x80, 0xFF, 0xF8, 0x1F, 0xCF, 0xC3, 0xF8, 0xFE, 0x7E, 0x07, 0xEF,
-  0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0xE0, 0x7F, 0xFF,
-  0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xEF, 0xFF, 0xFF, 0xFF, 0x00, 0x60, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F,
-  0x06, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x07, 0xFF,
-  0xFE, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00,
-  0x3E, 0x00, 0x7F, 0xFE, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF,
-  0xFC, 0x3F, 0xFF, 0xFC, 0x7F, 0x00, 0x78, 0x7C, 0x00, 0x78, 0xF8, 0x00,
-  0xF8, 0xF8, 0x03, 0xF8, 0xFC, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-  0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFD, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x3F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x00, 0xF0, 0xFE, 0x00, 0x0F, 0xBF, 0xFC, 0x00, 0x7F,
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0x03,
-  0xF8, 0x0F, 0xE0, 0x07, 0xE0, 0x7E, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xF8,
-  0x1F, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x01, 0xF0, 0x7C,
-  0x00, 0x1F, 0x03, 0xE0, 0x00, 0xF8, 0x1F, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-  0x7C, 0x0F, 0xE0, 0x07, 0xE3, 0xFF, 0xC0, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1,
-  0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0x9F, 0xFC, 0x00, 0x00,
-  0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE3, 0x80, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0x01, 0xFC, 0x7E, 0x00,
-  0x7C, 0x7E, 0x00, 0x3E, 0x3E, 0x00, 0x0E, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0,
-  0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0C, 0x7F, 0x80, 0x3F, 0x1F,
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3E,
-  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0x87, 0xC0, 0x0F,
-  0xFF, 0x7C, 0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-  0x81, 0xFC, 0x0F, 0xF8, 0x3F, 0x00, 0x3F, 0x83, 0xE0, 0x01, 0xF0, 0x7C,
-  0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF0, 0xF8, 0x00, 0x1F, 0x0F, 0x80, 0x01,
-  0xF0, 0xF8, 0x00, 0x1E, 0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00, 0x3E, 0x0F,
-  0xC0, 0x07, 0xE0, 0xFC, 0x00, 0xFE, 0x07, 0xF0, 0x3F, 0xF8, 0x7F, 0xFF,
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xE7, 0xF8,
-  0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-  0xF8, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x1F, 0xE0, 0x7E, 0x3F, 0x80,
-  0x1F, 0x3F, 0x00, 0x0F, 0x7E, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x1C, 0x7F, 0x01, 0xFE, 0x7F, 0xFF,
-  0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
-  0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xF0,
-  0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-  0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xE0, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-  0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00,
-  0x00, 0x03, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0F,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-  0x80, 0x00, 0x0F, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-  0x0F, 0xFF, 0xFF, 0xF1, 0xFC, 0x1F, 0xFE, 0x3F, 0x80, 0x7F, 0x03, 0xE0,
-  0x03, 0xF0, 0x7E, 0x00, 0x3E, 0x07, 0xC0, 0x03, 0xE0, 0xF8, 0x00, 0x3E,
-  0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00, 0x3E, 0x0F, 0x80, 0x03, 0xC0, 0xF8,
-  0x00, 0x7C, 0x0F, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x7F,
-  0x80, 0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00,
-  0xFF, 0xEF, 0x80, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-  0xF0, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00,
-  0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03,
-  0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
-  0x07, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0,
-  0x00, 0x01, 0xF1, 0xF8, 0x00, 0x79, 0xFF, 0x80, 0x1E, 0xFF, 0xF0, 0x0F,
-  0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0x07, 0xE0, 0x3F, 0x00, 0xF8,
-  0x1F, 0x80, 0x3E, 0x07, 0xC0, 0x0F, 0x81, 0xF0, 0x03, 0xC0, 0x7C, 0x00,
-  0xF0, 0x1E, 0x00, 0x7C, 0x0F, 0x80, 0x1F, 0x03, 0xE0, 0x07, 0xC0, 0xF8,
-  0x01, 0xE0, 0x3C, 0x00, 0xF8, 0x0F, 0x00, 0x3E, 0x1F, 0xF8, 0x3F, 0xEF,
-  0xFE, 0x1F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0x3F,
-  0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3E,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00,
-  0x3F, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
-  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x01,
-  0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x3F, 0xFF,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07,
-  0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0,
-  0x3F, 0xFF, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00,
-  0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x01,
-  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3E,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0,
-  0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x0F,
-  0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-  0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x3F, 0xF0,
-  0x1F, 0x1F, 0xFC, 0x07, 0xC7, 0xFF, 0x01, 0xF1, 0xFF, 0xC0, 0x78, 0x7F,
-  0xE0, 0x1E, 0x7F, 0x80, 0x0F, 0xBF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x01,
-  0xF7, 0xF0, 0x00, 0x7C, 0xFE, 0x00, 0x1E, 0x1F, 0xC0, 0x0F, 0x83, 0xF8,
-  0x1F, 0xE0, 0xFF, 0xEF, 0xF8, 0x3F, 0xFB, 0xFE, 0x1F, 0xFE, 0xFF, 0x07,
-  0xFF, 0x9F, 0xC0, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x03,
-  0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00,
-  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0,
-  0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x81, 0xE0,
-  0x3F, 0xBF, 0x9F, 0xE1, 0xFF, 0xFE, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x1F,
-  0xFF, 0xFF, 0xFC, 0x7F, 0xC7, 0xF1, 0xF0, 0x7E, 0x1F, 0x87, 0xC1, 0xF0,
-  0x7C, 0x1F, 0x07, 0x81, 0xE0, 0x7C, 0x1E, 0x0F, 0x81, 0xE0, 0xF8, 0x3E,
-  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3C, 0x0F, 0x03,
-  0xC1, 0xF0, 0x7C, 0x0F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF1,
-  0xFE, 0x1F, 0x87, 0xEF, 0xFC, 0x7F, 0x1F, 0xFF, 0xF3, 0xFC, 0x7F, 0xFF,
-  0xCF, 0xF3, 0xFF, 0xFE, 0x3F, 0x8F, 0xE0, 0x00, 0x01, 0xF8, 0x01, 0xF9,
-  0xFF, 0x80, 0xFE, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x83,
-  0xFF, 0x07, 0xE0, 0x3F, 0x00, 0xF8, 0x1F, 0x80, 0x3E, 0x07, 0xC0, 0x0F,
-  0x81, 0xF0, 0x03, 0xC0, 0x7C, 0x00, 0xF0, 0x1E, 0x00, 0x7C, 0x0F, 0x80,
-  0x1F, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x01, 0xE0, 0x3C, 0x00, 0xF8, 0x0F,
-  0x00, 0x3E, 0x1F, 0xF8, 0x3F, 0xEF, 0xFE, 0x1F, 0xFF, 0xFF, 0x87, 0xFF,
-  0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-  0xFC, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF,
-  0x03, 0xF8, 0xFE, 0x00, 0xFE, 0x7C, 0x00, 0x3F, 0x7C, 0x00, 0x0F, 0xBE,
-  0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF,
-  0xC0, 0x00, 0xFB, 0xE0, 0x00, 0xFD, 0xF8, 0x00, 0x7C, 0xFE, 0x00, 0xFE,
-  0x3F, 0x81, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFC,
-  0x00, 0x7F, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07,
-  0xF9, 0xFF, 0xC0, 0x1F, 0xF7, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F,
-  0xFF, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F, 0x80, 0x3F, 0x80, 0x1F, 0x80, 0x7E,
-  0x00, 0x3F, 0x00, 0xF8, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7C, 0x03, 0xC0,
-  0x00, 0xF8, 0x0F, 0x80, 0x01, 0xF0, 0x1F, 0x00, 0x07, 0xE0, 0x3E, 0x00,
-  0x0F, 0x80, 0x7C, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0xFC, 0x03, 0xFE, 0x07,
-  0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x1E, 0xFF, 0xFC,
-  0x00, 0x7C, 0xFF, 0xF0, 0x00, 0xF8, 0x7F, 0x00, 0x01, 0xF0, 0x00, 0x00,
-  0x03, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F,
-  0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x07, 0xFF, 0x3F, 0xC0, 0xFF, 0xFD, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF,
-  0xFF, 0xFF, 0x8F, 0xE0, 0x7F, 0xF8, 0xFC, 0x00, 0xFE, 0x07, 0xC0, 0x03,
-  0xE0, 0x7C, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0xF8, 0x1E, 0x00, 0x07, 0xC1,
-  0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x01, 0xE0, 0x7C, 0x00, 0x1F, 0x03, 0xF0,
-  0x01, 0xF8, 0x1F, 0x80, 0x1F, 0xC0, 0xFF, 0x03, 0xFC, 0x03, 0xFF, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xE7, 0xC0,
-  0x01, 0xFC, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F,
-  0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xF0,
-  0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xC3, 0xFE, 0x07, 0xFC, 0xFF, 0xE0,
-  0x7F, 0xDF, 0xFF, 0x07, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x1C, 0x00, 0x7F,
-  0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00,
-  0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xCE, 0x03, 0xFF, 0xFC,
-  0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xF8, 0x0F, 0x87,
-  0xC0, 0x0E, 0x0F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x3F,
-  0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00,
-  0x3F, 0x1C, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0xFC, 0x03, 0xF3, 0xFF, 0xFF,
-  0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
-  0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-  0x80, 0x00, 0x78, 0x00, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00,
-  0x1E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00,
-  0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7E, 0x00, 0xF7, 0xFF,
-  0xFF, 0x7F, 0xFF, 0xF3, 0xFF, 0xFE, 0x1F, 0xFF, 0x80, 0x7F, 0x80, 0x7F,
-  0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0,
-  0x3F, 0xC7, 0xC0, 0x07, 0x8F, 0x80, 0x1F, 0x3E, 0x00, 0x3E, 0x7C, 0x00,
-  0x7C, 0xF8, 0x00, 0xF1, 0xF0, 0x03, 0xE3, 0xE0, 0x07, 0xC7, 0xC0, 0x0F,
-  0x8F, 0x80, 0x1F, 0x1F, 0x00, 0x7C, 0x3E, 0x01, 0xF8, 0x7E, 0x0F, 0xFC,
-  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xEF, 0xE1, 0xFF, 0xBF, 0x80,
-  0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0,
-  0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xE1, 0xF8, 0x03, 0xE0,
-  0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x0F, 0x80, 0xF8, 0x00, 0xFC,
-  0x1F, 0x80, 0x07, 0xC1, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x07, 0xE7, 0xE0,
-  0x00, 0x3E, 0x7C, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xEF, 0xFC, 0x03, 0xFF,
-  0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x07, 0xFE, 0x7F, 0x80, 0x3F, 0xC3, 0xE1,
-  0xF0, 0xF8, 0x3E, 0x3F, 0x0F, 0x03, 0xE3, 0xF1, 0xF0, 0x3E, 0x7F, 0x1E,
-  0x03, 0xE7, 0xF3, 0xE0, 0x3E, 0xFF, 0xBC, 0x03, 0xFF, 0xFF, 0xC0, 0x3F,
-  0xFF, 0xFC, 0x03, 0xFE, 0xFF, 0x80, 0x3F, 0xEF, 0xF8, 0x03, 0xFC, 0xFF,
-  0x00, 0x3F, 0x8F, 0xF0, 0x03, 0xF8, 0x7E, 0x00, 0x3F, 0x07, 0xE0, 0x01,
-  0xF0, 0x7C, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x3F,
-  0xF0, 0xFF, 0xC1, 0xFF, 0x8F, 0xFE, 0x0F, 0xFC, 0x7F, 0xF0, 0x7F, 0xC1,
-  0xFF, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF9, 0xFC, 0x00, 0x0F, 0xFF, 0xC0,
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFE, 0xFE, 0x00, 0x0F, 0xE3,
-  0xF8, 0x00, 0xFE, 0x0F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC3, 0xFF, 0x87, 0xFF,
-  0x3F, 0xFC, 0x7F, 0xF9, 0xFF, 0xE3, 0xFF, 0x87, 0xFE, 0x0F, 0xF8, 0x00,
-  0x01, 0xFE, 0x03, 0xFE, 0x03, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF,
-  0x07, 0xFF, 0x07, 0xFE, 0x03, 0xFC, 0x03, 0xFC, 0x01, 0xF8, 0x01, 0xF0,
-  0x00, 0xF8, 0x03, 0xF0, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0xFC, 0x07, 0xC0,
-  0x00, 0x7C, 0x0F, 0x80, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x7E, 0x1F, 0x00,
-  0x00, 0x7E, 0x3E, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x3E, 0x7C, 0x00,
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-  0x07, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xE0, 0x7C, 0x0F, 0xE0, 0x3C, 0x0F, 0xE0, 0x1E, 0x0F,
-  0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
-  0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0xF0, 0x3F,
-  0x00, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x0F,
-  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x1F,
-  0xE0, 0x1F, 0xF0, 0x0F, 0xE0, 0x0F, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x03,
-  0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3E, 0x00,
-  0x1F, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xC0,
-  0x0F, 0xE0, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F,
-  0x80, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00,
-  0x7E, 0x00, 0x3F, 0x80, 0x1F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x78,
-  0x00, 0x01, 0xE0, 0x3C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0x80, 0xF0, 0x3E,
-  0x07, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0x1F, 0x03, 0xC0, 0x78, 0x0F,
-  0x03, 0xE0, 0x7C, 0x0F, 0x01, 0xE0, 0x3C, 0x0F, 0x81, 0xF0, 0x3C, 0x07,
-  0x80, 0xF0, 0x3E, 0x07, 0xC0, 0xF0, 0x1E, 0x07, 0xC0, 0xF8, 0x1F, 0x03,
-  0xC0, 0x70, 0x00, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x3F, 0xC0,
-  0x0F, 0xE0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F,
-  0x00, 0x0F, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00,
-  0xF8, 0x00, 0x7E, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xF8,
-  0x07, 0xF8, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78,
-  0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x7F,
-  0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x07, 0x80, 0x00, 0x03, 0xE0,
-  0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE0, 0x39, 0xFF, 0xE0, 0xF7, 0xFF, 0xE7,
-  0xFF, 0xCF, 0xFF, 0xFE, 0x0F, 0xFF, 0x38, 0x0F, 0xFC, 0x00, 0x0F, 0xE0,
-  0x00, 0x0F, 0x80 };
+  0x74, 0x76, 0x57, 0x48, 0x48, 0x48, 0x47, 0x57, 0x57, 0x57, 0x56, 0x66,
+  0x57, 0x56, 0x66, 0x66, 0x66, 0x65, 0x75, 0x75, 0x74, 0x91, 0xFF, 0xF0,
+  0x47, 0x65, 0x75, 0x75, 0x67, 0x47, 0x16, 0x46, 0x16, 0x46, 0x16, 0x45,
+  0x25, 0x55, 0x25, 0x55, 0x25, 0x54, 0x34, 0x55, 0x34, 0x55, 0x34, 0x54,
+  0x43, 0x64, 0x43, 0x64, 0x43, 0x63, 0x43, 0x73, 0x52, 0x72, 0x50, 0xB3,
+  0x53, 0xC5, 0x35, 0xB5, 0x35, 0xB4, 0x44, 0xB5, 0x35, 0xB5, 0x35, 0xB5,
+  0x35, 0xA5, 0x35, 0xB5, 0x35, 0xB5, 0x35, 0x7F, 0x53, 0xF6, 0x3F, 0x63,
+  0xF6, 0x3F, 0x57, 0x53, 0x5B, 0x53, 0x5B, 0x44, 0x4B, 0x53, 0x57, 0xF5,
+  0x3F, 0x72, 0xF7, 0x2F, 0x63, 0xF5, 0x84, 0x44, 0xB5, 0x35, 0xB5, 0x35,
+  0xB5, 0x35, 0xA5, 0x44, 0xB5, 0x35, 0xB5, 0x35, 0xB4, 0x44, 0xB5, 0x35,
+  0xC3, 0x53, 0xB0, 0xF1, 0x3F, 0x64, 0xF5, 0x5F, 0x55, 0xF3, 0x8F, 0x0F,
+  0x08, 0xF2, 0x7F, 0x37, 0xF3, 0x67, 0x57, 0x56, 0x94, 0x65, 0xA4, 0x65,
+  0xB1, 0x86, 0xF4, 0x9F, 0x1D, 0xDF, 0x0B, 0xF0, 0xDC, 0xF2, 0x9F, 0x46,
+  0x53, 0xC5, 0x44, 0xC5, 0x35, 0xB6, 0x36, 0x96, 0x47, 0x68, 0x4F, 0x55,
+  0xF4, 0x5F, 0x47, 0xF1, 0xF0, 0x7F, 0x45, 0xF5, 0x4F, 0x64, 0xF5, 0x5F,
+  0x55, 0xF5, 0x4F, 0x63, 0xF0, 0x85, 0xF0, 0x9C, 0xAB, 0x44, 0x4A, 0x36,
+  0x39, 0x37, 0x39, 0x37, 0x39, 0x37, 0x39, 0x36, 0x3A, 0x44, 0x4B, 0xAC,
+  0x94, 0x56, 0x53, 0x8B, 0x9A, 0x99, 0xA9, 0x9C, 0x74, 0x56, 0x45, 0x9C,
+  0xAB, 0x44, 0x4A, 0x36, 0x39, 0x37, 0x39, 0x37, 0x39, 0x37, 0x39, 0x36,
+  0x3A, 0x44, 0x4B, 0xAC, 0x9F, 0x05, 0x80, 0xB5, 0xF0, 0xA9, 0xC8, 0xD8,
+  0xC8, 0x53, 0x48, 0x55, 0x1A, 0x5F, 0x15, 0xF1, 0x5F, 0x16, 0xF0, 0x6F,
+  0x16, 0xD8, 0xCA, 0x35, 0x2B, 0x26, 0x16, 0x1D, 0x15, 0x2C, 0x24, 0x49,
+  0x35, 0x49, 0x35, 0x57, 0x45, 0x57, 0x46, 0x49, 0x2F, 0x43, 0xF3, 0x3F,
+  0x34, 0xA1, 0x57, 0x6B, 0x16, 0x16, 0x15, 0x25, 0x25, 0x24, 0x25, 0x25,
+  0x24, 0x34, 0x34, 0x33, 0x43, 0x42, 0x50, 0xB2, 0xB4, 0x95, 0x86, 0x76,
+  0x85, 0x85, 0x86, 0x85, 0x85, 0x95, 0x85, 0x95, 0x85, 0x95, 0x85, 0x95,
+  0x95, 0x95, 0x85, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96,
+  0x95, 0x95, 0x96, 0x86, 0x96, 0x86, 0x95, 0x94, 0x70, 0x82, 0xB4, 0x96,
+  0x86, 0x86, 0x96, 0x86, 0x95, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x85, 0x95, 0x95, 0x85, 0x95, 0x95, 0x85, 0x95,
+  0x85, 0x86, 0x85, 0x85, 0x86, 0x85, 0x85, 0x85, 0x95, 0x94, 0xA0, 0xA4,
+  0xF2, 0x4F, 0x15, 0xF1, 0x5F, 0x15, 0xA1, 0x54, 0x61, 0x26, 0x24, 0x2F,
+  0xFF, 0x31, 0xF4, 0x4E, 0xA8, 0xC9, 0xBB, 0x9C, 0x86, 0x26, 0x75, 0x36,
+  0x74, 0x55, 0x73, 0x64, 0x60, 0xD3, 0xF5, 0x5F, 0x44, 0xF5, 0x4F, 0x45,
+  0xF4, 0x5F, 0x45, 0xF4, 0x4F, 0x45, 0xF4, 0x5A, 0xFF, 0xFF, 0xFF, 0xFD,
+  0xA5, 0xF4, 0x4F, 0x54, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x44, 0xF5, 0x4F,
+  0x45, 0xF4, 0x5F, 0x53, 0xD0, 0x66, 0x56, 0x65, 0x66, 0x65, 0x65, 0x74,
+  0x75, 0x74, 0x74, 0x84, 0x74, 0x83, 0x92, 0xA0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xD1, 0x24, 0x2F, 0xB2, 0x42, 0xFA, 0x2F, 0xA4, 0xF8, 0x5F, 0x75, 0xF8,
+  0x5F, 0x75, 0xF7, 0x5F, 0x85, 0xF7, 0x5F, 0x75, 0xF8, 0x5F, 0x75, 0xF7,
+  0x5F, 0x76, 0xF7, 0x5F, 0x75, 0xF7, 0x6F, 0x75, 0xF7, 0x5F, 0x76, 0xF7,
+  0x5F, 0x75, 0xF7, 0x5F, 0x85, 0xF7, 0x5F, 0x75, 0xF8, 0x5F, 0x75, 0xF7,
+  0x5F, 0x76, 0xF7, 0x5F, 0x75, 0xF7, 0x6F, 0x75, 0xF7, 0x5F, 0x85, 0xF7,
+  0x5F, 0x93, 0xF9, 0xC6, 0xEB, 0xBD, 0x8F, 0x16, 0xF2, 0x66, 0x56, 0x56,
+  0x76, 0x36, 0x95, 0x35, 0xA5, 0x25, 0xB5, 0x25, 0xB5, 0x25, 0xB5, 0x24,
+  0xB5, 0x25, 0xB5, 0x25, 0xB4, 0x35, 0xB4, 0x34, 0xB5, 0x34, 0xB5, 0x25,
+  0xB5, 0x25, 0xB4, 0x35, 0xA5, 0x35, 0xA5, 0x35, 0x95, 0x45, 0x95, 0x46,
+  0x75, 0x57, 0x47, 0x6F, 0x17, 0xF0, 0x9D, 0xBA, 0xF0, 0x6C, 0xD6, 0xE6,
+  0xD8, 0xBA, 0xAB, 0x87, 0x15, 0x86, 0x24, 0x94, 0x35, 0xF1, 0x5F, 0x15,
+  0xF1, 0x5F, 0x14, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x14, 0xF2, 0x4F, 0x15,
+  0xF1, 0x5F, 0x15, 0xF1, 0x4F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x59, 0xF3,
+  0x2F, 0xFF, 0xF1, 0x2F, 0x32, 0xE7, 0xF2, 0xBD, 0xEB, 0xF1, 0x9F, 0x28,
+  0x75, 0x77, 0x58, 0x66, 0x5A, 0x56, 0x5A, 0x56, 0x4B, 0x5F, 0x55, 0xF6,
+  0x5F, 0x55, 0xF4, 0x7F, 0x37, 0xF3, 0x7F, 0x28, 0xF2, 0x7F, 0x28, 0xF2,
+  0x8F, 0x18, 0xF2, 0x8F, 0x18, 0xF2, 0x88, 0x36, 0x79, 0x54, 0xF6, 0x5F,
+  0x65, 0xF6, 0x4F, 0x74, 0xF7, 0x40, 0xD8, 0xF0, 0xBC, 0xEA, 0xF1, 0x8F,
+  0x37, 0x56, 0x77, 0x3A, 0x5F, 0x55, 0xF5, 0x5F, 0x46, 0xF4, 0x5F, 0x36,
+  0xDB, 0xDB, 0xE9, 0xF1, 0xAF, 0x1A, 0xF4, 0x7F, 0x56, 0xF5, 0x5F, 0x55,
+  0xF5, 0x5F, 0x55, 0xF4, 0x5F, 0x46, 0x44, 0x97, 0x4F, 0x55, 0xF4, 0x6F,
+  0x38, 0xF1, 0xCA, 0xB0, 0xF1, 0x6F, 0x07, 0xE8, 0xD8, 0xD9, 0xCA, 0xBB,
+  0xA6, 0x15, 0xA5, 0x24, 0xA5, 0x25, 0x95, 0x35, 0x85, 0x45, 0x76, 0x44,
+  0x76, 0x54, 0x66, 0x55, 0x65, 0x65, 0x55, 0x74, 0x5F, 0x42, 0xF6, 0x1F,
+  0x61, 0xF5, 0x2F, 0x4F, 0x05, 0xDB, 0xAC, 0xAC, 0xAC, 0xAB, 0x40, 0x7F,
+  0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x7F, 0x28, 0x5F, 0x55, 0xF5, 0x5F, 0x54,
+  0xF5, 0x5F, 0x55, 0x17, 0xCF, 0x0A, 0xF1, 0x9F, 0x28, 0xF2, 0x84, 0x77,
+  0xF4, 0x6F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF4, 0x5F, 0x55,
+  0xF4, 0x55, 0x48, 0x84, 0xF5, 0x5F, 0x46, 0xF3, 0x8F, 0x0D, 0x9C, 0xF0,
+  0x7F, 0x0A, 0xCD, 0x9F, 0x08, 0xF0, 0x88, 0x43, 0x87, 0xF1, 0x6F, 0x26,
+  0xF2, 0x6F, 0x35, 0xF3, 0x53, 0x5B, 0x51, 0x98, 0x51, 0xB7, 0xF3, 0x6F,
+  0x36, 0x84, 0x74, 0x86, 0x64, 0x69, 0x54, 0x5A, 0x54, 0x5A, 0x54, 0x5A,
+  0x54, 0x59, 0x55, 0x59, 0x55, 0x67, 0x56, 0x75, 0x67, 0xF1, 0x8F, 0x0A,
+  0xDC, 0xBF, 0x07, 0xC0, 0x1F, 0x61, 0xF5, 0x2F, 0x51, 0xF6, 0x1F, 0x61,
+  0x5A, 0x52, 0x4B, 0x5F, 0x15, 0xF2, 0x5F, 0x15, 0xF2, 0x5F, 0x15, 0xF2,
+  0x5F, 0x15, 0xF2, 0x4F, 0x25, 0xF1, 0x5F, 0x25, 0xF1, 0x5F, 0x25, 0xF1,
+  0x5F, 0x25, 0xF1, 0x5F, 0x25, 0xF1, 0x5F, 0x25, 0xF1, 0x5F, 0x25, 0xF1,
+  0x5F, 0x33, 0xF0, 0xB7, 0xEB, 0xAE, 0x8F, 0x16, 0xF2, 0x66, 0x57, 0x46,
+  0x76, 0x36, 0x95, 0x35, 0xA5, 0x35, 0xA5, 0x35, 0x95, 0x46, 0x76, 0x56,
+  0x56, 0x6F, 0x18, 0xDB, 0xC9, 0xF0, 0x7F, 0x25, 0x75, 0x64, 0x68, 0x63,
+  0x5A, 0x52, 0x5B, 0x52, 0x5B, 0x52, 0x5A, 0x62, 0x68, 0x63, 0x75, 0x83,
+  0xF4, 0x5F, 0x27, 0xF0, 0x9C, 0xD7, 0xB0, 0xC7, 0xF0, 0xBB, 0xE9, 0xF1,
+  0x7F, 0x27, 0x65, 0x75, 0x67, 0x65, 0x59, 0x54, 0x69, 0x54, 0x5A, 0x54,
+  0x5A, 0x54, 0x59, 0x64, 0x67, 0x74, 0x74, 0x95, 0xF3, 0x6F, 0x37, 0xB1,
+  0x58, 0x91, 0x5A, 0x63, 0x5F, 0x36, 0xF2, 0x6F, 0x36, 0xF2, 0x6F, 0x17,
+  0xF1, 0x78, 0x34, 0x88, 0xF0, 0x8F, 0x09, 0xDC, 0xAF, 0x07, 0xF0, 0x54,
+  0x56, 0x37, 0x37, 0x36, 0x54, 0xFF, 0xFF, 0xFF, 0xE4, 0x56, 0x37, 0x37,
+  0x36, 0x54, 0x50, 0xA4, 0xA6, 0x87, 0x87, 0x86, 0xA4, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x69, 0x59, 0x69, 0x59, 0x5A, 0x4A, 0x5A, 0x4A, 0x4B, 0x3B,
+  0x4B, 0x3B, 0x3C, 0xF8, 0x1F, 0x74, 0xF3, 0x7F, 0x19, 0xE9, 0xE9, 0xE9,
+  0xDA, 0xDA, 0xDA, 0xD9, 0xF0, 0xBF, 0x29, 0xF3, 0x9F, 0x2A, 0xF2, 0x9F,
+  0x39, 0xF3, 0x9F, 0x29, 0xF3, 0x7F, 0x54, 0x40, 0x3F, 0x82, 0xF9, 0x2F,
+  0x92, 0xF9, 0x2F, 0x8F, 0xFF, 0xFF, 0xFF, 0x1F, 0x82, 0xF9, 0x2F, 0x92,
+  0xF9, 0x2F, 0x83, 0xFE, 0x4F, 0x57, 0xF3, 0x8F, 0x39, 0xF3, 0x9F, 0x2A,
+  0xF2, 0xAF, 0x29, 0xF2, 0xAF, 0x2A, 0xF0, 0xAD, 0xAD, 0xAD, 0x9E, 0x9D,
+  0xAD, 0xAE, 0x8F, 0x26, 0xF4, 0x4F, 0xFF, 0x10, 0x77, 0x9C, 0x4F, 0x13,
+  0xF2, 0x2F, 0x96, 0xC9, 0x9A, 0x9A, 0x5E, 0x5D, 0x5C, 0x7A, 0x88, 0xA8,
+  0xA8, 0x9A, 0x7C, 0x5E, 0x4F, 0x13, 0xFF, 0xFF, 0xB4, 0xE6, 0xC7, 0xC7,
+  0xC6, 0xE4, 0xD0, 0xC7, 0xEB, 0xBD, 0x8F, 0x07, 0x65, 0x66, 0x57, 0x55,
+  0x4A, 0x44, 0x5A, 0x44, 0x4B, 0x34, 0x4B, 0x44, 0x48, 0x73, 0x47, 0x93,
+  0x45, 0xA4, 0x44, 0xB4, 0x34, 0x62, 0x43, 0x43, 0x54, 0x43, 0x43, 0x45,
+  0x43, 0x42, 0x46, 0x34, 0x33, 0x45, 0x44, 0x33, 0x45, 0x43, 0x43, 0x45,
+  0x43, 0x43, 0x54, 0x34, 0x43, 0xD3, 0x44, 0xD2, 0x45, 0xB3, 0x47, 0x93,
+  0x4F, 0x44, 0xF4, 0x4F, 0x45, 0xF4, 0x4F, 0x46, 0x73, 0x7F, 0x18, 0xEA,
+  0xCD, 0x7B, 0xAD, 0xF1, 0xEF, 0x1E, 0xF1, 0xEF, 0x1E, 0xF6, 0xAF, 0x4B,
+  0xF4, 0x42, 0x5F, 0x35, 0x25, 0xF2, 0x53, 0x5F, 0x24, 0x46, 0xF0, 0x54,
+  0x6E, 0x56, 0x5E, 0x56, 0x5D, 0x57, 0x5D, 0xF3, 0xBF, 0x4A, 0xF5, 0xAF,
+  0x59, 0xF7, 0x76, 0xB6, 0x75, 0xD5, 0x4B, 0x6B, 0x1C, 0x5F, 0xA5, 0xFA,
+  0x5C, 0x1B, 0x6B, 0x20, 0x6F, 0x49, 0xF7, 0x7F, 0x86, 0xF8, 0x6F, 0x98,
+  0x5A, 0x68, 0x5B, 0x58, 0x4C, 0x57, 0x5C, 0x57, 0x5B, 0x58, 0x59, 0x69,
+  0xF4, 0xAF, 0x3A, 0xF4, 0xAF, 0x68, 0xF6, 0x84, 0xA8, 0x65, 0xC6, 0x65,
+  0xD5, 0x65, 0xD5, 0x64, 0xE5, 0x64, 0xC6, 0x3F, 0xB2, 0xFB, 0x3F, 0xA4,
+  0xF8, 0x7F, 0x58, 0xD7, 0xF3, 0xD2, 0x2A, 0xF4, 0x7F, 0x66, 0xF7, 0x58,
+  0x69, 0x47, 0xA6, 0x46, 0xD5, 0x45, 0xE5, 0x36, 0xE4, 0x45, 0xF0, 0x43,
+  0x6F, 0x75, 0xF8, 0x5F, 0x85, 0xF7, 0x5F, 0x85, 0xF8, 0x5F, 0x85, 0xF8,
+  0x5F, 0x86, 0xF7, 0x6F, 0x03, 0x56, 0xC5, 0x58, 0x87, 0x6F, 0x76, 0xF6,
+  0x8F, 0x3C, 0xEF, 0x28, 0xC0, 0x6F, 0x1B, 0xF4, 0x9F, 0x58, 0xF6, 0x8F,
+  0x68, 0x58, 0x78, 0x59, 0x68, 0x4B, 0x67, 0x4C, 0x56, 0x5C, 0x56, 0x5C,
+  0x56, 0x5C, 0x56, 0x4D, 0x55, 0x5D, 0x55, 0x5C, 0x65, 0x5C, 0x56, 0x4D,
+  0x56, 0x4C, 0x65, 0x5C, 0x56, 0x5B, 0x66, 0x5A, 0x67, 0x49, 0x75, 0xF7,
+  0x6F, 0x66, 0xF6, 0x7F, 0x4A, 0xF0, 0xC0, 0x6F, 0x85, 0xF9, 0x4F, 0xA4,
+  0xF9, 0x6F, 0x89, 0x4B, 0x58, 0x5B, 0x58, 0x5B, 0x58, 0x54, 0x43, 0x49,
+  0x44, 0x53, 0x3A, 0x44, 0x5F, 0x0E, 0xF0, 0xDF, 0x1D, 0xF1, 0xDF, 0x0E,
+  0xF0, 0x54, 0x4F, 0x15, 0x44, 0x44, 0x84, 0x53, 0x54, 0x84, 0xC5, 0x75,
+  0xC5, 0x75, 0xC5, 0x4F, 0x94, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0x95, 0x6F,
+  0xA5, 0xFA, 0x6F, 0xA6, 0xFA, 0x7F, 0x99, 0x5C, 0x59, 0x5C, 0x4A, 0x4C,
+  0x5A, 0x45, 0x34, 0x59, 0x54, 0x54, 0x3A, 0x54, 0x4F, 0x3D, 0xF3, 0xDF,
+  0x2E, 0xF2, 0xEF, 0x2D, 0xF3, 0x44, 0x5F, 0x34, 0x45, 0xF2, 0x55, 0x3F,
+  0x35, 0xFB, 0x5F, 0xB4, 0xF9, 0xEF, 0x1F, 0x0F, 0x0F, 0x1F, 0x0F, 0x1F,
+  0x1E, 0xF1, 0xD8, 0x42, 0xBF, 0x39, 0xF4, 0x7F, 0x66, 0xF6, 0x68, 0x77,
+  0x57, 0xB5, 0x55, 0xD4, 0x55, 0xE4, 0x46, 0xF7, 0x5F, 0x85, 0xF7, 0x5F,
+  0x85, 0xF8, 0x5F, 0x85, 0x7D, 0x25, 0x7F, 0x01, 0x57, 0xF0, 0x15, 0x7E,
+  0x25, 0x8C, 0x35, 0xE5, 0x46, 0xD5, 0x47, 0xC5, 0x58, 0x86, 0x6F, 0x77,
+  0xF6, 0x8F, 0x4B, 0xEF, 0x28, 0xC0, 0x79, 0x49, 0x7A, 0x3B, 0x5B, 0x3B,
+  0x5B, 0x3A, 0x79, 0x49, 0x95, 0xA5, 0xA5, 0xA4, 0xB4, 0xB4, 0xB4, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0xAF, 0x4B, 0xF4, 0xAF, 0x5A, 0xF5, 0xAF, 0x4B,
+  0x4A, 0x5B, 0x4A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x4B, 0x4A, 0x58,
+  0xA4, 0xA5, 0xB3, 0xC4, 0xB3, 0xC4, 0xB3, 0xB5, 0xA4, 0xB5, 0x6F, 0x45,
+  0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x4D, 0x5F, 0x55, 0xF5, 0x4F, 0x55, 0xF5,
+  0x5F, 0x55, 0xF5, 0x4F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x54, 0xF5,
+  0x5F, 0x55, 0xF5, 0x5F, 0x54, 0xF5, 0x5D, 0xF4, 0x5F, 0x55, 0xF5, 0x5F,
+  0x56, 0xF3, 0x60, 0xDF, 0x3C, 0xF4, 0xCF, 0x4C, 0xF4, 0xDF, 0x2F, 0x65,
+  0xFB, 0x5F, 0xB4, 0xFC, 0x4F, 0xB5, 0xFB, 0x5F, 0xB5, 0xFB, 0x4F, 0xB5,
+  0xB3, 0xC5, 0xA5, 0xB5, 0xA5, 0xB5, 0xA4, 0xC4, 0xA5, 0xB5, 0xA5, 0xB5,
+  0xA5, 0xA5, 0xB5, 0x96, 0xB7, 0x66, 0xBF, 0x5B, 0xF4, 0xEF, 0x0F, 0x3C,
+  0xF6, 0x7F, 0x30, 0x6C, 0x49, 0x5D, 0x3A, 0x5D, 0x2B, 0x5D, 0x2B, 0x5C,
+  0x49, 0x95, 0x77, 0xC5, 0x67, 0xD4, 0x57, 0xE5, 0x47, 0xF0, 0x53, 0x6F,
+  0x25, 0x17, 0xF3, 0xBF, 0x5C, 0xF3, 0xEF, 0x2F, 0x0F, 0x17, 0x26, 0xF1,
+  0x55, 0x6E, 0x56, 0x6E, 0x57, 0x6D, 0x57, 0x6D, 0x49, 0x5D, 0x49, 0x68,
+  0xC5, 0x94, 0xD5, 0xA3, 0xD6, 0x93, 0xD6, 0x94, 0xB7, 0x84, 0x6F, 0x0B,
+  0xF1, 0xBF, 0x1B, 0xF1, 0xBF, 0x0F, 0x25, 0xF7, 0x5F, 0x74, 0xF7, 0x5F,
+  0x75, 0xF7, 0x5F, 0x74, 0xF8, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xA3, 0x94,
+  0xB4, 0x75, 0xA5, 0x75, 0xA5, 0x75, 0xA5, 0x74, 0xA5, 0x75, 0xA5, 0x2F,
+  0xA1, 0xFB, 0x1F, 0xA2, 0xFA, 0x3F, 0x92, 0x68, 0xC8, 0x59, 0xB9, 0x59,
+  0xB9, 0x59, 0xA9, 0x88, 0x88, 0x99, 0x79, 0x99, 0x79, 0x99, 0x69, 0xAA,
+  0x4A, 0xA4, 0x15, 0x4A, 0x95, 0x15, 0x35, 0x15, 0x95, 0x15, 0x26, 0x15,
+  0x95, 0x16, 0x15, 0x24, 0xA4, 0x3A, 0x25, 0xA4, 0x3A, 0x25, 0x95, 0x39,
+  0x35, 0x95, 0x47, 0x45, 0x95, 0x47, 0x44, 0xA4, 0x56, 0x45, 0x95, 0x55,
+  0x55, 0x95, 0xF0, 0x59, 0x5F, 0x04, 0x8A, 0x8A, 0x5C, 0x6C, 0x4C, 0x5D,
+  0x4B, 0x6C, 0x5A, 0x8A, 0x60, 0x58, 0x8B, 0x4A, 0x6C, 0x4A, 0x6C, 0x4A,
+  0x6C, 0x4B, 0x5B, 0x88, 0x95, 0xA9, 0x84, 0xB9, 0x75, 0xAB, 0x65, 0xAB,
+  0x65, 0xA5, 0x16, 0x55, 0xA4, 0x26, 0x54, 0xA5, 0x36, 0x35, 0xA5, 0x36,
+  0x35, 0xA5, 0x46, 0x25, 0xA5, 0x46, 0x24, 0xB4, 0x65, 0x15, 0xA5, 0x6B,
+  0xA5, 0x7A, 0xA5, 0x7A, 0xA4, 0x89, 0xB4, 0x98, 0x8B, 0x58, 0x7C, 0x67,
+  0x7C, 0x66, 0x8C, 0x75, 0x9A, 0x85, 0x80, 0xD7, 0xF3, 0xBE, 0xEB, 0xF2,
+  0x9F, 0x47, 0x85, 0x85, 0x79, 0x64, 0x6B, 0x64, 0x5D, 0x62, 0x6E, 0x52,
+  0x5F, 0x05, 0x15, 0xF1, 0x51, 0x5F, 0x15, 0x14, 0xF2, 0xAF, 0x2A, 0xF1,
+  0x51, 0x5F, 0x15, 0x15, 0xF1, 0x51, 0x5F, 0x05, 0x25, 0xE6, 0x26, 0xD5,
+  0x45, 0xC6, 0x46, 0x97, 0x58, 0x58, 0x7F, 0x49, 0xF2, 0xBE, 0xEB, 0xF3,
+  0x7D, 0x6F, 0x2A, 0xF5, 0x8F, 0x67, 0xF7, 0x6F, 0x88, 0x58, 0x78, 0x5A,
+  0x58, 0x4B, 0x57, 0x5B, 0x57, 0x5B, 0x57, 0x5A, 0x58, 0x4A, 0x68, 0x49,
+  0x68, 0xF5, 0x8F, 0x49, 0xF2, 0xBF, 0x1B, 0xEE, 0x5F, 0x85, 0xF8, 0x4F,
+  0x94, 0xF5, 0xF0, 0xCF, 0x1C, 0xF1, 0xCF, 0x1D, 0xED, 0xD7, 0xF2, 0xCD,
+  0xF0, 0xBF, 0x29, 0xF4, 0x78, 0x58, 0x57, 0x96, 0x46, 0xC6, 0x35, 0xD6,
+  0x25, 0xF0, 0x51, 0x6F, 0x05, 0x15, 0xF1, 0x51, 0x5F, 0x1A, 0xF2, 0xAF,
+  0x2A, 0xF1, 0x51, 0x5F, 0x15, 0x15, 0xF0, 0x61, 0x5F, 0x05, 0x26, 0xD5,
+  0x36, 0xC6, 0x46, 0x97, 0x58, 0x58, 0x7F, 0x49, 0xF2, 0xBF, 0x0D, 0xCF,
+  0x18, 0xF3, 0x4F, 0x7A, 0x53, 0x7F, 0x66, 0xF6, 0x5F, 0x66, 0xF5, 0x84,
+  0x76, 0x80, 0x6F, 0x2B, 0xF5, 0x9F, 0x68, 0xF7, 0x8F, 0x79, 0x58, 0x79,
+  0x5A, 0x59, 0x4B, 0x59, 0x4B, 0x58, 0x5A, 0x68, 0x59, 0x69, 0x57, 0x7A,
+  0xF4, 0x9F, 0x3B, 0xF2, 0xCF, 0x0E, 0xF1, 0xD4, 0x67, 0xB5, 0x77, 0xA5,
+  0x86, 0xA5, 0x87, 0x94, 0xA6, 0x6B, 0x69, 0x2C, 0x7F, 0x77, 0xF7, 0x88,
+  0x1B, 0x97, 0x10, 0xC7, 0x42, 0xBF, 0x18, 0xF3, 0x7F, 0x46, 0xF5, 0x57,
+  0x67, 0x65, 0x96, 0x55, 0xB5, 0x55, 0xB4, 0x65, 0xB4, 0x66, 0xF5, 0x9F,
+  0x3C, 0xEF, 0x0C, 0xF0, 0xDE, 0xF2, 0xAF, 0x47, 0xF6, 0x54, 0x4D, 0x53,
+  0x5D, 0x53, 0x5C, 0x63, 0x6A, 0x64, 0x86, 0x84, 0xF6, 0x5F, 0x56, 0xF4,
+  0x73, 0x2C, 0xF1, 0x8B, 0x2F, 0x92, 0xF9, 0x1F, 0xA1, 0xF9, 0x2F, 0x92,
+  0x55, 0x45, 0x52, 0x45, 0x55, 0x51, 0x55, 0x55, 0x51, 0x55, 0x55, 0x42,
+  0x55, 0x45, 0x52, 0x45, 0x55, 0x52, 0x36, 0x56, 0x3C, 0x5F, 0x64, 0xF7,
+  0x4F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x4F, 0x65, 0xF6, 0x5F, 0x65, 0xF0,
+  0xF1, 0xAF, 0x19, 0xF2, 0x9F, 0x2A, 0xF0, 0xA0, 0x2A, 0x5A, 0x2C, 0x3C,
+  0x1C, 0x2D, 0x1B, 0x3C, 0x2B, 0x4A, 0x54, 0xC5, 0x74, 0xC5, 0x65, 0xC5,
+  0x65, 0xC5, 0x65, 0xC4, 0x74, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC4,
+  0x75, 0xC4, 0x74, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC4, 0x75, 0xB5,
+  0x76, 0x96, 0x76, 0x86, 0x88, 0x56, 0xAF, 0x3A, 0xF2, 0xCE, 0xF1, 0xBF,
+  0x46, 0xF1, 0x1B, 0x7F, 0x86, 0xF9, 0x6F, 0x96, 0xC1, 0xA7, 0xB4, 0x5D,
+  0x57, 0x5C, 0x58, 0x5C, 0x58, 0x6A, 0x5A, 0x59, 0x5B, 0x59, 0x5B, 0x58,
+  0x5C, 0x66, 0x6D, 0x56, 0x5E, 0x55, 0x5F, 0x05, 0x46, 0xF0, 0x54, 0x5F,
+  0x16, 0x25, 0xF3, 0x51, 0x6F, 0x35, 0x15, 0xF4, 0xAF, 0x5A, 0xF5, 0x9F,
+  0x77, 0xF8, 0x7F, 0x86, 0xF9, 0x5F, 0x30, 0x1B, 0x6F, 0x85, 0xF9, 0x5F,
+  0x95, 0xF8, 0x6B, 0x34, 0xF1, 0x45, 0x45, 0x55, 0x54, 0x54, 0x65, 0x45,
+  0x54, 0x64, 0x55, 0x53, 0x74, 0x55, 0x53, 0x83, 0x46, 0x52, 0x92, 0x56,
+  0x52, 0x92, 0x56, 0x51, 0xA2, 0x47, 0x51, 0x41, 0x51, 0x57, 0xA1, 0x51,
+  0x57, 0x41, 0x42, 0xA8, 0x92, 0xA7, 0x93, 0xA7, 0x94, 0x88, 0x85, 0x88,
+  0x85, 0x88, 0x76, 0x79, 0x76, 0x79, 0x67, 0x79, 0x67, 0x6A, 0x58, 0x6A,
+  0x78, 0x79, 0x7A, 0x5B, 0x5B, 0x5B, 0x5A, 0x6A, 0x78, 0x88, 0xA6, 0x86,
+  0xC7, 0x66, 0xE6, 0x47, 0xF1, 0x62, 0x6F, 0x4C, 0xF5, 0xBF, 0x79, 0xF9,
+  0x7F, 0xA6, 0xFA, 0x8F, 0x8A, 0xF5, 0xCF, 0x46, 0x26, 0xF2, 0x64, 0x6F,
+  0x06, 0x56, 0xE6, 0x76, 0xC6, 0x96, 0x8A, 0x6A, 0x5B, 0x5B, 0x5B, 0x5B,
+  0x5B, 0x5B, 0x69, 0x6A, 0x60, 0x19, 0x7F, 0x46, 0xF5, 0x6F, 0x56, 0xA1,
+  0x87, 0x94, 0x59, 0x57, 0x67, 0x59, 0x56, 0x5A, 0x64, 0x5C, 0x53, 0x5D,
+  0x61, 0x5F, 0x0A, 0xF1, 0x9F, 0x38, 0xF3, 0x7F, 0x55, 0xF6, 0x4F, 0x65,
+  0xF6, 0x5F, 0x65, 0xF6, 0x4F, 0x74, 0xF1, 0xF0, 0xAF, 0x29, 0xF2, 0x9F,
+  0x1A, 0xF0, 0xB0, 0x7F, 0x48, 0xF4, 0x8F, 0x48, 0xF4, 0x7F, 0x57, 0x58,
+  0x68, 0x57, 0x69, 0x56, 0x6A, 0x46, 0x6A, 0x55, 0x6C, 0x35, 0x6F, 0x56,
+  0xF5, 0x6F, 0x46, 0xF5, 0x6F, 0x56, 0xF5, 0x67, 0x3A, 0x67, 0x58, 0x68,
+  0x57, 0x69, 0x47, 0x69, 0x56, 0x6A, 0x55, 0xF7, 0x5F, 0x75, 0xF6, 0x6F,
+  0x66, 0xF6, 0x50, 0x8A, 0x8A, 0x8A, 0x7B, 0x7A, 0x85, 0xD4, 0xE4, 0xD5,
+  0xD5, 0xD5, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xD5, 0xD5, 0xD5, 0xD4,
+  0xE4, 0xD5, 0xD5, 0xD5, 0xD4, 0xE4, 0xD5, 0xD5, 0xD5, 0xD4, 0xD5, 0xDA,
+  0x8A, 0x8A, 0x8A, 0x7A, 0x80, 0x21, 0xB4, 0x85, 0x85, 0x95, 0x85, 0x85,
+  0x85, 0x95, 0x85, 0x85, 0x85, 0x95, 0x85, 0x85, 0x85, 0x95, 0x85, 0x85,
+  0x86, 0x85, 0x85, 0x85, 0x95, 0x85, 0x85, 0x85, 0x95, 0x85, 0x85, 0x85,
+  0x95, 0x85, 0x85, 0x85, 0x94, 0x94, 0x93, 0x10, 0x8A, 0x7A, 0x8A, 0x8A,
+  0x8A, 0xD5, 0xD4, 0xD5, 0xD5, 0xD5, 0xD4, 0xE4, 0xD5, 0xD5, 0xD5, 0xD4,
+  0xE4, 0xD5, 0xD5, 0xD5, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xD5, 0xD5,
+  0xD5, 0xD4, 0xE4, 0xD5, 0x8A, 0x7B, 0x7A, 0x8A, 0x8A, 0x80, 0xC1, 0xF3,
+  0x3F, 0x14, 0xF0, 0x6D, 0x7C, 0x9A, 0xB7, 0xD6, 0x72, 0x64, 0x73, 0x72,
+  0x66, 0x61, 0x68, 0xB9, 0xAB, 0x8D, 0x31, 0x1F, 0xD1, 0xFF, 0xFF, 0xFA,
+  0x1F, 0xD1, 0x12, 0x54, 0x45, 0x45, 0x45, 0x45, 0x44, 0x52, 0x10, 0xA9,
+  0xBF, 0x08, 0xF2, 0x7F, 0x36, 0xF3, 0xF3, 0x6F, 0x45, 0xF4, 0x5A, 0xE7,
+  0xF1, 0x6F, 0x35, 0xF4, 0x4F, 0x53, 0x79, 0x44, 0x5B, 0x43, 0x5B, 0x53,
+  0x59, 0x73, 0x66, 0xB1, 0xF9, 0x1F, 0x81, 0xF8, 0x2C, 0x18, 0x57, 0xD0,
+  0x68, 0xF5, 0x9F, 0x59, 0xF5, 0x8F, 0x77, 0xF9, 0x5F, 0x95, 0xF9, 0x5F,
+  0x94, 0x47, 0xD5, 0x1C, 0xBF, 0x59, 0xF5, 0x9F, 0x68, 0x86, 0x77, 0x7A,
+  0x66, 0x6B, 0x66, 0x5D, 0x56, 0x5D, 0x56, 0x4E, 0x55, 0x5E, 0x55, 0x5D,
+  0x56, 0x5D, 0x56, 0x5C, 0x66, 0x6B, 0x56, 0x7A, 0x63, 0xC6, 0x73, 0xFA,
+  0x4F, 0x95, 0xF8, 0x68, 0x2B, 0xF5, 0x7A, 0xB8, 0x33, 0x8F, 0x27, 0xF3,
+  0x5F, 0x54, 0xF6, 0x38, 0x77, 0x36, 0xA5, 0x36, 0xB5, 0x35, 0xD3, 0x35,
+  0xF5, 0x5F, 0x45, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x6E, 0x23,
+  0x89, 0x63, 0xF7, 0x3F, 0x65, 0xF4, 0x8F, 0x0C, 0xA9, 0xF5, 0x8F, 0x48,
+  0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x85, 0xF8, 0x4F, 0x85, 0xC7, 0x45, 0xAC,
+  0x15, 0x8F, 0x57, 0xF5, 0x7F, 0x66, 0x76, 0x95, 0x6A, 0x75, 0x5C, 0x55,
+  0x5D, 0x55, 0x5D, 0x54, 0x5E, 0x54, 0x5E, 0x54, 0x5E, 0x45, 0x5D, 0x55,
+  0x5D, 0x55, 0x6B, 0x65, 0x6A, 0x76, 0x76, 0xB4, 0xFA, 0x4F, 0x94, 0xF9,
+  0x6B, 0x28, 0x97, 0xF0, 0xB7, 0xEC, 0xAF, 0x08, 0xF2, 0x6F, 0x44, 0x86,
+  0x63, 0x7A, 0x52, 0x6C, 0x41, 0x6D, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+  0x46, 0xF3, 0x6D, 0x33, 0x77, 0x82, 0xF7, 0x3F, 0x64, 0xF4, 0x6F, 0x1A,
+  0xA8, 0xF2, 0x9F, 0x1E, 0xDF, 0x0C, 0xF1, 0xBF, 0x1C, 0x5F, 0x75, 0xF8,
+  0x5F, 0x84, 0xF4, 0xF4, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF4, 0xE4, 0xF8,
+  0x5F, 0x85, 0xF8, 0x5F, 0x84, 0xF8, 0x5F, 0x85, 0xF8, 0x5F, 0x85, 0xF8,
+  0x4F, 0x85, 0xF3, 0xF4, 0x8F, 0x58, 0xF5, 0x8F, 0x59, 0xF3, 0x90, 0xA7,
+  0xF4, 0xB1, 0x86, 0xF7, 0x5F, 0x84, 0xF9, 0x37, 0x5C, 0x37, 0x87, 0x65,
+  0xB6, 0x56, 0xB5, 0x65, 0xC5, 0x55, 0xD5, 0x55, 0xD5, 0x55, 0xD5, 0x55,
+  0xD4, 0x65, 0xC5, 0x66, 0xA6, 0x66, 0x97, 0x77, 0x58, 0x8F, 0x59, 0xF4,
+  0x9F, 0x4B, 0xB1, 0x5D, 0x64, 0x4F, 0x85, 0xF8, 0x5F, 0x66, 0xCF, 0x1B,
+  0xF1, 0xCF, 0x0D, 0xDF, 0x0B, 0xF0, 0x67, 0xF3, 0x8F, 0x29, 0xF2, 0x9F,
+  0x37, 0xF7, 0x4F, 0x65, 0xF6, 0x5F, 0x65, 0x36, 0xC4, 0x2A, 0xA4, 0x1C,
+  0x8F, 0x38, 0xF4, 0x78, 0x56, 0x76, 0x85, 0x66, 0x95, 0x65, 0xA5, 0x65,
+  0xA4, 0x75, 0xA4, 0x74, 0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65, 0xA4, 0x74,
+  0xA5, 0x74, 0xA5, 0x4A, 0x59, 0x1B, 0x4F, 0x74, 0xF7, 0x4F, 0x66, 0x91,
+  0xD6, 0xF2, 0x6F, 0x26, 0xF2, 0x5F, 0x35, 0xFF, 0xFF, 0xF6, 0xBB, 0xCB,
+  0xBC, 0xBC, 0xBF, 0x35, 0xF3, 0x4F, 0x44, 0xF3, 0x5F, 0x35, 0xF3, 0x5F,
+  0x34, 0xF4, 0x4F, 0x35, 0xF3, 0x5F, 0x35, 0xAF, 0x52, 0xFF, 0xFF, 0x72,
+  0xF5, 0x20, 0xF2, 0x5F, 0x35, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0xFF, 0xFF,
+  0x2F, 0x16, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x1F, 0x44, 0xF3, 0x5F, 0x35,
+  0xF3, 0x5F, 0x34, 0xF4, 0x4F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x4F, 0x35,
+  0xF3, 0x5F, 0x35, 0xF3, 0x4F, 0x44, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x25,
+  0xF2, 0x66, 0xF1, 0x6F, 0x17, 0xF0, 0x8E, 0xAA, 0xC0, 0x68, 0xF3, 0x8F,
+  0x29, 0xF2, 0x9F, 0x37, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x44,
+  0xA7, 0x53, 0xB7, 0x53, 0xB7, 0x53, 0xB7, 0x44, 0xA8, 0x42, 0x8B, 0x51,
+  0x7D, 0xCE, 0xAF, 0x19, 0xF2, 0xAF, 0x0C, 0xE5, 0x17, 0xD5, 0x27, 0xC4,
+  0x47, 0xA5, 0x57, 0x68, 0x5B, 0x19, 0x5B, 0x19, 0x4C, 0x18, 0x5C, 0x27,
+  0x6A, 0x20, 0x9B, 0xBB, 0xCB, 0xCB, 0xCB, 0xF3, 0x5F, 0x34, 0xF3, 0x5F,
+  0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x4F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x4F,
+  0x44, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x34, 0xF4, 0x4F, 0x35, 0xF3, 0x5F,
+  0x35, 0xAF, 0x52, 0xFF, 0xFF, 0x72, 0xF5, 0x20, 0xD4, 0x64, 0x77, 0x17,
+  0x28, 0x4F, 0x11, 0x94, 0xFC, 0x3F, 0xC3, 0x93, 0x73, 0x55, 0x64, 0x64,
+  0x55, 0x55, 0x55, 0x55, 0x46, 0x46, 0x55, 0x45, 0x56, 0x45, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x46, 0x46, 0x45, 0x55, 0x56,
+  0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x84, 0x64, 0x61, 0xA3, 0x73,
+  0xF2, 0x28, 0x3F, 0x22, 0x82, 0xF2, 0x37, 0x37, 0x10, 0xF0, 0x6A, 0x62,
+  0xA7, 0x71, 0xC5, 0xF6, 0x5F, 0x75, 0xA5, 0x67, 0x68, 0x56, 0x69, 0x56,
+  0x5A, 0x56, 0x5A, 0x47, 0x5A, 0x47, 0x4A, 0x56, 0x5A, 0x56, 0x5A, 0x56,
+  0x5A, 0x47, 0x4A, 0x57, 0x4A, 0x54, 0xA5, 0x91, 0xB4, 0xF7, 0x4F, 0x74,
+  0xF6, 0x69, 0x10, 0xB7, 0xF0, 0xDB, 0xF0, 0x8F, 0x36, 0xF5, 0x48, 0x67,
+  0x37, 0x97, 0x25, 0xC6, 0x15, 0xE5, 0x15, 0xEA, 0xF0, 0xAF, 0x0A, 0xF0,
+  0xAE, 0x51, 0x5D, 0x61, 0x6C, 0x52, 0x79, 0x73, 0x76, 0x84, 0xF5, 0x6F,
+  0x38, 0xF0, 0xBD, 0xF0, 0x7B, 0xF3, 0x7C, 0x82, 0xB9, 0x91, 0xD8, 0xF9,
+  0x7F, 0xA7, 0xB6, 0x79, 0x7A, 0x68, 0x6B, 0x68, 0x5D, 0x58, 0x5D, 0x58,
+  0x4E, 0x57, 0x5E, 0x57, 0x5D, 0x67, 0x5D, 0x58, 0x5C, 0x67, 0x7A, 0x68,
+  0x96, 0x88, 0xF7, 0x9F, 0x6A, 0x41, 0xEB, 0x52, 0xCC, 0x54, 0x7F, 0x05,
+  0xFB, 0x5F, 0xB4, 0xFB, 0x5F, 0x8D, 0xF2, 0xEF, 0x2E, 0xF2, 0xEF, 0x2D,
+  0xF3, 0xA7, 0xF5, 0xB2, 0x86, 0xE1, 0x85, 0xF9, 0x4F, 0xA3, 0x76, 0xC3,
+  0x6A, 0x76, 0x5C, 0x56, 0x5D, 0x56, 0x5D, 0x56, 0x4E, 0x55, 0x5E, 0x55,
+  0x5E, 0x46, 0x5D, 0x56, 0x6B, 0x66, 0x6A, 0x76, 0x86, 0x88, 0xF6, 0x8F,
+  0x69, 0xF5, 0xBB, 0x25, 0xD7, 0x44, 0xFA, 0x4F, 0x95, 0xF9, 0x5F, 0x95,
+  0xF4, 0xCF, 0x1E, 0xEF, 0x0E, 0xEF, 0x1C, 0x70, 0xF5, 0x59, 0x84, 0x96,
+  0x92, 0xB6, 0x91, 0xD5, 0xF7, 0x6F, 0x03, 0x3B, 0x9F, 0x47, 0xF5, 0x7F,
+  0x66, 0xF7, 0x5F, 0x84, 0xF8, 0x5F, 0x85, 0xF8, 0x5F, 0x84, 0xF9, 0x4F,
+  0x3F, 0x48, 0xF5, 0x8F, 0x58, 0xF5, 0x9F, 0x39, 0xA8, 0x23, 0x7F, 0x16,
+  0xF2, 0x5F, 0x34, 0xF3, 0x47, 0x75, 0x45, 0xA3, 0x55, 0xF3, 0x9E, 0xF0,
+  0x9F, 0x18, 0xF1, 0x9F, 0x0D, 0xAF, 0x26, 0x33, 0xC5, 0x25, 0xB5, 0x26,
+  0x86, 0x2F, 0x62, 0xF5, 0x3F, 0x44, 0xF2, 0xC8, 0x90, 0x64, 0xF0, 0x5F,
+  0x05, 0xF0, 0x5F, 0x04, 0xF1, 0x4C, 0xF3, 0x1F, 0xFF, 0xFF, 0x44, 0x5F,
+  0x05, 0xF0, 0x4F, 0x14, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x04, 0xF0, 0x5F,
+  0x05, 0xF0, 0x5F, 0x06, 0x94, 0x1F, 0x41, 0xF4, 0x2F, 0x24, 0xE8, 0x87,
+  0x17, 0x7F, 0x16, 0xF1, 0x6F, 0x26, 0xF2, 0x78, 0x35, 0xB4, 0x35, 0xA5,
+  0x25, 0xB5, 0x25, 0xB5, 0x25, 0xB4, 0x35, 0xA5, 0x35, 0xA5, 0x35, 0xA5,
+  0x35, 0xA5, 0x35, 0x95, 0x45, 0x86, 0x46, 0x5A, 0x2F, 0x63, 0xF5, 0x3C,
+  0x17, 0x4A, 0x17, 0x76, 0xC0, 0x1B, 0x5F, 0x84, 0xF9, 0x4F, 0x94, 0xF8,
+  0x5B, 0x46, 0x95, 0x95, 0x95, 0x95, 0x85, 0xA5, 0x75, 0xB6, 0x56, 0xC5,
+  0x55, 0xD5, 0x45, 0xE6, 0x26, 0xF0, 0x52, 0x5F, 0x15, 0x15, 0xF2, 0xAF,
+  0x3A, 0xF4, 0x8F, 0x57, 0xF6, 0x7F, 0x75, 0xF0, 0x19, 0x98, 0x1A, 0x8F,
+  0x57, 0xF6, 0x7A, 0x28, 0x98, 0x45, 0x45, 0x45, 0x55, 0x36, 0x44, 0x65,
+  0x36, 0x35, 0x65, 0x27, 0x34, 0x75, 0x27, 0x25, 0x75, 0x19, 0x14, 0x8F,
+  0x58, 0xF5, 0x89, 0x19, 0x99, 0x19, 0x98, 0x28, 0xA7, 0x38, 0xA7, 0x46,
+  0xB6, 0x56, 0xC5, 0x55, 0xD4, 0x65, 0xA0, 0x69, 0x59, 0x5A, 0x4A, 0x5A,
+  0x3B, 0x5A, 0x3B, 0x59, 0x59, 0x87, 0x47, 0xC7, 0x27, 0xEE, 0xF1, 0xBF,
+  0x49, 0xF5, 0x8F, 0x5A, 0xF2, 0xDF, 0x07, 0x17, 0xD7, 0x37, 0xB7, 0x57,
+  0x79, 0x69, 0x4B, 0x4B, 0x2C, 0x3C, 0x2C, 0x3B, 0x4A, 0x59, 0x40, 0x78,
+  0x79, 0x7A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x78, 0x88, 0x96, 0xA5, 0xC5,
+  0x96, 0xC5, 0x95, 0xD6, 0x75, 0xF0, 0x56, 0x5F, 0x15, 0x65, 0xF1, 0x64,
+  0x5F, 0x26, 0x35, 0xF4, 0x52, 0x5F, 0x55, 0x25, 0xF5, 0xBF, 0x79, 0xF8,
+  0x8F, 0x97, 0xFB, 0x6F, 0xB5, 0xFB, 0x5F, 0xC4, 0xFC, 0x5F, 0xB5, 0xF4,
+  0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xEF, 0x20, 0x5F, 0x55,
+  0xF4, 0x6F, 0x45, 0xF5, 0x5F, 0x46, 0x56, 0x77, 0x46, 0x78, 0x45, 0x6F,
+  0x27, 0xF2, 0x7F, 0x27, 0xF2, 0x6F, 0x27, 0xF2, 0x7F, 0x27, 0x74, 0x66,
+  0x85, 0x5F, 0x54, 0xF6, 0x4F, 0x55, 0xF5, 0x4F, 0x64, 0xC4, 0xB7, 0x98,
+  0x89, 0x87, 0x96, 0xB5, 0xB5, 0xC5, 0xC5, 0xC5, 0xC4, 0xC5, 0xC5, 0xC5,
+  0xB5, 0xC5, 0x97, 0x98, 0x97, 0xA7, 0xA8, 0xB6, 0xC5, 0xC5, 0xC5, 0xC4,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC6, 0xB7, 0xA8, 0xA7, 0xA7, 0xC4, 0x80, 0x74,
+  0x74, 0x65, 0x65, 0x65, 0x64, 0x74, 0x65, 0x65, 0x64, 0x74, 0x74, 0x65,
+  0x65, 0x64, 0x74, 0x74, 0x65, 0x65, 0x64, 0x74, 0x74, 0x65, 0x65, 0x64,
+  0x74, 0x74, 0x65, 0x65, 0x64, 0x74, 0x65, 0x65, 0x65, 0x64, 0x73, 0x80,
+  0x84, 0xC6, 0xB7, 0xA8, 0xA7, 0xB6, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC4,
+  0xD4, 0xC5, 0xC5, 0xC5, 0xC6, 0xB8, 0xA7, 0xA7, 0x98, 0x88, 0x95, 0xB5,
+  0xC5, 0xC4, 0xD4, 0xC5, 0xC5, 0xC5, 0xC4, 0xB6, 0x89, 0x79, 0x88, 0x97,
+  0xB4, 0xC0, 0x65, 0xF1, 0x8E, 0xA7, 0x32, 0xC5, 0x41, 0xE2, 0xD2, 0xF4,
+  0x5C, 0x23, 0x7A, 0xE7, 0xF2, 0x55 };
 
 const GFXglyph FreeMonoBoldOblique24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  28,    0,    1 },   // 0x20 ' '
   {     0,  12,  31,  28,   12,  -29 },   // 0x21 '!'
-  {    47,  17,  14,  28,   11,  -28 },   // 0x22 '"'
-  {    77,  24,  34,  28,    5,  -30 },   // 0x23 '#'
-  {   179,  25,  38,  28,    4,  -31 },   // 0x24 '$'
-  {   298,  22,  30,  28,    6,  -28 },   // 0x25 '%'
-  {   381,  21,  28,  28,    5,  -26 },   // 0x26 '&'
-  {   455,   7,  14,  28,   16,  -28 },   // 0x27 '''
-  {   468,  14,  37,  28,   14,  -29 },   // 0x28 '('
-  {   533,  14,  37,  28,    5,  -29 },   // 0x29 ')'
-  {   598,  21,  19,  28,    8,  -28 },   // 0x2A '*'
-  {   648,  24,  26,  28,    5,  -25 },   // 0x2B '+'
-  {   726,  12,  14,  28,    6,   -6 },   // 0x2C ','
-  {   747,  24,   5,  28,    5,  -15 },   // 0x2D '-'
-  {   762,   7,   6,  28,   11,   -4 },   // 0x2E '.'
-  {   768,  28,  38,  28,    3,  -32 },   // 0x2F '/'
-  {   901,  23,  31,  28,    6,  -29 },   // 0x30 '0'
-  {   991,  21,  30,  28,    4,  -29 },   // 0x31 '1'
-  {  1070,  26,  30,  28,    3,  -29 },   // 0x32 '2'
-  {  1168,  25,  31,  28,    4,  -29 },   // 0x33 '3'
-  {  1265,  22,  28,  28,    5,  -27 },   // 0x34 '4'
-  {  1342,  25,  31,  28,    4,  -29 },   // 0x35 '5'
-  {  1439,  24,  31,  28,    7,  -29 },   // 0x36 '6'
-  {  1532,  22,  30,  28,    9,  -29 },   // 0x37 '7'
-  {  1615,  23,  31,  28,    6,  -29 },   // 0x38 '8'
-  {  1705,  24,  31,  28,    5,  -29 },   // 0x39 '9'
-  {  1798,  10,  22,  28,   11,  -20 },   // 0x3A ':'
-  {  1826,  15,  28,  28,    5,  -20 },   // 0x3B ';'
-  {  1879,  25,  21,  28,    5,  -23 },   // 0x3C '<'
-  {  1945,  26,  14,  28,    4,  -19 },   // 0x3D '='
-  {  1991,  25,  22,  28,    4,  -23 },   // 0x3E '>'
-  {  2060,  19,  29,  28,   10,  -27 },   // 0x3F '?'
-  {  2129,  23,  36,  28,    5,  -28 },   // 0x40 '@'
-  {  2233,  30,  27,  28,    0,  -26 },   // 0x41 'A'
-  {  2335,  29,  27,  28,    1,  -26 },   // 0x42 'B'
-  {  2433,  28,  29,  28,    3,  -27 },   // 0x43 'C'
-  {  2535,  28,  27,  28,    1,  -26 },   // 0x44 'D'
-  {  2630,  29,  27,  28,    1,  -26 },   // 0x45 'E'
-  {  2728,  31,  27,  28,    0,  -26 },   // 0x46 'F'
-  {  2833,  28,  29,  28,    3,  -27 },   // 0x47 'G'
-  {  2935,  30,  27,  28,    1,  -26 },   // 0x48 'H'
-  {  3037,  25,  27,  28,    3,  -26 },   // 0x49 'I'
-  {  3122,  31,  28,  28,    0,  -26 },   // 0x4A 'J'
-  {  3231,  31,  27,  28,    0,  -26 },   // 0x4B 'K'
-  {  3336,  27,  27,  28,    1,  -26 },   // 0x4C 'L'
-  {  3428,  34,  27,  28,    0,  -26 },   // 0x4D 'M'
-  {  3543,  32,  27,  28,    1,  -26 },   // 0x4E 'N'
-  {  3651,  27,  29,  28,    3,  -27 },   // 0x4F 'O'
-  {  3749,  28,  27,  28,    1,  -26 },   // 0x50 'P'
-  {  3844,  27,  35,  28,    3,  -27 },   // 0x51 'Q'
-  {  3963,  29,  27,  28,    0,  -26 },   // 0x52 'R'
-  {  4061,  26,  29,  28,    3,  -27 },   // 0x53 'S'
-  {  4156,  26,  27,  28,    4,  -26 },   // 0x54 'T'
-  {  4244,  28,  28,  28,    4,  -26 },   // 0x55 'U'
-  {  4342,  30,  27,  28,    2,  -26 },   // 0x56 'V'
-  {  4444,  29,  27,  28,    3,  -26 },   // 0x57 'W'
-  {  4542,  32,  27,  28,    0,  -26 },   // 0x58 'X'
-  {  4650,  26,  27,  28,    4,  -26 },   // 0x59 'Y'
-  {  4738,  27,  27,  28,    2,  -26 },   // 0x5A 'Z'
-  {  4830,  18,  37,  28,   10,  -29 },   // 0x5B '['
-  {  4914,  13,  38,  28,   10,  -32 },   // 0x5C '\'
-  {  4976,  18,  37,  28,    5,  -29 },   // 0x5D ']'
-  {  5060,  20,  15,  28,    8,  -29 },   // 0x5E '^'
-  {  5098,  29,   5,  28,   -2,    5 },   // 0x5F '_'
-  {  5117,   8,   8,  28,   13,  -30 },   // 0x60 '`'
-  {  5125,  24,  23,  28,    3,  -21 },   // 0x61 'a'
-  {  5194,  29,  31,  28,    0,  -29 },   // 0x62 'b'
-  {  5307,  25,  23,  28,    3,  -21 },   // 0x63 'c'
-  {  5379,  28,  31,  28,    3,  -29 },   // 0x64 'd'
-  {  5488,  24,  23,  28,    3,  -21 },   // 0x65 'e'
-  {  5557,  28,  30,  28,    4,  -29 },   // 0x66 'f'
-  {  5662,  28,  31,  28,    3,  -21 },   // 0x67 'g'
-  {  5771,  26,  30,  28,    2,  -29 },   // 0x68 'h'
-  {  5869,  23,  29,  28,    3,  -28 },   // 0x69 'i'
-  {  5953,  23,  38,  28,    3,  -28 },   // 0x6A 'j'
-  {  6063,  26,  30,  28,    2,  -29 },   // 0x6B 'k'
-  {  6161,  23,  30,  28,    3,  -29 },   // 0x6C 'l'
-  {  6248,  30,  22,  28,    0,  -21 },   // 0x6D 'm'
-  {  6331,  26,  22,  28,    2,  -21 },   // 0x6E 'n'
-  {  6403,  25,  23,  28,    3,  -21 },   // 0x6F 'o'
-  {  6475,  31,  31,  28,   -1,  -21 },   // 0x70 'p'
-  {  6596,  29,  31,  28,    2,  -21 },   // 0x71 'q'
-  {  6709,  28,  22,  28,    2,  -21 },   // 0x72 'r'
-  {  6786,  23,  23,  28,    4,  -21 },   // 0x73 's'
-  {  6853,  20,  28,  28,    5,  -26 },   // 0x74 't'
-  {  6923,  23,  22,  28,    5,  -20 },   // 0x75 'u'
-  {  6987,  28,  21,  28,    3,  -20 },   // 0x76 'v'
-  {  7061,  28,  21,  28,    3,  -20 },   // 0x77 'w'
-  {  7135,  29,  21,  28,    1,  -20 },   // 0x78 'x'
-  {  7212,  32,  30,  28,   -1,  -20 },   // 0x79 'y'
-  {  7332,  25,  21,  28,    4,  -20 },   // 0x7A 'z'
-  {  7398,  17,  37,  28,   10,  -29 },   // 0x7B '{'
-  {  7477,  11,  36,  28,   11,  -28 },   // 0x7C '|'
-  {  7527,  17,  37,  28,    6,  -29 },   // 0x7D '}'
-  {  7606,  23,  10,  28,    5,  -17 } }; // 0x7E '~'
+  {    30,  17,  14,  28,   11,  -28 },   // 0x22 '"'
+  {    59,  24,  34,  28,    5,  -30 },   // 0x23 '#'
+  {   123,  25,  38,  28,    4,  -31 },   // 0x24 '$'
+  {   185,  22,  30,  28,    6,  -28 },   // 0x25 '%'
+  {   235,  21,  28,  28,    5,  -26 },   // 0x26 '&'
+  {   280,   7,  14,  28,   16,  -28 },   // 0x27 '''
+  {   295,  14,  37,  28,   14,  -29 },   // 0x28 '('
+  {   333,  14,  37,  28,    5,  -29 },   // 0x29 ')'
+  {   371,  21,  19,  28,    8,  -28 },   // 0x2A '*'
+  {   401,  24,  26,  28,    5,  -25 },   // 0x2B '+'
+  {   437,  12,  14,  28,    6,   -6 },   // 0x2C ','
+  {   452,  24,   5,  28,    5,  -15 },   // 0x2D '-'
+  {   457,   7,   6,  28,   11,   -4 },   // 0x2E '.'
+  {   461,  28,  38,  28,    3,  -32 },   // 0x2F '/'
+  {   519,  23,  31,  28,    6,  -29 },   // 0x30 '0'
+  {   574,  21,  30,  28,    4,  -29 },   // 0x31 '1'
+  {   617,  26,  30,  28,    3,  -29 },   // 0x32 '2'
+  {   666,  25,  31,  28,    4,  -29 },   // 0x33 '3'
+  {   712,  22,  28,  28,    5,  -27 },   // 0x34 '4'
+  {   755,  25,  31,  28,    4,  -29 },   // 0x35 '5'
+  {   803,  24,  31,  28,    7,  -29 },   // 0x36 '6'
+  {   856,  22,  30,  28,    9,  -29 },   // 0x37 '7'
+  {   903,  23,  31,  28,    6,  -29 },   // 0x38 '8'
+  {   955,  24,  31,  28,    5,  -29 },   // 0x39 '9'
+  {  1007,  10,  22,  28,   11,  -20 },   // 0x3A ':'
+  {  1023,  15,  28,  28,    5,  -20 },   // 0x3B ';'
+  {  1047,  25,  21,  28,    5,  -23 },   // 0x3C '<'
+  {  1076,  26,  14,  28,    4,  -19 },   // 0x3D '='
+  {  1095,  25,  22,  28,    4,  -23 },   // 0x3E '>'
+  {  1124,  19,  29,  28,   10,  -27 },   // 0x3F '?'
+  {  1155,  23,  36,  28,    5,  -28 },   // 0x40 '@'
+  {  1226,  30,  27,  28,    0,  -26 },   // 0x41 'A'
+  {  1276,  29,  27,  28,    1,  -26 },   // 0x42 'B'
+  {  1323,  28,  29,  28,    3,  -27 },   // 0x43 'C'
+  {  1373,  28,  27,  28,    1,  -26 },   // 0x44 'D'
+  {  1423,  29,  27,  28,    1,  -26 },   // 0x45 'E'
+  {  1475,  31,  27,  28,    0,  -26 },   // 0x46 'F'
+  {  1526,  28,  29,  28,    3,  -27 },   // 0x47 'G'
+  {  1578,  30,  27,  28,    1,  -26 },   // 0x48 'H'
+  {  1630,  25,  27,  28,    3,  -26 },   // 0x49 'I'
+  {  1671,  31,  28,  28,    0,  -26 },   // 0x4A 'J'
+  {  1719,  31,  27,  28,    0,  -26 },   // 0x4B 'K'
+  {  1774,  27,  27,  28,    1,  -26 },   // 0x4C 'L'
+  {  1819,  34,  27,  28,    0,  -26 },   // 0x4D 'M'
+  {  1889,  32,  27,  28,    1,  -26 },   // 0x4E 'N'
+  {  1951,  27,  29,  28,    3,  -27 },   // 0x4F 'O'
+  {  2005,  28,  27,  28,    1,  -26 },   // 0x50 'P'
+  {  2049,  27,  35,  28,    3,  -27 },   // 0x51 'Q'
+  {  2114,  29,  27,  28,    0,  -26 },   // 0x52 'R'
+  {  2163,  26,  29,  28,    3,  -27 },   // 0x53 'S'
+  {  2212,  26,  27,  28,    4,  -26 },   // 0x54 'T'
+  {  2264,  28,  28,  28,    4,  -26 },   // 0x55 'U'
+  {  2318,  30,  27,  28,    2,  -26 },   // 0x56 'V'
+  {  2371,  29,  27,  28,    3,  -26 },   // 0x57 'W'
+  {  2436,  32,  27,  28,    0,  -26 },   // 0x58 'X'
+  {  2489,  26,  27,  28,    4,  -26 },   // 0x59 'Y'
+  {  2535,  27,  27,  28,    2,  -26 },   // 0x5A 'Z'
+  {  2583,  18,  37,  28,   10,  -29 },   // 0x5B '['
+  {  2621,  13,  38,  28,   10,  -32 },   // 0x5C '\'
+  {  2660,  18,  37,  28,    5,  -29 },   // 0x5D ']'
+  {  2698,  20,  15,  28,    8,  -29 },   // 0x5E '^'
+  {  2719,  29,   5,  28,   -2,    5 },   // 0x5F '_'
+  {  2726,   8,   8,  28,   13,  -30 },   // 0x60 '`'
+  {  2735,  24,  23,  28,    3,  -21 },   // 0x61 'a'
+  {  2772,  29,  31,  28,    0,  -29 },   // 0x62 'b'
+  {  2827,  25,  23,  28,    3,  -21 },   // 0x63 'c'
+  {  2865,  28,  31,  28,    3,  -29 },   // 0x64 'd'
+  {  2920,  24,  23,  28,    3,  -21 },   // 0x65 'e'
+  {  2953,  28,  30,  28,    4,  -29 },   // 0x66 'f'
+  {  2999,  28,  31,  28,    3,  -21 },   // 0x67 'g'
+  {  3054,  26,  30,  28,    2,  -29 },   // 0x68 'h'
+  {  3108,  23,  29,  28,    3,  -28 },   // 0x69 'i'
+  {  3146,  23,  38,  28,    3,  -28 },   // 0x6A 'j'
+  {  3201,  26,  30,  28,    2,  -29 },   // 0x6B 'k'
+  {  3254,  23,  30,  28,    3,  -29 },   // 0x6C 'l'
+  {  3296,  30,  22,  28,    0,  -21 },   // 0x6D 'm'
+  {  3357,  26,  22,  28,    2,  -21 },   // 0x6E 'n'
+  {  3399,  25,  23,  28,    3,  -21 },   // 0x6F 'o'
+  {  3437,  31,  31,  28,   -1,  -21 },   // 0x70 'p'
+  {  3493,  29,  31,  28,    2,  -21 },   // 0x71 'q'
+  {  3548,  28,  22,  28,    2,  -21 },   // 0x72 'r'
+  {  3584,  23,  23,  28,    4,  -21 },   // 0x73 's'
+  {  3621,  20,  28,  28,    5,  -26 },   // 0x74 't'
+  {  3660,  23,  22,  28,    5,  -20 },   // 0x75 'u'
+  {  3701,  28,  21,  28,    3,  -20 },   // 0x76 'v'
+  {  3740,  28,  21,  28,    3,  -20 },   // 0x77 'w'
+  {  3787,  29,  21,  28,    1,  -20 },   // 0x78 'x'
+  {  3827,  32,  30,  28,   -1,  -20 },   // 0x79 'y'
+  {  3886,  25,  21,  28,    4,  -20 },   // 0x7A 'z'
+  {  3921,  17,  37,  28,   10,  -29 },   // 0x7B '{'
+  {  3959,  11,  36,  28,   11,  -28 },   // 0x7C '|'
+  {  3996,  17,  37,  28,    6,  -29 },   // 0x7D '}'
+  {  4034,  23,  10,  28,    5,  -17 } }; // 0x7E '~'
 
 const GFXfont FreeMonoBoldOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique24pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique24pt7bGlyphs,
-  0x20, 0x7E, 47 };
+  0x20, 0x7E, 47, 1 };
 
-// Approx. 8307 bytes
+// Approx. 4722 bytes
@@ -198,6 +198,6 @@ const GFXglyph FreeMonoBoldOblique9pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeMonoBoldOblique9pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique9pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique9pt7bGlyphs,
-  0x20, 0x7E, 18 };
+  0x20, 0x7E, 18, 0 };
 
 // Approx. 1839 bytes
@@ -1,643 +1,453 @@
 const uint8_t FreeMonoOblique24pt7bBitmaps[] PROGMEM = {
-  0x01, 0xC0, 0xF0, 0x3C, 0x0E, 0x03, 0x81, 0xE0, 0x78, 0x1C, 0x07, 0x01,
-  0xC0, 0xE0, 0x38, 0x0E, 0x03, 0x00, 0xC0, 0x70, 0x1C, 0x06, 0x01, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x83, 0xE0, 0xF8,
-  0x1C, 0x00, 0x7E, 0x3F, 0x7E, 0x3F, 0x7C, 0x3E, 0x7C, 0x3E, 0x7C, 0x3E,
-  0x78, 0x3C, 0xF8, 0x7C, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xE0, 0x70,
-  0xE0, 0x70, 0xE0, 0x70, 0xC0, 0x60, 0x00, 0x18, 0x30, 0x00, 0x61, 0x80,
-  0x01, 0x86, 0x00, 0x04, 0x18, 0x00, 0x30, 0xC0, 0x00, 0xC3, 0x00, 0x03,
-  0x0C, 0x00, 0x18, 0x30, 0x00, 0x61, 0x80, 0x01, 0x86, 0x00, 0x06, 0x18,
-  0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x03, 0x0C, 0x00, 0x18, 0x30, 0x00,
-  0x61, 0x80, 0x01, 0x86, 0x00, 0x06, 0x18, 0x00, 0x30, 0xC0, 0x1F, 0xFF,
-  0xF8, 0x7F, 0xFF, 0xE0, 0x18, 0x30, 0x00, 0x61, 0x80, 0x01, 0x86, 0x00,
-  0x06, 0x18, 0x00, 0x30, 0x40, 0x00, 0xC3, 0x00, 0x03, 0x0C, 0x00, 0x18,
-  0x30, 0x00, 0x61, 0x80, 0x01, 0x86, 0x00, 0x06, 0x18, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x80,
-  0x70, 0x7C, 0x06, 0x00, 0xE0, 0x60, 0x02, 0x07, 0x00, 0x10, 0x30, 0x00,
-  0x01, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xF0, 0x00, 0x07,
-  0xF8, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0xC2, 0x00, 0x06, 0x30, 0x00, 0x61, 0x80, 0x03, 0x1E, 0x00,
-  0x30, 0xFC, 0x07, 0x06, 0x7F, 0xF0, 0x00, 0xFE, 0x00, 0x01, 0x80, 0x00,
-  0x0C, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80,
-  0x00, 0x00, 0x78, 0x00, 0x07, 0xF8, 0x00, 0x38, 0x60, 0x01, 0xC0, 0xC0,
-  0x06, 0x03, 0x00, 0x30, 0x0C, 0x00, 0xC0, 0x30, 0x03, 0x01, 0x80, 0x0C,
-  0x0E, 0x00, 0x38, 0x70, 0x00, 0x7F, 0x81, 0xC0, 0xF8, 0x3F, 0x00, 0x07,
-  0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x01,
-  0x00, 0x78, 0x00, 0x07, 0xF8, 0x00, 0x38, 0x60, 0x01, 0x80, 0xC0, 0x06,
-  0x03, 0x00, 0x30, 0x0C, 0x00, 0xC0, 0x30, 0x03, 0x01, 0x80, 0x0C, 0x0E,
-  0x00, 0x18, 0x70, 0x00, 0x7F, 0x80, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
-  0x0F, 0xF8, 0x03, 0x8E, 0x00, 0xC0, 0x00, 0x38, 0x00, 0x06, 0x00, 0x00,
-  0xC0, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x30, 0x00, 0x06, 0x00, 0x03,
-  0xE0, 0x01, 0xCC, 0x0E, 0x60, 0xC3, 0xD8, 0x18, 0x63, 0x03, 0x18, 0xC0,
-  0x33, 0x18, 0x06, 0xC3, 0x00, 0x70, 0x60, 0x0E, 0x0C, 0x01, 0xC0, 0xC0,
-  0x78, 0x1C, 0x3B, 0xE1, 0xFE, 0x3C, 0x1F, 0x00, 0x00, 0x7E, 0xFD, 0xF3,
-  0xE7, 0xCF, 0x3E, 0x78, 0xF1, 0xE3, 0x87, 0x0E, 0x18, 0x00, 0x00, 0x60,
-  0x18, 0x07, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x80,
-  0x60, 0x1C, 0x03, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0xF0, 0x1C, 0x03, 0x80,
-  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x30,
-  0x06, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x30, 0x02, 0x00, 0x01, 0x80, 0x30,
-  0x06, 0x00, 0xE0, 0x0C, 0x01, 0x80, 0x30, 0x07, 0x00, 0xE0, 0x1C, 0x03,
-  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x38, 0x07, 0x00,
-  0xE0, 0x3C, 0x07, 0x00, 0xE0, 0x38, 0x07, 0x01, 0xC0, 0x38, 0x0E, 0x01,
-  0x80, 0x70, 0x0C, 0x03, 0x00, 0xC0, 0x10, 0x00, 0x00, 0x20, 0x00, 0x18,
-  0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x30, 0x0E, 0x0C, 0x0B,
-  0xF3, 0x3E, 0x3F, 0xFE, 0x01, 0xFC, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0E,
-  0x60, 0x07, 0x18, 0x01, 0x83, 0x00, 0xC0, 0xC0, 0x60, 0x30, 0x00, 0x00,
-  0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x60, 0x00, 0x01, 0x80, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00,
-  0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x30, 0x00, 0x01,
-  0x80, 0x00, 0x06, 0x00, 0x00, 0x18, 0x00, 0x00, 0x60, 0x00, 0x01, 0x80,
-  0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00,
-  0x03, 0xF0, 0x7E, 0x07, 0xC0, 0xF8, 0x0F, 0x81, 0xF0, 0x1E, 0x03, 0xE0,
-  0x3C, 0x07, 0x80, 0x70, 0x0F, 0x00, 0xE0, 0x0C, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x3C, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60,
-  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00,
-  0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00,
-  0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00,
-  0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x00,
-  0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xF8, 0x01,
-  0xC1, 0xC0, 0x38, 0x0E, 0x07, 0x00, 0x60, 0xE0, 0x03, 0x0C, 0x00, 0x31,
-  0x80, 0x03, 0x18, 0x00, 0x33, 0x00, 0x03, 0x30, 0x00, 0x33, 0x00, 0x03,
-  0x20, 0x00, 0x26, 0x00, 0x06, 0x60, 0x00, 0x66, 0x00, 0x06, 0x40, 0x00,
-  0x4C, 0x00, 0x0C, 0xC0, 0x00, 0xCC, 0x00, 0x0C, 0xC0, 0x01, 0x8C, 0x00,
-  0x18, 0xC0, 0x01, 0x8C, 0x00, 0x30, 0xC0, 0x07, 0x06, 0x00, 0xE0, 0x60,
-  0x1C, 0x03, 0x87, 0x80, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0E, 0x00,
-  0x0F, 0x00, 0x0F, 0x80, 0x0E, 0xC0, 0x1C, 0xC0, 0x1C, 0x60, 0x1C, 0x30,
-  0x08, 0x18, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01,
-  0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
-  0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80,
-  0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0x07, 0xE0, 0x00, 0x3F, 0xE0, 0x01, 0xE0, 0xE0, 0x07, 0x00, 0xE0, 0x1C,
-  0x00, 0xE0, 0x30, 0x00, 0xC0, 0xC0, 0x01, 0x81, 0x00, 0x03, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03,
-  0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00,
-  0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xE0,
-  0x00, 0xC3, 0x80, 0x01, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-  0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x1E, 0x07, 0x80, 0xE0, 0x06, 0x03, 0x00,
-  0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C,
-  0x00, 0x00, 0x60, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00,
-  0xFE, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x01,
-  0x80, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0,
-  0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE3, 0x00, 0x07, 0x0E, 0x00,
-  0x38, 0x1E, 0x03, 0xC0, 0x3F, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-  0xE0, 0x00, 0xF8, 0x00, 0x1B, 0x00, 0x06, 0x60, 0x01, 0x8C, 0x00, 0x63,
-  0x00, 0x18, 0x60, 0x07, 0x0C, 0x00, 0xC1, 0x80, 0x30, 0x30, 0x0C, 0x0C,
-  0x03, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x06, 0x00, 0xC1, 0x80, 0x30,
-  0x60, 0x06, 0x18, 0x00, 0xC3, 0xFF, 0xFE, 0x7F, 0xFF, 0xC0, 0x00, 0xC0,
-  0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x03, 0x00,
-  0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x40,
-  0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00,
-  0xC0, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x01, 0xBF, 0xC0, 0x0F, 0xFF,
-  0x80, 0xF8, 0x1E, 0x02, 0x00, 0x30, 0x00, 0x01, 0xC0, 0x00, 0x06, 0x00,
-  0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x06,
-  0x00, 0x00, 0x30, 0x00, 0x03, 0x80, 0x00, 0x18, 0xC0, 0x01, 0x87, 0x00,
-  0x38, 0x1E, 0x07, 0x80, 0x7F, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03,
-  0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x01,
-  0x80, 0x00, 0x18, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0xC0, 0x00,
-  0x0E, 0x00, 0x00, 0x60, 0x00, 0x07, 0x0F, 0x80, 0x31, 0xFF, 0x01, 0x9C,
-  0x3C, 0x0D, 0x80, 0x60, 0xD8, 0x03, 0x87, 0x80, 0x0C, 0x38, 0x00, 0x61,
-  0xC0, 0x03, 0x0C, 0x00, 0x18, 0x60, 0x00, 0xC3, 0x00, 0x0C, 0x18, 0x00,
-  0x60, 0xE0, 0x06, 0x03, 0x00, 0x30, 0x1C, 0x07, 0x00, 0x70, 0x70, 0x01,
-  0xFF, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x0F,
-  0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
-  0x06, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x18, 0x00, 0x0C,
-  0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00, 0x30, 0x00, 0x0C, 0x00,
-  0x06, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x18, 0x00, 0x0C,
-  0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00, 0x00, 0x3F, 0x00, 0x0F,
-  0xFC, 0x01, 0xC1, 0xE0, 0x70, 0x06, 0x06, 0x00, 0x30, 0xC0, 0x03, 0x1C,
-  0x00, 0x31, 0x80, 0x03, 0x18, 0x00, 0x31, 0x80, 0x06, 0x18, 0x00, 0xE0,
-  0xC0, 0x1C, 0x0F, 0x07, 0x80, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0xE0, 0x70,
-  0x18, 0x03, 0x83, 0x00, 0x1C, 0x60, 0x00, 0xC6, 0x00, 0x0C, 0xC0, 0x00,
-  0xCC, 0x00, 0x0C, 0xC0, 0x00, 0xCC, 0x00, 0x18, 0xC0, 0x03, 0x8E, 0x00,
-  0x70, 0x60, 0x0E, 0x07, 0x83, 0xC0, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-  0x0F, 0x80, 0x00, 0xFF, 0x80, 0x0F, 0x07, 0x00, 0x70, 0x0E, 0x03, 0x80,
-  0x18, 0x0C, 0x00, 0x70, 0x60, 0x00, 0xC1, 0x80, 0x03, 0x0C, 0x00, 0x0C,
-  0x30, 0x00, 0x30, 0xC0, 0x01, 0xC3, 0x00, 0x0F, 0x0C, 0x00, 0x6C, 0x38,
-  0x03, 0xF0, 0x60, 0x1D, 0x81, 0xE1, 0xE6, 0x03, 0xFE, 0x18, 0x03, 0xE0,
-  0xC0, 0x00, 0x03, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x60, 0x00, 0x03, 0x00,
-  0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03,
-  0xC0, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x07, 0x83,
-  0xF1, 0xFC, 0x7F, 0x1F, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7E, 0x3F, 0x8F, 0xE3, 0xF0, 0x78,
-  0x00, 0x00, 0x3C, 0x00, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x0F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7E, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x3E,
-  0x00, 0xF8, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x70, 0x01,
-  0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3C, 0x00, 0x01,
-  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
-  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x03,
-  0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0C, 0x00, 0x3F, 0xFF, 0xFF, 0x9F,
-  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-  0x00, 0x06, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
-  0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xFC, 0x78,
-  0x1E, 0xC0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-  0x06, 0x00, 0x06, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xE0, 0x07, 0xC0, 0x07,
-  0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xFE, 0x00, 0xFE,
-  0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xF0, 0x07, 0x07, 0x01, 0xC0,
-  0x70, 0x60, 0x06, 0x1C, 0x00, 0xC3, 0x00, 0x18, 0xC0, 0x03, 0x18, 0x00,
-  0x66, 0x00, 0xFC, 0xC0, 0x7F, 0x98, 0x1C, 0x66, 0x06, 0x0C, 0xC1, 0x81,
-  0x98, 0x30, 0x33, 0x0C, 0x0E, 0x61, 0x81, 0x98, 0x30, 0x33, 0x06, 0x06,
-  0x60, 0xF0, 0xCC, 0x0F, 0xF9, 0x80, 0x7F, 0x30, 0x00, 0x06, 0x00, 0x00,
-  0xC0, 0x00, 0x18, 0x00, 0x03, 0x80, 0x00, 0x30, 0x00, 0x07, 0x00, 0x00,
-  0x70, 0x18, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-  0xFE, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x31, 0x80,
-  0x00, 0x06, 0x30, 0x00, 0x01, 0x86, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x0C,
-  0x1C, 0x00, 0x03, 0x01, 0x80, 0x00, 0x40, 0x30, 0x00, 0x18, 0x06, 0x00,
-  0x06, 0x00, 0xC0, 0x00, 0xC0, 0x18, 0x00, 0x30, 0x01, 0x80, 0x07, 0xFF,
-  0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x60, 0x00, 0xC0, 0x0C, 0x00, 0x18, 0x03,
-  0x00, 0x03, 0x00, 0x40, 0x00, 0x30, 0x18, 0x00, 0x06, 0x06, 0x00, 0x00,
-  0xC0, 0xC0, 0x00, 0x18, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x0F, 0xFC, 0x03,
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x06, 0x00, 0x38, 0x01, 0x80, 0x07,
-  0x00, 0xC0, 0x00, 0xC0, 0x30, 0x00, 0x30, 0x0C, 0x00, 0x0C, 0x03, 0x00,
-  0x03, 0x00, 0xC0, 0x01, 0x80, 0x60, 0x00, 0xC0, 0x18, 0x01, 0xE0, 0x07,
-  0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x00, 0xE0, 0x03, 0x80, 0x30, 0x00, 0x70,
-  0x0C, 0x00, 0x0E, 0x03, 0x00, 0x01, 0x80, 0xC0, 0x00, 0x60, 0x60, 0x00,
-  0x18, 0x18, 0x00, 0x06, 0x06, 0x00, 0x03, 0x01, 0x80, 0x01, 0xC0, 0x60,
-  0x00, 0xE0, 0x30, 0x00, 0x70, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x00,
-  0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFC, 0xC0, 0x3C, 0x0F, 0x60, 0x78, 0x01,
-  0xF0, 0x70, 0x00, 0x70, 0x70, 0x00, 0x18, 0x30, 0x00, 0x0C, 0x30, 0x00,
-  0x06, 0x38, 0x00, 0x02, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00,
-  0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
-  0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x60,
-  0x60, 0x00, 0x60, 0x38, 0x00, 0xE0, 0x0F, 0x01, 0xE0, 0x03, 0xFF, 0xC0,
-  0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0C,
-  0x00, 0xF0, 0x03, 0x00, 0x1C, 0x01, 0xC0, 0x03, 0x80, 0x60, 0x00, 0x60,
-  0x18, 0x00, 0x1C, 0x06, 0x00, 0x03, 0x01, 0x80, 0x00, 0xC0, 0xC0, 0x00,
-  0x30, 0x30, 0x00, 0x0C, 0x0C, 0x00, 0x03, 0x03, 0x00, 0x00, 0xC0, 0xC0,
-  0x00, 0x60, 0x60, 0x00, 0x18, 0x18, 0x00, 0x06, 0x06, 0x00, 0x03, 0x01,
-  0x80, 0x00, 0xC0, 0xE0, 0x00, 0x70, 0x30, 0x00, 0x18, 0x0C, 0x00, 0x0C,
-  0x03, 0x00, 0x06, 0x00, 0xC0, 0x07, 0x00, 0x60, 0x07, 0x80, 0xFF, 0xFF,
-  0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFC,
-  0x01, 0x80, 0x01, 0x80, 0x30, 0x00, 0x60, 0x0C, 0x00, 0x0C, 0x01, 0x80,
-  0x01, 0x80, 0x30, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00,
-  0x30, 0x18, 0x00, 0x06, 0x03, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xF8,
-  0x00, 0x07, 0x03, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x18, 0x0C, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x0C, 0x03, 0x00, 0x01,
-  0x80, 0x60, 0x00, 0x30, 0x0C, 0x00, 0x0C, 0x01, 0x80, 0x01, 0x80, 0x60,
-  0x00, 0x30, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-  0xF0, 0x7F, 0xFF, 0xFF, 0x00, 0x60, 0x00, 0x30, 0x06, 0x00, 0x06, 0x00,
-  0xC0, 0x00, 0x60, 0x0C, 0x00, 0x06, 0x00, 0xC0, 0x00, 0x60, 0x0C, 0x00,
-  0x00, 0x00, 0xC0, 0xC0, 0x00, 0x18, 0x0C, 0x00, 0x01, 0x80, 0xC0, 0x00,
-  0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x38, 0x18, 0x00, 0x03, 0x01,
-  0x80, 0x00, 0x30, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x60,
-  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFC, 0xC0, 0x3C,
-  0x0F, 0xE0, 0x78, 0x01, 0xF0, 0x70, 0x00, 0x30, 0x70, 0x00, 0x18, 0x70,
-  0x00, 0x0C, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
-  0x80, 0x00, 0x01, 0x80, 0x1F, 0xFE, 0xC0, 0x0F, 0xFF, 0x60, 0x00, 0x06,
-  0x30, 0x00, 0x06, 0x18, 0x00, 0x03, 0x0C, 0x00, 0x01, 0x87, 0x00, 0x00,
-  0xC1, 0x80, 0x00, 0xE0, 0xE0, 0x00, 0x60, 0x38, 0x00, 0x70, 0x0F, 0x00,
-  0xF8, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x1F, 0xE0,
-  0x7F, 0x83, 0xFC, 0x03, 0x00, 0x06, 0x00, 0x60, 0x01, 0x80, 0x1C, 0x00,
-  0x30, 0x03, 0x00, 0x06, 0x00, 0x60, 0x00, 0xC0, 0x0C, 0x00, 0x38, 0x01,
-  0x80, 0x06, 0x00, 0x60, 0x00, 0xC0, 0x0C, 0x00, 0x18, 0x01, 0xFF, 0xFF,
-  0x00, 0x3F, 0xFF, 0xC0, 0x06, 0x00, 0x18, 0x01, 0x80, 0x03, 0x00, 0x30,
-  0x00, 0x60, 0x06, 0x00, 0x0C, 0x00, 0xC0, 0x03, 0x00, 0x38, 0x00, 0x60,
-  0x06, 0x00, 0x0C, 0x00, 0xC0, 0x01, 0x80, 0x18, 0x00, 0x70, 0x03, 0x00,
-  0x0C, 0x00, 0xE0, 0x01, 0x80, 0xFF, 0x83, 0xFE, 0x1F, 0xF0, 0x7F, 0xC0,
-  0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00,
-  0x0C, 0x00, 0x00, 0x70, 0x00, 0x01, 0x80, 0x00, 0x06, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00,
-  0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00, 0x60, 0x00, 0x01,
-  0x80, 0x00, 0x06, 0x00, 0x00, 0x38, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00,
-  0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00,
-  0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00,
-  0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x07,
-  0x00, 0x20, 0x00, 0x60, 0x06, 0x00, 0x06, 0x00, 0x60, 0x00, 0x60, 0x06,
-  0x00, 0x06, 0x00, 0x60, 0x00, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0xC0, 0x00,
-  0xC0, 0x0C, 0x00, 0x18, 0x00, 0xE0, 0x03, 0x00, 0x07, 0x00, 0x70, 0x00,
-  0x3C, 0x1C, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03,
-  0xFF, 0x07, 0xF8, 0x3F, 0xF8, 0x3F, 0xC0, 0x18, 0x00, 0x70, 0x00, 0xC0,
-  0x07, 0x00, 0x0C, 0x00, 0x60, 0x00, 0x60, 0x0E, 0x00, 0x03, 0x00, 0xE0,
-  0x00, 0x18, 0x0C, 0x00, 0x00, 0xC1, 0xC0, 0x00, 0x0C, 0x1C, 0x00, 0x00,
-  0x61, 0x80, 0x00, 0x03, 0x3C, 0x00, 0x00, 0x1B, 0x78, 0x00, 0x01, 0xF0,
-  0xE0, 0x00, 0x0F, 0x03, 0x80, 0x00, 0x60, 0x0C, 0x00, 0x03, 0x00, 0x70,
-  0x00, 0x18, 0x01, 0x80, 0x01, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x60, 0x00,
-  0x60, 0x01, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-  0x03, 0x00, 0xFF, 0xE0, 0x1F, 0x87, 0xFF, 0x00, 0x7C, 0x00, 0x07, 0xFF,
-  0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00,
-  0x00, 0xC0, 0x03, 0x00, 0x60, 0x01, 0x80, 0x60, 0x00, 0xC0, 0x30, 0x00,
-  0x60, 0x18, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0E, 0x00, 0x18, 0x06, 0x00,
-  0x0C, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-  0x07, 0xF0, 0x00, 0x7F, 0x01, 0xB0, 0x00, 0xD8, 0x01, 0xB0, 0x00, 0xD8,
-  0x01, 0x98, 0x01, 0x98, 0x01, 0x98, 0x03, 0x30, 0x01, 0x98, 0x03, 0x30,
-  0x03, 0x18, 0x06, 0x30, 0x03, 0x1C, 0x0C, 0x30, 0x03, 0x0C, 0x0C, 0x30,
-  0x03, 0x0C, 0x18, 0x60, 0x07, 0x0C, 0x30, 0x60, 0x06, 0x0C, 0x30, 0x60,
-  0x06, 0x06, 0x60, 0x60, 0x06, 0x06, 0xC0, 0x60, 0x06, 0x06, 0xC0, 0xC0,
-  0x0C, 0x07, 0x80, 0xC0, 0x0C, 0x03, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0,
-  0x0C, 0x00, 0x01, 0xC0, 0x0C, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80,
-  0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0xFF, 0x80, 0x3F, 0xE0,
-  0xFF, 0x80, 0x3F, 0xE0, 0x07, 0xE0, 0x0F, 0xFC, 0x3F, 0x80, 0x3F, 0xF0,
-  0x0F, 0x00, 0x06, 0x00, 0x3C, 0x00, 0x10, 0x01, 0x98, 0x00, 0xC0, 0x06,
-  0x60, 0x03, 0x00, 0x19, 0xC0, 0x0C, 0x00, 0x63, 0x00, 0x30, 0x01, 0x0C,
-  0x01, 0x80, 0x0C, 0x18, 0x06, 0x00, 0x30, 0x60, 0x18, 0x00, 0xC1, 0xC0,
-  0x60, 0x03, 0x03, 0x01, 0x00, 0x08, 0x0C, 0x0C, 0x00, 0x60, 0x18, 0x30,
-  0x01, 0x80, 0x60, 0xC0, 0x06, 0x01, 0xC3, 0x00, 0x18, 0x03, 0x18, 0x00,
-  0xC0, 0x0C, 0x60, 0x03, 0x00, 0x19, 0x80, 0x0C, 0x00, 0x66, 0x00, 0x30,
-  0x01, 0xD8, 0x00, 0x80, 0x03, 0xC0, 0x06, 0x00, 0x0F, 0x00, 0xFF, 0xC0,
-  0x1C, 0x03, 0xFE, 0x00, 0x70, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xF0,
-  0x00, 0xF0, 0x78, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x06,
-  0x0C, 0x00, 0x06, 0x18, 0x00, 0x07, 0x38, 0x00, 0x03, 0x30, 0x00, 0x03,
-  0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0xC0, 0x00, 0x03,
-  0xC0, 0x00, 0x03, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0x06,
-  0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x1C, 0xC0, 0x00, 0x18, 0x60, 0x00, 0x30,
-  0x60, 0x00, 0x70, 0x70, 0x00, 0xE0, 0x38, 0x01, 0xC0, 0x1E, 0x0F, 0x00,
-  0x0F, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-  0xC0, 0x06, 0x00, 0x78, 0x01, 0x80, 0x06, 0x00, 0xC0, 0x01, 0xC0, 0x30,
-  0x00, 0x30, 0x0C, 0x00, 0x0C, 0x03, 0x00, 0x03, 0x00, 0xC0, 0x01, 0xC0,
-  0x60, 0x00, 0x60, 0x18, 0x00, 0x30, 0x06, 0x00, 0x18, 0x01, 0x80, 0x3C,
-  0x00, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06,
-  0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7F,
-  0xF0, 0x00, 0xF0, 0x78, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x0E, 0x0E, 0x00,
-  0x06, 0x0C, 0x00, 0x06, 0x18, 0x00, 0x03, 0x38, 0x00, 0x03, 0x30, 0x00,
-  0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0xC0, 0x00,
-  0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0x06, 0xC0, 0x00,
-  0x06, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x1C, 0xC0, 0x00, 0x18, 0x60, 0x00,
-  0x30, 0x60, 0x00, 0x70, 0x30, 0x00, 0xE0, 0x38, 0x01, 0xC0, 0x0E, 0x0F,
-  0x00, 0x07, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xF8,
-  0x30, 0x3F, 0xFF, 0xF0, 0x78, 0x0F, 0x80, 0x07, 0xFF, 0xFC, 0x01, 0xFF,
-  0xFF, 0xC0, 0x06, 0x00, 0x78, 0x01, 0x80, 0x0E, 0x00, 0xC0, 0x01, 0xC0,
-  0x30, 0x00, 0x30, 0x0C, 0x00, 0x0C, 0x03, 0x00, 0x03, 0x00, 0xC0, 0x00,
-  0xC0, 0x60, 0x00, 0x60, 0x18, 0x00, 0x30, 0x06, 0x00, 0x38, 0x01, 0x80,
-  0x3C, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0C, 0x07, 0x80, 0x03,
-  0x00, 0x70, 0x00, 0xC0, 0x0E, 0x00, 0x60, 0x01, 0x80, 0x18, 0x00, 0x70,
-  0x06, 0x00, 0x0C, 0x01, 0x80, 0x03, 0x80, 0x60, 0x00, 0x60, 0x30, 0x00,
-  0x1C, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-  0x7F, 0xF3, 0x00, 0xE0, 0x3B, 0x03, 0x80, 0x0F, 0x07, 0x00, 0x0E, 0x06,
-  0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x0C,
-  0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-  0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00,
-  0x00, 0x18, 0x00, 0x00, 0x18, 0x20, 0x00, 0x18, 0x60, 0x00, 0x18, 0x60,
-  0x00, 0x30, 0x60, 0x00, 0x70, 0xF0, 0x00, 0xE0, 0xF8, 0x01, 0xC0, 0xDC,
-  0x07, 0x80, 0x8F, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x3F,
-  0xFF, 0xFE, 0x30, 0x18, 0x06, 0x60, 0x18, 0x06, 0x60, 0x18, 0x06, 0x60,
-  0x38, 0x0C, 0x60, 0x30, 0x04, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01,
-  0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0xFF,
-  0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0xDF, 0xF0, 0x3F, 0xF1, 0x80, 0x00, 0x60,
-  0x60, 0x00, 0x30, 0x18, 0x00, 0x0C, 0x06, 0x00, 0x03, 0x03, 0x80, 0x00,
-  0xC0, 0xC0, 0x00, 0x30, 0x30, 0x00, 0x18, 0x0C, 0x00, 0x06, 0x03, 0x00,
-  0x01, 0x81, 0xC0, 0x00, 0x60, 0x60, 0x00, 0x18, 0x18, 0x00, 0x0C, 0x06,
-  0x00, 0x03, 0x01, 0x80, 0x00, 0xC0, 0xC0, 0x00, 0x30, 0x30, 0x00, 0x1C,
-  0x0C, 0x00, 0x06, 0x03, 0x00, 0x01, 0x80, 0xC0, 0x00, 0xC0, 0x30, 0x00,
-  0x70, 0x0E, 0x00, 0x38, 0x01, 0xC0, 0x1C, 0x00, 0x38, 0x1E, 0x00, 0x07,
-  0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x07,
-  0xFC, 0xE0, 0x00, 0x0C, 0x0C, 0x00, 0x03, 0x01, 0x80, 0x00, 0x60, 0x30,
-  0x00, 0x18, 0x06, 0x00, 0x02, 0x00, 0xC0, 0x00, 0xC0, 0x0C, 0x00, 0x30,
-  0x01, 0x80, 0x06, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x60, 0x00, 0xC0,
-  0x0C, 0x00, 0x18, 0x03, 0x00, 0x01, 0x80, 0xC0, 0x00, 0x30, 0x18, 0x00,
-  0x06, 0x06, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x18, 0x30, 0x00, 0x03, 0x8C,
-  0x00, 0x00, 0x31, 0x80, 0x00, 0x06, 0x60, 0x00, 0x00, 0xD8, 0x00, 0x00,
-  0x1B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xFF, 0xC0,
-  0x7F, 0xFF, 0xF8, 0x0F, 0xF8, 0xC0, 0x00, 0x0C, 0x18, 0x00, 0x01, 0x83,
-  0x00, 0x00, 0x30, 0x60, 0x08, 0x0C, 0x0C, 0x07, 0x01, 0x81, 0x81, 0xE0,
-  0x30, 0x60, 0x2C, 0x0C, 0x0C, 0x0D, 0x81, 0x81, 0x81, 0x30, 0x30, 0x30,
-  0x66, 0x0C, 0x06, 0x08, 0xC1, 0x80, 0xC3, 0x0C, 0x30, 0x18, 0x41, 0x8C,
-  0x03, 0x18, 0x31, 0x80, 0x62, 0x06, 0x30, 0x0C, 0xC0, 0xCC, 0x03, 0x10,
-  0x19, 0x80, 0x66, 0x03, 0x30, 0x0C, 0x80, 0x6C, 0x01, 0xB0, 0x0D, 0x80,
-  0x34, 0x01, 0xB0, 0x07, 0x80, 0x3C, 0x00, 0xE0, 0x07, 0x80, 0x1C, 0x00,
-  0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x1F, 0xC0, 0x3F, 0xC0, 0x30, 0x00,
-  0x30, 0x01, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x30, 0x00, 0x18, 0x03, 0x00,
-  0x00, 0xE0, 0x30, 0x00, 0x03, 0x03, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x00,
-  0x63, 0x00, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x30,
-  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x36, 0x00, 0x00, 0x03, 0x38, 0x00,
-  0x00, 0x30, 0xC0, 0x00, 0x03, 0x07, 0x00, 0x00, 0x30, 0x18, 0x00, 0x03,
-  0x00, 0x60, 0x00, 0x30, 0x03, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
-  0x70, 0x03, 0x00, 0x01, 0x80, 0xFF, 0x80, 0xFF, 0x07, 0xFC, 0x07, 0xF8,
-  0x00, 0x7F, 0x80, 0x7F, 0x7F, 0x00, 0x7F, 0x1C, 0x00, 0x18, 0x0C, 0x00,
-  0x30, 0x0C, 0x00, 0x70, 0x06, 0x00, 0xE0, 0x06, 0x00, 0xC0, 0x03, 0x01,
-  0x80, 0x03, 0x03, 0x00, 0x01, 0x86, 0x00, 0x01, 0x8C, 0x00, 0x00, 0xD8,
-  0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0,
-  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-  0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
-  0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFF,
-  0xF8, 0x0C, 0x00, 0x30, 0x10, 0x00, 0xC0, 0x60, 0x03, 0x80, 0xC0, 0x0E,
-  0x01, 0x80, 0x38, 0x03, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x80, 0x00, 0x06, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x60, 0x00, 0x01, 0x80, 0x00, 0x06, 0x00, 0x60, 0x18,
-  0x00, 0xC0, 0x60, 0x01, 0x81, 0x80, 0x02, 0x06, 0x00, 0x0C, 0x18, 0x00,
-  0x18, 0x60, 0x00, 0x30, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x80, 0x01, 0xFE,
-  0x03, 0xFC, 0x06, 0x00, 0x08, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01,
-  0x80, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x40, 0x01, 0x80,
-  0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x60, 0x00, 0xC0, 0x01,
-  0x80, 0x03, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x80,
-  0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x20, 0x00, 0xFF, 0x01,
-  0xFE, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x60, 0x18, 0x07, 0x00, 0xC0,
-  0x30, 0x0C, 0x03, 0x80, 0x60, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x03,
-  0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18,
-  0x06, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x04, 0x01, 0xFE,
-  0x03, 0xFC, 0x00, 0x10, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00,
-  0x04, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x00, 0x06,
-  0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00,
-  0x06, 0x00, 0x08, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x06,
-  0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x01, 0x80, 0xFF, 0x01,
-  0xFE, 0x00, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x07, 0x80, 0x03, 0x60, 0x01,
-  0x8C, 0x00, 0xC3, 0x80, 0xE0, 0x60, 0x70, 0x1C, 0x38, 0x03, 0x1C, 0x00,
-  0x6E, 0x00, 0x1F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC3, 0x86, 0x0C, 0x18, 0x70, 0xC0, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x80,
-  0x78, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x18, 0x00, 0x00, 0x60, 0x00,
-  0x01, 0x80, 0x00, 0x06, 0x00, 0x00, 0x38, 0x03, 0xFC, 0xC0, 0x7F, 0xFF,
-  0x07, 0xC0, 0x0C, 0x38, 0x00, 0x31, 0xC0, 0x01, 0xCE, 0x00, 0x06, 0x30,
-  0x00, 0x18, 0xC0, 0x00, 0xE3, 0x00, 0x07, 0x8E, 0x00, 0x7C, 0x1C, 0x0F,
-  0x3F, 0x3F, 0xF0, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0x00, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x06, 0x07, 0xE0, 0x00, 0xC3,
-  0xFF, 0x00, 0x19, 0xC0, 0xF0, 0x03, 0x60, 0x07, 0x00, 0xD8, 0x00, 0x60,
-  0x1E, 0x00, 0x0E, 0x03, 0x80, 0x00, 0xC0, 0x60, 0x00, 0x18, 0x0C, 0x00,
-  0x03, 0x03, 0x00, 0x00, 0x60, 0x60, 0x00, 0x0C, 0x0C, 0x00, 0x01, 0x81,
-  0x80, 0x00, 0x60, 0x70, 0x00, 0x0C, 0x0E, 0x00, 0x03, 0x01, 0xC0, 0x00,
-  0x60, 0x3C, 0x00, 0x18, 0x05, 0x80, 0x06, 0x01, 0xB8, 0x01, 0x83, 0xF3,
-  0xC1, 0xE0, 0x7E, 0x3F, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-  0x07, 0xFF, 0x30, 0x38, 0x0F, 0xC1, 0x80, 0x1F, 0x0C, 0x00, 0x18, 0x60,
-  0x00, 0x63, 0x00, 0x01, 0x9C, 0x00, 0x06, 0x60, 0x00, 0x01, 0x80, 0x00,
-  0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C,
-  0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x80, 0x00, 0xC7, 0x00,
-  0x0E, 0x0F, 0x01, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-  0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00,
-  0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0xFC, 0x0C, 0x01,
-  0xFF, 0x86, 0x01, 0xC0, 0xE3, 0x03, 0x80, 0x1B, 0x03, 0x80, 0x05, 0x81,
-  0x80, 0x03, 0xC1, 0x80, 0x00, 0xE1, 0x80, 0x00, 0x60, 0xC0, 0x00, 0x30,
-  0x60, 0x00, 0x18, 0x60, 0x00, 0x0C, 0x30, 0x00, 0x06, 0x18, 0x00, 0x02,
-  0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x83, 0x00, 0x01, 0xC1, 0xC0, 0x01,
-  0xE0, 0x60, 0x01, 0xE0, 0x38, 0x01, 0xB0, 0x0F, 0x03, 0x9F, 0x03, 0xFF,
-  0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xFF, 0x80, 0x78,
-  0x0F, 0x03, 0x80, 0x0E, 0x1C, 0x00, 0x18, 0xE0, 0x00, 0x73, 0x00, 0x00,
-  0xD8, 0x00, 0x03, 0x60, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x38, 0x00,
-  0x00, 0x60, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x03, 0x07, 0x80, 0xF8,
-  0x0F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-  0xF0, 0x00, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x07, 0xFF, 0xFC, 0x03,
-  0xFF, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x60, 0x00,
-  0x00, 0x18, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xC0,
-  0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
-  0x80, 0x00, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFE,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x87, 0xC1, 0xE0, 0xF3, 0xE1, 0xC0,
-  0x1B, 0x01, 0xC0, 0x07, 0x81, 0xC0, 0x03, 0xC0, 0xC0, 0x00, 0xE0, 0xC0,
-  0x00, 0x60, 0x60, 0x00, 0x30, 0x60, 0x00, 0x18, 0x30, 0x00, 0x0C, 0x18,
-  0x00, 0x06, 0x0C, 0x00, 0x06, 0x06, 0x00, 0x03, 0x03, 0x00, 0x03, 0x81,
-  0xC0, 0x01, 0xC0, 0x60, 0x01, 0xC0, 0x38, 0x03, 0x60, 0x0F, 0x07, 0x30,
-  0x03, 0xFF, 0x18, 0x00, 0x7E, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01,
-  0x80, 0x00, 0x03, 0x80, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x07,
-  0xE0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x83, 0xF0, 0x01,
-  0x8F, 0xF8, 0x01, 0x98, 0x1C, 0x03, 0xB0, 0x0E, 0x03, 0x40, 0x06, 0x03,
-  0x80, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x06, 0x07, 0x00, 0x06, 0x06,
-  0x00, 0x0E, 0x06, 0x00, 0x0E, 0x06, 0x00, 0x0E, 0x06, 0x00, 0x0C, 0x0C,
-  0x00, 0x0C, 0x0C, 0x00, 0x1C, 0x0C, 0x00, 0x1C, 0x0C, 0x00, 0x18, 0x0C,
-  0x00, 0x18, 0x18, 0x00, 0x18, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0x00,
-  0x07, 0x00, 0x00, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x1F,
-  0xF0, 0x00, 0x06, 0x00, 0x01, 0xC0, 0x00, 0x30, 0x00, 0x06, 0x00, 0x00,
-  0xC0, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x03,
-  0x00, 0x00, 0x60, 0x00, 0x1C, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x0C,
-  0x00, 0x01, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x70, 0x00,
-  0x07, 0x00, 0x00, 0x70, 0x00, 0x06, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xF0,
-  0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06,
-  0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x00,
-  0xC0, 0x00, 0x0C, 0x00, 0x01, 0xC0, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00,
-  0x18, 0x00, 0x01, 0x80, 0x00, 0x38, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00,
-  0x03, 0x00, 0x00, 0x30, 0x00, 0x06, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00,
-  0x03, 0x80, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0,
-  0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xC1,
-  0xFF, 0x00, 0x80, 0x70, 0x01, 0x80, 0xC0, 0x01, 0x83, 0x80, 0x01, 0x87,
-  0x00, 0x01, 0x8C, 0x00, 0x03, 0x38, 0x00, 0x03, 0x70, 0x00, 0x03, 0xF8,
-  0x00, 0x03, 0x9C, 0x00, 0x03, 0x0C, 0x00, 0x06, 0x0E, 0x00, 0x06, 0x07,
-  0x00, 0x06, 0x03, 0x80, 0x06, 0x01, 0x80, 0x04, 0x00, 0xC0, 0x0C, 0x00,
-  0xE0, 0xFC, 0x03, 0xFE, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xE0,
-  0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x01, 0x80,
-  0x00, 0x70, 0x00, 0x0C, 0x00, 0x01, 0x80, 0x00, 0x30, 0x00, 0x06, 0x00,
-  0x01, 0x80, 0x00, 0x30, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x18, 0x00,
-  0x06, 0x00, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0xE0, 0x00,
-  0x18, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x1E, 0x07, 0x81, 0xE7, 0xE1, 0xF8, 0x3D, 0x8E, 0xE3,
-  0x81, 0xE0, 0xF8, 0x30, 0x38, 0x1E, 0x06, 0x06, 0x03, 0x80, 0xC1, 0x80,
-  0x60, 0x18, 0x30, 0x0C, 0x03, 0x06, 0x01, 0x80, 0x60, 0xC0, 0x30, 0x08,
-  0x18, 0x0C, 0x03, 0x06, 0x01, 0x80, 0x60, 0xC0, 0x30, 0x0C, 0x18, 0x06,
-  0x01, 0x83, 0x00, 0x80, 0x60, 0x40, 0x30, 0x0C, 0x18, 0x06, 0x01, 0x83,
-  0x00, 0xC0, 0x30, 0x60, 0x18, 0x06, 0x7F, 0x03, 0xC1, 0xFF, 0xE0, 0xF8,
-  0x3E, 0x00, 0x03, 0xE0, 0x1F, 0x1F, 0xF0, 0x3E, 0x60, 0x70, 0x0F, 0x80,
-  0x70, 0x3C, 0x00, 0x60, 0x70, 0x00, 0xC0, 0xC0, 0x01, 0x81, 0x80, 0x03,
-  0x07, 0x00, 0x06, 0x0C, 0x00, 0x1C, 0x18, 0x00, 0x30, 0x30, 0x00, 0x60,
-  0x60, 0x00, 0xC1, 0xC0, 0x01, 0x83, 0x00, 0x06, 0x06, 0x00, 0x0C, 0x0C,
-  0x00, 0x18, 0x18, 0x00, 0x30, 0x70, 0x00, 0x67, 0xFC, 0x07, 0xFF, 0xF0,
-  0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xFF, 0x00, 0x3C, 0x0F, 0x01, 0xC0,
-  0x1C, 0x0C, 0x00, 0x38, 0x60, 0x00, 0x63, 0x00, 0x00, 0xDC, 0x00, 0x03,
-  0x60, 0x00, 0x0D, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
-  0x00, 0x1B, 0x00, 0x00, 0x6C, 0x00, 0x03, 0xB0, 0x00, 0x0C, 0x60, 0x00,
-  0x61, 0xC0, 0x03, 0x03, 0x80, 0x38, 0x0F, 0x03, 0xC0, 0x0F, 0xFE, 0x00,
-  0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x8F, 0xFE, 0x00, 0xFC,
-  0xE0, 0x78, 0x00, 0xCC, 0x00, 0xE0, 0x06, 0xC0, 0x03, 0x00, 0x3C, 0x00,
-  0x1C, 0x01, 0xC0, 0x00, 0x60, 0x0C, 0x00, 0x03, 0x00, 0xE0, 0x00, 0x18,
-  0x06, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x06, 0x01, 0x80, 0x00, 0x30, 0x0C,
-  0x00, 0x03, 0x00, 0xE0, 0x00, 0x18, 0x07, 0x00, 0x01, 0x80, 0x3C, 0x00,
-  0x1C, 0x01, 0xE0, 0x01, 0xC0, 0x0D, 0x80, 0x1C, 0x00, 0xCF, 0x03, 0xC0,
-  0x06, 0x3F, 0xF8, 0x00, 0x30, 0x7F, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0C,
-  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x30, 0x00,
-  0x00, 0x01, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-  0x7F, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0xE1, 0xF0, 0x78,
-  0x1C, 0xFC, 0x38, 0x01, 0xB0, 0x1C, 0x00, 0x2C, 0x0E, 0x00, 0x0F, 0x03,
-  0x00, 0x01, 0xC1, 0x80, 0x00, 0x60, 0x60, 0x00, 0x18, 0x30, 0x00, 0x06,
-  0x0C, 0x00, 0x01, 0x83, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x30, 0x30, 0x00,
-  0x0C, 0x0C, 0x00, 0x07, 0x03, 0x80, 0x03, 0xC0, 0x60, 0x01, 0xB0, 0x1C,
-  0x00, 0xD8, 0x03, 0xC0, 0xE6, 0x00, 0x7F, 0xF1, 0x80, 0x07, 0xE0, 0x60,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF0, 0x3E, 0x03, 0xF8, 0x7F,
-  0xC0, 0x18, 0xF0, 0x60, 0x0C, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xC0,
-  0x00, 0x03, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60,
-  0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C,
-  0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
-  0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-  0x0F, 0xFE, 0xC0, 0xF0, 0x3E, 0x0E, 0x00, 0x70, 0xE0, 0x01, 0x06, 0x00,
-  0x08, 0x30, 0x00, 0x41, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x3F, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x18, 0x00, 0x00,
-  0xCC, 0x00, 0x06, 0x60, 0x00, 0x33, 0x00, 0x03, 0x3C, 0x00, 0x71, 0xF8,
-  0x0F, 0x0D, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01,
-  0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x70, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0,
-  0x00, 0xE0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E,
-  0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x03, 0x38, 0x0F,
-  0x9F, 0xFF, 0x03, 0xF8, 0x00, 0xFC, 0x03, 0xFF, 0xE0, 0x1F, 0xC6, 0x00,
-  0x0C, 0x30, 0x00, 0x61, 0x80, 0x03, 0x0C, 0x00, 0x18, 0x60, 0x01, 0x86,
-  0x00, 0x0C, 0x30, 0x00, 0x61, 0x80, 0x03, 0x0C, 0x00, 0x18, 0x60, 0x01,
-  0x86, 0x00, 0x0C, 0x30, 0x00, 0x61, 0x80, 0x03, 0x0C, 0x00, 0x38, 0x60,
-  0x07, 0x83, 0x80, 0x6C, 0x1E, 0x1E, 0x7C, 0x7F, 0xE3, 0xE0, 0xF8, 0x00,
-  0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xF0, 0x3F, 0xF1, 0xC0, 0x00, 0xC0, 0x30,
-  0x00, 0x60, 0x0C, 0x00, 0x18, 0x03, 0x00, 0x0C, 0x00, 0xE0, 0x06, 0x00,
-  0x18, 0x01, 0x80, 0x06, 0x00, 0xC0, 0x01, 0x80, 0x30, 0x00, 0x60, 0x18,
-  0x00, 0x0C, 0x0C, 0x00, 0x03, 0x03, 0x00, 0x00, 0xC1, 0x80, 0x00, 0x30,
-  0xC0, 0x00, 0x06, 0x30, 0x00, 0x01, 0x98, 0x00, 0x00, 0x6C, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x3F,
-  0xCC, 0x00, 0x03, 0x06, 0x00, 0x01, 0x83, 0x00, 0x01, 0x81, 0x81, 0x80,
-  0xC0, 0xC1, 0xE0, 0x60, 0x60, 0xF0, 0x60, 0x30, 0xD8, 0x30, 0x18, 0x6C,
-  0x30, 0x0C, 0x66, 0x18, 0x06, 0x33, 0x18, 0x03, 0x31, 0x8C, 0x01, 0x98,
-  0x66, 0x00, 0xD8, 0x36, 0x00, 0x6C, 0x1B, 0x00, 0x3C, 0x0F, 0x00, 0x1E,
-  0x07, 0x80, 0x0E, 0x03, 0x80, 0x07, 0x01, 0xC0, 0x00, 0x07, 0xF0, 0x3F,
-  0xC3, 0xFC, 0x0F, 0xF0, 0x38, 0x00, 0x60, 0x07, 0x00, 0x70, 0x00, 0xE0,
-  0x38, 0x00, 0x18, 0x1C, 0x00, 0x03, 0x0C, 0x00, 0x00, 0xEE, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xDC, 0x00,
-  0x00, 0xE3, 0x80, 0x00, 0x70, 0x70, 0x00, 0x38, 0x0E, 0x00, 0x18, 0x01,
-  0x80, 0x1C, 0x00, 0x30, 0x0E, 0x00, 0x0E, 0x0F, 0xF0, 0x3F, 0xE3, 0xFC,
-  0x0F, 0xF8, 0x03, 0xF8, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0xC0, 0x60, 0x00,
-  0x30, 0x01, 0x80, 0x01, 0x80, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-  0x03, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0xC0, 0x00, 0x60, 0x0C, 0x00, 0x03,
-  0x00, 0x60, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x60, 0x60, 0x00, 0x03, 0x06,
-  0x00, 0x00, 0x1C, 0x30, 0x00, 0x00, 0x63, 0x00, 0x00, 0x03, 0x30, 0x00,
-  0x00, 0x19, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-  0x1C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x60,
-  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x30, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-  0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xC3, 0x00, 0x0C, 0x18, 0x00, 0xC0, 0xC0,
-  0x0C, 0x00, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00,
-  0x01, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x18, 0x00, 0x01, 0x80,
-  0x00, 0x18, 0x00, 0x01, 0x80, 0x0C, 0x18, 0x00, 0x61, 0x80, 0x02, 0x1F,
-  0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x0E, 0x00, 0x7C, 0x01, 0xC0, 0x03,
-  0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x01, 0xC0, 0x03, 0x00,
-  0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x01, 0xC0, 0x0F, 0x00, 0xF8,
-  0x01, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x80,
-  0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0xE0, 0x01, 0x80, 0x03,
-  0x00, 0x06, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x01, 0x80, 0xC0,
-  0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x40,
-  0x60, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0xC0, 0x60,
-  0x30, 0x18, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x80, 0x80, 0xC0, 0x60, 0x30,
-  0x00, 0x01, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06,
-  0x00, 0x0C, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00,
-  0x0C, 0x00, 0x18, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x7C, 0x03,
-  0xC0, 0x0E, 0x00, 0x18, 0x00, 0x70, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00,
-  0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x00, 0x0E,
-  0x00, 0xF8, 0x01, 0xC0, 0x00, 0x0F, 0x00, 0x01, 0xFC, 0x03, 0x70, 0xE0,
-  0x7E, 0x07, 0x1E, 0xC0, 0x3F, 0x80, 0x01, 0xE0 };
+  0x73, 0x64, 0x64, 0x63, 0x73, 0x64, 0x64, 0x63, 0x73, 0x73, 0x63, 0x73,
+  0x73, 0x72, 0x82, 0x73, 0x73, 0x72, 0x82, 0xFF, 0xFF, 0x63, 0x65, 0x55,
+  0x55, 0x63, 0x60, 0x16, 0x36, 0x16, 0x36, 0x15, 0x45, 0x25, 0x45, 0x25,
+  0x45, 0x24, 0x54, 0x25, 0x45, 0x24, 0x54, 0x34, 0x54, 0x34, 0x54, 0x33,
+  0x63, 0x43, 0x63, 0x43, 0x63, 0x42, 0x72, 0x50, 0xB2, 0x52, 0xD2, 0x42,
+  0xE2, 0x42, 0xE1, 0x52, 0xD2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xD2, 0x52,
+  0xD2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0x8F, 0x43, 0xF4, 0x82, 0x42, 0xD2,
+  0x52, 0xD2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xD2, 0x42, 0x9F, 0x34, 0xF3,
+  0x82, 0x52, 0xD2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xD2, 0x51, 0xE2, 0x42,
+  0xE2, 0x42, 0xD2, 0x52, 0xD2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xB0, 0xE2,
+  0xF4, 0x2F, 0x41, 0xF2, 0x6D, 0x91, 0x28, 0x35, 0x57, 0x29, 0x36, 0x2B,
+  0x16, 0x3B, 0x16, 0x2F, 0x42, 0xF4, 0x2F, 0x43, 0xF4, 0x5F, 0x28, 0xF1,
+  0x7F, 0x34, 0xF4, 0x3F, 0x42, 0xF4, 0x24, 0x1E, 0x23, 0x2D, 0x24, 0x2D,
+  0x23, 0x4B, 0x24, 0x67, 0x35, 0x22, 0xBC, 0x7F, 0x12, 0xF4, 0x2F, 0x42,
+  0xF3, 0x2F, 0x42, 0xF4, 0x2C, 0x94, 0xF1, 0x8D, 0x34, 0x2C, 0x36, 0x2B,
+  0x27, 0x2A, 0x28, 0x2A, 0x28, 0x2A, 0x27, 0x2B, 0x26, 0x3B, 0x34, 0x3D,
+  0x86, 0x36, 0x55, 0x6D, 0x5D, 0x6D, 0x6D, 0x5F, 0x04, 0xF3, 0x19, 0x4F,
+  0x18, 0xD3, 0x42, 0xC2, 0x72, 0xB2, 0x72, 0xA2, 0x82, 0xA2, 0x82, 0xA2,
+  0x72, 0xB2, 0x63, 0xC2, 0x43, 0xD8, 0xF1, 0x49, 0xB4, 0xD9, 0x93, 0x33,
+  0x92, 0xF1, 0x3F, 0x12, 0xF2, 0x2F, 0x22, 0xF3, 0x1F, 0x32, 0xF2, 0x2F,
+  0x05, 0xC3, 0x22, 0x63, 0x22, 0x52, 0x44, 0x12, 0x62, 0x42, 0x32, 0x62,
+  0x32, 0x32, 0x82, 0x22, 0x32, 0x82, 0x12, 0x42, 0x93, 0x52, 0x93, 0x52,
+  0x93, 0x62, 0x74, 0x63, 0x43, 0x15, 0x48, 0x34, 0x55, 0xB0, 0x16, 0x16,
+  0x15, 0x25, 0x25, 0x24, 0x25, 0x24, 0x34, 0x34, 0x33, 0x43, 0x43, 0x42,
+  0x50, 0x92, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
+  0x83, 0x83, 0x73, 0x83, 0x83, 0x74, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x92, 0x92, 0x92, 0x93, 0x92, 0x92, 0xA1, 0x70,
+  0x72, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x93, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x73, 0x83, 0x83, 0x74, 0x73, 0x83, 0x73,
+  0x83, 0x73, 0x83, 0x73, 0x82, 0x83, 0x82, 0x82, 0x82, 0x91, 0xA0, 0xA1,
+  0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x02, 0xF1, 0x28, 0x35, 0x26, 0x11, 0x62,
+  0x22, 0x53, 0xD8, 0x7C, 0x4D, 0x5C, 0x32, 0x2A, 0x33, 0x2A, 0x25, 0x28,
+  0x26, 0x27, 0x27, 0x26, 0xC2, 0xF5, 0x2F, 0x52, 0xF4, 0x3F, 0x42, 0xF5,
+  0x2F, 0x52, 0xF5, 0x2F, 0x42, 0xF5, 0x2A, 0xFF, 0xDB, 0x2F, 0x42, 0xF5,
+  0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF4, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xC0,
+  0x66, 0x56, 0x65, 0x65, 0x75, 0x65, 0x74, 0x75, 0x74, 0x74, 0x83, 0x84,
+  0x83, 0x92, 0xA0, 0x0F, 0xFD, 0x10, 0x24, 0x2F, 0xB2, 0x42, 0xF7, 0x2F,
+  0x72, 0xF6, 0x2F, 0x62, 0xF7, 0x2F, 0x62, 0xF6, 0x2F, 0x72, 0xF6, 0x2F,
+  0x62, 0xF7, 0x2F, 0x62, 0xF6, 0x2F, 0x63, 0xF6, 0x2F, 0x62, 0xF6, 0x3F,
+  0x62, 0xF6, 0x2F, 0x63, 0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x72, 0xF6, 0x2F,
+  0x62, 0xF7, 0x2F, 0x62, 0xF6, 0x2F, 0x72, 0xF6, 0x2F, 0x62, 0xF6, 0x3F,
+  0x62, 0xF7, 0x1F, 0x80, 0xA6, 0xC9, 0xA3, 0x53, 0x83, 0x73, 0x63, 0x92,
+  0x53, 0xB2, 0x42, 0xC2, 0x32, 0xD2, 0x32, 0xD2, 0x22, 0xE2, 0x22, 0xE2,
+  0x22, 0xE2, 0x21, 0xF0, 0x12, 0x2E, 0x22, 0x2E, 0x22, 0x2E, 0x22, 0x1F,
+  0x01, 0x22, 0xE2, 0x22, 0xE2, 0x22, 0xE2, 0x22, 0xD2, 0x32, 0xD2, 0x32,
+  0xD2, 0x32, 0xC2, 0x42, 0xB3, 0x52, 0x93, 0x62, 0x83, 0x83, 0x44, 0x9A,
+  0xC6, 0xA0, 0xC3, 0xD4, 0xC5, 0xB3, 0x12, 0x93, 0x22, 0x93, 0x32, 0x83,
+  0x42, 0x81, 0x62, 0xE3, 0xE2, 0xF0, 0x2F, 0x02, 0xF0, 0x2E, 0x3E, 0x2F,
+  0x02, 0xF0, 0x2F, 0x02, 0xE2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE2,
+  0xF0, 0x2F, 0x02, 0xF0, 0x27, 0xFF, 0x40, 0xD6, 0xF0, 0x9C, 0x45, 0x3A,
+  0x38, 0x38, 0x3A, 0x37, 0x2C, 0x26, 0x2D, 0x26, 0x1E, 0x2F, 0x62, 0xF5,
+  0x2F, 0x62, 0xF5, 0x2F, 0x52, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF3,
+  0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF3, 0x3F, 0x43, 0xF4, 0x3F, 0x34, 0xF3,
+  0x3D, 0x24, 0x3E, 0x24, 0xF4, 0x4F, 0x35, 0xC6, 0xDB, 0x94, 0x64, 0x73,
+  0xA2, 0x72, 0xC2, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF4, 0x2F, 0x43,
+  0xF3, 0x3F, 0x33, 0xD7, 0xF0, 0x6F, 0x54, 0xF5, 0x3F, 0x52, 0xF6, 0x2F,
+  0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x42, 0xF4, 0x33, 0x2D, 0x34, 0x3B,
+  0x36, 0x47, 0x48, 0xCD, 0x7A, 0xE5, 0xD5, 0xE2, 0x12, 0xD2, 0x22, 0xC2,
+  0x32, 0xB2, 0x32, 0xB2, 0x42, 0xA3, 0x42, 0xA2, 0x52, 0x92, 0x62, 0x82,
+  0x62, 0x82, 0x72, 0x72, 0x82, 0x72, 0x82, 0x62, 0x92, 0x52, 0x92, 0x52,
+  0xA2, 0x42, 0xB2, 0x4F, 0x22, 0xF2, 0xE2, 0xF2, 0x2F, 0x22, 0xF2, 0x2F,
+  0x12, 0xF2, 0x2C, 0xA9, 0xA3, 0x7E, 0x7E, 0x71, 0xF4, 0x2F, 0x42, 0xF4,
+  0x2F, 0x42, 0xF3, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0x18, 0xAD, 0x75, 0x64,
+  0x71, 0xB2, 0xF4, 0x3F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF3,
+  0x2F, 0x42, 0xF3, 0x3F, 0x32, 0x32, 0xD2, 0x43, 0xA3, 0x64, 0x64, 0x8C,
+  0xC6, 0xA0, 0xE6, 0xCA, 0x95, 0xF0, 0x3F, 0x23, 0xF2, 0x2F, 0x32, 0xF3,
+  0x3F, 0x23, 0xF3, 0x2F, 0x33, 0xF3, 0x2F, 0x33, 0x45, 0x92, 0x39, 0x72,
+  0x23, 0x44, 0x62, 0x12, 0x82, 0x52, 0x12, 0x93, 0x44, 0xB2, 0x43, 0xC2,
+  0x43, 0xC2, 0x42, 0xD2, 0x42, 0xD2, 0x42, 0xC2, 0x52, 0xC2, 0x53, 0xA2,
+  0x72, 0xA2, 0x73, 0x73, 0x93, 0x53, 0xB9, 0xD6, 0xB0, 0x1F, 0x21, 0xF4,
+  0xE4, 0xE2, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF1,
+  0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF1,
+  0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0,
+  0x2F, 0x12, 0xD0, 0xA6, 0xCA, 0x93, 0x54, 0x63, 0x92, 0x62, 0xB2, 0x42,
+  0xC2, 0x33, 0xC2, 0x32, 0xD2, 0x32, 0xD2, 0x32, 0xC2, 0x42, 0xB3, 0x52,
+  0x93, 0x64, 0x54, 0x99, 0xB9, 0x93, 0x63, 0x72, 0x93, 0x52, 0xB3, 0x32,
+  0xD2, 0x32, 0xD2, 0x22, 0xE2, 0x22, 0xE2, 0x22, 0xE2, 0x22, 0xD2, 0x32,
+  0xC3, 0x33, 0xA3, 0x52, 0x93, 0x64, 0x54, 0x8A, 0xC6, 0xA0, 0xC5, 0xF0,
+  0x9B, 0x45, 0x39, 0x38, 0x37, 0x3A, 0x27, 0x2B, 0x35, 0x2D, 0x25, 0x2D,
+  0x24, 0x2E, 0x24, 0x2E, 0x24, 0x2D, 0x34, 0x2C, 0x44, 0x2B, 0x21, 0x24,
+  0x39, 0x65, 0x28, 0x31, 0x26, 0x44, 0x42, 0x27, 0x94, 0x29, 0x55, 0x2F,
+  0x52, 0xF4, 0x3F, 0x42, 0xF4, 0x2F, 0x43, 0xF3, 0x3F, 0x33, 0xF3, 0x3F,
+  0x24, 0xF0, 0x5A, 0xAD, 0x6F, 0x54, 0x56, 0x37, 0x37, 0x36, 0x54, 0xFF,
+  0xFF, 0xFF, 0x44, 0x56, 0x37, 0x37, 0x36, 0x54, 0x50, 0xA4, 0xA6, 0x87,
+  0x87, 0x86, 0xA4, 0xFF, 0xFF, 0xFF, 0xF8, 0x69, 0x68, 0x69, 0x59, 0x5A,
+  0x59, 0x5A, 0x4A, 0x4B, 0x4A, 0x4B, 0x3B, 0x3D, 0x1D, 0xF6, 0x2F, 0x44,
+  0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4F, 0x44, 0xF6, 0x4F, 0x54, 0xF6, 0x4F, 0x63, 0xF6, 0x4F, 0x64,
+  0xF5, 0x4F, 0x64, 0xF5, 0x4F, 0x62, 0x40, 0x2F, 0x82, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x6F, 0x82, 0xF8, 0x10, 0x52, 0xF7, 0x4F, 0x74, 0xF6, 0x4F,
+  0x74, 0xF6, 0x4F, 0x74, 0xF7, 0x3F, 0x74, 0xF7, 0x4F, 0x64, 0xF4, 0x4F,
+  0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F,
+  0x43, 0xF5, 0x2F, 0x70, 0x57, 0x6C, 0x34, 0x64, 0x12, 0xB5, 0xC4, 0xC2,
+  0xE2, 0xE2, 0xD2, 0xE2, 0xC3, 0xC3, 0xB3, 0xA5, 0xB3, 0xC2, 0xE2, 0xE2,
+  0xFF, 0xFF, 0xFF, 0x24, 0xB6, 0x97, 0x97, 0xA5, 0xA0, 0xA6, 0xB9, 0x93,
+  0x53, 0x73, 0x73, 0x52, 0xA2, 0x43, 0xA2, 0x42, 0xB2, 0x32, 0xC2, 0x32,
+  0xC2, 0x22, 0x96, 0x22, 0x78, 0x22, 0x63, 0x32, 0x22, 0x62, 0x52, 0x22,
+  0x52, 0x62, 0x22, 0x52, 0x62, 0x22, 0x42, 0x63, 0x22, 0x42, 0x62, 0x22,
+  0x52, 0x62, 0x22, 0x52, 0x62, 0x22, 0x54, 0x42, 0x22, 0x69, 0x22, 0x87,
+  0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x23, 0xF2, 0x2F, 0x23, 0xF2, 0x37,
+  0x27, 0xBA, 0x78, 0x9B, 0xF1, 0xBF, 0x72, 0x12, 0xF7, 0x22, 0x2F, 0x52,
+  0x32, 0xF5, 0x23, 0x2F, 0x42, 0x42, 0xF3, 0x25, 0x2F, 0x32, 0x53, 0xF1,
+  0x27, 0x2F, 0x11, 0x82, 0xF0, 0x28, 0x2E, 0x29, 0x2E, 0x29, 0x2D, 0x2B,
+  0x2C, 0xF0, 0xBF, 0x1A, 0x2D, 0x2A, 0x2D, 0x29, 0x2E, 0x29, 0x1F, 0x12,
+  0x72, 0xF1, 0x26, 0x2F, 0x22, 0x62, 0xF2, 0x23, 0x98, 0xF4, 0x8A, 0x6F,
+  0x19, 0xF4, 0xB2, 0xB3, 0xA2, 0xC3, 0x82, 0xE2, 0x82, 0xE2, 0x82, 0xE2,
+  0x82, 0xE2, 0x82, 0xD2, 0x82, 0xD2, 0x92, 0xA4, 0xAE, 0xCF, 0x0A, 0x3B,
+  0x39, 0x2D, 0x38, 0x2E, 0x37, 0x2F, 0x02, 0x72, 0xF0, 0x26, 0x2F, 0x12,
+  0x62, 0xF1, 0x26, 0x2F, 0x02, 0x72, 0xE3, 0x72, 0xD3, 0x72, 0xD3, 0x4F,
+  0x65, 0xF4, 0x70, 0xC7, 0xF0, 0xC2, 0x28, 0x46, 0x41, 0x26, 0x4A, 0x55,
+  0x3D, 0x35, 0x3F, 0x02, 0x52, 0xF1, 0x24, 0x2F, 0x22, 0x33, 0xF2, 0x14,
+  0x2F, 0x73, 0xF7, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF7, 0x2F, 0x82, 0xF8,
+  0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF9, 0x2F, 0x82, 0xF1, 0x26, 0x2E, 0x27,
+  0x3B, 0x39, 0x47, 0x4B, 0xCF, 0x16, 0xC0, 0x6E, 0xBF, 0x2C, 0x2A, 0x4A,
+  0x2B, 0x39, 0x3C, 0x38, 0x2E, 0x28, 0x2E, 0x37, 0x2F, 0x02, 0x72, 0xF0,
+  0x26, 0x2F, 0x12, 0x62, 0xF1, 0x26, 0x2F, 0x12, 0x62, 0xF1, 0x26, 0x2F,
+  0x02, 0x62, 0xF1, 0x26, 0x2F, 0x12, 0x62, 0xF0, 0x27, 0x2F, 0x02, 0x63,
+  0xE3, 0x62, 0xF0, 0x27, 0x2E, 0x28, 0x2D, 0x29, 0x2B, 0x39, 0x2A, 0x47,
+  0xF3, 0x8F, 0x0B, 0x6F, 0x65, 0xF7, 0x92, 0xE2, 0x92, 0xD2, 0x92, 0xE2,
+  0x92, 0xE2, 0x92, 0xE2, 0x92, 0xFA, 0x26, 0x2F, 0x12, 0x72, 0xF1, 0x27,
+  0x2F, 0x1B, 0xF1, 0xAF, 0x13, 0x62, 0xF1, 0x27, 0x2F, 0x12, 0x72, 0xF1,
+  0x2F, 0xA2, 0xF9, 0x2F, 0x02, 0x82, 0xF0, 0x28, 0x2F, 0x02, 0x82, 0xE2,
+  0x92, 0xE2, 0x82, 0xF0, 0x24, 0xF8, 0x4F, 0x84, 0x6F, 0x75, 0xF8, 0x92,
+  0xF0, 0x29, 0x2E, 0x29, 0x2F, 0x02, 0x92, 0xF0, 0x29, 0x2F, 0x02, 0x92,
+  0xFB, 0x26, 0x2F, 0x22, 0x72, 0xF2, 0x27, 0x2F, 0x2B, 0xF2, 0xAF, 0x23,
+  0x62, 0xF2, 0x27, 0x2F, 0x22, 0x72, 0xF2, 0x2F, 0xB2, 0xFA, 0x2F, 0xB2,
+  0xFB, 0x2F, 0xB2, 0xFB, 0x2F, 0xA2, 0xF7, 0xEE, 0xEE, 0xC7, 0xF0, 0xC2,
+  0x28, 0x46, 0x76, 0x4A, 0x55, 0x3E, 0x25, 0x3F, 0x02, 0x43, 0xF1, 0x24,
+  0x2F, 0x72, 0xF8, 0x2F, 0x72, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF7,
+  0x2A, 0xC1, 0x2A, 0xC1, 0x2F, 0x32, 0x32, 0xF2, 0x24, 0x2F, 0x22, 0x42,
+  0xF2, 0x24, 0x3F, 0x12, 0x52, 0xF0, 0x35, 0x3E, 0x27, 0x3C, 0x38, 0x48,
+  0x59, 0xEE, 0x7B, 0x68, 0x58, 0x68, 0x58, 0x82, 0xD2, 0xA2, 0xC2, 0xA3,
+  0xC2, 0xA2, 0xD2, 0xA2, 0xD2, 0xA2, 0xC3, 0xA2, 0xC2, 0xA2, 0xD2, 0xA2,
+  0xD2, 0xAF, 0x2A, 0xF1, 0xB2, 0xC2, 0xA2, 0xD2, 0xA2, 0xD2, 0xA2, 0xD2,
+  0xA2, 0xC2, 0xA3, 0xC2, 0xA2, 0xD2, 0xA2, 0xD2, 0xA2, 0xC3, 0xA2, 0xC2,
+  0xA3, 0xC2, 0x79, 0x59, 0x49, 0x59, 0x40, 0x5F, 0x25, 0xF2, 0xC2, 0xF5,
+  0x2F, 0x52, 0xF4, 0x3F, 0x42, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x42, 0xF5,
+  0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF4, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF4,
+  0x3F, 0x42, 0xF5, 0x2F, 0x52, 0xF5, 0x2C, 0xF2, 0x5F, 0x25, 0xCF, 0x1B,
+  0xF2, 0xF5, 0x2F, 0xB2, 0xFA, 0x2F, 0xB2, 0xFB, 0x2F, 0xB2, 0xFA, 0x3F,
+  0xA2, 0xFB, 0x2F, 0xB2, 0xFB, 0x2F, 0xA3, 0xA1, 0xE2, 0xA2, 0xE2, 0xA2,
+  0xE2, 0xA2, 0xE2, 0xA2, 0xD2, 0xA2, 0xE2, 0xA2, 0xE2, 0xA2, 0xD2, 0xB3,
+  0xB2, 0xD3, 0x93, 0xE4, 0x53, 0xF2, 0xAF, 0x56, 0xF2, 0x6A, 0x58, 0x5B,
+  0x58, 0x92, 0xC3, 0xC2, 0xB3, 0xC2, 0xB2, 0xE2, 0x93, 0xF0, 0x28, 0x3F,
+  0x12, 0x72, 0xF3, 0x25, 0x3F, 0x32, 0x53, 0xF4, 0x24, 0x2F, 0x62, 0x24,
+  0xF6, 0x21, 0x21, 0x4F, 0x35, 0x43, 0xF2, 0x46, 0x3F, 0x12, 0x92, 0xF1,
+  0x29, 0x3F, 0x02, 0xA2, 0xE2, 0xB2, 0xE2, 0xB2, 0xE2, 0xC2, 0xD2, 0xC2,
+  0xD2, 0xC2, 0xC2, 0xD2, 0x8B, 0x86, 0x4B, 0x95, 0x40, 0x5E, 0xBE, 0xF2,
+  0x2F, 0x82, 0xF7, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF7, 0x3F, 0x72, 0xF8,
+  0x2F, 0x82, 0xF8, 0x2F, 0x72, 0xF8, 0x2F, 0x82, 0xF8, 0x2C, 0x29, 0x2C,
+  0x28, 0x2D, 0x28, 0x2D, 0x28, 0x2D, 0x28, 0x2C, 0x28, 0x3C, 0x28, 0x2D,
+  0x22, 0xF8, 0x2F, 0x82, 0x57, 0xE6, 0x57, 0xD7, 0x72, 0x12, 0xC2, 0x12,
+  0xA2, 0x12, 0xC2, 0x12, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0x92, 0x22,
+  0xB2, 0x22, 0x92, 0x22, 0xA2, 0x32, 0x82, 0x32, 0xA2, 0x33, 0x62, 0x42,
+  0xA2, 0x42, 0x62, 0x42, 0xA2, 0x42, 0x52, 0x42, 0xA3, 0x42, 0x42, 0x52,
+  0xA2, 0x52, 0x42, 0x52, 0xA2, 0x62, 0x22, 0x62, 0xA2, 0x62, 0x12, 0x72,
+  0xA2, 0x62, 0x12, 0x62, 0xA2, 0x74, 0x72, 0xA2, 0x82, 0x82, 0xA2, 0xF3,
+  0x2A, 0x2F, 0x23, 0xA2, 0xF2, 0x2A, 0x2F, 0x32, 0xA2, 0xF3, 0x2A, 0x2F,
+  0x32, 0x79, 0x99, 0x59, 0x99, 0x50, 0x56, 0x9A, 0x47, 0x9A, 0x84, 0xD2,
+  0xB4, 0xD1, 0xB2, 0x22, 0xB2, 0xB2, 0x22, 0xB2, 0xB2, 0x23, 0xA2, 0xB2,
+  0x32, 0xA2, 0xB1, 0x42, 0x92, 0xB2, 0x52, 0x82, 0xB2, 0x52, 0x82, 0xB2,
+  0x53, 0x72, 0xB2, 0x62, 0x71, 0xC1, 0x72, 0x62, 0xB2, 0x82, 0x52, 0xB2,
+  0x82, 0x52, 0xB2, 0x83, 0x42, 0xB2, 0x92, 0x32, 0xB2, 0xA2, 0x32, 0xB2,
+  0xB2, 0x22, 0xB2, 0xB2, 0x22, 0xB2, 0xB3, 0x12, 0xB1, 0xD4, 0xB2, 0xD4,
+  0x8A, 0x93, 0x89, 0xA3, 0x80, 0xC6, 0xF0, 0xBC, 0x45, 0x49, 0x3A, 0x37,
+  0x3C, 0x35, 0x3E, 0x25, 0x2F, 0x02, 0x42, 0xF1, 0x32, 0x3F, 0x22, 0x22,
+  0xF3, 0x21, 0x2F, 0x42, 0x12, 0xF4, 0x21, 0x2F, 0x44, 0xF5, 0x4F, 0x54,
+  0xF4, 0x21, 0x2F, 0x42, 0x12, 0xF4, 0x21, 0x2F, 0x32, 0x22, 0xF2, 0x32,
+  0x2F, 0x22, 0x42, 0xF0, 0x25, 0x2E, 0x35, 0x3C, 0x37, 0x3A, 0x39, 0x45,
+  0x4C, 0xBF, 0x06, 0xC0, 0x6F, 0x19, 0xF4, 0xB2, 0xA4, 0xA2, 0xC2, 0x92,
+  0xD3, 0x82, 0xE2, 0x82, 0xE2, 0x82, 0xE2, 0x82, 0xD3, 0x72, 0xE2, 0x82,
+  0xD2, 0x92, 0xC2, 0xA2, 0x94, 0xAF, 0x0B, 0xCE, 0x2F, 0x92, 0xF9, 0x2F,
+  0x82, 0xF9, 0x2F, 0x92, 0xF9, 0x2F, 0x92, 0xF8, 0x2F, 0x5E, 0xCE, 0xC0,
+  0xC6, 0xF0, 0xBC, 0x45, 0x49, 0x3A, 0x37, 0x3C, 0x35, 0x3E, 0x25, 0x2F,
+  0x02, 0x42, 0xF2, 0x22, 0x3F, 0x22, 0x22, 0xF3, 0x21, 0x2F, 0x42, 0x12,
+  0xF4, 0x21, 0x2F, 0x44, 0xF5, 0x4F, 0x54, 0xF4, 0x21, 0x2F, 0x42, 0x12,
+  0xF4, 0x21, 0x2F, 0x32, 0x22, 0xF2, 0x32, 0x2F, 0x22, 0x42, 0xF0, 0x25,
+  0x2E, 0x36, 0x2C, 0x37, 0x3A, 0x3A, 0x35, 0x4D, 0xAF, 0x06, 0xF1, 0x4F,
+  0x4A, 0x52, 0x6F, 0x35, 0x47, 0x57, 0x5F, 0x29, 0xF4, 0xB2, 0xA4, 0xA2,
+  0xB3, 0x92, 0xD3, 0x82, 0xE2, 0x82, 0xE2, 0x82, 0xE2, 0x82, 0xE2, 0x72,
+  0xE2, 0x82, 0xD2, 0x92, 0xB3, 0xA2, 0x94, 0xAE, 0xCC, 0xE2, 0x74, 0xD2,
+  0x93, 0xC2, 0xA3, 0xA2, 0xC2, 0xA2, 0xC3, 0x92, 0xD2, 0x92, 0xD3, 0x82,
+  0xE2, 0x72, 0xF0, 0x32, 0xBA, 0xF1, 0xB4, 0xB7, 0xF0, 0xB2, 0x28, 0x37,
+  0x31, 0x26, 0x3B, 0x45, 0x3C, 0x36, 0x2E, 0x25, 0x2F, 0x02, 0x52, 0xF0,
+  0x25, 0x2F, 0x72, 0xF7, 0x3F, 0x73, 0xF7, 0x6F, 0x67, 0xF7, 0x5F, 0x73,
+  0xF7, 0x3F, 0x72, 0xF7, 0x25, 0x1F, 0x12, 0x42, 0xF1, 0x24, 0x2F, 0x02,
+  0x52, 0xE3, 0x44, 0xC3, 0x55, 0xA3, 0x62, 0x13, 0x74, 0x71, 0x3B, 0xF0,
+  0x6C, 0x2F, 0x63, 0xF6, 0x32, 0x72, 0x82, 0x22, 0x82, 0x82, 0x22, 0x82,
+  0x82, 0x22, 0x73, 0x72, 0x32, 0x72, 0x91, 0xC2, 0xF7, 0x2F, 0x72, 0xF6,
+  0x3F, 0x62, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x62, 0xF7, 0x2F, 0x72, 0xF7,
+  0x2F, 0x72, 0xF6, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF0, 0xF0, 0x9E, 0xA0,
+  0x19, 0x6A, 0x19, 0x6A, 0x32, 0xF1, 0x26, 0x2F, 0x02, 0x72, 0xF0, 0x27,
+  0x2F, 0x02, 0x63, 0xF0, 0x26, 0x2F, 0x12, 0x62, 0xF0, 0x27, 0x2F, 0x02,
+  0x72, 0xF0, 0x26, 0x3F, 0x02, 0x62, 0xF1, 0x26, 0x2F, 0x02, 0x72, 0xF0,
+  0x27, 0x2F, 0x02, 0x62, 0xF1, 0x26, 0x2F, 0x03, 0x62, 0xF0, 0x27, 0x2F,
+  0x02, 0x72, 0xE2, 0x82, 0xD3, 0x83, 0xB3, 0xA3, 0x93, 0xC3, 0x64, 0xEA,
+  0xF3, 0x6F, 0x09, 0x9F, 0x39, 0x92, 0x3F, 0x22, 0x62, 0xF1, 0x27, 0x2F,
+  0x12, 0x72, 0xF0, 0x28, 0x2F, 0x01, 0x92, 0xE2, 0xA2, 0xC2, 0xB2, 0xC2,
+  0xB2, 0xB2, 0xC2, 0xA2, 0xD2, 0xA2, 0xD2, 0x92, 0xF0, 0x27, 0x2F, 0x12,
+  0x72, 0xF1, 0x26, 0x2F, 0x22, 0x62, 0xF2, 0x25, 0x2F, 0x33, 0x32, 0xF5,
+  0x23, 0x2F, 0x52, 0x22, 0xF6, 0x21, 0x2F, 0x72, 0x12, 0xF7, 0x4F, 0x93,
+  0xF2, 0x0A, 0x7F, 0x57, 0x93, 0x2F, 0x32, 0x52, 0xF3, 0x25, 0x2F, 0x32,
+  0x52, 0x91, 0x72, 0x62, 0x73, 0x72, 0x62, 0x64, 0x72, 0x52, 0x71, 0x12,
+  0x62, 0x62, 0x62, 0x12, 0x62, 0x62, 0x61, 0x22, 0x62, 0x62, 0x52, 0x22,
+  0x52, 0x72, 0x51, 0x32, 0x52, 0x72, 0x42, 0x42, 0x42, 0x72, 0x41, 0x52,
+  0x32, 0x82, 0x32, 0x52, 0x32, 0x82, 0x31, 0x62, 0x32, 0x82, 0x22, 0x62,
+  0x22, 0x82, 0x31, 0x72, 0x22, 0x82, 0x22, 0x72, 0x22, 0x82, 0x21, 0x82,
+  0x12, 0x92, 0x12, 0x82, 0x12, 0x92, 0x11, 0x92, 0x12, 0x94, 0x94, 0xA3,
+  0xA4, 0xA3, 0xA4, 0xA0, 0x67, 0x97, 0x67, 0x88, 0x82, 0xE2, 0xB3, 0xC2,
+  0xD2, 0xB2, 0xF0, 0x29, 0x2F, 0x13, 0x72, 0xF3, 0x26, 0x2F, 0x43, 0x42,
+  0xF6, 0x23, 0x2F, 0x73, 0x12, 0xF9, 0x4F, 0xB2, 0xFB, 0x4F, 0x92, 0x12,
+  0xF8, 0x22, 0x3F, 0x62, 0x42, 0xF5, 0x25, 0x3F, 0x32, 0x72, 0xF2, 0x29,
+  0x2F, 0x02, 0xA3, 0xD2, 0xC2, 0xC2, 0xD3, 0xA2, 0xF0, 0x27, 0x97, 0x85,
+  0x97, 0x85, 0x18, 0x87, 0x17, 0x97, 0x33, 0xD2, 0x72, 0xC2, 0x82, 0xB3,
+  0x92, 0x93, 0xA2, 0x92, 0xC2, 0x72, 0xD2, 0x62, 0xF0, 0x24, 0x2F, 0x12,
+  0x32, 0xF3, 0x21, 0x2F, 0x44, 0xF5, 0x3F, 0x72, 0xF6, 0x2F, 0x72, 0xF7,
+  0x2F, 0x72, 0xF7, 0x2F, 0x62, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x0F, 0x09,
+  0xEA, 0x6F, 0x26, 0xF1, 0x72, 0xC2, 0x71, 0xC2, 0x72, 0xB3, 0x72, 0xA3,
+  0x82, 0x93, 0x92, 0x83, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF5, 0x2F,
+  0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xA2, 0x82, 0xB2, 0x72, 0xC2,
+  0x62, 0xD1, 0x62, 0xD2, 0x52, 0xE2, 0x42, 0xF0, 0x24, 0xF4, 0x4F, 0x35,
+  0x78, 0x78, 0x72, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xC2, 0xD2, 0xD2, 0xD2,
+  0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xC2, 0xD2,
+  0xD2, 0xD2, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD8, 0x78, 0x70, 0x02,
+  0x82, 0x83, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82,
+  0x82, 0x92, 0x82, 0x82, 0x82, 0x92, 0x82, 0x82, 0x82, 0x92, 0x82, 0x82,
+  0x82, 0x92, 0x82, 0x82, 0x82, 0x92, 0x82, 0x82, 0x82, 0x91, 0x78, 0x78,
+  0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2, 0xC2, 0xD2,
+  0xD2, 0xD2, 0xD2, 0xC2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD2, 0xD2, 0xD2, 0xD2,
+  0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xC2, 0x78, 0x78, 0x70, 0xB1, 0xF1, 0x2F,
+  0x04, 0xD2, 0x12, 0xC2, 0x32, 0xA2, 0x43, 0x73, 0x62, 0x63, 0x73, 0x43,
+  0x92, 0x33, 0xB2, 0x13, 0xC5, 0xE1, 0x10, 0x0F, 0xFF, 0xB0, 0x02, 0x43,
+  0x42, 0x52, 0x52, 0x43, 0x42, 0xA7, 0xBD, 0x84, 0x83, 0xF5, 0x3F, 0x52,
+  0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x43, 0x98, 0x22, 0x7F, 0x05, 0x5A, 0x24,
+  0x3D, 0x23, 0x3D, 0x32, 0x3E, 0x23, 0x2F, 0x02, 0x32, 0xE3, 0x32, 0xD4,
+  0x33, 0xA5, 0x53, 0x64, 0x26, 0x2A, 0x46, 0x37, 0xC0, 0x66, 0xF6, 0x5F,
+  0xA2, 0xFA, 0x2F, 0xA2, 0xFA, 0x2F, 0xA1, 0xFA, 0x26, 0x6D, 0x24, 0xAB,
+  0x22, 0x36, 0x4A, 0x21, 0x2A, 0x38, 0x21, 0x2C, 0x28, 0x4D, 0x37, 0x3F,
+  0x02, 0x72, 0xF1, 0x27, 0x2F, 0x12, 0x62, 0xF2, 0x26, 0x2F, 0x22, 0x62,
+  0xF2, 0x26, 0x2F, 0x12, 0x63, 0xF1, 0x26, 0x3F, 0x02, 0x73, 0xF0, 0x27,
+  0x4D, 0x28, 0x11, 0x2C, 0x28, 0x21, 0x3A, 0x25, 0x62, 0x45, 0x46, 0x63,
+  0xBF, 0x36, 0xA0, 0xA6, 0xDB, 0x22, 0x63, 0x76, 0x52, 0xA5, 0x42, 0xD2,
+  0x42, 0xE2, 0x32, 0xF0, 0x22, 0x3F, 0x02, 0x22, 0xF5, 0x2F, 0x42, 0xF5,
+  0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x53, 0xF5, 0x2F, 0x02, 0x33,
+  0xC3, 0x54, 0x75, 0x7D, 0xB8, 0x90, 0xF4, 0x6F, 0x45, 0xF8, 0x2F, 0x82,
+  0xF8, 0x2F, 0x81, 0xF8, 0x2B, 0x66, 0x29, 0xA4, 0x28, 0x36, 0x33, 0x26,
+  0x3A, 0x21, 0x26, 0x3C, 0x11, 0x26, 0x2D, 0x45, 0x2F, 0x03, 0x42, 0xF1,
+  0x25, 0x2F, 0x12, 0x52, 0xF1, 0x24, 0x2F, 0x22, 0x42, 0xF2, 0x24, 0x2F,
+  0x21, 0x52, 0xF1, 0x25, 0x2F, 0x12, 0x52, 0xF0, 0x35, 0x3D, 0x46, 0x2C,
+  0x47, 0x3A, 0x21, 0x28, 0x46, 0x32, 0x56, 0xA4, 0x58, 0x6E, 0xA6, 0xDC,
+  0x84, 0x74, 0x63, 0xB3, 0x43, 0xD2, 0x33, 0xE3, 0x22, 0xF1, 0x21, 0x2F,
+  0x22, 0x12, 0xF2, 0xFF, 0xF3, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x53, 0xF5,
+  0x2F, 0x53, 0xF5, 0x3D, 0x25, 0x47, 0x57, 0xDB, 0x88, 0xF1, 0x9F, 0x0C,
+  0xC4, 0xF6, 0x3F, 0x82, 0xF9, 0x2F, 0x82, 0xF9, 0x2F, 0x4F, 0x28, 0xF3,
+  0xE2, 0xF8, 0x2F, 0x92, 0xF9, 0x2F, 0x92, 0xF8, 0x3F, 0x82, 0xF9, 0x2F,
+  0x92, 0xF9, 0x2F, 0x82, 0xF9, 0x2F, 0x92, 0xF9, 0x2F, 0x92, 0xF8, 0x2F,
+  0x3F, 0x38, 0xF2, 0x90, 0x96, 0xF2, 0x94, 0x55, 0x45, 0x42, 0x54, 0x39,
+  0x21, 0x27, 0x3B, 0x46, 0x3C, 0x46, 0x2E, 0x35, 0x2F, 0x02, 0x62, 0xF0,
+  0x25, 0x2F, 0x12, 0x52, 0xF1, 0x25, 0x2F, 0x12, 0x52, 0xF0, 0x26, 0x2F,
+  0x02, 0x62, 0xE3, 0x63, 0xD3, 0x72, 0xC3, 0x83, 0x92, 0x12, 0x94, 0x53,
+  0x22, 0xAA, 0x32, 0xC6, 0x52, 0xF7, 0x2F, 0x82, 0xF8, 0x2F, 0x72, 0xF8,
+  0x2F, 0x72, 0xF6, 0x3D, 0xBE, 0x9E, 0x56, 0xF3, 0x5F, 0x72, 0xF7, 0x2F,
+  0x72, 0xF7, 0x2F, 0x62, 0xF7, 0x25, 0x6B, 0x23, 0x9A, 0x22, 0x26, 0x38,
+  0x31, 0x28, 0x37, 0x21, 0x1B, 0x27, 0x3C, 0x27, 0x2D, 0x27, 0x2D, 0x26,
+  0x3D, 0x26, 0x2D, 0x36, 0x2D, 0x36, 0x2D, 0x36, 0x2D, 0x26, 0x2E, 0x26,
+  0x2D, 0x36, 0x2D, 0x36, 0x2D, 0x27, 0x2D, 0x26, 0x2E, 0x23, 0x87, 0xF2,
+  0x79, 0xD3, 0xF1, 0x2F, 0x13, 0xF1, 0x3F, 0x13, 0xFF, 0xFF, 0xFA, 0x9A,
+  0x9F, 0x22, 0xF1, 0x3F, 0x12, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x13, 0xF1,
+  0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF1, 0x3F, 0x12, 0xF2, 0x2F, 0x22, 0xF2,
+  0x28, 0xFF, 0x80, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x22, 0xF2, 0x3F, 0xFF,
+  0xFF, 0xCE, 0x6E, 0xF3, 0x2F, 0x32, 0xF2, 0x2F, 0x32, 0xF3, 0x2F, 0x32,
+  0xF3, 0x2F, 0x22, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x23, 0xF2, 0x2F, 0x32,
+  0xF3, 0x2F, 0x32, 0xF2, 0x3F, 0x22, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x22,
+  0xF2, 0x3F, 0x13, 0xF1, 0x37, 0xC8, 0xAA, 0x66, 0xF3, 0x5F, 0x72, 0xF7,
+  0x2F, 0x72, 0xF7, 0x2F, 0x62, 0xF7, 0x2F, 0x72, 0x68, 0x82, 0x59, 0x81,
+  0x83, 0xB2, 0x72, 0xD2, 0x53, 0xE2, 0x43, 0xF0, 0x23, 0x2F, 0x12, 0x23,
+  0xF2, 0x21, 0x3F, 0x37, 0xF2, 0x32, 0x3F, 0x12, 0x42, 0xF0, 0x25, 0x3E,
+  0x26, 0x3D, 0x27, 0x3C, 0x28, 0x2C, 0x1A, 0x2A, 0x2A, 0x35, 0x68, 0x91,
+  0x68, 0x82, 0x79, 0xA9, 0xF2, 0x2F, 0x12, 0xF2, 0x2F, 0x22, 0xF2, 0x2F,
+  0x13, 0xF1, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF2, 0x2F,
+  0x22, 0xF2, 0x2F, 0x12, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x13, 0xF1, 0x2F,
+  0x22, 0xF2, 0x2F, 0x22, 0x8F, 0xF8, 0xB4, 0x64, 0x64, 0x26, 0x46, 0x54,
+  0x12, 0x33, 0x13, 0x33, 0x64, 0x55, 0x52, 0x63, 0x64, 0x62, 0x62, 0x73,
+  0x72, 0x52, 0x82, 0x82, 0x52, 0x82, 0x82, 0x52, 0x82, 0x82, 0x52, 0x82,
+  0x81, 0x62, 0x72, 0x82, 0x52, 0x82, 0x82, 0x52, 0x82, 0x82, 0x52, 0x82,
+  0x82, 0x52, 0x81, 0x82, 0x61, 0x82, 0x82, 0x52, 0x82, 0x82, 0x52, 0x82,
+  0x82, 0x52, 0x82, 0x82, 0x27, 0x64, 0x5C, 0x55, 0x55, 0xE5, 0x85, 0x39,
+  0x65, 0x22, 0x63, 0x85, 0x83, 0x64, 0xB2, 0x63, 0xC2, 0x62, 0xD2, 0x62,
+  0xD2, 0x53, 0xD2, 0x52, 0xD3, 0x52, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x53,
+  0xD2, 0x52, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x53, 0xD2, 0x29,
+  0x7F, 0x08, 0x70, 0xA6, 0xDB, 0xA4, 0x64, 0x73, 0x93, 0x62, 0xC3, 0x42,
+  0xE2, 0x32, 0xF1, 0x21, 0x3F, 0x12, 0x12, 0xF2, 0x21, 0x2F, 0x24, 0xF3,
+  0x4F, 0x34, 0xF2, 0x21, 0x2F, 0x22, 0x12, 0xF1, 0x31, 0x2F, 0x12, 0x32,
+  0xE2, 0x43, 0xC2, 0x63, 0x93, 0x74, 0x64, 0xAB, 0xD6, 0xA0, 0xF2, 0x7B,
+  0x63, 0xB9, 0x62, 0x36, 0x4B, 0x22, 0x2A, 0x3A, 0x21, 0x2C, 0x2A, 0x4D,
+  0x39, 0x3F, 0x02, 0x92, 0xF1, 0x28, 0x3F, 0x12, 0x82, 0xF2, 0x28, 0x2F,
+  0x22, 0x82, 0xF2, 0x28, 0x2F, 0x12, 0x83, 0xF1, 0x28, 0x3F, 0x02, 0x94,
+  0xD3, 0x94, 0xC3, 0xA2, 0x12, 0xA3, 0xA2, 0x24, 0x64, 0xB2, 0x3B, 0xD2,
+  0x57, 0xF0, 0x2F, 0xC2, 0xFB, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F,
+  0x8B, 0xF2, 0xCF, 0x20, 0x96, 0xF3, 0xA4, 0x55, 0x46, 0x32, 0x64, 0x3A,
+  0x21, 0x27, 0x3C, 0x11, 0x26, 0x3D, 0x46, 0x2F, 0x03, 0x52, 0xF1, 0x26,
+  0x2F, 0x12, 0x52, 0xF2, 0x25, 0x2F, 0x22, 0x52, 0xF2, 0x25, 0x2F, 0x12,
+  0x62, 0xF1, 0x26, 0x2F, 0x03, 0x63, 0xD4, 0x72, 0xC2, 0x12, 0x73, 0xA2,
+  0x12, 0x94, 0x63, 0x22, 0xAB, 0x32, 0xC6, 0x62, 0xF9, 0x2F, 0x82, 0xF9,
+  0x2F, 0x92, 0xF9, 0x2F, 0x92, 0xF8, 0x2F, 0x3C, 0xEC, 0x50, 0x57, 0x65,
+  0x77, 0x49, 0x92, 0x34, 0x52, 0x92, 0x23, 0xF3, 0x6F, 0x44, 0xF5, 0x4F,
+  0x62, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x73, 0xF7, 0x2F, 0x82, 0xF8, 0x2F,
+  0x82, 0xF7, 0x3F, 0x72, 0xF2, 0xF3, 0x7F, 0x28, 0xA6, 0xCB, 0x12, 0x64,
+  0x65, 0x53, 0xA3, 0x43, 0xC1, 0x52, 0xD1, 0x52, 0xD1, 0x53, 0xF4, 0x3F,
+  0x3A, 0xE9, 0xF3, 0x5F, 0x43, 0xF4, 0x2F, 0x42, 0x22, 0xF0, 0x22, 0x2F,
+  0x02, 0x22, 0xE2, 0x24, 0xB3, 0x36, 0x74, 0x42, 0x1D, 0xB7, 0x80, 0x62,
+  0xE2, 0xF0, 0x2F, 0x02, 0xF0, 0x2E, 0x3A, 0xFF, 0x44, 0x2F, 0x02, 0xE2,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2E, 0x3E, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE3,
+  0xE2, 0xF0, 0x2F, 0x02, 0xF0, 0x2C, 0x22, 0x37, 0x52, 0xD6, 0x76, 0x06,
+  0x8D, 0x87, 0x32, 0xD2, 0x42, 0xD2, 0x42, 0xD2, 0x42, 0xD2, 0x42, 0xC2,
+  0x42, 0xD2, 0x42, 0xD2, 0x42, 0xD2, 0x42, 0xD2, 0x42, 0xC2, 0x42, 0xD2,
+  0x42, 0xD2, 0x42, 0xD2, 0x42, 0xC3, 0x42, 0xA4, 0x53, 0x82, 0x12, 0x54,
+  0x44, 0x25, 0x3A, 0x35, 0x55, 0xC0, 0x19, 0x6F, 0x56, 0xA3, 0x3E, 0x28,
+  0x2D, 0x29, 0x2D, 0x29, 0x2C, 0x2A, 0x3A, 0x2C, 0x2A, 0x2C, 0x29, 0x2D,
+  0x29, 0x2D, 0x28, 0x2F, 0x02, 0x62, 0xF1, 0x26, 0x2F, 0x12, 0x52, 0xF2,
+  0x24, 0x2F, 0x42, 0x32, 0xF4, 0x22, 0x2F, 0x52, 0x12, 0xF6, 0x5F, 0x64,
+  0xF0, 0x07, 0xAF, 0x0A, 0x82, 0x2F, 0x12, 0x52, 0xF1, 0x25, 0x2F, 0x02,
+  0x62, 0x62, 0x72, 0x62, 0x54, 0x62, 0x62, 0x54, 0x52, 0x72, 0x42, 0x12,
+  0x52, 0x72, 0x42, 0x12, 0x42, 0x82, 0x32, 0x22, 0x42, 0x82, 0x32, 0x22,
+  0x32, 0x92, 0x22, 0x32, 0x32, 0x92, 0x22, 0x42, 0x22, 0x92, 0x12, 0x52,
+  0x12, 0xA2, 0x12, 0x52, 0x12, 0xA4, 0x64, 0xB4, 0x64, 0xB3, 0x73, 0xC3,
+  0x73, 0xA0, 0x57, 0x68, 0x48, 0x68, 0x63, 0xC2, 0xA3, 0x93, 0xC3, 0x73,
+  0xE2, 0x63, 0xF1, 0x24, 0x2F, 0x33, 0x13, 0xF5, 0x5F, 0x73, 0xF7, 0x4F,
+  0x53, 0x13, 0xF3, 0x33, 0x3F, 0x13, 0x53, 0xE3, 0x73, 0xC2, 0xA2, 0xA3,
+  0xC2, 0x83, 0xD3, 0x58, 0x69, 0x38, 0x69, 0x30, 0x67, 0x88, 0x58, 0x88,
+  0x72, 0xF0, 0x2B, 0x2E, 0x2B, 0x2D, 0x2C, 0x2C, 0x2D, 0x3B, 0x2E, 0x2A,
+  0x2F, 0x02, 0x92, 0xF1, 0x29, 0x2F, 0x22, 0x72, 0xF3, 0x26, 0x2F, 0x42,
+  0x52, 0xF5, 0x34, 0x2F, 0x62, 0x32, 0xF7, 0x22, 0x2F, 0x82, 0x22, 0xF9,
+  0x4F, 0xA3, 0xFB, 0x3F, 0xB2, 0xFB, 0x2F, 0xC2, 0xFB, 0x2F, 0xB2, 0xFC,
+  0x2F, 0xB2, 0xF4, 0xEF, 0x0D, 0xF1, 0x5F, 0x15, 0xF1, 0x42, 0xC2, 0x52,
+  0xB2, 0x62, 0xA2, 0xF3, 0x2F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23,
+  0xF2, 0x3F, 0x22, 0xF3, 0x2F, 0x32, 0xF3, 0x2B, 0x25, 0x2C, 0x24, 0x2D,
+  0x14, 0xF2, 0x4F, 0x23, 0xC3, 0xA5, 0x93, 0xC2, 0xC2, 0xD2, 0xD2, 0xD2,
+  0xC3, 0xC2, 0xD2, 0xD2, 0xD2, 0xC2, 0xC3, 0xA4, 0x85, 0xA5, 0xE2, 0xE2,
+  0xD2, 0xD2, 0xC3, 0xC2, 0xD2, 0xD2, 0xD2, 0xC3, 0xC2, 0xD2, 0xD2, 0xD3,
+  0xD4, 0xC3, 0x70, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72, 0x72, 0x72, 0x62,
+  0x72, 0x72, 0x72, 0x71, 0x72, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72, 0x72,
+  0x72, 0x62, 0x72, 0x72, 0x72, 0x71, 0x72, 0x72, 0x72, 0x72, 0x71, 0x72,
+  0x72, 0x72, 0x70, 0x73, 0xC4, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xC2, 0xD2,
+  0xD2, 0xD2, 0xD2, 0xC2, 0xD2, 0xD3, 0xD3, 0xD5, 0xA5, 0x84, 0xA3, 0xC2,
+  0xC3, 0xC2, 0xD2, 0xD2, 0xD2, 0xC2, 0xD2, 0xD2, 0xD2, 0xC2, 0xC3, 0x95,
+  0xA3, 0xC0, 0x44, 0xF0, 0x78, 0x21, 0x34, 0x36, 0x66, 0x33, 0x41, 0x28,
+  0x7E, 0x45 };
 
 const GFXglyph FreeMonoOblique24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  28,    0,    1 },   // 0x20 ' '
   {     0,  10,  30,  28,   12,  -28 },   // 0x21 '!'
-  {    38,  16,  14,  28,   10,  -28 },   // 0x22 '"'
-  {    66,  22,  32,  28,    6,  -29 },   // 0x23 '#'
-  {   154,  21,  33,  28,    6,  -29 },   // 0x24 '$'
-  {   241,  22,  29,  28,    6,  -27 },   // 0x25 '%'
-  {   321,  19,  25,  28,    6,  -23 },   // 0x26 '&'
-  {   381,   7,  14,  28,   16,  -28 },   // 0x27 '''
-  {   394,  11,  34,  28,   16,  -27 },   // 0x28 '('
-  {   441,  11,  34,  28,    7,  -27 },   // 0x29 ')'
-  {   488,  18,  17,  28,   10,  -28 },   // 0x2A '*'
-  {   527,  22,  22,  28,    6,  -23 },   // 0x2B '+'
-  {   588,  12,  14,  28,    5,   -6 },   // 0x2C ','
-  {   609,  22,   2,  28,    6,  -13 },   // 0x2D '-'
-  {   615,   7,   6,  28,   11,   -4 },   // 0x2E '.'
-  {   621,  24,  35,  28,    5,  -30 },   // 0x2F '/'
-  {   726,  20,  30,  28,    7,  -28 },   // 0x30 '0'
-  {   801,  17,  29,  28,    6,  -28 },   // 0x31 '1'
-  {   863,  23,  29,  28,    4,  -28 },   // 0x32 '2'
-  {   947,  22,  30,  28,    5,  -28 },   // 0x33 '3'
-  {  1030,  19,  28,  28,    7,  -27 },   // 0x34 '4'
-  {  1097,  21,  29,  28,    6,  -27 },   // 0x35 '5'
-  {  1174,  21,  30,  28,    9,  -28 },   // 0x36 '6'
-  {  1253,  18,  28,  28,   10,  -27 },   // 0x37 '7'
-  {  1316,  20,  30,  28,    7,  -28 },   // 0x38 '8'
-  {  1391,  22,  30,  28,    6,  -28 },   // 0x39 '9'
-  {  1474,  10,  21,  28,   11,  -19 },   // 0x3A ':'
-  {  1501,  15,  27,  28,    5,  -19 },   // 0x3B ';'
-  {  1552,  23,  22,  28,    6,  -23 },   // 0x3C '<'
-  {  1616,  25,   9,  28,    4,  -17 },   // 0x3D '='
-  {  1645,  24,  22,  28,    4,  -23 },   // 0x3E '>'
-  {  1711,  16,  28,  28,   11,  -26 },   // 0x3F '?'
-  {  1767,  19,  32,  28,    7,  -28 },   // 0x40 '@'
-  {  1843,  27,  26,  28,    1,  -25 },   // 0x41 'A'
-  {  1931,  26,  26,  28,    2,  -25 },   // 0x42 'B'
-  {  2016,  25,  28,  28,    5,  -26 },   // 0x43 'C'
-  {  2104,  26,  26,  28,    2,  -25 },   // 0x44 'D'
-  {  2189,  27,  26,  28,    2,  -25 },   // 0x45 'E'
-  {  2277,  28,  26,  28,    2,  -25 },   // 0x46 'F'
-  {  2368,  25,  28,  28,    5,  -26 },   // 0x47 'G'
-  {  2456,  27,  26,  28,    3,  -25 },   // 0x48 'H'
-  {  2544,  22,  26,  28,    6,  -25 },   // 0x49 'I'
-  {  2616,  28,  27,  28,    5,  -25 },   // 0x4A 'J'
-  {  2711,  29,  26,  28,    2,  -25 },   // 0x4B 'K'
-  {  2806,  25,  26,  28,    3,  -25 },   // 0x4C 'L'
-  {  2888,  32,  26,  28,    1,  -25 },   // 0x4D 'M'
-  {  2992,  30,  26,  28,    2,  -25 },   // 0x4E 'N'
-  {  3090,  24,  28,  28,    5,  -26 },   // 0x4F 'O'
-  {  3174,  26,  26,  28,    2,  -25 },   // 0x50 'P'
-  {  3259,  24,  32,  28,    5,  -26 },   // 0x51 'Q'
-  {  3355,  26,  26,  28,    2,  -25 },   // 0x52 'R'
-  {  3440,  24,  28,  28,    5,  -26 },   // 0x53 'S'
-  {  3524,  24,  26,  28,    7,  -25 },   // 0x54 'T'
-  {  3602,  26,  27,  28,    6,  -25 },   // 0x55 'U'
-  {  3690,  27,  26,  28,    6,  -25 },   // 0x56 'V'
-  {  3778,  27,  26,  28,    6,  -25 },   // 0x57 'W'
-  {  3866,  29,  26,  28,    2,  -25 },   // 0x58 'X'
-  {  3961,  24,  26,  28,    7,  -25 },   // 0x59 'Y'
-  {  4039,  23,  26,  28,    5,  -25 },   // 0x5A 'Z'
-  {  4114,  15,  34,  28,   12,  -27 },   // 0x5B '['
-  {  4178,  10,  35,  28,   12,  -30 },   // 0x5C '\'
-  {  4222,  15,  34,  28,    6,  -27 },   // 0x5D ']'
-  {  4286,  18,  12,  28,    9,  -28 },   // 0x5E '^'
-  {  4313,  28,   2,  28,   -1,    5 },   // 0x5F '_'
-  {  4320,   6,   7,  28,   13,  -29 },   // 0x60 '`'
-  {  4326,  22,  22,  28,    4,  -20 },   // 0x61 'a'
-  {  4387,  27,  29,  28,    1,  -27 },   // 0x62 'b'
-  {  4485,  22,  22,  28,    6,  -20 },   // 0x63 'c'
-  {  4546,  25,  29,  28,    5,  -27 },   // 0x64 'd'
-  {  4637,  22,  22,  28,    5,  -20 },   // 0x65 'e'
-  {  4698,  26,  28,  28,    5,  -27 },   // 0x66 'f'
-  {  4789,  25,  30,  28,    5,  -20 },   // 0x67 'g'
-  {  4883,  24,  28,  28,    3,  -27 },   // 0x68 'h'
-  {  4967,  19,  29,  28,    5,  -28 },   // 0x69 'i'
-  {  5036,  20,  38,  28,    4,  -28 },   // 0x6A 'j'
-  {  5131,  24,  28,  28,    3,  -27 },   // 0x6B 'k'
-  {  5215,  19,  28,  28,    5,  -27 },   // 0x6C 'l'
-  {  5282,  27,  21,  28,    1,  -20 },   // 0x6D 'm'
-  {  5353,  23,  21,  28,    3,  -20 },   // 0x6E 'n'
-  {  5414,  22,  22,  28,    5,  -20 },   // 0x6F 'o'
-  {  5475,  29,  30,  28,   -1,  -20 },   // 0x70 'p'
-  {  5584,  26,  30,  28,    5,  -20 },   // 0x71 'q'
-  {  5682,  25,  20,  28,    4,  -19 },   // 0x72 'r'
-  {  5745,  21,  22,  28,    5,  -20 },   // 0x73 's'
-  {  5803,  17,  27,  28,    7,  -25 },   // 0x74 't'
-  {  5861,  21,  21,  28,    6,  -19 },   // 0x75 'u'
-  {  5917,  26,  20,  28,    5,  -19 },   // 0x76 'v'
-  {  5982,  25,  20,  28,    6,  -19 },   // 0x77 'w'
-  {  6045,  26,  20,  28,    3,  -19 },   // 0x78 'x'
-  {  6110,  29,  29,  28,    1,  -19 },   // 0x79 'y'
-  {  6216,  21,  20,  28,    5,  -19 },   // 0x7A 'z'
-  {  6269,  15,  34,  28,   10,  -27 },   // 0x7B '{'
-  {  6333,   9,  35,  28,   12,  -28 },   // 0x7C '|'
-  {  6373,  15,  34,  28,    8,  -27 },   // 0x7D '}'
-  {  6437,  20,   6,  28,    7,  -15 } }; // 0x7E '~'
+  {    27,  16,  14,  28,   10,  -28 },   // 0x22 '"'
+  {    56,  22,  32,  28,    6,  -29 },   // 0x23 '#'
+  {   119,  21,  33,  28,    6,  -29 },   // 0x24 '$'
+  {   173,  22,  29,  28,    6,  -27 },   // 0x25 '%'
+  {   224,  19,  25,  28,    6,  -23 },   // 0x26 '&'
+  {   274,   7,  14,  28,   16,  -28 },   // 0x27 '''
+  {   289,  11,  34,  28,   16,  -27 },   // 0x28 '('
+  {   324,  11,  34,  28,    7,  -27 },   // 0x29 ')'
+  {   359,  18,  17,  28,   10,  -28 },   // 0x2A '*'
+  {   388,  22,  22,  28,    6,  -23 },   // 0x2B '+'
+  {   420,  12,  14,  28,    5,   -6 },   // 0x2C ','
+  {   435,  22,   2,  28,    6,  -13 },   // 0x2D '-'
+  {   438,   7,   6,  28,   11,   -4 },   // 0x2E '.'
+  {   442,  24,  35,  28,    5,  -30 },   // 0x2F '/'
+  {   496,  20,  30,  28,    7,  -28 },   // 0x30 '0'
+  {   554,  17,  29,  28,    6,  -28 },   // 0x31 '1'
+  {   595,  23,  29,  28,    4,  -28 },   // 0x32 '2'
+  {   643,  22,  30,  28,    5,  -28 },   // 0x33 '3'
+  {   689,  19,  28,  28,    7,  -27 },   // 0x34 '4'
+  {   737,  21,  29,  28,    6,  -27 },   // 0x35 '5'
+  {   782,  21,  30,  28,    9,  -28 },   // 0x36 '6'
+  {   837,  18,  28,  28,   10,  -27 },   // 0x37 '7'
+  {   879,  20,  30,  28,    7,  -28 },   // 0x38 '8'
+  {   934,  22,  30,  28,    6,  -28 },   // 0x39 '9'
+  {   989,  10,  21,  28,   11,  -19 },   // 0x3A ':'
+  {  1005,  15,  27,  28,    5,  -19 },   // 0x3B ';'
+  {  1029,  23,  22,  28,    6,  -23 },   // 0x3C '<'
+  {  1063,  25,   9,  28,    4,  -17 },   // 0x3D '='
+  {  1074,  24,  22,  28,    4,  -23 },   // 0x3E '>'
+  {  1108,  16,  28,  28,   11,  -26 },   // 0x3F '?'
+  {  1137,  19,  32,  28,    7,  -28 },   // 0x40 '@'
+  {  1203,  27,  26,  28,    1,  -25 },   // 0x41 'A'
+  {  1259,  26,  26,  28,    2,  -25 },   // 0x42 'B'
+  {  1311,  25,  28,  28,    5,  -26 },   // 0x43 'C'
+  {  1363,  26,  26,  28,    2,  -25 },   // 0x44 'D'
+  {  1419,  27,  26,  28,    2,  -25 },   // 0x45 'E'
+  {  1472,  28,  26,  28,    2,  -25 },   // 0x46 'F'
+  {  1521,  25,  28,  28,    5,  -26 },   // 0x47 'G'
+  {  1575,  27,  26,  28,    3,  -25 },   // 0x48 'H'
+  {  1627,  22,  26,  28,    6,  -25 },   // 0x49 'I'
+  {  1666,  28,  27,  28,    5,  -25 },   // 0x4A 'J'
+  {  1713,  29,  26,  28,    2,  -25 },   // 0x4B 'K'
+  {  1773,  25,  26,  28,    3,  -25 },   // 0x4C 'L'
+  {  1816,  32,  26,  28,    1,  -25 },   // 0x4D 'M'
+  {  1902,  30,  26,  28,    2,  -25 },   // 0x4E 'N'
+  {  1973,  24,  28,  28,    5,  -26 },   // 0x4F 'O'
+  {  2032,  26,  26,  28,    2,  -25 },   // 0x50 'P'
+  {  2076,  24,  32,  28,    5,  -26 },   // 0x51 'Q'
+  {  2142,  26,  26,  28,    2,  -25 },   // 0x52 'R'
+  {  2191,  24,  28,  28,    5,  -26 },   // 0x53 'S'
+  {  2245,  24,  26,  28,    7,  -25 },   // 0x54 'T'
+  {  2292,  26,  27,  28,    6,  -25 },   // 0x55 'U'
+  {  2354,  27,  26,  28,    6,  -25 },   // 0x56 'V'
+  {  2413,  27,  26,  28,    6,  -25 },   // 0x57 'W'
+  {  2500,  29,  26,  28,    2,  -25 },   // 0x58 'X'
+  {  2558,  24,  26,  28,    7,  -25 },   // 0x59 'Y'
+  {  2605,  23,  26,  28,    5,  -25 },   // 0x5A 'Z'
+  {  2652,  15,  34,  28,   12,  -27 },   // 0x5B '['
+  {  2687,  10,  35,  28,   12,  -30 },   // 0x5C '\'
+  {  2722,  15,  34,  28,    6,  -27 },   // 0x5D ']'
+  {  2757,  18,  12,  28,    9,  -28 },   // 0x5E '^'
+  {  2779,  28,   2,  28,   -1,    5 },   // 0x5F '_'
+  {  2782,   6,   7,  28,   13,  -29 },   // 0x60 '`'
+  {  2789,  22,  22,  28,    4,  -20 },   // 0x61 'a'
+  {  2829,  27,  29,  28,    1,  -27 },   // 0x62 'b'
+  {  2895,  22,  22,  28,    6,  -20 },   // 0x63 'c'
+  {  2934,  25,  29,  28,    5,  -27 },   // 0x64 'd'
+  {  2998,  22,  22,  28,    5,  -20 },   // 0x65 'e'
+  {  3033,  26,  28,  28,    5,  -27 },   // 0x66 'f'
+  {  3076,  25,  30,  28,    5,  -20 },   // 0x67 'g'
+  {  3138,  24,  28,  28,    3,  -27 },   // 0x68 'h'
+  {  3193,  19,  29,  28,    5,  -28 },   // 0x69 'i'
+  {  3231,  20,  38,  28,    4,  -28 },   // 0x6A 'j'
+  {  3283,  24,  28,  28,    3,  -27 },   // 0x6B 'k'
+  {  3338,  19,  28,  28,    5,  -27 },   // 0x6C 'l'
+  {  3378,  27,  21,  28,    1,  -20 },   // 0x6D 'm'
+  {  3441,  23,  21,  28,    3,  -20 },   // 0x6E 'n'
+  {  3483,  22,  22,  28,    5,  -20 },   // 0x6F 'o'
+  {  3526,  29,  30,  28,   -1,  -20 },   // 0x70 'p'
+  {  3592,  26,  30,  28,    5,  -20 },   // 0x71 'q'
+  {  3658,  25,  20,  28,    4,  -19 },   // 0x72 'r'
+  {  3692,  21,  22,  28,    5,  -20 },   // 0x73 's'
+  {  3731,  17,  27,  28,    7,  -25 },   // 0x74 't'
+  {  3767,  21,  21,  28,    6,  -19 },   // 0x75 'u'
+  {  3810,  26,  20,  28,    5,  -19 },   // 0x76 'v'
+  {  3853,  25,  20,  28,    6,  -19 },   // 0x77 'w'
+  {  3914,  26,  20,  28,    3,  -19 },   // 0x78 'x'
+  {  3956,  29,  29,  28,    1,  -19 },   // 0x79 'y'
+  {  4014,  21,  20,  28,    5,  -19 },   // 0x7A 'z'
+  {  4048,  15,  34,  28,   10,  -27 },   // 0x7B '{'
+  {  4083,   9,  35,  28,   12,  -28 },   // 0x7C '|'
+  {  4119,  15,  34,  28,    8,  -27 },   // 0x7D '}'
+  {  4154,  20,   6,  28,    7,  -15 } }; // 0x7E '~'
 
 const GFXfont FreeMonoOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique24pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique24pt7bGlyphs,
-  0x20, 0x7E, 47 };
+  0x20, 0x7E, 47, 1 };
 
-// Approx. 7124 bytes
+// Approx. 4838 bytes
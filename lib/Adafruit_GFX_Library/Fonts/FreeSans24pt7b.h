@@ -1,727 +1,465 @@
 const uint8_t FreeSans24pt7bBitmaps[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x66,
-  0x66, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F,
-  0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xEC, 0x19, 0x83, 0x30, 0x60, 0x00, 0x70,
-  0x3C, 0x00, 0x70, 0x3C, 0x00, 0xF0, 0x38, 0x00, 0xF0, 0x38, 0x00, 0xF0,
-  0x78, 0x00, 0xE0, 0x78, 0x00, 0xE0, 0x78, 0x01, 0xE0, 0x70, 0x01, 0xE0,
-  0x70, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x03, 0xC0,
-  0xE0, 0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03, 0x81, 0xE0, 0x03, 0x81,
-  0xE0, 0x03, 0x81, 0xE0, 0x07, 0x81, 0xC0, 0x07, 0x81, 0xC0, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x0F, 0x03, 0x80, 0x0F, 0x03,
-  0x80, 0x0F, 0x07, 0x80, 0x0E, 0x07, 0x80, 0x0E, 0x07, 0x80, 0x1E, 0x07,
-  0x00, 0x1E, 0x07, 0x00, 0x1E, 0x07, 0x00, 0x1C, 0x0F, 0x00, 0x1C, 0x0F,
-  0x00, 0x00, 0x38, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFE,
-  0x01, 0xFF, 0xFE, 0x07, 0xE7, 0x3E, 0x0F, 0x8E, 0x3C, 0x3E, 0x1C, 0x3C,
-  0x78, 0x38, 0x38, 0xF0, 0x70, 0x71, 0xE0, 0xE0, 0xE3, 0xC1, 0xC0, 0x07,
-  0x83, 0x80, 0x0F, 0x87, 0x00, 0x0F, 0x8E, 0x00, 0x1F, 0xDC, 0x00, 0x1F,
-  0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x03,
-  0xFF, 0x80, 0x07, 0x1F, 0x80, 0x0E, 0x1F, 0x00, 0x1C, 0x1F, 0x00, 0x38,
-  0x1F, 0xC0, 0x70, 0x3F, 0x80, 0xE0, 0x7F, 0x81, 0xC0, 0xFF, 0x03, 0x81,
-  0xEF, 0x07, 0x07, 0x9F, 0x0E, 0x0F, 0x3E, 0x1C, 0x3E, 0x3F, 0x39, 0xF8,
-  0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0x80, 0x00,
-  0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00,
-  0x00, 0x00, 0x1C, 0x00, 0x0F, 0xC0, 0x00, 0x78, 0x00, 0x3F, 0xE0, 0x00,
-  0xE0, 0x01, 0xFF, 0xE0, 0x03, 0x80, 0x03, 0xFF, 0xE0, 0x07, 0x00, 0x0F,
-  0x87, 0xC0, 0x1C, 0x00, 0x3C, 0x03, 0xC0, 0x38, 0x00, 0x70, 0x03, 0x80,
-  0xE0, 0x00, 0xE0, 0x07, 0x03, 0xC0, 0x01, 0xC0, 0x0E, 0x07, 0x00, 0x03,
-  0x80, 0x1C, 0x1E, 0x00, 0x07, 0x80, 0x78, 0x38, 0x00, 0x07, 0xC3, 0xE0,
-  0xF0, 0x00, 0x07, 0xFF, 0xC1, 0xC0, 0x00, 0x0F, 0xFF, 0x07, 0x80, 0x00,
-  0x0F, 0xFC, 0x0E, 0x00, 0x00, 0x07, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0x80, 0xFF,
-  0x80, 0x00, 0x0E, 0x07, 0xFF, 0x80, 0x00, 0x3C, 0x0F, 0xFF, 0x80, 0x00,
-  0x70, 0x3E, 0x1F, 0x00, 0x01, 0xE0, 0xF0, 0x0F, 0x00, 0x03, 0x81, 0xC0,
-  0x0E, 0x00, 0x0F, 0x03, 0x80, 0x1C, 0x00, 0x1C, 0x07, 0x00, 0x38, 0x00,
-  0x78, 0x0E, 0x00, 0x70, 0x00, 0xE0, 0x1E, 0x01, 0xE0, 0x03, 0x80, 0x1F,
-  0x0F, 0x80, 0x07, 0x00, 0x1F, 0xFF, 0x00, 0x1C, 0x00, 0x3F, 0xFC, 0x00,
-  0x38, 0x00, 0x1F, 0xF0, 0x00, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00,
-  0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x07,
-  0xC3, 0xC0, 0x00, 0xF8, 0x1E, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0xF0, 0x0E,
-  0x00, 0x0F, 0x00, 0xE0, 0x00, 0xF0, 0x0E, 0x00, 0x07, 0x81, 0xE0, 0x00,
-  0x7C, 0x3C, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x1F, 0x1E, 0x07, 0x83, 0xE0, 0xF0, 0x78, 0x7C, 0x0F, 0x8F, 0x87, 0x80,
-  0x7C, 0xF0, 0xF0, 0x03, 0xFF, 0x0F, 0x00, 0x1F, 0xE0, 0xF0, 0x00, 0xFE,
-  0x0F, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x7E, 0x0F, 0x80, 0x0F, 0xF0, 0x7C,
-  0x01, 0xFF, 0x07, 0xF0, 0x7D, 0xF8, 0x3F, 0xFF, 0x8F, 0xC1, 0xFF, 0xF0,
-  0x7E, 0x0F, 0xFE, 0x03, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF6, 0x66, 0x01, 0xC0, 0x70, 0x38, 0x1C, 0x07, 0x03, 0xC0, 0xE0, 0x78,
-  0x1C, 0x07, 0x03, 0xC0, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x70, 0x3C,
-  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
-  0xC0, 0x70, 0x1E, 0x07, 0x81, 0xE0, 0x38, 0x0F, 0x03, 0xC0, 0x70, 0x1E,
-  0x03, 0x80, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x18, 0x07, 0xE0, 0x38, 0x07,
-  0x01, 0xC0, 0x38, 0x0F, 0x01, 0xC0, 0x78, 0x0E, 0x03, 0x80, 0xF0, 0x1C,
-  0x07, 0x01, 0xE0, 0x78, 0x1E, 0x03, 0x80, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
-  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0x81, 0xE0, 0x78,
-  0x1E, 0x07, 0x03, 0xC0, 0xF0, 0x38, 0x1E, 0x07, 0x01, 0xC0, 0xE0, 0x38,
-  0x1C, 0x06, 0x03, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x63,
-  0x1B, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x07, 0x80, 0x3F, 0x01, 0xCE, 0x07,
-  0x3C, 0x38, 0x70, 0x21, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00,
-  0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E,
-  0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x0E, 0x00,
-  0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00,
-  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0xF3,
-  0x33, 0x36, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0,
-  0x00, 0x38, 0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x07, 0x00, 0x30, 0x03, 0x80,
-  0x1C, 0x00, 0xC0, 0x06, 0x00, 0x70, 0x03, 0x80, 0x18, 0x01, 0xC0, 0x0E,
-  0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0x80, 0x0C, 0x00, 0xE0, 0x07, 0x00,
-  0x30, 0x03, 0x80, 0x1C, 0x00, 0xC0, 0x06, 0x00, 0x70, 0x03, 0x80, 0x18,
-  0x01, 0xC0, 0x0E, 0x00, 0x60, 0x07, 0x00, 0x38, 0x00, 0x00, 0xFC, 0x00,
-  0x0F, 0xFC, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x1F, 0x87, 0xE0, 0xF8,
-  0x07, 0xC3, 0xC0, 0x0F, 0x1F, 0x00, 0x3E, 0x78, 0x00, 0x79, 0xE0, 0x01,
-  0xE7, 0x80, 0x07, 0xBC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-  0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-  0xDE, 0x00, 0x1E, 0x78, 0x00, 0x79, 0xE0, 0x01, 0xE7, 0xC0, 0x0F, 0x8F,
-  0x00, 0x3C, 0x3E, 0x01, 0xF0, 0x7C, 0x1F, 0x81, 0xFF, 0xFE, 0x03, 0xFF,
-  0xF0, 0x03, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x60, 0x1C, 0x03, 0x80,
-  0xF0, 0x3E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
-  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
-  0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
-  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x01, 0xFF,
-  0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0x03, 0xF9, 0xF0, 0x03, 0xE7, 0x80, 0x07,
-  0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xC0,
-  0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-  0x7C, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0,
-  0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x3E,
-  0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83,
-  0xF0, 0x1F, 0x87, 0xC0, 0x1F, 0x1F, 0x00, 0x1F, 0x3C, 0x00, 0x1E, 0x78,
-  0x00, 0x3C, 0xF0, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
-  0x07, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
-  0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-  0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-  0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xFB, 0xC0, 0x01, 0xE7, 0xC0, 0x07, 0xC7,
-  0xE0, 0x3F, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x03,
-  0xFC, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-  0xE0, 0x00, 0x7B, 0xC0, 0x01, 0xE7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E,
-  0x00, 0x3C, 0x3C, 0x00, 0xF0, 0x78, 0x03, 0xC0, 0xF0, 0x07, 0x81, 0xE0,
-  0x1E, 0x03, 0xC0, 0x78, 0x07, 0x81, 0xE0, 0x0F, 0x03, 0xC0, 0x1E, 0x0F,
-  0x00, 0x3C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03,
-  0xC0, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x07, 0xFF, 0xFC,
-  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x3F, 0x80, 0x7B, 0xFF,
-  0x81, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0x80, 0xFC, 0x78, 0x01, 0xF8,
-  0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0xFF, 0x80, 0x07, 0x9E, 0x00, 0x1E, 0x7C, 0x00, 0xF1, 0xFC, 0x0F, 0xC3,
-  0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x07, 0xF0, 0x00, 0x00,
-  0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xF8, 0x1F, 0x83,
-  0xF0, 0xF8, 0x07, 0xC3, 0xC0, 0x0F, 0x8F, 0x00, 0x1E, 0x78, 0x00, 0x79,
-  0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0xFE, 0x03, 0xCF,
-  0xFE, 0x0F, 0x7F, 0xFE, 0x3F, 0xFF, 0xFC, 0xFF, 0x03, 0xF3, 0xF0, 0x03,
-  0xEF, 0x80, 0x07, 0xBE, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-  0x00, 0x03, 0xFC, 0x00, 0x0F, 0x70, 0x00, 0x3D, 0xC0, 0x00, 0xF7, 0x80,
-  0x07, 0x9F, 0x00, 0x3E, 0x3E, 0x00, 0xF8, 0xFC, 0x0F, 0xC1, 0xFF, 0xFE,
-  0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0x00, 0x00,
-  0x78, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
-  0x01, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x70,
-  0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x01,
-  0xE0, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00,
-  0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78,
-  0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00,
-  0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x3F,
-  0x03, 0xF1, 0xF0, 0x03, 0xC7, 0xC0, 0x0F, 0x9E, 0x00, 0x1E, 0x78, 0x00,
-  0x79, 0xE0, 0x01, 0xE7, 0x80, 0x0F, 0x8F, 0x00, 0x3C, 0x3F, 0x03, 0xF0,
-  0x7F, 0xFF, 0x80, 0x7F, 0xF8, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0xFC,
-  0x0F, 0xC7, 0xC0, 0x0F, 0x9E, 0x00, 0x1E, 0xF8, 0x00, 0x7F, 0xC0, 0x00,
-  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-  0x80, 0x07, 0xDE, 0x00, 0x1E, 0x7C, 0x00, 0xF8, 0xFC, 0x0F, 0xC3, 0xFF,
-  0xFF, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x01, 0xFC,
-  0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x83, 0xF0, 0x7E, 0x3E,
-  0x00, 0xF1, 0xE0, 0x07, 0xCF, 0x00, 0x1E, 0xF0, 0x00, 0x77, 0x80, 0x03,
-  0xBC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xE0,
-  0x03, 0xEF, 0x00, 0x1F, 0x7C, 0x01, 0xF9, 0xF8, 0x3F, 0xCF, 0xFF, 0xFE,
-  0x3F, 0xFE, 0xF0, 0xFF, 0xE7, 0x80, 0xFC, 0x3C, 0x00, 0x01, 0xE0, 0x00,
-  0x0E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x9E, 0x00, 0x3C, 0xF0, 0x03, 0xC7,
-  0xC0, 0x3E, 0x1F, 0x03, 0xE0, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x0F, 0xFE,
-  0x00, 0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0x33, 0x36, 0xEC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1C, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xC0,
-  0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-  0x80, 0x03, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xF0,
-  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x01,
-  0xC0, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-  0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF8, 0x00,
-  0x01, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F,
-  0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00,
-  0x0F, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0xF8,
-  0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x7E, 0x0F, 0xE7, 0x80,
-  0x3E, 0x78, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-  0x00, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
-  0x00, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-  0x01, 0xF0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0,
-  0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01,
-  0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-  0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-  0x07, 0xFC, 0x03, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7E,
-  0x00, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00,
-  0x00, 0x3F, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x3C, 0x00, 0x7E, 0x00,
-  0x3E, 0x0F, 0x00, 0x3F, 0xE3, 0xC3, 0xE3, 0xE0, 0x1F, 0xFE, 0x78, 0x3C,
-  0x78, 0x07, 0xE1, 0xFF, 0x07, 0xDF, 0x01, 0xF0, 0x1F, 0xC0, 0xFB, 0xC0,
-  0x7C, 0x01, 0xF8, 0x0F, 0x78, 0x0F, 0x00, 0x3F, 0x01, 0xEF, 0x03, 0xC0,
-  0x07, 0xC0, 0x3F, 0xC0, 0x78, 0x00, 0xF8, 0x07, 0xF8, 0x0F, 0x00, 0x1F,
-  0x00, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x1F, 0xE0, 0x78, 0x00, 0x78, 0x07,
-  0xFC, 0x0F, 0x00, 0x1F, 0x00, 0xF7, 0x81, 0xE0, 0x03, 0xC0, 0x1E, 0xF0,
-  0x3C, 0x00, 0x78, 0x07, 0x9E, 0x07, 0x80, 0x1F, 0x01, 0xF3, 0xE0, 0xF8,
-  0x07, 0xC0, 0x3C, 0x3C, 0x0F, 0x81, 0xF8, 0x0F, 0x87, 0x81, 0xF8, 0x7F,
-  0x87, 0xE0, 0xF8, 0x1F, 0xFE, 0xFF, 0xF8, 0x0F, 0x01, 0xFF, 0x1F, 0xFC,
-  0x01, 0xF0, 0x0F, 0x80, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-  0x7C, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-  0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x03,
-  0xDF, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x01, 0xE3,
-  0xE0, 0x00, 0x0F, 0x87, 0x80, 0x00, 0x3C, 0x1F, 0x00, 0x01, 0xF0, 0x7C,
-  0x00, 0x07, 0x80, 0xF0, 0x00, 0x1E, 0x03, 0xE0, 0x00, 0xF8, 0x0F, 0x80,
-  0x03, 0xC0, 0x1E, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x7C, 0x01, 0xF0, 0x01,
-  0xE0, 0x03, 0xC0, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0xFF,
-  0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x07, 0xC0, 0x78, 0x00,
-  0x0F, 0x83, 0xE0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0xF8, 0x3C, 0x00, 0x01,
-  0xF1, 0xF0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x3E,
-  0xF8, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x01, 0xE0, 0xFF, 0xFF, 0x80, 0x7F,
-  0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x0F, 0x00, 0x0F, 0xC7,
-  0x80, 0x01, 0xE3, 0xC0, 0x00, 0xF9, 0xE0, 0x00, 0x3C, 0xF0, 0x00, 0x1E,
-  0x78, 0x00, 0x0F, 0x3C, 0x00, 0x07, 0x9E, 0x00, 0x07, 0x8F, 0x00, 0x03,
-  0xC7, 0x80, 0x07, 0xC3, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-  0xF8, 0x7F, 0xFF, 0xFE, 0x3C, 0x00, 0x0F, 0x9E, 0x00, 0x03, 0xEF, 0x00,
-  0x00, 0xF7, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
-  0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF,
-  0x00, 0x01, 0xF7, 0x80, 0x01, 0xFB, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF8,
-  0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07,
-  0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0xFE, 0x01,
-  0xF8, 0x07, 0xC0, 0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x3C,
-  0x3C, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x07, 0x9E, 0x00, 0x00, 0x3C, 0xF0,
-  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x00,
-  0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-  0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x78, 0x00,
-  0x00, 0x7B, 0xC0, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x3C, 0x78, 0x00, 0x01,
-  0xE3, 0xE0, 0x00, 0x1F, 0x0F, 0x80, 0x01, 0xF0, 0x3E, 0x00, 0x1F, 0x81,
-  0xFE, 0x03, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x3F,
-  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x0F, 0x00, 0x0F, 0xE1, 0xE0,
-  0x00, 0x7E, 0x3C, 0x00, 0x07, 0xE7, 0x80, 0x00, 0x7C, 0xF0, 0x00, 0x07,
-  0xDE, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x0F, 0x78, 0x00, 0x01, 0xEF, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F,
-  0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF7,
-  0x80, 0x00, 0x1E, 0xF0, 0x00, 0x03, 0xDE, 0x00, 0x00, 0xFB, 0xC0, 0x00,
-  0x3E, 0x78, 0x00, 0x0F, 0xCF, 0x00, 0x03, 0xF1, 0xE0, 0x01, 0xFC, 0x3F,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0,
-  0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFE, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
-  0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3C,
-  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
-  0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFE,
-  0x00, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x7F,
-  0x01, 0xF8, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x1E,
-  0x3E, 0x00, 0x00, 0x3E, 0x78, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x03,
-  0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0,
-  0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00,
-  0x07, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xBC, 0x00,
-  0x00, 0x0F, 0x78, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x7D, 0xF0, 0x00,
-  0x00, 0xF9, 0xF0, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x07, 0xE3, 0xF0, 0x00,
-  0x1F, 0xC3, 0xF0, 0x00, 0xFF, 0x83, 0xFC, 0x07, 0xEF, 0x03, 0xFF, 0xFF,
-  0x9E, 0x03, 0xFF, 0xFE, 0x1C, 0x01, 0xFF, 0xF0, 0x38, 0x00, 0x7F, 0x80,
-  0x00, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xE0,
-  0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
-  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80,
-  0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00,
-  0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00,
-  0x03, 0xC0, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-  0x07, 0xF8, 0x01, 0xFF, 0x80, 0x3E, 0xF0, 0x0F, 0x9F, 0x83, 0xF1, 0xFF,
-  0xFC, 0x3F, 0xFF, 0x01, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0xF0, 0x00, 0x07,
-  0xDE, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x7C, 0x78, 0x00, 0x1F, 0x0F, 0x00,
-  0x07, 0xC1, 0xE0, 0x01, 0xF0, 0x3C, 0x00, 0x7C, 0x07, 0x80, 0x1F, 0x00,
-  0xF0, 0x07, 0xC0, 0x1E, 0x01, 0xF0, 0x03, 0xC0, 0x7C, 0x00, 0x78, 0x1F,
-  0x00, 0x0F, 0x07, 0xC0, 0x01, 0xE1, 0xF0, 0x00, 0x3C, 0x7E, 0x00, 0x07,
-  0x9F, 0xE0, 0x00, 0xF7, 0xFE, 0x00, 0x1F, 0xF7, 0xC0, 0x03, 0xFC, 0x7C,
-  0x00, 0x7F, 0x07, 0xC0, 0x0F, 0xC0, 0xF8, 0x01, 0xF0, 0x0F, 0x80, 0x3C,
-  0x00, 0xF8, 0x07, 0x80, 0x1F, 0x80, 0xF0, 0x01, 0xF0, 0x1E, 0x00, 0x1F,
-  0x03, 0xC0, 0x03, 0xF0, 0x78, 0x00, 0x3E, 0x0F, 0x00, 0x03, 0xE1, 0xE0,
-  0x00, 0x3E, 0x3C, 0x00, 0x07, 0xC7, 0x80, 0x00, 0x7C, 0xF0, 0x00, 0x07,
-  0xDE, 0x00, 0x00, 0xFC, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
-  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
-  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
-  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00,
-  0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78,
-  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-  0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x00,
-  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xF7, 0x00, 0x00, 0xEF, 0xF7, 0x80, 0x01, 0xEF, 0xF7, 0x80,
-  0x01, 0xEF, 0xF3, 0xC0, 0x01, 0xCF, 0xF3, 0xC0, 0x03, 0xCF, 0xF3, 0xC0,
-  0x03, 0xCF, 0xF1, 0xE0, 0x03, 0x8F, 0xF1, 0xE0, 0x07, 0x8F, 0xF1, 0xE0,
-  0x07, 0x8F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0,
-  0x0F, 0x0F, 0xF0, 0x78, 0x1E, 0x0F, 0xF0, 0x78, 0x1E, 0x0F, 0xF0, 0x78,
-  0x1E, 0x0F, 0xF0, 0x3C, 0x3C, 0x0F, 0xF0, 0x3C, 0x3C, 0x0F, 0xF0, 0x3C,
-  0x3C, 0x0F, 0xF0, 0x1E, 0x78, 0x0F, 0xF0, 0x1E, 0x78, 0x0F, 0xF0, 0x0E,
-  0x78, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07,
-  0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x03,
-  0xE0, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-  0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00,
-  0x3F, 0xDE, 0x00, 0x0F, 0xF7, 0xC0, 0x03, 0xFC, 0xF8, 0x00, 0xFF, 0x1E,
-  0x00, 0x3F, 0xC7, 0xC0, 0x0F, 0xF0, 0xF0, 0x03, 0xFC, 0x3E, 0x00, 0xFF,
-  0x07, 0xC0, 0x3F, 0xC0, 0xF0, 0x0F, 0xF0, 0x3E, 0x03, 0xFC, 0x07, 0xC0,
-  0xFF, 0x00, 0xF0, 0x3F, 0xC0, 0x3E, 0x0F, 0xF0, 0x07, 0x83, 0xFC, 0x01,
-  0xF0, 0xFF, 0x00, 0x3E, 0x3F, 0xC0, 0x07, 0x8F, 0xF0, 0x01, 0xF3, 0xFC,
-  0x00, 0x3E, 0xFF, 0x00, 0x07, 0xBF, 0xC0, 0x01, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
-  0x0F, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-  0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7F, 0x80,
-  0xFF, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x03, 0xF0, 0x3E, 0x00,
-  0x00, 0xF8, 0x3E, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0F, 0x1F, 0x00,
-  0x00, 0x07, 0xCF, 0x00, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x00, 0xF7, 0xC0,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0x0F,
-  0x3E, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x07, 0x87, 0xC0, 0x00, 0x07,
-  0xC1, 0xF0, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07,
-  0xE0, 0x0F, 0xF0, 0x1F, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-  0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xF0, 0x00,
-  0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-  0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-  0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0xFE, 0xFF, 0xFF,
-  0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0xFF,
-  0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00,
-  0xF8, 0x3E, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00,
-  0x07, 0xCF, 0x00, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x00, 0xF7, 0xC0, 0x00,
-  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0x0F, 0x3E,
-  0x00, 0x00, 0x0F, 0x8F, 0x00, 0x03, 0x87, 0x87, 0xC0, 0x03, 0xE7, 0xC1,
-  0xF0, 0x00, 0xFF, 0xC0, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0x00, 0x0F, 0xE0,
-  0x0F, 0xF0, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0x1F, 0xFF, 0xC7, 0xC0, 0x01, 0xFF, 0x01, 0xE0, 0x00, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x0F,
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x3F, 0x3C, 0x00, 0x07,
-  0xCF, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x1E, 0xF0, 0x00, 0x07, 0xBC, 0x00,
-  0x01, 0xEF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x1E, 0xF0, 0x00, 0x07, 0xBC,
-  0x00, 0x03, 0xCF, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0xF8, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xF0, 0x00,
-  0x3F, 0x3C, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x1E, 0xF0,
-  0x00, 0x07, 0xBC, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x1E,
-  0xF0, 0x00, 0x07, 0xBC, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x7B, 0xC0, 0x00,
-  0x1E, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0xC0, 0x00,
-  0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x81, 0xF8, 0x07,
-  0xF0, 0x7C, 0x00, 0x1F, 0x0F, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x3E, 0x78,
-  0x00, 0x03, 0xCF, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0x07, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xF8,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x3E, 0xF8, 0x00,
-  0x07, 0x9F, 0x80, 0x01, 0xF1, 0xFE, 0x01, 0xFC, 0x1F, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00,
-  0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00,
-  0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
-  0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00,
-  0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80,
-  0x00, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x7D, 0xE0, 0x00, 0x1E, 0x7C, 0x00, 0x0F, 0x9F,
-  0x80, 0x07, 0xE3, 0xF8, 0x07, 0xF0, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC,
-  0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF7, 0xC0,
-  0x00, 0x0F, 0x9E, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xC7, 0xC0, 0x00,
-  0x3E, 0x1E, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0xF8,
-  0x1E, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x3C, 0x07, 0xC0, 0x03, 0xE0, 0x1E,
-  0x00, 0x1F, 0x00, 0xF8, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1E, 0x00,
-  0x7C, 0x00, 0xF8, 0x03, 0xC0, 0x03, 0xC0, 0x1E, 0x00, 0x1F, 0x01, 0xF0,
-  0x00, 0xF8, 0x0F, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x1F, 0x07, 0x80, 0x00,
-  0xF8, 0x3C, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x78,
-  0xF0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x1F, 0x78, 0x00, 0x00, 0x7B, 0xC0,
-  0x00, 0x03, 0xDE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-  0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0x80, 0x03,
-  0xF0, 0x00, 0x7D, 0xE0, 0x00, 0xFC, 0x00, 0x1E, 0x7C, 0x00, 0x7F, 0x80,
-  0x0F, 0x9F, 0x00, 0x1F, 0xE0, 0x03, 0xE7, 0xC0, 0x07, 0xF8, 0x00, 0xF8,
-  0xF0, 0x01, 0xFF, 0x00, 0x3C, 0x3E, 0x00, 0xF3, 0xC0, 0x1F, 0x0F, 0x80,
-  0x3C, 0xF0, 0x07, 0xC3, 0xE0, 0x0F, 0x3C, 0x01, 0xF0, 0x78, 0x07, 0xC7,
-  0x80, 0x78, 0x1F, 0x01, 0xE1, 0xE0, 0x1E, 0x07, 0xC0, 0x78, 0x78, 0x0F,
-  0x80, 0xF0, 0x1E, 0x1E, 0x03, 0xE0, 0x3C, 0x0F, 0x83, 0xC0, 0xF0, 0x0F,
-  0x83, 0xC0, 0xF0, 0x3C, 0x03, 0xE0, 0xF0, 0x3C, 0x1F, 0x00, 0x78, 0x3C,
-  0x0F, 0x87, 0xC0, 0x1E, 0x1E, 0x01, 0xE1, 0xE0, 0x07, 0x87, 0x80, 0x78,
-  0x78, 0x01, 0xF1, 0xE0, 0x1E, 0x1E, 0x00, 0x3C, 0xF8, 0x03, 0xCF, 0x80,
-  0x0F, 0x3C, 0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x3C, 0xF0, 0x00, 0xFB,
-  0xC0, 0x0F, 0xBC, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF8, 0x00,
-  0x7F, 0x80, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xF8,
-  0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00,
-  0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-  0x01, 0xF3, 0xF0, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0xF8, 0x3E, 0x00, 0x0F,
-  0x80, 0xF8, 0x00, 0xF8, 0x07, 0xC0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x00,
-  0x7C, 0x07, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3E,
-  0x3E, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07,
-  0xDF, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3E, 0x0F,
-  0x80, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x01, 0xF0, 0x01, 0xF0, 0x07, 0xC0,
-  0x1F, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0xF8, 0x0F, 0x80, 0x03, 0xE0, 0xF8,
-  0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7C, 0x7C, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-  0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFD, 0xF0, 0x00, 0x03, 0xE7, 0xE0, 0x00,
-  0x1F, 0x0F, 0x80, 0x00, 0x7C, 0x1F, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x1F,
-  0x00, 0xF8, 0x00, 0x7C, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
-  0x0F, 0x80, 0x7C, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x7C, 0x0F, 0x80, 0x00,
-  0xF8, 0x7C, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x0F,
-  0x3C, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC,
-  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1E, 0x00,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00,
-  0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-  0x07, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01,
-  0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xFF,
-  0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01,
-  0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01,
-  0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00,
-  0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x07, 0x00, 0x18, 0x00, 0xE0, 0x07, 0x00, 0x18, 0x00, 0xE0,
-  0x07, 0x00, 0x18, 0x00, 0xC0, 0x07, 0x00, 0x38, 0x00, 0xC0, 0x07, 0x00,
-  0x38, 0x00, 0xC0, 0x06, 0x00, 0x38, 0x00, 0xC0, 0x06, 0x00, 0x38, 0x01,
-  0xC0, 0x06, 0x00, 0x38, 0x01, 0xC0, 0x06, 0x00, 0x30, 0x01, 0xC0, 0x0E,
-  0x00, 0x30, 0x01, 0xC0, 0x0E, 0x00, 0x30, 0x01, 0xC0, 0x0E, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3F,
-  0x00, 0x0F, 0xC0, 0x07, 0xF8, 0x01, 0xCE, 0x00, 0x73, 0x80, 0x3C, 0x70,
-  0x0E, 0x1C, 0x07, 0x87, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x38, 0x07, 0x0E,
-  0x01, 0xC7, 0x80, 0x79, 0xC0, 0x0E, 0x70, 0x03, 0xB8, 0x00, 0x70, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
-  0x00, 0xE0, 0x1C, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0,
-  0x3F, 0xFF, 0xF0, 0x7E, 0x03, 0xF8, 0x7C, 0x00, 0xF8, 0x78, 0x00, 0x78,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8,
-  0x00, 0x03, 0xF8, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x3F, 0xFE, 0x78,
-  0x7F, 0x80, 0x78, 0xFC, 0x00, 0x78, 0xF8, 0x00, 0x78, 0xF0, 0x00, 0x78,
-  0xF0, 0x00, 0xF8, 0xF0, 0x00, 0xF8, 0xF8, 0x03, 0xF8, 0x7E, 0x0F, 0xF8,
-  0x7F, 0xFF, 0x7F, 0x3F, 0xFE, 0x3F, 0x1F, 0xFC, 0x3F, 0x07, 0xE0, 0x1F,
-  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
-  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x7E,
-  0x03, 0xC7, 0xFE, 0x0F, 0x7F, 0xFC, 0x3D, 0xFF, 0xF8, 0xFF, 0x07, 0xF3,
-  0xF8, 0x07, 0xCF, 0xC0, 0x0F, 0xBE, 0x00, 0x1E, 0xF8, 0x00, 0x7B, 0xE0,
-  0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-  0x80, 0x07, 0xBE, 0x00, 0x1E, 0xFC, 0x00, 0xFB, 0xF8, 0x07, 0xCF, 0xF0,
-  0x7F, 0x3B, 0xFF, 0xF8, 0xE7, 0xFF, 0xC3, 0x8F, 0xFE, 0x00, 0x0F, 0xE0,
-  0x00, 0x00, 0xFE, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0xC3,
-  0xF0, 0x3F, 0x1F, 0x00, 0xF9, 0xF0, 0x03, 0xCF, 0x00, 0x0F, 0x78, 0x00,
-  0x07, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78,
-  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-  0x1E, 0x00, 0x1E, 0xF0, 0x00, 0xF7, 0xC0, 0x0F, 0x9F, 0x00, 0xF8, 0xFC,
-  0x0F, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x7F, 0x00,
-  0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
-  0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x01,
-  0xFC, 0x1E, 0x0F, 0xFE, 0x3C, 0x3F, 0xFF, 0x78, 0xFF, 0xFF, 0xF3, 0xF8,
-  0x3F, 0xE7, 0xC0, 0x1F, 0xDF, 0x00, 0x1F, 0xBE, 0x00, 0x1F, 0x78, 0x00,
-  0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x01,
-  0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-  0xF0, 0x00, 0x7D, 0xE0, 0x00, 0xFB, 0xC0, 0x01, 0xF7, 0xC0, 0x07, 0xE7,
-  0xC0, 0x1F, 0xCF, 0xE0, 0xFF, 0x8F, 0xFF, 0xF7, 0x0F, 0xFF, 0xCE, 0x0F,
-  0xFF, 0x1C, 0x07, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xFF,
-  0xFC, 0x07, 0xFF, 0xF8, 0x1F, 0x83, 0xF0, 0xF8, 0x07, 0xC7, 0xC0, 0x0F,
-  0x9E, 0x00, 0x1E, 0x78, 0x00, 0x7B, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x1E,
-  0x7C, 0x00, 0x78, 0xF8, 0x03, 0xE3, 0xF0, 0x3F, 0x07, 0xFF, 0xF8, 0x0F,
-  0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xC3, 0xF0, 0xFC,
-  0x7F, 0x1F, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x3F, 0xFF, 0xFF, 0xFF, 0x1E,
-  0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81,
-  0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
-  0x1E, 0x07, 0x80, 0x00, 0xFC, 0x00, 0x1F, 0xF8, 0xF0, 0xFF, 0xFB, 0xC7,
-  0xFF, 0xFF, 0x3F, 0x83, 0xFC, 0xF8, 0x07, 0xF7, 0xC0, 0x0F, 0xDE, 0x00,
-  0x1F, 0x78, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-  0x00, 0x3F, 0xC0, 0x00, 0xF7, 0x80, 0x07, 0xDE, 0x00, 0x1F, 0x7C, 0x00,
-  0xFC, 0xF8, 0x07, 0xF3, 0xF8, 0x3F, 0xC7, 0xFF, 0xEF, 0x0F, 0xFF, 0x3C,
-  0x1F, 0xF8, 0xF0, 0x1F, 0x83, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x79, 0xE0,
-  0x01, 0xE7, 0xC0, 0x0F, 0x8F, 0x80, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF,
-  0x80, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
-  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80,
-  0x00, 0xF0, 0xFE, 0x1E, 0x3F, 0xE3, 0xCF, 0xFF, 0x7B, 0xFF, 0xEF, 0xF0,
-  0xFF, 0xF8, 0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x01, 0xFE, 0x00,
-  0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00,
-  0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
-  0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
-  0xFE, 0x00, 0x3C, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F,
-  0xFF, 0xFE, 0xFE, 0xF8, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
-  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
-  0x00, 0xF0, 0x00, 0x07, 0x80, 0x1F, 0x3C, 0x01, 0xF1, 0xE0, 0x1F, 0x0F,
-  0x01, 0xF0, 0x78, 0x1F, 0x03, 0xC1, 0xF0, 0x1E, 0x1F, 0x00, 0xF1, 0xF0,
-  0x07, 0x9F, 0x00, 0x3D, 0xF8, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x7F,
-  0x7C, 0x03, 0xF1, 0xF0, 0x1F, 0x07, 0xC0, 0xF0, 0x3E, 0x07, 0x80, 0xF8,
-  0x3C, 0x03, 0xC1, 0xE0, 0x1F, 0x0F, 0x00, 0x7C, 0x78, 0x03, 0xE3, 0xC0,
-  0x0F, 0x9E, 0x00, 0x3C, 0xF0, 0x01, 0xF7, 0x80, 0x07, 0xC0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x03, 0xF0, 0xE3, 0xFE, 0x0F, 0xFC, 0xE7,
-  0xFF, 0x1F, 0xFE, 0xEF, 0xFF, 0xBF, 0xFE, 0xFE, 0x0F, 0xF8, 0x3F, 0xFC,
-  0x07, 0xF0, 0x1F, 0xF8, 0x03, 0xE0, 0x0F, 0xF8, 0x03, 0xE0, 0x0F, 0xF0,
-  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
-  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
-  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
-  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
-  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
-  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x7E, 0x0E, 0x1F, 0xF8, 0xE7, 0xFF, 0xCE, 0xFF, 0xFE, 0xEF, 0x07, 0xFF,
-  0xE0, 0x1F, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x0F,
-  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-  0x00, 0xFF, 0x00, 0x0F, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF,
-  0x80, 0xFF, 0xFF, 0x83, 0xF8, 0x3F, 0x87, 0xC0, 0x1F, 0x1F, 0x00, 0x1F,
-  0x3C, 0x00, 0x1E, 0x78, 0x00, 0x3D, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-  0x80, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8,
-  0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x7D, 0xE0, 0x00, 0xF3, 0xC0,
-  0x01, 0xE7, 0xC0, 0x07, 0xC7, 0xC0, 0x1F, 0x0F, 0xE0, 0xFE, 0x0F, 0xFF,
-  0xF8, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x03, 0xF8, 0x00, 0x00, 0xFE,
-  0x03, 0x8F, 0xFE, 0x0E, 0x7F, 0xFC, 0x3B, 0xFF, 0xF8, 0xFF, 0x87, 0xF3,
-  0xF8, 0x07, 0xCF, 0xC0, 0x0F, 0xBE, 0x00, 0x1E, 0xF8, 0x00, 0x7B, 0xE0,
-  0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-  0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-  0x80, 0x07, 0xBE, 0x00, 0x1E, 0xFC, 0x00, 0xFB, 0xF8, 0x07, 0xCF, 0xF0,
-  0x7F, 0x3F, 0xFF, 0xF8, 0xF7, 0xFF, 0xC3, 0xC7, 0xFE, 0x0F, 0x07, 0xE0,
-  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x07, 0xFF, 0x1C, 0x3F, 0xFF, 0x38, 0xFF, 0xFF, 0x73, 0xF8,
-  0x3F, 0xE7, 0xC0, 0x1F, 0xDF, 0x00, 0x1F, 0xBE, 0x00, 0x1F, 0x78, 0x00,
-  0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x01,
-  0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-  0xF0, 0x00, 0x7D, 0xE0, 0x00, 0xFB, 0xC0, 0x01, 0xF7, 0xC0, 0x07, 0xE7,
-  0xC0, 0x1F, 0xCF, 0xE0, 0xFF, 0x8F, 0xFF, 0xEF, 0x0F, 0xFF, 0xDE, 0x0F,
-  0xFE, 0x3C, 0x07, 0xF0, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
-  0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x3C, 0x00, 0x00, 0x78, 0x00, 0xFE, 0x1F, 0xE7, 0xFE, 0xFF, 0xFF, 0x8F,
-  0xC0, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0xF0,
-  0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x3E, 0x07, 0xE7, 0xC0, 0x3E, 0x78, 0x01,
-  0xE7, 0x80, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xFC,
-  0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-  0x03, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-  0x80, 0x1F, 0x7E, 0x07, 0xE7, 0xFF, 0xFE, 0x3F, 0xFF, 0xC1, 0xFF, 0xF0,
-  0x03, 0xFC, 0x00, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x8F, 0xFF,
-  0xFF, 0xFF, 0xC7, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E,
-  0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81,
-  0xE0, 0x78, 0x1F, 0xC7, 0xF0, 0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
-  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-  0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF8, 0x07, 0xFF,
-  0xE0, 0xFF, 0x7F, 0xFF, 0x77, 0xFF, 0xE7, 0x1F, 0xFC, 0x70, 0x7E, 0x00,
-  0x78, 0x00, 0x3E, 0xF0, 0x00, 0x79, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xE3,
-  0xC0, 0x07, 0x87, 0xC0, 0x0F, 0x07, 0x80, 0x3C, 0x0F, 0x00, 0x78, 0x1F,
-  0x01, 0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x7C, 0x1F, 0x00, 0x78,
-  0x3C, 0x00, 0xF0, 0x78, 0x01, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7,
-  0x80, 0x03, 0xDE, 0x00, 0x07, 0xBC, 0x00, 0x0F, 0x70, 0x00, 0x0F, 0xE0,
-  0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
-  0xF8, 0x03, 0xE0, 0x07, 0x9E, 0x00, 0xFC, 0x01, 0xE7, 0x80, 0x3F, 0x00,
-  0x79, 0xF0, 0x0F, 0xC0, 0x3E, 0x3C, 0x07, 0xF0, 0x0F, 0x0F, 0x01, 0xFE,
-  0x03, 0xC3, 0xC0, 0x7F, 0x80, 0xF0, 0x78, 0x1D, 0xE0, 0x78, 0x1E, 0x0F,
-  0x38, 0x1E, 0x07, 0x83, 0xCF, 0x07, 0x81, 0xE0, 0xF3, 0xC1, 0xE0, 0x3C,
-  0x38, 0xF0, 0xF0, 0x0F, 0x1E, 0x1C, 0x3C, 0x03, 0xC7, 0x87, 0x8F, 0x00,
-  0x71, 0xE1, 0xE3, 0x80, 0x1E, 0x70, 0x79, 0xE0, 0x07, 0xBC, 0x0E, 0x78,
-  0x01, 0xEF, 0x03, 0xDE, 0x00, 0x3B, 0xC0, 0xF7, 0x00, 0x0F, 0xE0, 0x3F,
-  0xC0, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x1F, 0x80,
-  0x7E, 0x00, 0x07, 0xC0, 0x1F, 0x80, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0x7C,
-  0x00, 0x78, 0xF0, 0x03, 0xE1, 0xE0, 0x0F, 0x07, 0xC0, 0x78, 0x0F, 0x03,
-  0xE0, 0x1E, 0x0F, 0x00, 0x7C, 0x78, 0x00, 0xF3, 0xE0, 0x01, 0xEF, 0x00,
-  0x07, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x03,
-  0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xCF, 0x00, 0x0F, 0x1E,
-  0x00, 0x78, 0x7C, 0x03, 0xE0, 0xF0, 0x0F, 0x03, 0xE0, 0x78, 0x07, 0xC3,
-  0xE0, 0x0F, 0x1F, 0x00, 0x3E, 0x78, 0x00, 0x7C, 0x78, 0x00, 0x3D, 0xE0,
-  0x01, 0xF7, 0x80, 0x07, 0x8F, 0x00, 0x1E, 0x3C, 0x00, 0xF0, 0xF0, 0x03,
-  0xC1, 0xE0, 0x0F, 0x07, 0x80, 0x78, 0x1E, 0x01, 0xE0, 0x3C, 0x07, 0x80,
-  0xF0, 0x3C, 0x03, 0xC0, 0xF0, 0x07, 0x87, 0xC0, 0x1E, 0x1E, 0x00, 0x78,
-  0x78, 0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0xE0,
-  0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-  0x3E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
-  0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00,
-  0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF7,
-  0xFF, 0xFF, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x01, 0xE0, 0x00, 0x3E,
-  0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C,
-  0x00, 0x07, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C,
-  0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x01, 0xE0, 0xFC, 0x1F, 0x87, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
-  0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01,
-  0xC0, 0x78, 0x1E, 0x0F, 0x81, 0xE0, 0x3C, 0x07, 0xC0, 0x3C, 0x03, 0x80,
-  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38,
-  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0x00, 0xFC, 0x1F, 0x80,
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x1F, 0x83, 0xF0, 0x0F, 0x00,
-  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
-  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x1C, 0x03, 0xC0, 0x3E, 0x03,
-  0xC0, 0x78, 0x1F, 0x07, 0x80, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03,
-  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
-  0x70, 0x1E, 0x1F, 0x83, 0xF0, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x0D,
-  0xFF, 0x01, 0xF0, 0xF8, 0x7C, 0x0F, 0xFD, 0x80, 0x7F, 0x80, 0x03, 0xE0 };
+  0x0F, 0xFF, 0xFF, 0x51, 0x31, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xF5, 0x04,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x12, 0x52, 0x22,
+  0x52, 0x22, 0x52, 0x10, 0x93, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4, 0x63,
+  0xB4, 0x54, 0xB3, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4, 0x63, 0x5F, 0x81,
+  0xF8, 0x1F, 0x86, 0x46, 0x3B, 0x46, 0x3B, 0x46, 0x3B, 0x36, 0x4B, 0x36,
+  0x4B, 0x36, 0x4A, 0x46, 0x3B, 0x46, 0x36, 0xF8, 0x1F, 0x81, 0xF8, 0x54,
+  0x63, 0xB4, 0x63, 0xB4, 0x54, 0xB3, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4,
+  0x63, 0xB4, 0x63, 0xB3, 0x64, 0xB3, 0x64, 0x80, 0xA3, 0xF3, 0x7D, 0xCA,
+  0xE8, 0xF1, 0x66, 0x23, 0x25, 0x55, 0x33, 0x34, 0x45, 0x43, 0x44, 0x34,
+  0x53, 0x53, 0x34, 0x53, 0x53, 0x34, 0x53, 0x53, 0x34, 0x53, 0xB4, 0x53,
+  0xB5, 0x43, 0xC5, 0x33, 0xC7, 0x13, 0xDA, 0xED, 0xCD, 0xCC, 0xDB, 0xC3,
+  0x36, 0xB3, 0x45, 0xB3, 0x55, 0xA3, 0x67, 0x73, 0x67, 0x73, 0x68, 0x63,
+  0x68, 0x63, 0x64, 0x14, 0x53, 0x54, 0x25, 0x43, 0x54, 0x25, 0x43, 0x45,
+  0x36, 0x23, 0x26, 0x5F, 0x27, 0xEC, 0x9F, 0x23, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3F, 0x53, 0xA0, 0xFC, 0x3E, 0x6F, 0x04, 0xD9, 0xD3, 0xCC, 0xB3, 0xDD,
+  0xA3, 0xC5, 0x45, 0x93, 0xC4, 0x84, 0x83, 0xC3, 0xA3, 0x73, 0xD3, 0xA3,
+  0x64, 0xD3, 0xA3, 0x63, 0xE3, 0xA3, 0x54, 0xE4, 0x84, 0x53, 0xF1, 0x54,
+  0x55, 0x4F, 0x2D, 0x53, 0xF3, 0xC5, 0x4F, 0x4A, 0x63, 0xF7, 0x67, 0x3F,
+  0xF6, 0x3F, 0xF5, 0x38, 0x6F, 0x73, 0x79, 0xF4, 0x36, 0xCF, 0x24, 0x6D,
+  0xF1, 0x36, 0x54, 0x5F, 0x04, 0x54, 0x84, 0xE3, 0x63, 0xA3, 0xD4, 0x63,
+  0xA3, 0xD3, 0x73, 0xA3, 0xC4, 0x73, 0xA3, 0xC3, 0x84, 0x84, 0xB3, 0xA5,
+  0x45, 0xC3, 0xBD, 0xB3, 0xCC, 0xC3, 0xE9, 0xC3, 0xF1, 0x65, 0x96, 0xF5,
+  0x9F, 0x3B, 0xF1, 0xDF, 0x05, 0x44, 0xE5, 0x64, 0xD4, 0x83, 0xD4, 0x83,
+  0xD4, 0x83, 0xD4, 0x83, 0xE4, 0x64, 0xE5, 0x44, 0xF1, 0x51, 0x5F, 0x39,
+  0xF4, 0x8F, 0x56, 0xF6, 0x8F, 0x3B, 0xF1, 0x53, 0x46, 0x45, 0x55, 0x45,
+  0x44, 0x56, 0x53, 0x54, 0x48, 0x52, 0x44, 0x4A, 0xA4, 0x4B, 0x85, 0x4C,
+  0x75, 0x4C, 0x66, 0x4D, 0x65, 0x5B, 0x85, 0x59, 0x95, 0x75, 0x51, 0x65,
+  0xF0, 0x36, 0x5D, 0x56, 0x5B, 0x75, 0x77, 0xF0, 0x0F, 0xF6, 0x12, 0x22,
+  0x22, 0x10, 0x73, 0x73, 0x63, 0x63, 0x73, 0x64, 0x63, 0x64, 0x63, 0x73,
+  0x64, 0x63, 0x64, 0x64, 0x64, 0x64, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x73, 0x74, 0x64, 0x64, 0x73, 0x74,
+  0x64, 0x73, 0x74, 0x73, 0x73, 0x83, 0x73, 0x83, 0x82, 0x83, 0x03, 0x73,
+  0x83, 0x73, 0x83, 0x74, 0x73, 0x74, 0x73, 0x73, 0x74, 0x73, 0x73, 0x74,
+  0x64, 0x64, 0x73, 0x74, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x54, 0x64, 0x64, 0x64, 0x63, 0x64, 0x64, 0x63, 0x64, 0x63,
+  0x73, 0x63, 0x73, 0x63, 0x72, 0x73, 0x70, 0x62, 0xC2, 0xC2, 0xC2, 0x72,
+  0x32, 0x32, 0x1F, 0xD4, 0x69, 0x49, 0x67, 0x32, 0x36, 0x32, 0x44, 0x34,
+  0x36, 0x14, 0x14, 0xA3, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xAF, 0xFF, 0xFF, 0xF2, 0xA3, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xA0, 0x0F, 0x52,
+  0x22, 0x22, 0x22, 0x21, 0x21, 0x31, 0x22, 0x0F, 0xFE, 0x0F, 0x50, 0xA3,
+  0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xB2, 0xA3, 0xA3, 0xA2,
+  0xA3, 0xA3, 0xA2, 0xB2, 0xA3, 0xA2, 0xB2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3,
+  0xA2, 0xB2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA0, 0x86,
+  0xEA, 0xAE, 0x7F, 0x16, 0x64, 0x65, 0x58, 0x54, 0x4A, 0x43, 0x5A, 0x52,
+  0x4C, 0x42, 0x4C, 0x42, 0x4C, 0x41, 0x4E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+  0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x41, 0x4C, 0x42, 0x4C, 0x42, 0x4C,
+  0x42, 0x5A, 0x53, 0x4A, 0x44, 0x58, 0x55, 0x55, 0x66, 0xF1, 0x7E, 0xAA,
+  0xE6, 0x80, 0x92, 0x83, 0x83, 0x74, 0x65, 0x3F, 0xFB, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x78, 0xCC, 0x8F,
+  0x15, 0xF3, 0x46, 0x67, 0x25, 0xA5, 0x24, 0xCA, 0xC9, 0xE8, 0xE8, 0xE4,
+  0xF3, 0x4F, 0x25, 0xF2, 0x5F, 0x15, 0xF1, 0x5F, 0x07, 0xD8, 0xC8, 0xD8,
+  0xC8, 0xD7, 0xE6, 0xF0, 0x5F, 0x15, 0xF2, 0x3F, 0x34, 0xF3, 0x3F, 0x43,
+  0xF3, 0xFF, 0xFF, 0xFD, 0x87, 0xDD, 0x9F, 0x07, 0xF2, 0x56, 0x76, 0x45,
+  0x95, 0x35, 0xB5, 0x24, 0xD4, 0x24, 0xD4, 0x24, 0xD4, 0xF4, 0x4F, 0x44,
+  0xF3, 0x4F, 0x17, 0xBB, 0xC9, 0xEA, 0xDC, 0xF2, 0x7F, 0x35, 0xF4, 0x5F,
+  0x44, 0xF4, 0x4F, 0x48, 0xF0, 0x8F, 0x09, 0xD5, 0x14, 0xD4, 0x25, 0xB5,
+  0x36, 0x76, 0x4F, 0x45, 0xF2, 0x8D, 0xC8, 0x80, 0xF0, 0x3F, 0x44, 0xF3,
+  0x5F, 0x26, 0xF2, 0x6F, 0x17, 0xF0, 0x8E, 0x9E, 0x41, 0x4D, 0x42, 0x4C,
+  0x43, 0x4C, 0x43, 0x4B, 0x44, 0x4A, 0x45, 0x49, 0x46, 0x49, 0x46, 0x48,
+  0x47, 0x47, 0x48, 0x46, 0x49, 0x46, 0x49, 0x45, 0x4A, 0x45, 0xFF, 0xFF,
+  0xFF, 0x2E, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F,
+  0x44, 0x50, 0x3F, 0x25, 0xF2, 0x5F, 0x25, 0xF2, 0x44, 0xF3, 0x4F, 0x34,
+  0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF2, 0x52, 0x78, 0x41, 0xB6, 0xF2,
+  0x5F, 0x34, 0x67, 0x63, 0x4A, 0x6F, 0x25, 0xF3, 0x5F, 0x34, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x8E, 0x9C, 0x42, 0x4C, 0x42, 0x5A, 0x43,
+  0x76, 0x64, 0xF2, 0x6F, 0x08, 0xDC, 0x78, 0x87, 0xDB, 0xAD, 0x8F, 0x06,
+  0x65, 0x64, 0x58, 0x54, 0x4A, 0x53, 0x4B, 0x42, 0x4C, 0x42, 0x4F, 0x33,
+  0xF3, 0x4F, 0x34, 0x47, 0x74, 0x2B, 0x54, 0x1E, 0x3F, 0x52, 0x86, 0x62,
+  0x6A, 0x51, 0x5C, 0x41, 0x5C, 0x9E, 0x8E, 0x8E, 0x8E, 0x41, 0x3E, 0x41,
+  0x3E, 0x41, 0x4C, 0x42, 0x5A, 0x53, 0x59, 0x53, 0x66, 0x65, 0xF1, 0x7E,
+  0x9C, 0xC8, 0x70, 0x0F, 0xFF, 0xFF, 0x9F, 0x23, 0xF2, 0x4F, 0x14, 0xF2,
+  0x3F, 0x24, 0xF1, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2,
+  0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x24, 0xF2,
+  0x3F, 0x24, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x23, 0xF2,
+  0x4F, 0x24, 0xD0, 0x78, 0xCC, 0x9E, 0x7F, 0x15, 0x66, 0x63, 0x5A, 0x43,
+  0x5A, 0x52, 0x4C, 0x42, 0x4C, 0x42, 0x4C, 0x42, 0x4B, 0x53, 0x4A, 0x44,
+  0x66, 0x65, 0xF1, 0x8C, 0x9E, 0x7F, 0x15, 0x66, 0x63, 0x5A, 0x52, 0x4C,
+  0x41, 0x5C, 0x9E, 0x8E, 0x8E, 0x8E, 0x8E, 0x9C, 0x51, 0x4C, 0x42, 0x5A,
+  0x53, 0x66, 0x64, 0xF3, 0x5F, 0x18, 0xCC, 0x87, 0x77, 0xCB, 0x9D, 0x7F,
+  0x05, 0x65, 0x63, 0x59, 0x43, 0x4A, 0x52, 0x4B, 0x41, 0x4D, 0x31, 0x4D,
+  0x31, 0x4D, 0x8D, 0x8D, 0x8D, 0x9B, 0x51, 0x4B, 0x51, 0x59, 0x62, 0x65,
+  0x82, 0xF4, 0x3D, 0x14, 0x4B, 0x24, 0x76, 0x44, 0xF2, 0x4F, 0x23, 0xF2,
+  0x4F, 0x24, 0x24, 0xB4, 0x24, 0xA4, 0x35, 0x85, 0x45, 0x65, 0x5F, 0x07,
+  0xD9, 0xBC, 0x78, 0x0F, 0x5F, 0xFF, 0xF0, 0xF5, 0x0F, 0x5F, 0xFF, 0xF0,
+  0xF5, 0x22, 0x22, 0x22, 0x22, 0x12, 0x13, 0x12, 0x20, 0xFF, 0xD3, 0xF3,
+  0x5F, 0x17, 0xD9, 0xC8, 0xC9, 0xC9, 0xC8, 0xC9, 0xD7, 0xF1, 0x5F, 0x37,
+  0xF2, 0x8F, 0x29, 0xF1, 0x9F, 0x28, 0xF2, 0x9F, 0x19, 0xF2, 0x8F, 0x26,
+  0xF5, 0x3F, 0x71, 0x0F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
+  0xFF, 0xF2, 0x01, 0xF7, 0x3F, 0x56, 0xF2, 0x8F, 0x28, 0xF2, 0x9F, 0x19,
+  0xF2, 0x8F, 0x29, 0xF2, 0x8F, 0x27, 0xF3, 0x5F, 0x26, 0xF0, 0x8C, 0x8D,
+  0x8C, 0x9C, 0x8C, 0x9C, 0x9E, 0x6F, 0x24, 0xF4, 0x2F, 0x60, 0x67, 0xBC,
+  0x7E, 0x5F, 0x13, 0x65, 0x72, 0x49, 0x52, 0x4A, 0x9C, 0x8C, 0x8C, 0x8C,
+  0x4F, 0x05, 0xF0, 0x4F, 0x05, 0xE5, 0xE5, 0xD6, 0xD6, 0xE5, 0xE5, 0xE5,
+  0xF0, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0xFF, 0xFF, 0xF6, 0x4F,
+  0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x49, 0xF3, 0x9F, 0xF0, 0xF2, 0xF9, 0xF6,
+  0xF6, 0xF9, 0xF2, 0x98, 0xAF, 0x07, 0xE8, 0xD6, 0xF3, 0x7B, 0x5F, 0x76,
+  0x95, 0xF9, 0x67, 0x5F, 0xB6, 0x64, 0xB6, 0xB5, 0x54, 0xA9, 0x34, 0x45,
+  0x35, 0x8C, 0x24, 0x54, 0x34, 0x86, 0x49, 0x55, 0x15, 0x75, 0x77, 0x65,
+  0x14, 0x75, 0x96, 0x74, 0x14, 0x74, 0xA6, 0x74, 0x14, 0x64, 0xB5, 0x88,
+  0x74, 0xB5, 0x88, 0x74, 0xB5, 0x88, 0x64, 0xC4, 0x98, 0x64, 0xC4, 0x89,
+  0x64, 0xB5, 0x84, 0x14, 0x64, 0xB4, 0x94, 0x14, 0x64, 0xB4, 0x84, 0x24,
+  0x64, 0xA5, 0x75, 0x25, 0x55, 0x85, 0x84, 0x44, 0x65, 0x66, 0x75, 0x44,
+  0x66, 0x48, 0x46, 0x55, 0x6C, 0x1D, 0x74, 0x79, 0x3B, 0x95, 0x85, 0x77,
+  0xC5, 0xFF, 0x86, 0xFF, 0x86, 0xFF, 0x87, 0xFF, 0x77, 0xFF, 0x79, 0xA5,
+  0xF6, 0xF7, 0xF7, 0xF7, 0xF8, 0xF3, 0xFE, 0xAF, 0x20, 0xC6, 0xF8, 0x7F,
+  0x87, 0xF8, 0x8F, 0x69, 0xF6, 0x41, 0x5F, 0x54, 0x15, 0xF4, 0x52, 0x4F,
+  0x44, 0x35, 0xF3, 0x43, 0x5F, 0x25, 0x44, 0xF2, 0x45, 0x5F, 0x05, 0x55,
+  0xF0, 0x47, 0x4F, 0x04, 0x75, 0xD5, 0x75, 0xD4, 0x94, 0xD4, 0x95, 0xB5,
+  0x95, 0xB4, 0xB4, 0xBF, 0x59, 0xF6, 0x9F, 0x77, 0xF8, 0x75, 0xD5, 0x74,
+  0xF0, 0x55, 0x5F, 0x05, 0x55, 0xF0, 0x55, 0x4F, 0x25, 0x35, 0xF2, 0x53,
+  0x5F, 0x25, 0x34, 0xF4, 0x51, 0x5F, 0x45, 0x15, 0xF5, 0x41, 0x0F, 0x28,
+  0xF4, 0x6F, 0x64, 0xF6, 0x44, 0xC6, 0x34, 0xE4, 0x34, 0xE5, 0x24, 0xF0,
+  0x42, 0x4F, 0x04, 0x24, 0xF0, 0x42, 0x4F, 0x04, 0x24, 0xE4, 0x34, 0xE4,
+  0x34, 0xC5, 0x4F, 0x55, 0xF4, 0x6F, 0x64, 0xF7, 0x34, 0xE5, 0x24, 0xF0,
+  0x51, 0x4F, 0x14, 0x14, 0xF2, 0x8F, 0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x8F,
+  0x28, 0xF1, 0x9F, 0x05, 0x14, 0xE6, 0x1F, 0x82, 0xF7, 0x3F, 0x64, 0xF4,
+  0x60, 0xB8, 0xF3, 0xEE, 0xF2, 0xAF, 0x58, 0x78, 0x68, 0x5C, 0x56, 0x5E,
+  0x54, 0x5F, 0x14, 0x44, 0xF2, 0x43, 0x5F, 0x34, 0x24, 0xF4, 0x42, 0x4F,
+  0xA4, 0xF9, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F,
+  0xA4, 0xFA, 0x4F, 0xA4, 0xFB, 0x4F, 0x54, 0x14, 0xF5, 0x41, 0x4F, 0x45,
+  0x15, 0xF3, 0x43, 0x4F, 0x34, 0x35, 0xF1, 0x54, 0x5E, 0x56, 0x5C, 0x66,
+  0x87, 0x78, 0xF5, 0xBF, 0x2D, 0xEF, 0x38, 0xA0, 0x0F, 0x2A, 0xF5, 0x7F,
+  0x66, 0xF7, 0x54, 0xC7, 0x44, 0xE6, 0x34, 0xF0, 0x62, 0x4F, 0x15, 0x24,
+  0xF2, 0x51, 0x4F, 0x34, 0x14, 0xF3, 0x41, 0x4F, 0x34, 0x14, 0xF4, 0x8F,
+  0x48, 0xF4, 0x8F, 0x48, 0xF4, 0x8F, 0x48, 0xF4, 0x8F, 0x48, 0xF4, 0x8F,
+  0x48, 0xF3, 0x41, 0x4F, 0x34, 0x14, 0xF3, 0x41, 0x4F, 0x25, 0x14, 0xF1,
+  0x52, 0x4F, 0x06, 0x24, 0xE6, 0x34, 0xC7, 0x4F, 0x75, 0xF6, 0x6F, 0x57,
+  0xF2, 0xA0, 0x0F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x14, 0xF5, 0x4F, 0x54,
+  0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54,
+  0xF5, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0x81, 0x4F, 0x54, 0xF5, 0x4F, 0x54,
+  0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x5F,
+  0xFF, 0xFF, 0xF6, 0x0F, 0xFF, 0xFF, 0xF2, 0xF3, 0x4F, 0x34, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0xF5,
+  0x2F, 0x52, 0xF5, 0x2F, 0x52, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x30, 0xC9, 0xF4, 0xF0, 0xEF, 0x4B, 0xF6, 0x98, 0x87,
+  0x76, 0xD6, 0x56, 0xF1, 0x54, 0x5F, 0x34, 0x35, 0xF4, 0x52, 0x4F, 0x64,
+  0x15, 0xFB, 0x4F, 0xC4, 0xFB, 0x5F, 0xB4, 0xFC, 0x4F, 0xC4, 0xFC, 0x4D,
+  0xF3, 0xDF, 0x3D, 0xF3, 0xDF, 0x3F, 0x89, 0xF7, 0x41, 0x4F, 0x74, 0x14,
+  0xF7, 0x41, 0x5F, 0x55, 0x15, 0xF5, 0x52, 0x5F, 0x36, 0x26, 0xF2, 0x63,
+  0x6F, 0x07, 0x46, 0xC9, 0x58, 0x76, 0x14, 0x6F, 0x42, 0x47, 0xF2, 0x43,
+  0x9D, 0x63, 0xC8, 0xB0, 0x04, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3,
+  0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3,
+  0x8F, 0x38, 0xF3, 0xFF, 0xFF, 0xFF, 0xF7, 0xF3, 0x8F, 0x38, 0xF3, 0x8F,
+  0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F,
+  0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+  0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04,
+  0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04,
+  0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x8B, 0x8B,
+  0x8B, 0x8B, 0x8A, 0xA9, 0x51, 0x48, 0x52, 0x65, 0x63, 0xF0, 0x4E, 0x7B,
+  0xA7, 0x60, 0x04, 0xF2, 0x51, 0x4F, 0x15, 0x24, 0xF0, 0x53, 0x4E, 0x54,
+  0x4D, 0x55, 0x4C, 0x56, 0x4B, 0x57, 0x4A, 0x58, 0x49, 0x59, 0x48, 0x5A,
+  0x47, 0x5B, 0x46, 0x5C, 0x45, 0x5D, 0x44, 0x5E, 0x43, 0x6E, 0x42, 0x8D,
+  0x41, 0xAC, 0x91, 0x5C, 0x83, 0x5B, 0x75, 0x5A, 0x66, 0x5A, 0x58, 0x59,
+  0x4A, 0x58, 0x4A, 0x67, 0x4B, 0x57, 0x4C, 0x56, 0x4C, 0x65, 0x4D, 0x55,
+  0x4E, 0x54, 0x4F, 0x05, 0x34, 0xF0, 0x53, 0x4F, 0x15, 0x24, 0xF2, 0x51,
+  0x4F, 0x26, 0x04, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x2F,
+  0xFF, 0xFF, 0x90, 0x06, 0xF5, 0xCF, 0x5D, 0xF3, 0xEF, 0x3E, 0xF3, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xC1, 0x3F, 0x13, 0x18, 0x14, 0xE4, 0x18, 0x14, 0xE4,
+  0x18, 0x24, 0xD3, 0x28, 0x24, 0xC4, 0x28, 0x24, 0xC4, 0x28, 0x34, 0xB3,
+  0x38, 0x34, 0xA4, 0x38, 0x34, 0xA4, 0x38, 0x44, 0x84, 0x48, 0x44, 0x84,
+  0x48, 0x44, 0x84, 0x48, 0x54, 0x64, 0x58, 0x54, 0x64, 0x58, 0x54, 0x64,
+  0x58, 0x64, 0x44, 0x68, 0x64, 0x44, 0x68, 0x64, 0x44, 0x68, 0x74, 0x24,
+  0x78, 0x74, 0x24, 0x78, 0x83, 0x24, 0x78, 0x88, 0x88, 0x88, 0x88, 0x97,
+  0x88, 0x96, 0x98, 0x96, 0x98, 0xA5, 0x94, 0x05, 0xF2, 0xAF, 0x1A, 0xF1,
+  0xBF, 0x0B, 0xF0, 0xCE, 0xDD, 0x81, 0x4D, 0x81, 0x5C, 0x82, 0x5B, 0x83,
+  0x4B, 0x83, 0x5A, 0x84, 0x4A, 0x84, 0x59, 0x85, 0x58, 0x86, 0x48, 0x86,
+  0x57, 0x87, 0x56, 0x88, 0x46, 0x88, 0x55, 0x89, 0x45, 0x89, 0x54, 0x8A,
+  0x53, 0x8B, 0x43, 0x8B, 0x52, 0x8C, 0x51, 0x8D, 0x41, 0x8D, 0xDE, 0xCE,
+  0xCF, 0x0B, 0xF1, 0xAF, 0x1A, 0xF2, 0x50, 0xC9, 0xF6, 0xF0, 0xF1, 0xF4,
+  0xDF, 0x6B, 0x87, 0x89, 0x6D, 0x67, 0x6F, 0x06, 0x65, 0xF2, 0x55, 0x5F,
+  0x45, 0x44, 0xF6, 0x43, 0x5F, 0x65, 0x24, 0xF8, 0x42, 0x4F, 0x84, 0x15,
+  0xF8, 0x9F, 0xA8, 0xFA, 0x8F, 0xA8, 0xFA, 0x8F, 0xA8, 0xFA, 0x8F, 0xA8,
+  0xFA, 0x8F, 0x95, 0x14, 0xF8, 0x42, 0x4F, 0x84, 0x25, 0xF6, 0x53, 0x4F,
+  0x64, 0x45, 0xF4, 0x55, 0x5F, 0x25, 0x66, 0xF0, 0x67, 0x6D, 0x69, 0x87,
+  0x8B, 0xF6, 0xDF, 0x4F, 0x1F, 0x0F, 0x69, 0xC0, 0x0F, 0x27, 0xF5, 0x4F,
+  0x63, 0xF7, 0x24, 0xC7, 0x14, 0xE5, 0x14, 0xF0, 0x9F, 0x18, 0xF1, 0x8F,
+  0x18, 0xF1, 0x8F, 0x18, 0xF1, 0x8F, 0x09, 0xE5, 0x14, 0xC7, 0x1F, 0x72,
+  0xF6, 0x3F, 0x54, 0xF3, 0x64, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5,
+  0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5,
+  0x4F, 0x50, 0xC9, 0xF6, 0xF0, 0xF1, 0xF3, 0xEF, 0x6B, 0x87, 0x89, 0x6D,
+  0x67, 0x6F, 0x06, 0x65, 0xF2, 0x55, 0x5F, 0x45, 0x44, 0xF6, 0x43, 0x5F,
+  0x65, 0x24, 0xF8, 0x42, 0x4F, 0x84, 0x15, 0xF8, 0x9F, 0xA8, 0xFA, 0x8F,
+  0xA8, 0xFA, 0x8F, 0xA8, 0xFA, 0x8F, 0xA8, 0xFA, 0x8F, 0x95, 0x14, 0xF8,
+  0x42, 0x4F, 0x84, 0x25, 0xF6, 0x53, 0x4E, 0x34, 0x44, 0x5C, 0x52, 0x55,
+  0x5C, 0xA6, 0x6C, 0x97, 0x6C, 0x79, 0x87, 0x9A, 0xF9, 0xAF, 0x9B, 0xF0,
+  0x35, 0xD9, 0x74, 0xFF, 0x03, 0xFF, 0x11, 0x20, 0x0F, 0x47, 0xF6, 0x5F,
+  0x74, 0xF8, 0x34, 0xE6, 0x24, 0xF0, 0x52, 0x4F, 0x15, 0x14, 0xF2, 0x41,
+  0x4F, 0x24, 0x14, 0xF2, 0x41, 0x4F, 0x24, 0x14, 0xF2, 0x41, 0x4F, 0x24,
+  0x14, 0xF1, 0x42, 0x4F, 0x05, 0x24, 0xE5, 0x3F, 0x74, 0xF6, 0x5F, 0x74,
+  0xF8, 0x34, 0xE6, 0x24, 0xF1, 0x42, 0x4F, 0x15, 0x14, 0xF2, 0x41, 0x4F,
+  0x24, 0x14, 0xF2, 0x41, 0x4F, 0x24, 0x14, 0xF2, 0x41, 0x4F, 0x24, 0x14,
+  0xF2, 0x41, 0x4F, 0x24, 0x14, 0xF2, 0x41, 0x4F, 0x29, 0xF2, 0x50, 0x99,
+  0xF0, 0xF0, 0xBF, 0x28, 0xF6, 0x66, 0x87, 0x55, 0xD5, 0x44, 0xF0, 0x43,
+  0x5F, 0x05, 0x24, 0xF2, 0x42, 0x4F, 0x24, 0x24, 0xF8, 0x4F, 0x85, 0xF8,
+  0x6F, 0x68, 0xF5, 0xBF, 0x2E, 0xF0, 0xF0, 0xF0, 0xEF, 0x2B, 0xF5, 0x8F,
+  0x67, 0xF7, 0x5F, 0x85, 0xF8, 0x8F, 0x48, 0xF4, 0x8F, 0x44, 0x14, 0xF2,
+  0x51, 0x5F, 0x14, 0x26, 0xE5, 0x38, 0x87, 0x5F, 0x67, 0xF4, 0xAF, 0x0F,
+  0x09, 0x90, 0x0F, 0xFF, 0xFF, 0xFE, 0xB4, 0xF7, 0x4F, 0x74, 0xF7, 0x4F,
+  0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F,
+  0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F,
+  0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F,
+  0x74, 0xF7, 0x4B, 0x04, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F,
+  0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F,
+  0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F,
+  0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF2, 0x51, 0x4F, 0x14, 0x25,
+  0xE5, 0x26, 0xC6, 0x37, 0x87, 0x5F, 0x57, 0xF3, 0xAE, 0xE9, 0x90, 0x05,
+  0xF4, 0x41, 0x5F, 0x35, 0x24, 0xF3, 0x52, 0x5F, 0x24, 0x35, 0xF1, 0x54,
+  0x4F, 0x15, 0x45, 0xF0, 0x45, 0x5E, 0x56, 0x4E, 0x56, 0x5D, 0x47, 0x5C,
+  0x58, 0x4C, 0x58, 0x5B, 0x4A, 0x4A, 0x5A, 0x4A, 0x5A, 0x59, 0x4C, 0x49,
+  0x4C, 0x57, 0x5C, 0x57, 0x4E, 0x47, 0x4E, 0x55, 0x4F, 0x05, 0x54, 0xF1,
+  0x45, 0x4F, 0x15, 0x34, 0xF3, 0x43, 0x4F, 0x34, 0x34, 0xF3, 0x51, 0x4F,
+  0x54, 0x14, 0xF5, 0x41, 0x4F, 0x58, 0xF7, 0x7F, 0x77, 0xF7, 0x6F, 0x95,
+  0xC0, 0x05, 0xD6, 0xDA, 0xD6, 0xDA, 0xD6, 0xD5, 0x14, 0xD6, 0xD4, 0x25,
+  0xB8, 0xB5, 0x25, 0xB8, 0xB5, 0x25, 0xB8, 0xB5, 0x34, 0xB9, 0xA4, 0x45,
+  0x94, 0x24, 0x95, 0x45, 0x94, 0x24, 0x95, 0x45, 0x94, 0x24, 0x95, 0x54,
+  0x85, 0x34, 0x84, 0x65, 0x74, 0x44, 0x84, 0x65, 0x74, 0x44, 0x75, 0x74,
+  0x74, 0x44, 0x75, 0x74, 0x65, 0x54, 0x64, 0x85, 0x54, 0x64, 0x64, 0x85,
+  0x54, 0x64, 0x55, 0x94, 0x54, 0x65, 0x45, 0x94, 0x44, 0x84, 0x44, 0xA4,
+  0x44, 0x84, 0x44, 0xA5, 0x34, 0x84, 0x44, 0xB4, 0x25, 0x94, 0x25, 0xB4,
+  0x24, 0xA4, 0x24, 0xC4, 0x24, 0xA4, 0x24, 0xC5, 0x14, 0xA5, 0x14, 0xD9,
+  0xB9, 0xD8, 0xC8, 0xE8, 0xC8, 0xE8, 0xD7, 0xF0, 0x6E, 0x7F, 0x06, 0xE6,
+  0xF1, 0x6E, 0x6F, 0x16, 0xF0, 0x58, 0x15, 0xF2, 0x52, 0x6F, 0x06, 0x35,
+  0xF0, 0x55, 0x5D, 0x57, 0x5B, 0x58, 0x5B, 0x59, 0x59, 0x5B, 0x57, 0x5C,
+  0x57, 0x5D, 0x55, 0x5F, 0x05, 0x35, 0xF1, 0x53, 0x5F, 0x25, 0x15, 0xF4,
+  0x9F, 0x59, 0xF6, 0x7F, 0x85, 0xF8, 0x7F, 0x68, 0xF6, 0x9F, 0x45, 0x15,
+  0xF2, 0x53, 0x4F, 0x25, 0x35, 0xF0, 0x55, 0x5D, 0x57, 0x5C, 0x57, 0x5B,
+  0x59, 0x59, 0x5A, 0x68, 0x5B, 0x57, 0x5D, 0x55, 0x5E, 0x63, 0x6F, 0x05,
+  0x35, 0xF2, 0x51, 0x5F, 0x36, 0x06, 0xF3, 0x61, 0x5F, 0x35, 0x26, 0xF1,
+  0x54, 0x5F, 0x15, 0x55, 0xE5, 0x65, 0xD5, 0x85, 0xC5, 0x95, 0xA5, 0xA5,
+  0xA5, 0xB5, 0x85, 0xD4, 0x84, 0xE5, 0x65, 0xF0, 0x54, 0x5F, 0x15, 0x44,
+  0xF3, 0x52, 0x5F, 0x44, 0x24, 0xF5, 0xAF, 0x68, 0xF8, 0x6F, 0x96, 0xFA,
+  0x4F, 0xB4, 0xFB, 0x4F, 0xB4, 0xFB, 0x4F, 0xB4, 0xFB, 0x4F, 0xB4, 0xFB,
+  0x4F, 0xB4, 0xFB, 0x4F, 0xB4, 0xFB, 0x4F, 0xB4, 0xD0, 0x2F, 0x93, 0xF9,
+  0x3F, 0x93, 0xF9, 0xF7, 0x5F, 0x65, 0xF6, 0x6F, 0x56, 0xF5, 0x6F, 0x65,
+  0xF6, 0x5F, 0x66, 0xF5, 0x6F, 0x56, 0xF6, 0x5F, 0x65, 0xF6, 0x6F, 0x56,
+  0xF5, 0x6F, 0x65, 0xF6, 0x5F, 0x66, 0xF5, 0x6F, 0x65, 0xF6, 0x5F, 0x65,
+  0xF6, 0x6F, 0x56, 0xF6, 0x5F, 0x65, 0xF6, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F,
+  0xF6, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x4F, 0xF2, 0x03, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB2,
+  0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB2, 0xB3, 0xB2, 0xB2, 0xB3, 0xA3,
+  0xB2, 0xB3, 0xA3, 0xB2, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3,
+  0xA3, 0x0F, 0xF2, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x4F, 0xF6, 0x74, 0xE4, 0xD6, 0xC6, 0xB8, 0xA3, 0x23, 0xA3,
+  0x23, 0x94, 0x33, 0x83, 0x43, 0x74, 0x44, 0x63, 0x63, 0x63, 0x63, 0x53,
+  0x83, 0x43, 0x83, 0x34, 0x84, 0x23, 0xA3, 0x23, 0xA3, 0x13, 0xC3, 0x0F,
+  0xFF, 0xB0, 0x06, 0x64, 0x74, 0x74, 0x73, 0x83, 0x83, 0x79, 0xCE, 0x9F,
+  0x17, 0xF3, 0x56, 0x77, 0x45, 0xA5, 0x44, 0xC4, 0xF5, 0x4F, 0x54, 0xF5,
+  0x4F, 0x45, 0xF2, 0x7B, 0xD7, 0xF2, 0x5D, 0x24, 0x48, 0x84, 0x36, 0xB4,
+  0x35, 0xC4, 0x34, 0xD4, 0x34, 0xC5, 0x34, 0xC5, 0x35, 0x97, 0x46, 0x59,
+  0x4F, 0x01, 0x72, 0xD3, 0x63, 0xB4, 0x65, 0x68, 0x50, 0x04, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0x56, 0x74,
+  0x3A, 0x54, 0x1D, 0x44, 0x1E, 0x38, 0x57, 0x27, 0x85, 0x26, 0xA5, 0x15,
+  0xC4, 0x15, 0xC4, 0x15, 0xC9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xDA, 0xC4, 0x15, 0xC4, 0x16, 0xA5, 0x17, 0x85, 0x28, 0x57, 0x23, 0x1F,
+  0x03, 0x32, 0xD4, 0x33, 0xBD, 0x77, 0x87, 0xBC, 0x8E, 0x6F, 0x14, 0x66,
+  0x63, 0x58, 0x52, 0x5A, 0x42, 0x4C, 0x41, 0x4F, 0x15, 0xF1, 0x4F, 0x24,
+  0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF3, 0x4C, 0x41,
+  0x4C, 0x41, 0x5A, 0x52, 0x58, 0x53, 0x66, 0x64, 0xF1, 0x6E, 0x8C, 0xB7,
+  0x70, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F,
+  0x44, 0x77, 0x54, 0x5B, 0x34, 0x4E, 0x14, 0x3F, 0x52, 0x75, 0x92, 0x59,
+  0x71, 0x5B, 0x61, 0x5C, 0x51, 0x4D, 0xAD, 0x9F, 0x08, 0xF0, 0x8F, 0x08,
+  0xF0, 0x8F, 0x08, 0xF0, 0x8F, 0x09, 0xD5, 0x14, 0xD5, 0x14, 0xD5, 0x15,
+  0xB6, 0x25, 0x97, 0x27, 0x59, 0x3F, 0x11, 0x34, 0xE2, 0x35, 0xC3, 0x37,
+  0x88, 0x87, 0xDB, 0x9E, 0x7F, 0x16, 0x65, 0x64, 0x58, 0x53, 0x5A, 0x52,
+  0x4C, 0x42, 0x4C, 0x41, 0x4E, 0x8E, 0x8E, 0xFF, 0xFF, 0xEF, 0x34, 0xF3,
+  0x4F, 0x44, 0xF3, 0x4C, 0x42, 0x5B, 0x43, 0x59, 0x53, 0x66, 0x65, 0xF1,
+  0x7F, 0x08, 0xCD, 0x77, 0x64, 0x46, 0x46, 0x37, 0x35, 0x54, 0x64, 0x64,
+  0x64, 0x3F, 0xF0, 0x34, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x30, 0x86, 0xDA, 0x34, 0x4D, 0x14, 0x3F, 0x42, 0x75, 0x82, 0x58,
+  0x71, 0x5A, 0x61, 0x4C, 0x51, 0x4C, 0xAD, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+  0x8E, 0x8E, 0x8E, 0x41, 0x4C, 0x51, 0x4C, 0x51, 0x5A, 0x62, 0x58, 0x72,
+  0x75, 0x83, 0xE1, 0x44, 0xC2, 0x45, 0xA3, 0x47, 0x65, 0x4F, 0x34, 0xF2,
+  0x42, 0x4C, 0x42, 0x5A, 0x53, 0x57, 0x64, 0xF3, 0x5F, 0x17, 0xEB, 0x87,
+  0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F,
+  0x04, 0x47, 0x44, 0x39, 0x34, 0x2C, 0x14, 0x1D, 0x18, 0x4D, 0x8B, 0x99,
+  0xA9, 0xA8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB4, 0x0F, 0x5F, 0x1F, 0xFF, 0xFF,
+  0xFA, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFF, 0x64, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x3F, 0x51, 0x71, 0x53, 0x04, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4A, 0x52, 0x49, 0x53, 0x48,
+  0x54, 0x47, 0x55, 0x46, 0x56, 0x45, 0x57, 0x44, 0x58, 0x43, 0x59, 0x42,
+  0x5A, 0x41, 0x6A, 0xC9, 0xD8, 0x71, 0x58, 0x63, 0x57, 0x55, 0x56, 0x46,
+  0x56, 0x47, 0x55, 0x48, 0x45, 0x48, 0x54, 0x49, 0x53, 0x49, 0x53, 0x4A,
+  0x52, 0x4B, 0x42, 0x4B, 0x51, 0x4C, 0x50, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x10, 0x86, 0x86, 0x43, 0x39, 0x5A, 0x23, 0x2B, 0x3C, 0x13, 0x1D, 0x1D,
+  0x17, 0x59, 0x5C, 0x77, 0x7A, 0x95, 0x99, 0x95, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0x96, 0x53, 0x4A,
+  0x33, 0x2D, 0x23, 0x1F, 0x01, 0x31, 0x45, 0xE8, 0xB9, 0xAB, 0x9B, 0x8C,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x40, 0x87, 0xEB, 0xAF, 0x07, 0xF2, 0x57, 0x57,
+  0x45, 0x95, 0x35, 0xB5, 0x24, 0xD4, 0x24, 0xD4, 0x15, 0xD9, 0xF0, 0x8F,
+  0x08, 0xF0, 0x8F, 0x08, 0xF0, 0x8F, 0x08, 0xF0, 0x9D, 0x51, 0x4D, 0x42,
+  0x4D, 0x42, 0x5B, 0x53, 0x59, 0x54, 0x75, 0x75, 0xF2, 0x7F, 0x09, 0xDD,
+  0x78, 0x87, 0x73, 0x3B, 0x53, 0x2D, 0x43, 0x1F, 0x03, 0x94, 0x72, 0x78,
+  0x52, 0x6A, 0x51, 0x5C, 0x41, 0x5C, 0x41, 0x5C, 0x9E, 0x8E, 0x8E, 0x8E,
+  0x8E, 0x8E, 0x8E, 0x8D, 0xAC, 0x41, 0x5C, 0x41, 0x6A, 0x51, 0x78, 0x52,
+  0x85, 0x72, 0xF4, 0x34, 0x1D, 0x44, 0x3A, 0x54, 0x56, 0x74, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x30, 0x87, 0xEB,
+  0x33, 0x4E, 0x23, 0x3F, 0x11, 0x32, 0x75, 0x92, 0x59, 0x71, 0x5B, 0x61,
+  0x5C, 0x51, 0x4D, 0xAD, 0x9F, 0x08, 0xF0, 0x8F, 0x08, 0xF0, 0x8F, 0x08,
+  0xF0, 0x8F, 0x09, 0xD5, 0x14, 0xD5, 0x14, 0xD5, 0x15, 0xB6, 0x25, 0x97,
+  0x27, 0x59, 0x3F, 0x01, 0x44, 0xE1, 0x45, 0xB3, 0x47, 0x75, 0x4F, 0x44,
+  0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x40, 0x87,
+  0x48, 0x2A, 0x1F, 0x23, 0x66, 0x57, 0x57, 0x57, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x77, 0xAC, 0x7E, 0x5F, 0x14, 0x56, 0x62, 0x58, 0x52, 0x4A, 0x42,
+  0x4F, 0x14, 0xF1, 0x5F, 0x06, 0xF0, 0x8D, 0xBA, 0xD9, 0xCC, 0x9F, 0x06,
+  0xF0, 0x5F, 0x18, 0xC8, 0xC9, 0xA5, 0x16, 0x66, 0x2F, 0x33, 0xF1, 0x5D,
+  0xA8, 0x60, 0x34, 0x64, 0x64, 0x64, 0x64, 0x64, 0x3F, 0xF0, 0x34, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x67, 0x37, 0x46, 0x55, 0x04, 0xC8, 0xC8,
+  0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+  0xC8, 0xC8, 0xC8, 0xB9, 0xB9, 0xAB, 0x8E, 0x58, 0x1F, 0x01, 0x31, 0xE2,
+  0x33, 0xB3, 0x35, 0x69, 0x14, 0xD5, 0x14, 0xD4, 0x25, 0xC4, 0x34, 0xB5,
+  0x34, 0xB4, 0x45, 0xA4, 0x54, 0x94, 0x64, 0x94, 0x65, 0x75, 0x74, 0x74,
+  0x84, 0x74, 0x85, 0x55, 0x94, 0x54, 0xA4, 0x54, 0xA5, 0x34, 0xC4, 0x34,
+  0xC4, 0x34, 0xD4, 0x14, 0xE4, 0x14, 0xE4, 0x13, 0xF1, 0x7F, 0x17, 0xF1,
+  0x6F, 0x35, 0xF3, 0x59, 0x05, 0x95, 0xA4, 0x24, 0x96, 0x94, 0x24, 0x96,
+  0x94, 0x25, 0x86, 0x85, 0x34, 0x77, 0x84, 0x44, 0x78, 0x74, 0x44, 0x78,
+  0x74, 0x54, 0x63, 0x14, 0x64, 0x64, 0x54, 0x23, 0x64, 0x64, 0x54, 0x24,
+  0x54, 0x64, 0x54, 0x24, 0x54, 0x74, 0x43, 0x34, 0x44, 0x84, 0x34, 0x43,
+  0x44, 0x84, 0x34, 0x44, 0x34, 0x93, 0x34, 0x44, 0x33, 0xA4, 0x23, 0x54,
+  0x24, 0xA4, 0x14, 0x63, 0x24, 0xA4, 0x14, 0x64, 0x14, 0xB3, 0x14, 0x64,
+  0x13, 0xC7, 0x78, 0xC7, 0x87, 0xD6, 0x86, 0xE6, 0x86, 0xE5, 0x96, 0xE5,
+  0xA4, 0x80, 0x15, 0xB4, 0x34, 0xA5, 0x44, 0x94, 0x55, 0x74, 0x74, 0x65,
+  0x84, 0x54, 0x95, 0x34, 0xB4, 0x25, 0xC4, 0x14, 0xD8, 0xF0, 0x6F, 0x25,
+  0xF2, 0x5F, 0x16, 0xF1, 0x7E, 0x9C, 0x42, 0x4C, 0x43, 0x4A, 0x44, 0x58,
+  0x55, 0x48, 0x46, 0x56, 0x48, 0x54, 0x59, 0x43, 0x5A, 0x52, 0x4C, 0x50,
+  0x14, 0xD4, 0x14, 0xC5, 0x14, 0xC4, 0x34, 0xB4, 0x34, 0xA4, 0x44, 0xA4,
+  0x54, 0x94, 0x54, 0x84, 0x64, 0x84, 0x74, 0x74, 0x74, 0x64, 0x84, 0x64,
+  0x94, 0x45, 0x94, 0x44, 0xA4, 0x44, 0xB4, 0x24, 0xC4, 0x24, 0xC4, 0x24,
+  0xD8, 0xE8, 0xE8, 0xF0, 0x6F, 0x16, 0xF1, 0x5F, 0x34, 0xF3, 0x4F, 0x24,
+  0xF3, 0x4F, 0x25, 0xF2, 0x4F, 0x25, 0xD8, 0xE8, 0xE7, 0xF1, 0x4F, 0x1F,
+  0x41, 0xF4, 0x1F, 0x41, 0xF4, 0xF0, 0x4F, 0x05, 0xE5, 0xE5, 0xE5, 0xE5,
+  0xE5, 0xF0, 0x4F, 0x05, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xF0, 0x4F,
+  0x05, 0xEF, 0xFF, 0xFF, 0x50, 0x74, 0x56, 0x56, 0x44, 0x73, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x74,
+  0x64, 0x55, 0x64, 0x74, 0x75, 0x84, 0x83, 0x93, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x86, 0x56,
+  0x74, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x04, 0x76, 0x56, 0x84, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x93, 0x84, 0x85, 0x74, 0x74, 0x65, 0x54, 0x73, 0x73, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x74, 0x46,
+  0x56, 0x54, 0x70, 0x25, 0xD8, 0x82, 0x19, 0x75, 0x45, 0x45, 0x6A, 0x12,
+  0x88, 0xD5, 0x20 };
 
 const GFXglyph FreeSans24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
   {     0,   4,  34,  16,    6,  -33 },   // 0x21 '!'
-  {    17,  11,  12,  16,    2,  -32 },   // 0x22 '"'
-  {    34,  24,  33,  26,    1,  -31 },   // 0x23 '#'
-  {   133,  23,  41,  26,    1,  -34 },   // 0x24 '$'
-  {   251,  39,  34,  42,    1,  -32 },   // 0x25 '%'
-  {   417,  28,  34,  31,    2,  -32 },   // 0x26 '&'
-  {   536,   4,  12,   9,    2,  -32 },   // 0x27 '''
-  {   542,  10,  44,  16,    3,  -33 },   // 0x28 '('
-  {   597,  10,  44,  16,    2,  -33 },   // 0x29 ')'
-  {   652,  14,  14,  18,    2,  -33 },   // 0x2A '*'
-  {   677,  23,  22,  27,    2,  -21 },   // 0x2B '+'
-  {   741,   4,  12,  13,    4,   -4 },   // 0x2C ','
-  {   747,  11,   4,  16,    2,  -14 },   // 0x2D '-'
-  {   753,   4,   5,  12,    4,   -4 },   // 0x2E '.'
-  {   756,  13,  35,  13,    0,  -33 },   // 0x2F '/'
-  {   813,  22,  34,  26,    2,  -32 },   // 0x30 '0'
-  {   907,  11,  33,  26,    5,  -32 },   // 0x31 '1'
-  {   953,  22,  33,  26,    2,  -32 },   // 0x32 '2'
-  {  1044,  23,  34,  26,    1,  -32 },   // 0x33 '3'
-  {  1142,  23,  33,  26,    1,  -32 },   // 0x34 '4'
-  {  1237,  22,  34,  26,    2,  -32 },   // 0x35 '5'
-  {  1331,  22,  34,  26,    2,  -32 },   // 0x36 '6'
-  {  1425,  21,  33,  26,    2,  -32 },   // 0x37 '7'
-  {  1512,  22,  34,  26,    2,  -32 },   // 0x38 '8'
-  {  1606,  21,  34,  26,    2,  -32 },   // 0x39 '9'
-  {  1696,   4,  25,  12,    4,  -24 },   // 0x3A ':'
-  {  1709,   4,  32,  12,    4,  -24 },   // 0x3B ';'
-  {  1725,  23,  23,  27,    2,  -22 },   // 0x3C '<'
-  {  1792,  23,  12,  27,    2,  -16 },   // 0x3D '='
-  {  1827,  23,  23,  27,    2,  -22 },   // 0x3E '>'
-  {  1894,  20,  35,  26,    4,  -34 },   // 0x3F '?'
-  {  1982,  43,  42,  48,    2,  -34 },   // 0x40 '@'
-  {  2208,  30,  34,  31,    1,  -33 },   // 0x41 'A'
-  {  2336,  25,  34,  31,    4,  -33 },   // 0x42 'B'
-  {  2443,  29,  36,  33,    2,  -34 },   // 0x43 'C'
-  {  2574,  27,  34,  33,    4,  -33 },   // 0x44 'D'
-  {  2689,  24,  34,  30,    4,  -33 },   // 0x45 'E'
-  {  2791,  22,  34,  28,    4,  -33 },   // 0x46 'F'
-  {  2885,  31,  36,  36,    2,  -34 },   // 0x47 'G'
-  {  3025,  26,  34,  34,    4,  -33 },   // 0x48 'H'
-  {  3136,   4,  34,  13,    5,  -33 },   // 0x49 'I'
-  {  3153,  19,  35,  25,    2,  -33 },   // 0x4A 'J'
-  {  3237,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
-  {  3352,  21,  34,  26,    4,  -33 },   // 0x4C 'L'
-  {  3442,  32,  34,  40,    4,  -33 },   // 0x4D 'M'
-  {  3578,  26,  34,  34,    4,  -33 },   // 0x4E 'N'
-  {  3689,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
-  {  3838,  24,  34,  31,    4,  -33 },   // 0x50 'P'
-  {  3940,  33,  38,  37,    2,  -34 },   // 0x51 'Q'
-  {  4097,  26,  34,  33,    4,  -33 },   // 0x52 'R'
-  {  4208,  27,  36,  31,    2,  -34 },   // 0x53 'S'
-  {  4330,  26,  34,  30,    2,  -33 },   // 0x54 'T'
-  {  4441,  26,  35,  34,    4,  -33 },   // 0x55 'U'
-  {  4555,  29,  34,  30,    1,  -33 },   // 0x56 'V'
-  {  4679,  42,  34,  44,    1,  -33 },   // 0x57 'W'
-  {  4858,  29,  34,  31,    1,  -33 },   // 0x58 'X'
-  {  4982,  30,  34,  32,    1,  -33 },   // 0x59 'Y'
-  {  5110,  27,  34,  29,    1,  -33 },   // 0x5A 'Z'
-  {  5225,   8,  44,  13,    3,  -33 },   // 0x5B '['
-  {  5269,  13,  35,  13,    0,  -33 },   // 0x5C '\'
-  {  5326,   8,  44,  13,    1,  -33 },   // 0x5D ']'
-  {  5370,  18,  18,  22,    2,  -32 },   // 0x5E '^'
-  {  5411,  28,   2,  26,   -1,    7 },   // 0x5F '_'
-  {  5418,  10,   7,  12,    1,  -34 },   // 0x60 '`'
-  {  5427,  24,  27,  26,    1,  -25 },   // 0x61 'a'
-  {  5508,  22,  35,  26,    3,  -33 },   // 0x62 'b'
-  {  5605,  21,  27,  24,    1,  -25 },   // 0x63 'c'
-  {  5676,  23,  35,  26,    1,  -33 },   // 0x64 'd'
-  {  5777,  22,  27,  25,    1,  -25 },   // 0x65 'e'
-  {  5852,  10,  34,  13,    1,  -33 },   // 0x66 'f'
-  {  5895,  22,  36,  26,    1,  -25 },   // 0x67 'g'
-  {  5994,  19,  34,  25,    3,  -33 },   // 0x68 'h'
-  {  6075,   4,  34,  10,    3,  -33 },   // 0x69 'i'
-  {  6092,   8,  44,  11,    0,  -33 },   // 0x6A 'j'
-  {  6136,  21,  34,  24,    3,  -33 },   // 0x6B 'k'
-  {  6226,   4,  34,  10,    3,  -33 },   // 0x6C 'l'
-  {  6243,  32,  26,  38,    3,  -25 },   // 0x6D 'm'
-  {  6347,  20,  26,  25,    3,  -25 },   // 0x6E 'n'
-  {  6412,  23,  27,  25,    1,  -25 },   // 0x6F 'o'
-  {  6490,  22,  35,  26,    3,  -25 },   // 0x70 'p'
-  {  6587,  23,  35,  26,    1,  -25 },   // 0x71 'q'
-  {  6688,  12,  26,  16,    3,  -25 },   // 0x72 'r'
-  {  6727,  20,  27,  23,    1,  -25 },   // 0x73 's'
-  {  6795,  10,  32,  13,    1,  -30 },   // 0x74 't'
-  {  6835,  20,  26,  25,    3,  -24 },   // 0x75 'u'
-  {  6900,  23,  25,  23,    0,  -24 },   // 0x76 'v'
-  {  6972,  34,  25,  34,    0,  -24 },   // 0x77 'w'
-  {  7079,  22,  25,  22,    0,  -24 },   // 0x78 'x'
-  {  7148,  22,  35,  22,    0,  -24 },   // 0x79 'y'
-  {  7245,  20,  25,  23,    1,  -24 },   // 0x7A 'z'
-  {  7308,  11,  44,  16,    2,  -33 },   // 0x7B '{'
-  {  7369,   3,  44,  12,    4,  -33 },   // 0x7C '|'
-  {  7386,  11,  44,  16,    2,  -33 },   // 0x7D '}'
-  {  7447,  19,   7,  24,    2,  -19 } }; // 0x7E '~'
+  {    11,  11,  12,  16,    2,  -32 },   // 0x22 '"'
+  {    28,  24,  33,  26,    1,  -31 },   // 0x23 '#'
+  {    92,  23,  41,  26,    1,  -34 },   // 0x24 '$'
+  {   171,  39,  34,  42,    1,  -32 },   // 0x25 '%'
+  {   262,  28,  34,  31,    2,  -32 },   // 0x26 '&'
+  {   332,   4,  12,   9,    2,  -32 },   // 0x27 '''
+  {   338,  10,  44,  16,    3,  -33 },   // 0x28 '('
+  {   382,  10,  44,  16,    2,  -33 },   // 0x29 ')'
+  {   427,  14,  14,  18,    2,  -33 },   // 0x2A '*'
+  {   447,  23,  22,  27,    2,  -21 },   // 0x2B '+'
+  {   478,   4,  12,  13,    4,   -4 },   // 0x2C ','
+  {   487,  11,   4,  16,    2,  -14 },   // 0x2D '-'
+  {   489,   4,   5,  12,    4,   -4 },   // 0x2E '.'
+  {   491,  13,  35,  13,    0,  -33 },   // 0x2F '/'
+  {   527,  22,  34,  26,    2,  -32 },   // 0x30 '0'
+  {   578,  11,  33,  26,    5,  -32 },   // 0x31 '1'
+  {   609,  22,  33,  26,    2,  -32 },   // 0x32 '2'
+  {   652,  23,  34,  26,    1,  -32 },   // 0x33 '3'
+  {   704,  23,  33,  26,    1,  -32 },   // 0x34 '4'
+  {   758,  22,  34,  26,    2,  -32 },   // 0x35 '5'
+  {   811,  22,  34,  26,    2,  -32 },   // 0x36 '6'
+  {   867,  21,  33,  26,    2,  -32 },   // 0x37 '7'
+  {   915,  22,  34,  26,    2,  -32 },   // 0x38 '8'
+  {   968,  21,  34,  26,    2,  -32 },   // 0x39 '9'
+  {  1023,   4,  25,  12,    4,  -24 },   // 0x3A ':'
+  {  1028,   4,  32,  12,    4,  -24 },   // 0x3B ';'
+  {  1041,  23,  23,  27,    2,  -22 },   // 0x3C '<'
+  {  1071,  23,  12,  27,    2,  -16 },   // 0x3D '='
+  {  1082,  23,  23,  27,    2,  -22 },   // 0x3E '>'
+  {  1114,  20,  35,  26,    4,  -34 },   // 0x3F '?'
+  {  1158,  43,  42,  48,    2,  -34 },   // 0x40 '@'
+  {  1281,  30,  34,  31,    1,  -33 },   // 0x41 'A'
+  {  1354,  25,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  1417,  29,  36,  33,    2,  -34 },   // 0x43 'C'
+  {  1484,  27,  34,  33,    4,  -33 },   // 0x44 'D'
+  {  1550,  24,  34,  30,    4,  -33 },   // 0x45 'E'
+  {  1599,  22,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  1648,  31,  36,  36,    2,  -34 },   // 0x47 'G'
+  {  1720,  26,  34,  34,    4,  -33 },   // 0x48 'H'
+  {  1770,   4,  34,  13,    5,  -33 },   // 0x49 'I'
+  {  1776,  19,  35,  25,    2,  -33 },   // 0x4A 'J'
+  {  1826,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
+  {  1898,  21,  34,  26,    4,  -33 },   // 0x4C 'L'
+  {  1947,  32,  34,  40,    4,  -33 },   // 0x4D 'M'
+  {  2035,  26,  34,  34,    4,  -33 },   // 0x4E 'N'
+  {  2095,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
+  {  2168,  24,  34,  31,    4,  -33 },   // 0x50 'P'
+  {  2222,  33,  38,  37,    2,  -34 },   // 0x51 'Q'
+  {  2300,  26,  34,  33,    4,  -33 },   // 0x52 'R'
+  {  2375,  27,  36,  31,    2,  -34 },   // 0x53 'S'
+  {  2438,  26,  34,  30,    2,  -33 },   // 0x54 'T'
+  {  2487,  26,  35,  34,    4,  -33 },   // 0x55 'U'
+  {  2543,  29,  34,  30,    1,  -33 },   // 0x56 'V'
+  {  2617,  42,  34,  44,    1,  -33 },   // 0x57 'W'
+  {  2730,  29,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  2801,  30,  34,  32,    1,  -33 },   // 0x59 'Y'
+  {  2865,  27,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  2915,   8,  44,  13,    3,  -33 },   // 0x5B '['
+  {  2954,  13,  35,  13,    0,  -33 },   // 0x5C '\'
+  {  2989,   8,  44,  13,    1,  -33 },   // 0x5D ']'
+  {  3028,  18,  18,  22,    2,  -32 },   // 0x5E '^'
+  {  3059,  28,   2,  26,   -1,    7 },   // 0x5F '_'
+  {  3062,  10,   7,  12,    1,  -34 },   // 0x60 '`'
+  {  3069,  24,  27,  26,    1,  -25 },   // 0x61 'a'
+  {  3117,  22,  35,  26,    3,  -33 },   // 0x62 'b'
+  {  3174,  21,  27,  24,    1,  -25 },   // 0x63 'c'
+  {  3217,  23,  35,  26,    1,  -33 },   // 0x64 'd'
+  {  3277,  22,  27,  25,    1,  -25 },   // 0x65 'e'
+  {  3316,  10,  34,  13,    1,  -33 },   // 0x66 'f'
+  {  3350,  22,  36,  26,    1,  -25 },   // 0x67 'g'
+  {  3408,  19,  34,  25,    3,  -33 },   // 0x68 'h'
+  {  3451,   4,  34,  10,    3,  -33 },   // 0x69 'i'
+  {  3457,   8,  44,  11,    0,  -33 },   // 0x6A 'j'
+  {  3497,  21,  34,  24,    3,  -33 },   // 0x6B 'k'
+  {  3559,   4,  34,  10,    3,  -33 },   // 0x6C 'l'
+  {  3565,  32,  26,  38,    3,  -25 },   // 0x6D 'm'
+  {  3621,  20,  26,  25,    3,  -25 },   // 0x6E 'n'
+  {  3653,  23,  27,  25,    1,  -25 },   // 0x6F 'o'
+  {  3697,  22,  35,  26,    3,  -25 },   // 0x70 'p'
+  {  3754,  23,  35,  26,    1,  -25 },   // 0x71 'q'
+  {  3815,  12,  26,  16,    3,  -25 },   // 0x72 'r'
+  {  3841,  20,  27,  23,    1,  -25 },   // 0x73 's'
+  {  3878,  10,  32,  13,    1,  -30 },   // 0x74 't'
+  {  3909,  20,  26,  25,    3,  -24 },   // 0x75 'u'
+  {  3940,  23,  25,  23,    0,  -24 },   // 0x76 'v'
+  {  3988,  34,  25,  34,    0,  -24 },   // 0x77 'w'
+  {  4070,  22,  25,  22,    0,  -24 },   // 0x78 'x'
+  {  4116,  22,  35,  22,    0,  -24 },   // 0x79 'y'
+  {  4175,  20,  25,  23,    1,  -24 },   // 0x7A 'z'
+  {  4205,  11,  44,  16,    2,  -33 },   // 0x7B '{'
+  {  4249,   3,  44,  12,    4,  -33 },   // 0x7C '|'
+  {  4254,  11,  44,  16,    2,  -33 },   // 0x7D '}'
+  {  4299,  19,   7,  24,    2,  -19 } }; // 0x7E '~'
 
 const GFXfont FreeSans24pt7b PROGMEM = {
   (uint8_t  *)FreeSans24pt7bBitmaps,
   (GFXglyph *)FreeSans24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56, 1 };
 
-// Approx. 8136 bytes
+// Approx. 4983 bytes
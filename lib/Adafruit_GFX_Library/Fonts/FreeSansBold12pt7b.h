@@ -283,6 +283,6 @@ const GFXglyph FreeSansBold12pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeSansBold12pt7b PROGMEM = {
   (uint8_t  *)FreeSansBold12pt7bBitmaps,
   (GFXglyph *)FreeSansBold12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29, 0 };
 
 // Approx. 2858 bytes
@@ -254,6 +254,6 @@ const GFXglyph FreeSerif12pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeSerif12pt7b PROGMEM = {
   (uint8_t  *)FreeSerif12pt7bBitmaps,
   (GFXglyph *)FreeSerif12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29, 0 };
 
 // Approx. 2511 bytes
@@ -190,6 +190,6 @@ const GFXglyph FreeSerif9pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeSerif9pt7b PROGMEM = {
   (uint8_t  *)FreeSerif9pt7bBitmaps,
   (GFXglyph *)FreeSerif9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22, 0 };
 
 // Approx. 1752 bytes
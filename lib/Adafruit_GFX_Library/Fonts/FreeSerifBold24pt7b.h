@@ -1,759 +1,482 @@
 const uint8_t FreeSerifBold24pt7bBitmaps[] PROGMEM = {
-  0x3C, 0x7E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x7E, 0x7C, 0x7C,
-  0x3C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x18, 0x10, 0x10, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0x70, 0x07,
-  0x7C, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xC0,
-  0x3E, 0xE0, 0x0E, 0x70, 0x07, 0x38, 0x03, 0x9C, 0x01, 0xC4, 0x00, 0xE2,
-  0x00, 0x20, 0x00, 0xF0, 0x70, 0x01, 0xC0, 0xE0, 0x03, 0x81, 0xC0, 0x0F,
-  0x07, 0x80, 0x1E, 0x0F, 0x00, 0x3C, 0x1E, 0x00, 0x78, 0x3C, 0x00, 0xF0,
-  0x78, 0x01, 0xC0, 0xE0, 0x03, 0x81, 0xC0, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-  0xF3, 0xFF, 0xFF, 0xE0, 0x78, 0x3C, 0x00, 0xF0, 0x78, 0x01, 0xC0, 0xE0,
-  0x03, 0x81, 0xC0, 0x0F, 0x07, 0x80, 0x1E, 0x0F, 0x00, 0x3C, 0x1E, 0x0F,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x03, 0x81, 0xC0, 0x0F,
-  0x07, 0x80, 0x1E, 0x0F, 0x00, 0x3C, 0x1E, 0x00, 0x78, 0x3C, 0x00, 0xF0,
-  0x78, 0x01, 0xE0, 0xE0, 0x03, 0x81, 0xC0, 0x07, 0x07, 0x80, 0x1E, 0x0F,
-  0x00, 0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00, 0xC0, 0x00,
-  0x7F, 0xF0, 0x0F, 0x37, 0xE0, 0xE1, 0x8F, 0x8E, 0x0C, 0x3C, 0x70, 0x60,
-  0xE7, 0x83, 0x03, 0x3C, 0x18, 0x19, 0xF0, 0xC0, 0x4F, 0xC6, 0x02, 0x7F,
-  0xF0, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0,
-  0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x3F, 0xF8, 0x01,
-  0xFF, 0xC0, 0x0C, 0xFF, 0x00, 0x63, 0xFA, 0x03, 0x0F, 0xD0, 0x18, 0x3E,
-  0x80, 0xC1, 0xF6, 0x06, 0x0F, 0xB8, 0x30, 0x79, 0xC1, 0x87, 0xCF, 0x0C,
-  0x3C, 0x7E, 0x67, 0xC0, 0xFF, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0xC0, 0x00,
-  0x06, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x30,
-  0x00, 0x3E, 0x00, 0x0C, 0x00, 0x0F, 0xF0, 0x03, 0x80, 0x07, 0xE7, 0x03,
-  0xE0, 0x01, 0xF8, 0x7F, 0xFC, 0x00, 0x3E, 0x07, 0xF7, 0x00, 0x0F, 0xC0,
-  0x80, 0xE0, 0x03, 0xF0, 0x10, 0x38, 0x00, 0x7E, 0x02, 0x07, 0x00, 0x0F,
-  0x80, 0x41, 0xC0, 0x03, 0xF0, 0x10, 0x30, 0x00, 0x7E, 0x02, 0x0E, 0x00,
-  0x0F, 0x80, 0xC1, 0x80, 0x01, 0xF0, 0x10, 0x70, 0x00, 0x3E, 0x06, 0x1C,
-  0x00, 0x07, 0xC1, 0x83, 0x80, 0x00, 0x7C, 0x60, 0xE0, 0x1F, 0x07, 0xF8,
-  0x18, 0x0F, 0xF8, 0x7C, 0x07, 0x07, 0xF1, 0x00, 0x00, 0xC1, 0xF8, 0x10,
-  0x00, 0x38, 0x3F, 0x02, 0x00, 0x06, 0x0F, 0xC0, 0x40, 0x01, 0xC3, 0xF0,
-  0x08, 0x00, 0x30, 0x7E, 0x01, 0x00, 0x0E, 0x1F, 0x80, 0x40, 0x03, 0x83,
-  0xF0, 0x08, 0x00, 0x60, 0x7E, 0x01, 0x00, 0x1C, 0x0F, 0x80, 0x40, 0x03,
-  0x01, 0xF0, 0x18, 0x00, 0xE0, 0x3E, 0x02, 0x00, 0x18, 0x03, 0xC0, 0xC0,
-  0x07, 0x00, 0x7C, 0x70, 0x00, 0xC0, 0x07, 0xFC, 0x00, 0x38, 0x00, 0x7E,
-  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0x8F,
-  0xE0, 0x00, 0x03, 0xC1, 0xF8, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x7C,
-  0x07, 0xC0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x01,
-  0xF8, 0x1E, 0x00, 0x00, 0x7F, 0x07, 0x80, 0x00, 0x1F, 0xE3, 0x80, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x3F,
-  0xF0, 0x07, 0xFC, 0x01, 0xF0, 0x07, 0xFF, 0x00, 0x78, 0x07, 0xBF, 0xE0,
-  0x1C, 0x03, 0x87, 0xFC, 0x07, 0x01, 0xE0, 0xFF, 0x81, 0x80, 0xF0, 0x3F,
-  0xE0, 0xC0, 0x7C, 0x07, 0xFC, 0x30, 0x1F, 0x00, 0xFF, 0x98, 0x0F, 0xC0,
-  0x3F, 0xFC, 0x03, 0xF0, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0x80, 0x3F,
-  0x80, 0x3F, 0xF0, 0x0F, 0xF0, 0x07, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x81,
-  0x7F, 0x80, 0x3F, 0xF8, 0xDF, 0xF0, 0x1F, 0xFF, 0xE3, 0xFF, 0x0E, 0xFF,
-  0xF8, 0xFF, 0xFE, 0x1F, 0xFC, 0x0F, 0xFE, 0x03, 0xFE, 0x00, 0xFE, 0x00,
-  0x3E, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0xEE, 0x73, 0x9C, 0xE2, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x60, 0x1C, 0x03, 0x80, 0x70, 0x06, 0x00, 0xE0, 0x1C,
-  0x01, 0xC0, 0x3C, 0x03, 0xC0, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0xF8,
-  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
-  0x0F, 0x80, 0x78, 0x07, 0x80, 0x78, 0x03, 0xC0, 0x3C, 0x01, 0xC0, 0x1C,
-  0x00, 0xE0, 0x0E, 0x00, 0x70, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00,
-  0x10, 0x00, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00,
-  0x70, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x1E, 0x01, 0xE0,
-  0x1E, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0,
-  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x3C, 0x03, 0xC0,
-  0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0xE0, 0x0C, 0x01, 0x80, 0x30, 0x0C,
-  0x00, 0x80, 0x00, 0x01, 0xC0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-  0x03, 0xE0, 0x3C, 0x78, 0xEF, 0x9C, 0x7B, 0xF7, 0x3F, 0xFE, 0xDF, 0x8F,
-  0xFF, 0xC0, 0x7F, 0x00, 0x3F, 0xC0, 0x7E, 0xBF, 0x3F, 0x77, 0xEF, 0x9C,
-  0xFF, 0xC7, 0x1E, 0x63, 0xE3, 0x80, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-  0x01, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
-  0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07,
-  0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
-  0x00, 0x3C, 0x7E, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x07, 0x06, 0x06, 0x0C,
-  0x18, 0x30, 0x60, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3C,
-  0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0x00, 0x1E, 0x00, 0x7C, 0x00,
-  0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF0,
-  0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF0, 0x01,
-  0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF0, 0x01, 0xE0,
-  0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x03,
-  0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-  0x0F, 0x3C, 0x00, 0x78, 0x78, 0x03, 0xE1, 0xF0, 0x1F, 0x03, 0xE0, 0x7C,
-  0x0F, 0x83, 0xF0, 0x3F, 0x0F, 0xC0, 0xFC, 0x7F, 0x03, 0xF9, 0xFC, 0x0F,
-  0xE7, 0xF0, 0x3F, 0xBF, 0xC0, 0xFE, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF,
-  0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0,
-  0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F,
-  0x9F, 0xC0, 0xFE, 0x7F, 0x03, 0xF9, 0xFC, 0x0F, 0xE3, 0xF0, 0x3F, 0x0F,
-  0xC0, 0xFC, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x80, 0xF8, 0x7C, 0x01, 0xE1,
-  0xE0, 0x03, 0xCF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x1E, 0x00,
-  0x1F, 0x80, 0x1F, 0xE0, 0x1F, 0xF8, 0x1D, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8,
-  0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
-  0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8,
-  0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xF8, 0xFF, 0xFF, 0xC0, 0x00, 0xFC,
-  0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x1C,
-  0x1F, 0xF1, 0xC0, 0x7F, 0x8C, 0x01, 0xFC, 0x40, 0x0F, 0xE0, 0x00, 0x3F,
-  0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
-  0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x00,
-  0x00, 0x70, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38,
-  0x01, 0x03, 0x80, 0x18, 0x38, 0x00, 0x81, 0x80, 0x1C, 0x1F, 0xFF, 0xE1,
-  0xFF, 0xFF, 0x1F, 0xFF, 0xF9, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF, 0xFF,
-  0xE0, 0x00, 0xFE, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF0, 0x30, 0xFF, 0xC2,
-  0x01, 0xFE, 0x30, 0x0F, 0xF1, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F,
-  0xE0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00,
-  0x1F, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0xFF,
-  0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00,
-  0x07, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x3C,
-  0x00, 0x01, 0xC7, 0x80, 0x0E, 0x7F, 0x00, 0xE3, 0xFC, 0x06, 0x1F, 0xF8,
-  0xE0, 0x7F, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1E,
-  0x00, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-  0xFF, 0x00, 0x0D, 0xF8, 0x00, 0xEF, 0xC0, 0x06, 0x7E, 0x00, 0x63, 0xF0,
-  0x07, 0x1F, 0x80, 0x30, 0xFC, 0x03, 0x07, 0xE0, 0x38, 0x3F, 0x03, 0x81,
-  0xF8, 0x18, 0x0F, 0xC1, 0xC0, 0x7E, 0x1C, 0x03, 0xF0, 0xC0, 0x1F, 0x8E,
-  0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00,
-  0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xFF,
-  0xF0, 0x7F, 0xFF, 0x0F, 0xFF, 0xE0, 0xFF, 0xFE, 0x0F, 0xFF, 0xE1, 0xFF,
-  0xFC, 0x18, 0x00, 0x01, 0x80, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x3F,
-  0x80, 0x03, 0xFF, 0x80, 0x7F, 0xFE, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0x87,
-  0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7E,
-  0x00, 0x03, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00,
-  0xC0, 0x00, 0x0C, 0x78, 0x00, 0x8F, 0xE0, 0x18, 0xFF, 0x87, 0x0F, 0xFF,
-  0xE0, 0x7F, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1F, 0x00,
-  0x07, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-  0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
-  0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x1F, 0xF1, 0xFC,
-  0xFF, 0x07, 0xE7, 0xF8, 0x3F, 0xBF, 0xC1, 0xFD, 0xFE, 0x07, 0xFF, 0xF0,
-  0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0x03, 0xFB,
-  0xF8, 0x1F, 0xDF, 0xC0, 0xFE, 0xFE, 0x07, 0xE3, 0xF0, 0x3F, 0x1F, 0xC1,
-  0xF0, 0x7E, 0x0F, 0x01, 0xF0, 0xF8, 0x03, 0xC7, 0x00, 0x07, 0xE0, 0x00,
-  0x3F, 0xFF, 0xF9, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE7, 0xFF,
-  0xFF, 0x3F, 0xFF, 0xF9, 0x80, 0x07, 0x98, 0x00, 0x3C, 0xC0, 0x03, 0xE4,
-  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03,
-  0xC0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-  0x07, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xF0,
-  0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x01,
-  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-  0x01, 0xFE, 0x00, 0x38, 0x7C, 0x07, 0x80, 0xF0, 0x78, 0x07, 0xC3, 0xC0,
-  0x1F, 0x3E, 0x00, 0xF9, 0xF0, 0x07, 0xCF, 0xC0, 0x3E, 0x7E, 0x01, 0xF3,
-  0xF8, 0x0F, 0x1F, 0xE0, 0xF8, 0x7F, 0xC7, 0x83, 0xFF, 0xF0, 0x0F, 0xFE,
-  0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0x03,
-  0xBF, 0xFC, 0x7C, 0x7F, 0xE7, 0xC1, 0xFF, 0x3E, 0x07, 0xFF, 0xE0, 0x1F,
-  0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x7F, 0xF0,
-  0x03, 0xE7, 0x80, 0x1F, 0x3E, 0x01, 0xF0, 0xF8, 0x0F, 0x83, 0xE1, 0xF8,
-  0x0F, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x1C, 0x3C, 0x00,
-  0xF0, 0x78, 0x07, 0x81, 0xF8, 0x3E, 0x07, 0xE1, 0xF8, 0x0F, 0xC7, 0xE0,
-  0x3F, 0x3F, 0x80, 0xFE, 0xFE, 0x03, 0xFB, 0xF8, 0x0F, 0xFF, 0xE0, 0x3F,
-  0xFF, 0x80, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x3F, 0xDF,
-  0xC0, 0xFF, 0x7F, 0x03, 0xFC, 0xFC, 0x0F, 0xF3, 0xFC, 0x7F, 0x83, 0xFF,
-  0xFE, 0x07, 0xF7, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8,
-  0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
-  0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00,
-  0x03, 0x80, 0x00, 0x00, 0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7E, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x7E, 0x3C, 0x3C, 0x3F, 0x3F, 0xDF, 0xEF, 0xF7, 0xF9, 0xF8,
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7F, 0x7F,
-  0xBF, 0xFF, 0xFF, 0xFB, 0xFC, 0xFE, 0x07, 0x03, 0x01, 0x81, 0x81, 0x81,
-  0x83, 0x81, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-  0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01,
-  0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-  0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
-  0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-  0xC0, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
-  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-  0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x30, 0x00, 0x00,
-  0x00, 0x07, 0xF0, 0x07, 0xFF, 0x03, 0x87, 0xE1, 0xC0, 0xFC, 0xF0, 0x3F,
-  0xBE, 0x07, 0xEF, 0xC1, 0xFF, 0xF0, 0x7F, 0xFC, 0x1F, 0xDF, 0x07, 0xF7,
-  0x81, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x07, 0xE0, 0x03,
-  0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x18, 0x00, 0x04, 0x00, 0x01, 0x00,
-  0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3C, 0x00, 0x1F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-  0xC0, 0x07, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-  0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x3C,
-  0x00, 0x03, 0x80, 0x3C, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x30, 0x3E,
-  0x00, 0x00, 0x0C, 0x3E, 0x00, 0x3C, 0x37, 0x1F, 0x00, 0x7E, 0xF1, 0x9F,
-  0x00, 0x7C, 0xF8, 0xCF, 0x80, 0x78, 0x7C, 0x37, 0xC0, 0x7C, 0x3C, 0x1F,
-  0xC0, 0x3C, 0x1E, 0x0F, 0xE0, 0x3C, 0x0F, 0x07, 0xF0, 0x3E, 0x0F, 0x03,
-  0xF8, 0x1E, 0x07, 0x81, 0xFC, 0x0F, 0x03, 0xC0, 0xFE, 0x0F, 0x03, 0xE0,
-  0x7F, 0x07, 0x81, 0xE0, 0x6F, 0x83, 0xC1, 0xF0, 0x37, 0xC1, 0xE1, 0x78,
-  0x31, 0xF0, 0xF9, 0xBC, 0x18, 0xF8, 0x3F, 0x9E, 0x38, 0x3C, 0x0F, 0x0F,
-  0xF8, 0x1F, 0x00, 0x01, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0,
-  0x00, 0xC0, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-  0x03, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-  0x07, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x37, 0xF8, 0x00, 0x00, 0x33, 0xF8, 0x00, 0x00, 0x33, 0xFC, 0x00, 0x00,
-  0x61, 0xFC, 0x00, 0x00, 0x61, 0xFE, 0x00, 0x00, 0xC1, 0xFE, 0x00, 0x00,
-  0xC0, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x01, 0x80, 0x7F, 0x00, 0x01,
-  0x80, 0x7F, 0x80, 0x03, 0x80, 0x7F, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
-  0xFF, 0xFF, 0xC0, 0x07, 0x00, 0x3F, 0xC0, 0x06, 0x00, 0x1F, 0xE0, 0x0E,
-  0x00, 0x1F, 0xE0, 0x0C, 0x00, 0x0F, 0xF0, 0x0C, 0x00, 0x0F, 0xF0, 0x1C,
-  0x00, 0x0F, 0xF8, 0x1C, 0x00, 0x0F, 0xF8, 0x7E, 0x00, 0x0F, 0xFC, 0xFF,
-  0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xF8,
-  0x7F, 0x00, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x01, 0xFE,
-  0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF,
-  0x01, 0xFE, 0x0F, 0xF0, 0x1F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
-  0x00, 0xFF, 0x0F, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F,
-  0xF0, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x01,
-  0xFE, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0,
-  0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0,
-  0x0F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x1F, 0xC0, 0xFF, 0x87, 0xF0,
-  0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x08, 0x01,
-  0xFF, 0xF0, 0x60, 0x0F, 0xC1, 0xF9, 0x80, 0xFC, 0x01, 0xFE, 0x07, 0xE0,
-  0x01, 0xF8, 0x3F, 0x00, 0x03, 0xE1, 0xFC, 0x00, 0x07, 0x87, 0xE0, 0x00,
-  0x1E, 0x3F, 0x80, 0x00, 0x38, 0xFE, 0x00, 0x00, 0x67, 0xF8, 0x00, 0x01,
-  0x9F, 0xC0, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0x87, 0xF0, 0x00, 0x07, 0x0F, 0xE0, 0x00, 0x38, 0x1F, 0x80, 0x01, 0xC0,
-  0x3F, 0x00, 0x1E, 0x00, 0x7F, 0x01, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-  0x3F, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F,
-  0xF8, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-  0xF0, 0x07, 0xF0, 0x0F, 0xF0, 0x03, 0xF8, 0x0F, 0xF0, 0x03, 0xFC, 0x0F,
-  0xF0, 0x01, 0xFC, 0x0F, 0xF0, 0x01, 0xFE, 0x0F, 0xF0, 0x01, 0xFE, 0x0F,
-  0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F,
-  0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F,
-  0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F,
-  0xF0, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0xFE, 0x0F, 0xF0, 0x01, 0xFE, 0x0F,
-  0xF0, 0x01, 0xFC, 0x0F, 0xF0, 0x01, 0xFC, 0x0F, 0xF0, 0x03, 0xF8, 0x0F,
-  0xF0, 0x03, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x0F, 0xC0, 0x0F,
-  0xF8, 0x3F, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x1F, 0xE0, 0x1F, 0xC1, 0xFE, 0x00,
-  0x3C, 0x1F, 0xE0, 0x01, 0xC1, 0xFE, 0x00, 0x0C, 0x1F, 0xE0, 0x00, 0xC1,
-  0xFE, 0x00, 0x04, 0x1F, 0xE0, 0x20, 0x41, 0xFE, 0x02, 0x00, 0x1F, 0xE0,
-  0x60, 0x01, 0xFE, 0x06, 0x00, 0x1F, 0xE0, 0xE0, 0x01, 0xFE, 0x1E, 0x00,
-  0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xE3, 0xE0, 0x01, 0xFE,
-  0x0E, 0x00, 0x1F, 0xE0, 0x60, 0x01, 0xFE, 0x06, 0x00, 0x1F, 0xE0, 0x20,
-  0x01, 0xFE, 0x02, 0x00, 0x1F, 0xE0, 0x00, 0x11, 0xFE, 0x00, 0x03, 0x1F,
-  0xE0, 0x00, 0x71, 0xFE, 0x00, 0x07, 0x1F, 0xE0, 0x00, 0xE1, 0xFE, 0x00,
-  0x1E, 0x1F, 0xE0, 0x03, 0xE3, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xC7, 0xFC, 0x07,
-  0xE3, 0xFC, 0x00, 0xF1, 0xFE, 0x00, 0x38, 0xFF, 0x00, 0x0C, 0x7F, 0x80,
-  0x06, 0x3F, 0xC0, 0x01, 0x1F, 0xE0, 0x20, 0x8F, 0xF0, 0x10, 0x07, 0xF8,
-  0x18, 0x03, 0xFC, 0x0C, 0x01, 0xFE, 0x0E, 0x00, 0xFF, 0x1F, 0x00, 0x7F,
-  0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x1F, 0xE3, 0xE0, 0x0F, 0xF0, 0x70, 0x07,
-  0xF8, 0x18, 0x03, 0xFC, 0x0C, 0x01, 0xFE, 0x02, 0x00, 0xFF, 0x01, 0x00,
-  0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-  0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x08, 0x00,
-  0x3F, 0xFE, 0x0C, 0x00, 0x3F, 0x07, 0xC6, 0x00, 0x7E, 0x00, 0xFF, 0x00,
-  0x7E, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x07, 0xC0, 0x7F, 0x00, 0x01, 0xE0,
-  0x3F, 0x00, 0x00, 0x70, 0x3F, 0x80, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x0C,
-  0x1F, 0xE0, 0x00, 0x06, 0x0F, 0xE0, 0x00, 0x01, 0x07, 0xF0, 0x00, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-  0x3F, 0xF1, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x07, 0xF8, 0x7F, 0x80,
-  0x03, 0xFC, 0x1F, 0xC0, 0x01, 0xFE, 0x0F, 0xE0, 0x00, 0xFF, 0x03, 0xF8,
-  0x00, 0x7F, 0x80, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0x00, 0x1F, 0xE0, 0x0F,
-  0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x1F, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-  0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x1F, 0xFF, 0x9F, 0xF8, 0x03, 0xFF,
-  0x07, 0xF8, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x3F,
-  0xC0, 0xFF, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x0F, 0xF0, 0x3F, 0xC0, 0x07,
-  0xF8, 0x1F, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFE, 0x07, 0xF8, 0x00,
-  0xFF, 0x03, 0xFC, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x3F, 0xC0, 0xFF, 0x00,
-  0x1F, 0xE0, 0x7F, 0x80, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-  0xFF, 0xFC, 0x0F, 0xF0, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0xFF, 0x03, 0xFC,
-  0x00, 0x7F, 0x81, 0xFE, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F, 0xE0, 0x7F,
-  0x80, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xF8, 0x1F, 0xE0, 0x03, 0xFC, 0x0F,
-  0xF0, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x7F, 0x81,
-  0xFE, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F, 0xE0, 0xFF, 0xC0, 0x1F, 0xF9,
-  0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xE0, 0x7F, 0x80, 0xFF, 0x01,
-  0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F,
-  0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0,
-  0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F,
-  0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC,
-  0x0F, 0xFC, 0x7F, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFE,
-  0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00,
-  0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07,
-  0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8,
-  0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00,
-  0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F,
-  0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x78, 0x1F, 0xE3,
-  0xF0, 0x7F, 0x8F, 0xC1, 0xFC, 0x3F, 0x07, 0xF0, 0xFC, 0x1F, 0xC1, 0xE0,
-  0xFE, 0x07, 0xC3, 0xF0, 0x0F, 0xFF, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0xFC,
-  0x1F, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x1E, 0x00, 0x7F,
-  0x80, 0x07, 0x00, 0x1F, 0xE0, 0x03, 0x80, 0x07, 0xF8, 0x01, 0xC0, 0x01,
-  0xFE, 0x00, 0xE0, 0x00, 0x7F, 0x80, 0x70, 0x00, 0x1F, 0xE0, 0x38, 0x00,
-  0x07, 0xF8, 0x1C, 0x00, 0x01, 0xFE, 0x0E, 0x00, 0x00, 0x7F, 0x87, 0x00,
-  0x00, 0x1F, 0xE3, 0xC0, 0x00, 0x07, 0xF9, 0xF8, 0x00, 0x01, 0xFE, 0xFE,
-  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x07, 0xFD,
-  0xFF, 0x00, 0x01, 0xFE, 0x7F, 0xE0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x1F,
-  0xE1, 0xFF, 0x00, 0x07, 0xF8, 0x3F, 0xE0, 0x01, 0xFE, 0x07, 0xFC, 0x00,
-  0x7F, 0x81, 0xFF, 0x80, 0x1F, 0xE0, 0x3F, 0xE0, 0x07, 0xF8, 0x07, 0xFC,
-  0x01, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0x80, 0x1F, 0xF0, 0x1F, 0xE0, 0x07,
-  0xFE, 0x07, 0xF8, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x3F, 0xF3, 0xFF, 0xF0,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x01, 0x1F, 0xE0, 0x00, 0x31, 0xFE,
-  0x00, 0x03, 0x1F, 0xE0, 0x00, 0x71, 0xFE, 0x00, 0x07, 0x1F, 0xE0, 0x00,
-  0xE1, 0xFE, 0x00, 0x1E, 0x1F, 0xE0, 0x07, 0xE3, 0xFF, 0x01, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xE1,
-  0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFC,
-  0x00, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xF8, 0x00,
-  0x0D, 0xFE, 0x01, 0x7F, 0x80, 0x01, 0xBF, 0xC0, 0x27, 0xF0, 0x00, 0x67,
-  0xF8, 0x04, 0xFF, 0x00, 0x0C, 0xFF, 0x00, 0x8F, 0xE0, 0x03, 0x1F, 0xE0,
-  0x11, 0xFE, 0x00, 0x63, 0xFC, 0x02, 0x3F, 0xC0, 0x08, 0x7F, 0x80, 0x43,
-  0xF8, 0x03, 0x0F, 0xF0, 0x08, 0x7F, 0x80, 0x61, 0xFE, 0x01, 0x07, 0xF0,
-  0x18, 0x3F, 0xC0, 0x20, 0xFF, 0x03, 0x07, 0xF8, 0x04, 0x0F, 0xE0, 0xC0,
-  0xFF, 0x00, 0x81, 0xFE, 0x18, 0x1F, 0xE0, 0x10, 0x3F, 0xC6, 0x03, 0xFC,
-  0x02, 0x03, 0xF8, 0xC0, 0x7F, 0x80, 0x40, 0x7F, 0x98, 0x0F, 0xF0, 0x08,
-  0x07, 0xF6, 0x01, 0xFE, 0x01, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x20, 0x0F,
-  0xF0, 0x07, 0xF8, 0x04, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x80, 0x1F, 0x80,
-  0x1F, 0xE0, 0x10, 0x03, 0xF0, 0x03, 0xFC, 0x02, 0x00, 0x7E, 0x00, 0x7F,
-  0x80, 0x40, 0x07, 0x80, 0x0F, 0xF0, 0x0C, 0x00, 0xF0, 0x01, 0xFE, 0x07,
-  0xC0, 0x0C, 0x00, 0x7F, 0xE7, 0xFF, 0x01, 0x80, 0x3F, 0xFF, 0xFF, 0xC0,
-  0x03, 0xFE, 0xFF, 0xC0, 0x01, 0xF0, 0xFF, 0xC0, 0x01, 0xC0, 0xFF, 0xC0,
-  0x01, 0x80, 0xFF, 0x80, 0x03, 0x01, 0xFF, 0x80, 0x06, 0x03, 0xFF, 0x80,
-  0x0C, 0x07, 0xFF, 0x80, 0x18, 0x0D, 0xFF, 0x80, 0x30, 0x19, 0xFF, 0x00,
-  0x60, 0x31, 0xFF, 0x00, 0xC0, 0x61, 0xFF, 0x01, 0x80, 0xC1, 0xFF, 0x03,
-  0x01, 0x83, 0xFF, 0x06, 0x03, 0x03, 0xFE, 0x0C, 0x06, 0x03, 0xFE, 0x18,
-  0x0C, 0x03, 0xFE, 0x30, 0x18, 0x03, 0xFE, 0x60, 0x30, 0x03, 0xFE, 0xC0,
-  0x60, 0x07, 0xFD, 0x80, 0xC0, 0x07, 0xFF, 0x01, 0x80, 0x07, 0xFE, 0x03,
-  0x00, 0x07, 0xFC, 0x06, 0x00, 0x07, 0xF8, 0x0C, 0x00, 0x07, 0xF0, 0x18,
-  0x00, 0x0F, 0xE0, 0x30, 0x00, 0x0F, 0xC0, 0x60, 0x00, 0x0F, 0x80, 0xC0,
-  0x00, 0x0F, 0x01, 0xC0, 0x00, 0x0E, 0x0F, 0xC0, 0x00, 0x1C, 0x7F, 0xE0,
-  0x00, 0x18, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
-  0x07, 0xF0, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x7E,
-  0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x03, 0xF8, 0x3F,
-  0x80, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x7F, 0x1F, 0xE0, 0x00, 0x3F, 0xCF,
-  0xE0, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0x03, 0xFF,
-  0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-  0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x01,
-  0xFC, 0xFE, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x00, 0xFF, 0x1F, 0xC0, 0x00,
-  0x7F, 0x0F, 0xE0, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x3F, 0x80, 0xFC, 0x00,
-  0x1F, 0x80, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x1F, 0x80, 0x03, 0xF8,
-  0x3F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF,
-  0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x01, 0xFE, 0x1F, 0xE0, 0x7F, 0x81, 0xFC,
-  0x1F, 0xE0, 0x7F, 0x87, 0xF8, 0x0F, 0xE1, 0xFE, 0x03, 0xFC, 0x7F, 0x80,
-  0xFF, 0x1F, 0xE0, 0x3F, 0xC7, 0xF8, 0x0F, 0xF1, 0xFE, 0x03, 0xFC, 0x7F,
-  0x80, 0xFF, 0x1F, 0xE0, 0x3F, 0x87, 0xF8, 0x1F, 0xE1, 0xFE, 0x07, 0xF0,
-  0x7F, 0x87, 0xF8, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x01, 0xFE, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00,
-  0x03, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x3F, 0xFF, 0x80, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0xFC, 0x00,
-  0x7E, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x07, 0xF0,
-  0x3F, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x7F,
-  0x1F, 0xE0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x07,
-  0xF7, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-  0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-  0x03, 0xFD, 0xFC, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x01, 0xFE, 0x7F, 0x80,
-  0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x3F, 0x83, 0xF8,
-  0x00, 0x3F, 0x80, 0xFC, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x1F, 0x80, 0x0F,
-  0xC0, 0x1F, 0x80, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-  0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0xE0,
-  0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0xFF, 0x01, 0xFC,
-  0x01, 0xFE, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF8, 0x07, 0xF8,
-  0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0,
-  0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0x01, 0xFE, 0x01, 0xFC, 0x03,
-  0xFC, 0x07, 0xF8, 0x07, 0xF8, 0x1F, 0xE0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F,
-  0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0x9F, 0xE0, 0x00, 0xFF,
-  0x3F, 0xC0, 0x01, 0xFE, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0xC0, 0x07, 0xF8,
-  0x7F, 0xC0, 0x0F, 0xF0, 0x7F, 0x80, 0x1F, 0xE0, 0xFF, 0x80, 0x3F, 0xC0,
-  0xFF, 0x80, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFE, 0x01,
-  0xFF, 0x03, 0xFC, 0x01, 0xFF, 0x0F, 0xFC, 0x03, 0xFE, 0x7F, 0xFE, 0x03,
-  0xFF, 0x03, 0xF8, 0x10, 0x7F, 0xF9, 0x87, 0xC1, 0xFC, 0x78, 0x03, 0xE7,
-  0x80, 0x0F, 0x3C, 0x00, 0x3B, 0xE0, 0x01, 0xDF, 0x00, 0x06, 0xF8, 0x00,
-  0x37, 0xE0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x3F,
-  0xFC, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x7F, 0xFF,
-  0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x07, 0xFC, 0x00,
-  0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-  0xC0, 0x01, 0xEE, 0x00, 0x0F, 0x78, 0x00, 0xF3, 0xE0, 0x0F, 0x9F, 0xC0,
-  0xF8, 0x8F, 0xFF, 0x04, 0x0F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x3F, 0xC3, 0xFF, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0xC0,
-  0x7C, 0x03, 0xFC, 0x03, 0xC0, 0x3F, 0xC0, 0x38, 0x03, 0xFC, 0x01, 0x80,
-  0x3F, 0xC0, 0x10, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0xFF,
-  0xFE, 0x07, 0xFC, 0xFF, 0xC0, 0x07, 0xC1, 0xFE, 0x00, 0x0E, 0x07, 0xF8,
-  0x00, 0x18, 0x1F, 0xE0, 0x00, 0x60, 0x7F, 0x80, 0x01, 0x81, 0xFE, 0x00,
-  0x06, 0x07, 0xF8, 0x00, 0x18, 0x1F, 0xE0, 0x00, 0x60, 0x7F, 0x80, 0x01,
-  0x81, 0xFE, 0x00, 0x06, 0x07, 0xF8, 0x00, 0x18, 0x1F, 0xE0, 0x00, 0x60,
-  0x7F, 0x80, 0x01, 0x81, 0xFE, 0x00, 0x06, 0x07, 0xF8, 0x00, 0x18, 0x1F,
-  0xE0, 0x00, 0x60, 0x7F, 0x80, 0x01, 0x81, 0xFE, 0x00, 0x06, 0x07, 0xF8,
-  0x00, 0x18, 0x1F, 0xE0, 0x00, 0x60, 0x7F, 0x80, 0x01, 0x81, 0xFE, 0x00,
-  0x06, 0x07, 0xF8, 0x00, 0x18, 0x1F, 0xE0, 0x00, 0x60, 0x7F, 0x80, 0x03,
-  0x00, 0xFF, 0x00, 0x0C, 0x03, 0xFC, 0x00, 0x30, 0x07, 0xF0, 0x01, 0x80,
-  0x0F, 0xE0, 0x0E, 0x00, 0x1F, 0xE0, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0x1F, 0x07,
-  0xFC, 0x00, 0x07, 0x01, 0xFE, 0x00, 0x03, 0x00, 0x7F, 0x80, 0x03, 0x80,
-  0x3F, 0xC0, 0x01, 0x80, 0x1F, 0xE0, 0x00, 0xC0, 0x07, 0xF8, 0x00, 0xC0,
-  0x03, 0xFC, 0x00, 0x60, 0x00, 0xFF, 0x00, 0x30, 0x00, 0x7F, 0x80, 0x30,
-  0x00, 0x1F, 0xE0, 0x18, 0x00, 0x0F, 0xF0, 0x18, 0x00, 0x07, 0xF8, 0x0C,
-  0x00, 0x01, 0xFE, 0x06, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x3F, 0xC3,
-  0x00, 0x00, 0x1F, 0xE3, 0x80, 0x00, 0x0F, 0xF1, 0x80, 0x00, 0x03, 0xFC,
-  0xC0, 0x00, 0x01, 0xFE, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03,
-  0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x80, 0x00, 0xFF, 0xF8, 0x7F, 0xFF, 0x0F, 0xFB, 0xFF, 0x00, 0xFF,
-  0xC0, 0x1F, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x70, 0x3F, 0x80, 0x0F, 0xE0,
-  0x03, 0x81, 0xFE, 0x00, 0x7F, 0x80, 0x1C, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
-  0xC0, 0x3F, 0x80, 0x0F, 0xE0, 0x06, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x70,
-  0x0F, 0xF0, 0x07, 0xFC, 0x03, 0x00, 0x3F, 0x80, 0x3F, 0xE0, 0x18, 0x01,
-  0xFE, 0x01, 0xFF, 0x01, 0xC0, 0x0F, 0xF0, 0x1B, 0xFC, 0x0C, 0x00, 0x3F,
-  0x80, 0xCF, 0xE0, 0x60, 0x01, 0xFE, 0x06, 0x7F, 0x07, 0x00, 0x0F, 0xF0,
-  0x63, 0xFC, 0x30, 0x00, 0x3F, 0x83, 0x0F, 0xE1, 0x80, 0x01, 0xFE, 0x30,
-  0x7F, 0x1C, 0x00, 0x07, 0xF1, 0x81, 0xFC, 0xC0, 0x00, 0x3F, 0x8C, 0x0F,
-  0xE6, 0x00, 0x01, 0xFE, 0xC0, 0x7F, 0x70, 0x00, 0x07, 0xF6, 0x01, 0xFB,
-  0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-  0x00, 0x07, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00,
-  0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0x00,
-  0x3E, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x07,
-  0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0,
-  0x00, 0x70, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x0F,
-  0xFF, 0x3F, 0xF8, 0x01, 0xF8, 0x1F, 0xF8, 0x01, 0xE0, 0x0F, 0xF8, 0x01,
-  0xC0, 0x0F, 0xF8, 0x01, 0x80, 0x07, 0xFC, 0x03, 0x80, 0x03, 0xFE, 0x07,
-  0x00, 0x03, 0xFE, 0x06, 0x00, 0x01, 0xFF, 0x0C, 0x00, 0x00, 0xFF, 0x9C,
-  0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x19, 0xFE, 0x00, 0x00, 0x31, 0xFF,
-  0x00, 0x00, 0x70, 0xFF, 0x80, 0x00, 0x60, 0x7F, 0x80, 0x00, 0xC0, 0x7F,
-  0xC0, 0x01, 0xC0, 0x3F, 0xE0, 0x03, 0x80, 0x1F, 0xE0, 0x07, 0x00, 0x1F,
-  0xF0, 0x07, 0x00, 0x0F, 0xF8, 0x0F, 0x00, 0x0F, 0xF8, 0x3F, 0x80, 0x1F,
-  0xFC, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x7F, 0xF0, 0x00,
-  0x7E, 0x1F, 0xF0, 0x00, 0x38, 0x1F, 0xF0, 0x00, 0x38, 0x0F, 0xF0, 0x00,
-  0x70, 0x0F, 0xF8, 0x00, 0x60, 0x07, 0xF8, 0x00, 0x60, 0x07, 0xFC, 0x00,
-  0xC0, 0x03, 0xFC, 0x01, 0xC0, 0x01, 0xFE, 0x01, 0x80, 0x01, 0xFE, 0x03,
-  0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0x86, 0x00, 0x00, 0x7F, 0x8E,
-  0x00, 0x00, 0x7F, 0xCC, 0x00, 0x00, 0x3F, 0xD8, 0x00, 0x00, 0x3F, 0xF8,
-  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xFE,
-  0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x7F, 0xC3,
-  0xE0, 0x07, 0xF8, 0x38, 0x00, 0xFF, 0x83, 0x80, 0x0F, 0xF0, 0x30, 0x01,
-  0xFE, 0x07, 0x00, 0x3F, 0xE0, 0x60, 0x03, 0xFC, 0x06, 0x00, 0x7F, 0xC0,
-  0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03,
-  0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x07, 0xFC, 0x00, 0x30, 0xFF, 0x80,
-  0x03, 0x0F, 0xF0, 0x00, 0x31, 0xFF, 0x00, 0x07, 0x1F, 0xE0, 0x00, 0xF3,
-  0xFE, 0x00, 0x1E, 0x7F, 0xC0, 0x03, 0xE7, 0xF8, 0x01, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x0F, 0x81,
-  0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0,
-  0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E,
-  0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07,
-  0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xFF, 0xFF, 0xF8, 0xF0,
-  0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x00,
-  0x1F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xF0, 0x01,
-  0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1F,
-  0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0,
-  0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
-  0x1E, 0xFF, 0xFF, 0xFC, 0x1F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F,
-  0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03,
-  0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
-  0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C,
-  0x0F, 0x81, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x78, 0x00, 0x07, 0xC0,
-  0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x01, 0xEF, 0x00, 0x0F,
-  0x3C, 0x00, 0xF1, 0xE0, 0x07, 0x87, 0x80, 0x78, 0x3C, 0x03, 0xC0, 0xF0,
-  0x3C, 0x07, 0x81, 0xE0, 0x1E, 0x1E, 0x00, 0xF0, 0xF0, 0x07, 0xCF, 0x00,
-  0x1E, 0x78, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x70, 0x1F, 0x03, 0xF0, 0x7E, 0x03, 0xE0, 0x3E, 0x01, 0xE0, 0x1E,
-  0x00, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0xFC, 0x03, 0xE1, 0xF8, 0x0F, 0x03,
-  0xF0, 0x7C, 0x07, 0xC1, 0xF8, 0x1F, 0x87, 0xE0, 0x7E, 0x1F, 0x81, 0xF8,
-  0x3C, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x01, 0xFE, 0x00, 0x3F, 0xF8, 0x03,
-  0xE7, 0xE0, 0x3E, 0x1F, 0x83, 0xF0, 0x7E, 0x1F, 0x81, 0xF8, 0x7E, 0x07,
-  0xE3, 0xF8, 0x1F, 0x8F, 0xE0, 0x7E, 0x3F, 0x83, 0xF8, 0xFF, 0x1F, 0xE1,
-  0xFF, 0xDF, 0xF7, 0xFE, 0x3F, 0x07, 0xE0, 0xF8, 0xFF, 0x80, 0x00, 0x1F,
-  0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-  0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00,
-  0x0F, 0xC7, 0xF0, 0x07, 0xEF, 0xFE, 0x03, 0xFC, 0x3F, 0x81, 0xFC, 0x0F,
-  0xE0, 0xFC, 0x03, 0xF0, 0x7E, 0x01, 0xFC, 0x3F, 0x00, 0xFE, 0x1F, 0x80,
-  0x3F, 0x8F, 0xC0, 0x1F, 0xC7, 0xE0, 0x0F, 0xE3, 0xF0, 0x07, 0xF1, 0xF8,
-  0x03, 0xF8, 0xFC, 0x01, 0xFC, 0x7E, 0x00, 0xFE, 0x3F, 0x00, 0x7F, 0x1F,
-  0x80, 0x3F, 0x0F, 0xC0, 0x1F, 0x87, 0xE0, 0x1F, 0xC3, 0xF0, 0x0F, 0xC1,
-  0xF8, 0x07, 0xE0, 0xFE, 0x07, 0xE0, 0x73, 0x87, 0xE0, 0x30, 0xFF, 0xC0,
-  0x10, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xE0, 0x3E, 0x3E, 0x0F,
-  0x83, 0xE3, 0xE0, 0x7C, 0x7C, 0x0F, 0x9F, 0x01, 0xF3, 0xE0, 0x1C, 0x7C,
-  0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8,
-  0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFC,
-  0x00, 0x1F, 0xC0, 0x21, 0xFE, 0x0C, 0x3F, 0xFF, 0x01, 0xFF, 0x80, 0x0F,
-  0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
-  0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
-  0xF8, 0x00, 0x01, 0xF8, 0x03, 0xF1, 0xF8, 0x07, 0xFD, 0xF8, 0x1F, 0xC7,
-  0xF8, 0x1F, 0x83, 0xF8, 0x3F, 0x01, 0xF8, 0x7F, 0x01, 0xF8, 0x7E, 0x01,
-  0xF8, 0x7E, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01,
-  0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01,
-  0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0x7E, 0x01, 0xF8, 0x7F, 0x01,
-  0xF8, 0x3F, 0x03, 0xF8, 0x3F, 0x03, 0xF8, 0x1F, 0x87, 0xFC, 0x0F, 0xFD,
-  0xFF, 0x03, 0xF1, 0xC0, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xE1, 0xE0, 0xF8,
-  0x7C, 0x3C, 0x0F, 0x1F, 0x03, 0xE7, 0xC0, 0xFB, 0xF0, 0x3E, 0xFC, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-  0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0C, 0xFC,
-  0x06, 0x3F, 0xC3, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0xFC,
-  0x01, 0xFF, 0x81, 0xF1, 0xC1, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0x7C, 0x7E,
-  0x1C, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x1F, 0xFF, 0x0F,
-  0xFF, 0x80, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
-  0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F,
-  0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00,
-  0xFC, 0x00, 0x7E, 0x00, 0x7F, 0x80, 0xFF, 0xF8, 0x00, 0x07, 0xF0, 0x03,
-  0xFF, 0xFC, 0xF8, 0x7F, 0xBE, 0x07, 0x87, 0xC0, 0xF9, 0xF8, 0x1F, 0xBF,
-  0x03, 0xF7, 0xE0, 0x7E, 0xFC, 0x0F, 0xDF, 0x81, 0xF9, 0xF0, 0x3F, 0x3E,
-  0x07, 0xC3, 0xE1, 0xF8, 0x3C, 0x7E, 0x01, 0xFF, 0x00, 0x60, 0x00, 0x38,
-  0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xF9, 0xFF,
-  0xFF, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x0F, 0xFF, 0xEF, 0x00, 0x3F, 0xC0,
-  0x03, 0xF8, 0x00, 0x7F, 0x00, 0x1C, 0xF8, 0x07, 0x0F, 0xFF, 0xC0, 0x7F,
-  0xC0, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80,
-  0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80,
-  0x00, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x1F, 0x9F, 0xF0, 0x1F, 0xBF,
-  0xF8, 0x1F, 0xF1, 0xF8, 0x1F, 0xC0, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80,
-  0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80,
-  0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80,
-  0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80,
-  0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x3F, 0xC1, 0xFE, 0xFF, 0xE3,
-  0xFF, 0x0F, 0x07, 0xE1, 0xFE, 0x3F, 0xC7, 0xF8, 0x7F, 0x03, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F,
-  0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83,
-  0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE1, 0xFE, 0xFF, 0xE0, 0x00,
-  0x70, 0x07, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x07, 0xF0, 0x0F, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFC, 0x03, 0xF0,
-  0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC,
-  0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F,
-  0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F,
-  0xDC, 0x3F, 0xF8, 0xFB, 0xE3, 0xEF, 0x0F, 0xBC, 0x7C, 0x7F, 0xE0, 0x7E,
-  0x00, 0xFF, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0,
-  0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-  0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE1, 0xFF, 0x83,
-  0xF0, 0x3F, 0x01, 0xF8, 0x0E, 0x00, 0xFC, 0x06, 0x00, 0x7E, 0x06, 0x00,
-  0x3F, 0x06, 0x00, 0x1F, 0x86, 0x00, 0x0F, 0xC7, 0x00, 0x07, 0xE7, 0x80,
-  0x03, 0xF7, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7E, 0x7F,
-  0x00, 0x3F, 0x1F, 0xC0, 0x1F, 0x8F, 0xE0, 0x0F, 0xC3, 0xF8, 0x07, 0xE0,
-  0xFE, 0x03, 0xF0, 0x7F, 0x81, 0xF8, 0x1F, 0xC0, 0xFC, 0x0F, 0xF0, 0xFF,
-  0x07, 0xFD, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8,
-  0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
-  0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
-  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x0F, 0xF7,
-  0xFF, 0x00, 0x07, 0xE0, 0x3F, 0x07, 0xFC, 0xFF, 0x87, 0xFC, 0x0F, 0xEF,
-  0xFE, 0x7F, 0xF0, 0x3F, 0xC3, 0xFF, 0x1F, 0x81, 0xFC, 0x0F, 0xE0, 0x7E,
-  0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x7E, 0x03, 0xF0, 0x1F, 0x83, 0xF0, 0x1F,
-  0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0xFC, 0x07, 0xE0, 0x3F, 0x07,
-  0xE0, 0x3F, 0x01, 0xF8, 0x3F, 0x01, 0xF8, 0x0F, 0xC1, 0xF8, 0x0F, 0xC0,
-  0x7E, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x7E, 0x03, 0xF0, 0x1F, 0x83, 0xF0,
-  0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0xFC, 0x07, 0xE0, 0x3F,
-  0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x3F, 0x01, 0xF8, 0x0F, 0xC1, 0xF8, 0x0F,
-  0xC0, 0x7E, 0x1F, 0xE0, 0xFF, 0x07, 0xFB, 0xFF, 0x8F, 0xFC, 0x7F, 0xE0,
-  0x00, 0x07, 0xE0, 0xFF, 0x9F, 0xF0, 0x3F, 0xBF, 0xF8, 0x1F, 0xF1, 0xF8,
-  0x1F, 0xC0, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC,
-  0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC,
-  0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC,
-  0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC, 0x1F, 0x80, 0xFC,
-  0x1F, 0x80, 0xFC, 0x3F, 0xC1, 0xFE, 0xFF, 0xE3, 0xFF, 0x01, 0xFC, 0x00,
-  0x3F, 0xF8, 0x03, 0xE3, 0xE0, 0x3E, 0x0F, 0x83, 0xF0, 0x7E, 0x1F, 0x01,
-  0xF1, 0xF8, 0x0F, 0xCF, 0xC0, 0x7E, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF,
-  0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F,
-  0xFF, 0xC0, 0x7F, 0x7E, 0x03, 0xF3, 0xF0, 0x1F, 0x8F, 0x80, 0xF8, 0x7E,
-  0x0F, 0xC1, 0xF0, 0x7C, 0x07, 0xC7, 0xC0, 0x1F, 0xFC, 0x00, 0x3F, 0x80,
-  0x00, 0x0F, 0xC0, 0xFF, 0xBF, 0xF0, 0x3F, 0xF1, 0xF8, 0x1F, 0xC0, 0xFC,
-  0x1F, 0xC0, 0xFC, 0x1F, 0x80, 0xFE, 0x1F, 0x80, 0x7E, 0x1F, 0x80, 0x7F,
-  0x1F, 0x80, 0x7F, 0x1F, 0x80, 0x7F, 0x1F, 0x80, 0x7F, 0x1F, 0x80, 0x7F,
-  0x1F, 0x80, 0x7F, 0x1F, 0x80, 0x7F, 0x1F, 0x80, 0x7F, 0x1F, 0x80, 0x7F,
-  0x1F, 0x80, 0x7E, 0x1F, 0x80, 0x7E, 0x1F, 0x80, 0xFE, 0x1F, 0x80, 0xFC,
-  0x1F, 0xC1, 0xF8, 0x1F, 0xE3, 0xF8, 0x1F, 0xBF, 0xE0, 0x1F, 0x8F, 0xC0,
-  0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00,
-  0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF8, 0x00,
-  0x00, 0xF8, 0x08, 0x07, 0xFE, 0x18, 0x0F, 0xC7, 0x38, 0x1F, 0x83, 0xF8,
-  0x3F, 0x01, 0xF8, 0x3F, 0x01, 0xF8, 0x7F, 0x01, 0xF8, 0x7E, 0x01, 0xF8,
-  0x7E, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8,
-  0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8, 0xFE, 0x01, 0xF8,
-  0xFE, 0x01, 0xF8, 0x7E, 0x01, 0xF8, 0x7F, 0x01, 0xF8, 0x7F, 0x01, 0xF8,
-  0x3F, 0x83, 0xF8, 0x1F, 0xC7, 0xF8, 0x0F, 0xFD, 0xF8, 0x03, 0xF1, 0xF8,
-  0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8,
-  0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x07, 0x9F, 0xF3, 0xF8, 0xFE, 0xFF, 0x8F, 0xFF, 0xF1, 0xFE, 0x7E,
-  0x3F, 0x87, 0x87, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
-  0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
-  0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01,
-  0xF8, 0x00, 0x7F, 0x80, 0x3F, 0xFC, 0x00, 0x0F, 0x84, 0x3F, 0xF8, 0xE1,
-  0xF3, 0x80, 0xEF, 0x00, 0xDE, 0x01, 0xBE, 0x01, 0x7E, 0x00, 0xFF, 0x01,
-  0xFF, 0x81, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0xC1, 0xFF, 0x80, 0xFF, 0x80,
-  0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0xFE, 0x01, 0xDF, 0x0F,
-  0x37, 0xFC, 0x43, 0xF0, 0x01, 0x00, 0x0C, 0x00, 0x70, 0x01, 0xC0, 0x0F,
-  0x00, 0x7C, 0x03, 0xF0, 0x1F, 0xC0, 0xFF, 0xF3, 0xFF, 0xC3, 0xF0, 0x0F,
-  0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03,
-  0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
-  0xFC, 0x23, 0xF0, 0x8F, 0xE6, 0x1F, 0xF0, 0x7F, 0x80, 0xF8, 0x00, 0xFF,
-  0x87, 0xFC, 0x1F, 0xC0, 0xFE, 0x07, 0xE0, 0x3F, 0x03, 0xF0, 0x1F, 0x81,
-  0xF8, 0x0F, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x3F, 0x01, 0xF8,
-  0x1F, 0x80, 0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x3F, 0x03, 0xF0, 0x1F,
-  0x81, 0xF8, 0x0F, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x3F, 0x01,
-  0xF8, 0x1F, 0x80, 0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x7F, 0x03, 0xF8,
-  0x7F, 0xC0, 0xFF, 0xEF, 0xF8, 0x3F, 0xE7, 0xC0, 0x0F, 0xC2, 0x00, 0xFF,
-  0xF1, 0xFC, 0xFF, 0x01, 0xE3, 0xFC, 0x03, 0x07, 0xF0, 0x0C, 0x1F, 0xC0,
-  0x60, 0x3F, 0x81, 0x80, 0xFE, 0x04, 0x01, 0xF8, 0x30, 0x07, 0xF0, 0xC0,
-  0x1F, 0xC6, 0x00, 0x3F, 0x98, 0x00, 0xFE, 0x40, 0x01, 0xFB, 0x00, 0x07,
-  0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x01, 0xF0,
-  0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00,
-  0x01, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x3F, 0xBF, 0xE0, 0xFE, 0x07, 0x0F,
-  0xE0, 0x7F, 0x03, 0x83, 0xF0, 0x1F, 0x81, 0x81, 0xFC, 0x0F, 0xC0, 0xC0,
-  0xFE, 0x07, 0xF0, 0x40, 0x3F, 0x03, 0xF8, 0x60, 0x1F, 0xC3, 0xFC, 0x30,
-  0x07, 0xE1, 0xFE, 0x10, 0x03, 0xF0, 0x9F, 0x98, 0x01, 0xFC, 0xCF, 0xCC,
-  0x00, 0x7E, 0x67, 0xEC, 0x00, 0x3F, 0xE1, 0xFE, 0x00, 0x1F, 0xF0, 0xFE,
-  0x00, 0x07, 0xF0, 0x7F, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0xFC, 0x0F,
-  0x80, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x0F, 0x00,
-  0xE0, 0x00, 0x07, 0x00, 0x70, 0x00, 0x03, 0x80, 0x38, 0x00, 0x00, 0x80,
-  0x08, 0x00, 0xFF, 0xF3, 0xFD, 0xFF, 0x03, 0xC3, 0xFC, 0x0E, 0x07, 0xF0,
-  0x30, 0x1F, 0xE1, 0x80, 0x3F, 0x8C, 0x00, 0x7F, 0x70, 0x01, 0xFF, 0x80,
-  0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-  0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0xCF, 0xF0, 0x06, 0x1F,
-  0xC0, 0x38, 0x3F, 0x80, 0xC0, 0xFF, 0x07, 0x01, 0xFC, 0x3C, 0x07, 0xFB,
-  0xFC, 0x7F, 0xF0, 0xFF, 0xE3, 0xFB, 0xFC, 0x07, 0x8F, 0xE0, 0x18, 0x7F,
-  0x01, 0x81, 0xF8, 0x0C, 0x0F, 0xE0, 0x60, 0x7F, 0x06, 0x01, 0xF8, 0x30,
-  0x0F, 0xE1, 0x80, 0x7F, 0x18, 0x01, 0xF8, 0xC0, 0x0F, 0xE6, 0x00, 0x3F,
-  0x60, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00,
-  0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x38,
-  0x00, 0x00, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x03, 0x82, 0x00, 0x3E,
-  0x30, 0x01, 0xF1, 0x00, 0x0F, 0x98, 0x00, 0x3F, 0x80, 0x00, 0xF0, 0x00,
-  0x00, 0x7F, 0xFF, 0xEF, 0xFF, 0xFD, 0xE0, 0x7F, 0x30, 0x1F, 0xC6, 0x07,
-  0xF8, 0x80, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x3F,
-  0x80, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x03, 0xF8,
-  0x00, 0xFE, 0x03, 0x3F, 0xC0, 0x67, 0xF0, 0x19, 0xFE, 0x07, 0x3F, 0x83,
-  0xEF, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x00, 0x7C, 0x07, 0xE0, 0x3E, 0x00,
-  0xF8, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
-  0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0,
-  0x1F, 0x00, 0xF8, 0x03, 0xC0, 0x3C, 0x01, 0xF0, 0x00, 0xF0, 0x03, 0xE0,
-  0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
-  0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
-  0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x3E, 0x00,
-  0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80,
-  0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0x7C, 0x00, 0xF0,
-  0x00, 0xF0, 0x03, 0xE0, 0x3C, 0x01, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
-  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E,
-  0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0xC0, 0x7E,
-  0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xC0, 0x47, 0xFF, 0xC3, 0x9F,
-  0xFF, 0xFF, 0x70, 0x7F, 0xF8, 0x80, 0x7F, 0xC0, 0x00, 0x3E, 0x00 };
+  0x24, 0x36, 0x17, 0x1F, 0xFA, 0x16, 0x26, 0x25, 0x35, 0x44, 0x44, 0x43,
+  0x53, 0x53, 0x53, 0x62, 0x61, 0x71, 0x71, 0xFF, 0x84, 0x36, 0x1F, 0xF2,
+  0x16, 0x34, 0x20, 0x13, 0x93, 0x15, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x85,
+  0x13, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x31, 0xA3, 0x31, 0xB1,
+  0x20, 0x84, 0x53, 0xB3, 0x63, 0xB3, 0x63, 0xA4, 0x54, 0xA4, 0x54, 0xA4,
+  0x54, 0xA4, 0x54, 0xA4, 0x54, 0xA3, 0x63, 0xB3, 0x63, 0x6F, 0x62, 0xF6,
+  0x2F, 0x66, 0x45, 0x4A, 0x45, 0x4A, 0x36, 0x3B, 0x36, 0x3A, 0x45, 0x4A,
+  0x45, 0x4A, 0x45, 0x45, 0xF7, 0x1F, 0x71, 0xF7, 0x63, 0x63, 0xA4, 0x54,
+  0xA4, 0x54, 0xA4, 0x54, 0xA4, 0x54, 0xA4, 0x54, 0xA4, 0x53, 0xB3, 0x63,
+  0xB3, 0x54, 0xA4, 0x54, 0x70, 0x92, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x0B,
+  0x84, 0x22, 0x16, 0x53, 0x42, 0x35, 0x33, 0x52, 0x44, 0x33, 0x52, 0x53,
+  0x24, 0x52, 0x62, 0x24, 0x52, 0x62, 0x25, 0x42, 0x71, 0x26, 0x32, 0x71,
+  0x2B, 0xAB, 0xBB, 0xBC, 0xAC, 0xAD, 0x9D, 0xAC, 0xBB, 0xAB, 0xA2, 0x28,
+  0x92, 0x37, 0x11, 0x72, 0x46, 0x11, 0x72, 0x55, 0x11, 0x72, 0x55, 0x12,
+  0x62, 0x55, 0x13, 0x52, 0x54, 0x23, 0x52, 0x45, 0x24, 0x42, 0x44, 0x36,
+  0x22, 0x25, 0x6D, 0xB7, 0xF2, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xA0, 0xFB,
+  0x2E, 0x5D, 0x2E, 0x8A, 0x3C, 0x62, 0x36, 0x5C, 0x64, 0xDC, 0x56, 0x71,
+  0x3C, 0x66, 0x17, 0x3B, 0x67, 0x16, 0x3C, 0x67, 0x16, 0x3C, 0x58, 0x15,
+  0x3C, 0x67, 0x16, 0x2D, 0x67, 0x15, 0x3D, 0x57, 0x25, 0x2E, 0x57, 0x15,
+  0x3E, 0x56, 0x24, 0x3F, 0x05, 0x52, 0x53, 0xF1, 0x53, 0x25, 0x38, 0x55,
+  0x86, 0x27, 0x94, 0x57, 0x35, 0x73, 0x1F, 0x12, 0x56, 0x61, 0xE3, 0x56,
+  0x61, 0xE2, 0x56, 0x71, 0xD3, 0x46, 0x81, 0xD2, 0x56, 0x81, 0xC3, 0x46,
+  0x81, 0xC3, 0x56, 0x81, 0xC2, 0x66, 0x81, 0xB3, 0x65, 0x81, 0xC2, 0x75,
+  0x72, 0xB3, 0x75, 0x71, 0xC2, 0x94, 0x62, 0xB3, 0x95, 0x33, 0xC2, 0xB9,
+  0xC3, 0xC6, 0x70, 0xC7, 0xFA, 0xBF, 0x74, 0x37, 0xF4, 0x45, 0x6F, 0x44,
+  0x66, 0xF2, 0x57, 0x5F, 0x25, 0x75, 0xF2, 0x66, 0x5F, 0x26, 0x64, 0xF3,
+  0x75, 0x4F, 0x38, 0x33, 0xF6, 0xCF, 0x79, 0xFB, 0x87, 0xA9, 0x99, 0x59,
+  0xB9, 0x48, 0x41, 0x98, 0x38, 0x34, 0x97, 0x37, 0x45, 0x96, 0x27, 0x46,
+  0x95, 0x27, 0x57, 0x94, 0x27, 0x58, 0x92, 0x27, 0x68, 0xC8, 0x69, 0xB8,
+  0x79, 0x99, 0x79, 0xA8, 0x89, 0xA7, 0x8A, 0x96, 0x11, 0x89, 0xB3, 0x21,
+  0x97, 0xF1, 0x3A, 0x43, 0x1D, 0x3F, 0x04, 0xB6, 0xB7, 0x99, 0x7B, 0x55,
+  0x13, 0x1F, 0xF0, 0x13, 0x23, 0x23, 0x23, 0x23, 0x31, 0x20, 0xF7, 0x29,
+  0x28, 0x38, 0x38, 0x39, 0x29, 0x38, 0x39, 0x38, 0x48, 0x47, 0x48, 0x48,
+  0x48, 0x47, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58,
+  0x48, 0x48, 0x49, 0x48, 0x49, 0x39, 0x3A, 0x39, 0x3A, 0x3A, 0x2B, 0x2B,
+  0x2C, 0x2B, 0x10, 0xC2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xA3, 0xA3, 0x93,
+  0x94, 0x84, 0x85, 0x84, 0x84, 0x84, 0x85, 0x75, 0x75, 0x75, 0x75, 0x75,
+  0x75, 0x75, 0x75, 0x75, 0x74, 0x84, 0x84, 0x74, 0x84, 0x83, 0x93, 0x83,
+  0x93, 0x83, 0x92, 0x92, 0x92, 0x82, 0xA1, 0xB0, 0x73, 0xE5, 0xD5, 0xD5,
+  0xD5, 0x74, 0x34, 0x33, 0x15, 0x23, 0x34, 0x16, 0x13, 0x2D, 0x12, 0x16,
+  0x3E, 0x77, 0xA8, 0x76, 0x11, 0x16, 0x26, 0x13, 0x16, 0x15, 0x23, 0x2A,
+  0x33, 0x34, 0x22, 0x35, 0x33, 0x75, 0xD5, 0xD5, 0xE3, 0x80, 0xB4, 0xF7,
+  0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7,
+  0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7,
+  0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xB0, 0x24, 0x36, 0x17,
+  0x1F, 0x91, 0x75, 0x35, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x0F,
+  0xFF, 0xA0, 0x24, 0x36, 0x1F, 0xF2, 0x16, 0x34, 0x20, 0xB4, 0xA5, 0xA4,
+  0xB4, 0xA5, 0xA4, 0xB4, 0xA5, 0xA4, 0xB4, 0xA5, 0xA4, 0xB4, 0xA5, 0xA4,
+  0xB4, 0xA5, 0xA4, 0xB4, 0xA5, 0xA4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xA4,
+  0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xA4, 0xB0, 0x86, 0xE4, 0x24, 0xB4, 0x44,
+  0x95, 0x45, 0x75, 0x65, 0x65, 0x65, 0x56, 0x66, 0x46, 0x66, 0x37, 0x67,
+  0x27, 0x67, 0x27, 0x67, 0x18, 0x67, 0x18, 0x6F, 0x16, 0xF1, 0x6F, 0x16,
+  0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x67, 0x27,
+  0x67, 0x27, 0x67, 0x27, 0x67, 0x36, 0x66, 0x46, 0x66, 0x55, 0x65, 0x65,
+  0x65, 0x75, 0x45, 0x94, 0x44, 0xB4, 0x24, 0xE6, 0x80, 0xB2, 0xE4, 0xC6,
+  0xA8, 0x8A, 0x63, 0x18, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+  0xB7, 0xB7, 0xB7, 0xB7, 0xA8, 0x9B, 0x3F, 0x30, 0x86, 0xDA, 0x9D, 0x7F,
+  0x06, 0xF0, 0x53, 0x59, 0x33, 0x78, 0x32, 0x97, 0x31, 0xA7, 0xF0, 0x6F,
+  0x06, 0xF0, 0x6F, 0x05, 0xF1, 0x5F, 0x05, 0xF1, 0x5F, 0x14, 0xF1, 0x4F,
+  0x23, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x23, 0xF2, 0x3A, 0x16, 0x3A, 0x25,
+  0x3B, 0x16, 0x2A, 0x35, 0xF1, 0x4F, 0x23, 0xF3, 0x2F, 0x32, 0xF4, 0x2F,
+  0x42, 0x87, 0xBC, 0x8E, 0x62, 0x4A, 0x41, 0x88, 0x32, 0x88, 0x31, 0xA7,
+  0xE7, 0xE7, 0xE6, 0xF0, 0x6E, 0x6F, 0x05, 0xF0, 0x7C, 0xAA, 0xCB, 0xBC,
+  0x9D, 0x9D, 0x8E, 0x7F, 0x06, 0xF0, 0x6F, 0x15, 0xF1, 0x5F, 0x14, 0xF2,
+  0x4F, 0x23, 0x34, 0xB3, 0x27, 0x83, 0x38, 0x72, 0x4A, 0x33, 0x6D, 0xA8,
+  0xA0, 0xE4, 0xF2, 0x4F, 0x15, 0xF0, 0x6E, 0x7E, 0x7D, 0x8C, 0x21, 0x6B,
+  0x31, 0x6B, 0x22, 0x6A, 0x23, 0x69, 0x33, 0x69, 0x24, 0x68, 0x25, 0x67,
+  0x35, 0x66, 0x36, 0x66, 0x27, 0x65, 0x37, 0x64, 0x38, 0x64, 0x29, 0x63,
+  0x39, 0x63, 0xFF, 0xFF, 0xFF, 0xF0, 0xC6, 0xF0, 0x6F, 0x06, 0xF0, 0x6F,
+  0x06, 0xF0, 0x6F, 0x06, 0x30, 0x5F, 0x05, 0xF0, 0x4F, 0x05, 0xF0, 0x5F,
+  0x04, 0xF0, 0x52, 0xF3, 0x2F, 0x32, 0xF2, 0x2F, 0x37, 0xDB, 0x8E, 0x6F,
+  0x05, 0xF1, 0x4F, 0x23, 0xF2, 0xB9, 0xD8, 0xE6, 0xF0, 0x5F, 0x14, 0xF2,
+  0x3F, 0x23, 0xF2, 0x2F, 0x32, 0x34, 0xB1, 0x37, 0x82, 0x39, 0x43, 0x4F,
+  0x06, 0xCA, 0x89, 0xF3, 0x3E, 0x5D, 0x6E, 0x5E, 0x6E, 0x6E, 0x6E, 0x6E,
+  0x7D, 0x7D, 0x8D, 0x7D, 0x8D, 0xE7, 0xF1, 0x49, 0x37, 0x28, 0x56, 0x28,
+  0x57, 0x18, 0x57, 0x18, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06,
+  0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x63, 0x66, 0x63, 0x75, 0x55, 0x65,
+  0x47, 0x54, 0x59, 0x43, 0x3D, 0x67, 0x2F, 0x42, 0xF4, 0x1F, 0x51, 0xF4,
+  0x2F, 0x42, 0xF4, 0x22, 0xC4, 0x22, 0xD4, 0x22, 0xC5, 0x21, 0xD4, 0xF2,
+  0x4F, 0x14, 0xF2, 0x4F, 0x24, 0xF1, 0x4F, 0x24, 0xF2, 0x4F, 0x14, 0xF2,
+  0x4F, 0x15, 0xF1, 0x4F, 0x24, 0xF1, 0x5F, 0x14, 0xF2, 0x4F, 0x15, 0xF1,
+  0x4F, 0x24, 0xF1, 0x5F, 0x14, 0xF1, 0x5F, 0x15, 0xA0, 0x78, 0xB3, 0x45,
+  0x74, 0x74, 0x54, 0x85, 0x44, 0x95, 0x25, 0x95, 0x25, 0x95, 0x26, 0x85,
+  0x26, 0x85, 0x27, 0x74, 0x38, 0x55, 0x49, 0x34, 0x5E, 0x8B, 0xAD, 0x9D,
+  0xAC, 0x9D, 0x63, 0x1C, 0x35, 0x3A, 0x25, 0x59, 0x25, 0x6E, 0x8D, 0x9C,
+  0x9C, 0xAB, 0xAB, 0xA5, 0x24, 0xA5, 0x25, 0x85, 0x45, 0x75, 0x55, 0x46,
+  0x7C, 0xB8, 0x70, 0x77, 0xD3, 0x44, 0xA4, 0x54, 0x84, 0x66, 0x55, 0x66,
+  0x46, 0x76, 0x36, 0x76, 0x27, 0x77, 0x17, 0x77, 0x17, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0x81, 0x76, 0x81, 0x76, 0x82, 0x66, 0x82,
+  0x83, 0x85, 0xF2, 0x67, 0x18, 0xE7, 0xE8, 0xE7, 0xE8, 0xE7, 0xE7, 0xF0,
+  0x6F, 0x06, 0xF0, 0x6E, 0x6F, 0x05, 0xE6, 0xE3, 0xF4, 0x24, 0x36, 0x1F,
+  0xF2, 0x16, 0x34, 0xFF, 0xFF, 0x84, 0x36, 0x1F, 0xF2, 0x16, 0x34, 0x20,
+  0x24, 0x46, 0x28, 0x18, 0x18, 0x18, 0x26, 0x44, 0xFF, 0xFF, 0x84, 0x47,
+  0x18, 0x1F, 0xC1, 0x82, 0x76, 0x36, 0x27, 0x26, 0x26, 0x26, 0x25, 0x36,
+  0x17, 0xF9, 0x2F, 0x74, 0xF5, 0x6F, 0x38, 0xF1, 0xAD, 0xAE, 0xAE, 0xAE,
+  0xAE, 0xAE, 0xAE, 0xAF, 0x09, 0xF2, 0x9F, 0x3A, 0xF3, 0xAF, 0x3A, 0xF3,
+  0xAF, 0x3B, 0xF3, 0xAF, 0x3A, 0xF3, 0xAF, 0x38, 0xF5, 0x6F, 0x74, 0xF9,
+  0x20, 0x0F, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xFA, 0x02, 0xF9, 0x4F, 0x76, 0xF5, 0x8F, 0x3A,
+  0xF3, 0xAF, 0x3A, 0xF3, 0xBF, 0x3A, 0xF3, 0xAF, 0x3A, 0xF3, 0xAF, 0x39,
+  0xF2, 0x9F, 0x0A, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xDA, 0xF1, 0x8F,
+  0x36, 0xF5, 0x4F, 0x72, 0xF9, 0x57, 0x9B, 0x63, 0x46, 0x43, 0x66, 0x24,
+  0x67, 0x15, 0x66, 0x16, 0x5D, 0x5D, 0x57, 0x15, 0x57, 0x14, 0x67, 0xA7,
+  0xB7, 0xA7, 0xB6, 0xB5, 0xD4, 0xD3, 0xF0, 0x2F, 0x11, 0xF2, 0x1F, 0x21,
+  0xFF, 0xFF, 0xFD, 0x4D, 0x6B, 0x8A, 0x8A, 0x8A, 0x8B, 0x6D, 0x48, 0xE8,
+  0xF6, 0xF0, 0xF2, 0x58, 0x4E, 0x5C, 0x4B, 0x4F, 0x13, 0x94, 0xF3, 0x37,
+  0x4F, 0x52, 0x65, 0xF6, 0x24, 0x5B, 0x44, 0x21, 0x33, 0x59, 0x61, 0x43,
+  0x22, 0x59, 0x52, 0x53, 0x22, 0x58, 0x44, 0x54, 0x21, 0x57, 0x54, 0x45,
+  0x78, 0x45, 0x45, 0x77, 0x46, 0x45, 0x76, 0x55, 0x46, 0x76, 0x46, 0x46,
+  0x76, 0x46, 0x46, 0x75, 0x46, 0x56, 0x75, 0x46, 0x46, 0x21, 0x55, 0x45,
+  0x56, 0x21, 0x55, 0x44, 0x11, 0x45, 0x23, 0x54, 0x52, 0x21, 0x45, 0x23,
+  0x55, 0x72, 0x43, 0x35, 0x46, 0x44, 0x96, 0x5F, 0x05, 0x94, 0xFE, 0x5F,
+  0xE5, 0xFE, 0x5F, 0xF0, 0x5E, 0x2D, 0x69, 0x5F, 0x0F, 0x1F, 0x5A, 0xA0,
+  0xF0, 0x2F, 0xE3, 0xFE, 0x3F, 0xE4, 0xFC, 0x5F, 0xC6, 0xFA, 0x7F, 0xA7,
+  0xFA, 0x8F, 0x89, 0xF8, 0xAF, 0x62, 0x18, 0xF6, 0x22, 0x7F, 0x62, 0x28,
+  0xF4, 0x24, 0x7F, 0x42, 0x48, 0xF2, 0x25, 0x8F, 0x22, 0x68, 0xF1, 0x26,
+  0x8F, 0x02, 0x87, 0xF0, 0x28, 0x8D, 0x38, 0x8D, 0xF5, 0xCF, 0x5B, 0x3A,
+  0x8B, 0x2C, 0x89, 0x3C, 0x89, 0x2E, 0x88, 0x2E, 0x87, 0x3E, 0x96, 0x3E,
+  0x94, 0x6D, 0xA2, 0x98, 0xF0, 0x0F, 0x58, 0xF8, 0x8A, 0x47, 0x88, 0x68,
+  0x68, 0x68, 0x68, 0x78, 0x58, 0x78, 0x58, 0x78, 0x58, 0x78, 0x58, 0x78,
+  0x58, 0x77, 0x68, 0x68, 0x68, 0x66, 0x88, 0x46, 0xAF, 0x0D, 0xF3, 0xA8,
+  0x48, 0x88, 0x68, 0x68, 0x78, 0x58, 0x78, 0x58, 0x88, 0x48, 0x88, 0x48,
+  0x88, 0x48, 0x88, 0x48, 0x88, 0x48, 0x88, 0x48, 0x87, 0x58, 0x78, 0x58,
+  0x77, 0x69, 0x47, 0x6F, 0x65, 0xF5, 0x80, 0xC8, 0x81, 0xAD, 0x52, 0x96,
+  0x56, 0x22, 0x76, 0x98, 0x66, 0xC6, 0x56, 0xE5, 0x47, 0xF0, 0x44, 0x6F,
+  0x14, 0x37, 0xF2, 0x33, 0x7F, 0x32, 0x28, 0xF3, 0x22, 0x7F, 0x51, 0x27,
+  0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x78,
+  0xF7, 0x8F, 0x87, 0xF8, 0x8F, 0x78, 0xF8, 0x7F, 0x87, 0xF4, 0x14, 0x7F,
+  0x23, 0x47, 0xF0, 0x36, 0x6E, 0x38, 0x6B, 0x4A, 0x77, 0x4E, 0xF0, 0xF3,
+  0x99, 0x0F, 0x4F, 0x0F, 0x6D, 0x94, 0x8B, 0x87, 0x7A, 0x88, 0x88, 0x89,
+  0x78, 0x8A, 0x77, 0x8A, 0x86, 0x8B, 0x76, 0x8B, 0x85, 0x8B, 0x85, 0x8C,
+  0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C,
+  0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x75, 0x8C, 0x75, 0x8B, 0x85, 0x8B,
+  0x76, 0x8B, 0x76, 0x8A, 0x77, 0x8A, 0x68, 0x89, 0x69, 0x88, 0x6A, 0x95,
+  0x7A, 0xF5, 0x9F, 0x5C, 0x0F, 0xB4, 0xF9, 0x58, 0x87, 0x58, 0xB4, 0x58,
+  0xC3, 0x58, 0xD2, 0x58, 0xD2, 0x58, 0xE1, 0x58, 0x71, 0x61, 0x58, 0x71,
+  0xC8, 0x62, 0xC8, 0x62, 0xC8, 0x53, 0xC8, 0x44, 0xCF, 0x1C, 0xF1, 0xC8,
+  0x35, 0xC8, 0x53, 0xC8, 0x62, 0xC8, 0x62, 0xC8, 0x71, 0xC8, 0x71, 0xC8,
+  0xF1, 0x13, 0x8F, 0x02, 0x38, 0xE3, 0x38, 0xE3, 0x38, 0xD3, 0x48, 0xC4,
+  0x48, 0xB5, 0x3A, 0x78, 0x1F, 0xC1, 0xFC, 0x10, 0x0F, 0xA2, 0xF8, 0x39,
+  0x76, 0x38, 0xA4, 0x38, 0xB3, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xD1, 0x38,
+  0x71, 0x51, 0x38, 0x71, 0x98, 0x62, 0x98, 0x62, 0x98, 0x53, 0x98, 0x35,
+  0x9F, 0x19, 0xF1, 0x98, 0x35, 0x98, 0x53, 0x98, 0x62, 0x98, 0x62, 0x98,
+  0x71, 0x98, 0x71, 0x98, 0xF2, 0x8F, 0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x8F,
+  0x28, 0xF2, 0x8F, 0x1A, 0xDF, 0x0A, 0xC8, 0x81, 0xDD, 0x52, 0xC6, 0x55,
+  0x32, 0xA6, 0x98, 0x96, 0xC6, 0x86, 0xE5, 0x77, 0xF0, 0x47, 0x6F, 0x23,
+  0x67, 0xF2, 0x36, 0x7F, 0x32, 0x58, 0xF3, 0x25, 0x7F, 0x51, 0x57, 0xFA,
+  0x8F, 0xA8, 0xFA, 0x8F, 0xA8, 0xFA, 0x8F, 0xA8, 0xFA, 0x8F, 0xA8, 0xAF,
+  0x8D, 0xA3, 0x7E, 0x84, 0x8D, 0x84, 0x8D, 0x85, 0x7D, 0x85, 0x7D, 0x86,
+  0x7C, 0x87, 0x6C, 0x88, 0x6B, 0x89, 0x6A, 0x8A, 0x76, 0x9D, 0xF2, 0xF4,
+  0xAB, 0x0E, 0x5E, 0x2A, 0x9A, 0x58, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68,
+  0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68,
+  0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x6F, 0xC6, 0xFC, 0x68, 0xB8,
+  0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8,
+  0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8, 0x68, 0xB8,
+  0x5A, 0x9A, 0x2E, 0x5E, 0x0F, 0x02, 0xA6, 0x87, 0x87, 0x87, 0x87, 0x87,
+  0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+  0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0xA3,
+  0xF0, 0x7F, 0x0A, 0xAD, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+  0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+  0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x84, 0x46, 0x83, 0x65, 0x83, 0x65, 0x74,
+  0x65, 0x74, 0x65, 0x75, 0x45, 0x76, 0x54, 0x68, 0xDC, 0x7A, 0x0E, 0x5D,
+  0x4A, 0xA8, 0x78, 0xC4, 0xA8, 0xC3, 0xB8, 0xB3, 0xC8, 0xA3, 0xD8, 0x93,
+  0xE8, 0x83, 0xF0, 0x87, 0x3F, 0x18, 0x63, 0xF2, 0x85, 0x3F, 0x38, 0x43,
+  0xF4, 0x83, 0x4F, 0x48, 0x26, 0xF3, 0x81, 0x7F, 0x3F, 0x2F, 0x2F, 0x3F,
+  0x19, 0x19, 0xF0, 0x82, 0xAE, 0x83, 0x9E, 0x84, 0x9D, 0x85, 0x9C, 0x86,
+  0x9B, 0x86, 0xAA, 0x87, 0x9A, 0x88, 0x99, 0x89, 0x98, 0x8A, 0x97, 0x8A,
+  0xA6, 0x8B, 0x95, 0xAA, 0xA2, 0xE4, 0xF1, 0x0F, 0x0F, 0x0A, 0xF4, 0x8F,
+  0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F,
+  0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F,
+  0x58, 0xF5, 0x8F, 0x58, 0xF1, 0x13, 0x8F, 0x02, 0x38, 0xF0, 0x23, 0x8E,
+  0x33, 0x8E, 0x33, 0x8D, 0x34, 0x8C, 0x44, 0x8A, 0x63, 0xA7, 0x81, 0xFC,
+  0x1F, 0xC1, 0x1B, 0xF4, 0xC4, 0x9F, 0x3A, 0x78, 0xF2, 0xA8, 0x8F, 0x2A,
+  0x89, 0xF1, 0x11, 0x88, 0x11, 0x7F, 0x02, 0x18, 0x81, 0x18, 0xE2, 0x18,
+  0x81, 0x27, 0xD2, 0x28, 0x81, 0x28, 0xC2, 0x28, 0x81, 0x37, 0xB2, 0x38,
+  0x81, 0x38, 0xA2, 0x38, 0x81, 0x38, 0xA1, 0x48, 0x81, 0x47, 0x92, 0x48,
+  0x81, 0x48, 0x82, 0x48, 0x81, 0x57, 0x72, 0x58, 0x81, 0x58, 0x62, 0x58,
+  0x81, 0x67, 0x52, 0x68, 0x81, 0x68, 0x42, 0x68, 0x81, 0x68, 0x32, 0x78,
+  0x81, 0x77, 0x32, 0x78, 0x81, 0x78, 0x22, 0x78, 0x81, 0x87, 0x12, 0x88,
+  0x81, 0x8A, 0x88, 0x81, 0x98, 0x98, 0x81, 0x98, 0x98, 0x81, 0xA6, 0xA8,
+  0x81, 0xA6, 0xA8, 0x81, 0xA6, 0xA8, 0x81, 0xB4, 0xB8, 0x82, 0xA4, 0xB8,
+  0x65, 0xA2, 0xBA, 0x2B, 0x72, 0x9E, 0x0A, 0xC9, 0x1A, 0xD5, 0x4A, 0xD3,
+  0x6A, 0xD2, 0x79, 0xD2, 0x7A, 0xC2, 0x7B, 0xB2, 0x7C, 0xA2, 0x72, 0x1A,
+  0x92, 0x72, 0x29, 0x92, 0x72, 0x39, 0x82, 0x72, 0x49, 0x72, 0x72, 0x59,
+  0x62, 0x72, 0x5A, 0x52, 0x72, 0x69, 0x52, 0x72, 0x79, 0x42, 0x72, 0x89,
+  0x32, 0x72, 0x99, 0x22, 0x72, 0xA9, 0x12, 0x72, 0xA9, 0x12, 0x72, 0xBB,
+  0x72, 0xCA, 0x72, 0xD9, 0x72, 0xE8, 0x72, 0xF0, 0x77, 0x2F, 0x07, 0x72,
+  0xF1, 0x67, 0x2F, 0x25, 0x72, 0xF3, 0x47, 0x3F, 0x33, 0x56, 0xF2, 0x33,
+  0xAF, 0x12, 0x30, 0xC9, 0xF6, 0xF0, 0xF2, 0x65, 0x7D, 0x69, 0x6B, 0x6B,
+  0x69, 0x6C, 0x77, 0x7D, 0x76, 0x6E, 0x75, 0x7F, 0x07, 0x38, 0xF0, 0x73,
+  0x8F, 0x08, 0x27, 0xF2, 0x71, 0x8F, 0x27, 0x18, 0xF2, 0xF1, 0xF2, 0xF1,
+  0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1,
+  0xF2, 0x81, 0x7F, 0x27, 0x27, 0xF1, 0x82, 0x8F, 0x08, 0x37, 0xF0, 0x74,
+  0x7F, 0x07, 0x57, 0xD7, 0x76, 0xD6, 0x96, 0xB6, 0xB6, 0x96, 0xD7, 0x57,
+  0xF1, 0xF0, 0xF6, 0x9C, 0x0F, 0x48, 0xF6, 0x78, 0x48, 0x68, 0x67, 0x58,
+  0x68, 0x48, 0x77, 0x48, 0x78, 0x38, 0x78, 0x38, 0x78, 0x38, 0x78, 0x38,
+  0x78, 0x38, 0x78, 0x38, 0x77, 0x48, 0x68, 0x48, 0x67, 0x58, 0x48, 0x6F,
+  0x38, 0xF1, 0xA8, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38,
+  0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x2A, 0xEE, 0xC0, 0xC9,
+  0xF6, 0xF0, 0xF2, 0x65, 0x6E, 0x69, 0x6B, 0x6B, 0x69, 0x6C, 0x77, 0x7D,
+  0x76, 0x6E, 0x75, 0x7F, 0x07, 0x47, 0xF0, 0x73, 0x8F, 0x08, 0x27, 0xF2,
+  0x72, 0x7F, 0x27, 0x18, 0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1,
+  0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0xF1, 0xF2, 0x81, 0x7F, 0x27,
+  0x27, 0xF1, 0x82, 0x8F, 0x08, 0x37, 0xF0, 0x74, 0x7F, 0x07, 0x57, 0xD7,
+  0x76, 0xD6, 0x96, 0xB6, 0xB6, 0x96, 0xD6, 0x75, 0xF3, 0xDF, 0x6A, 0xF9,
+  0xAF, 0x8B, 0xF8, 0xBF, 0x8B, 0xF8, 0xCF, 0x8F, 0x1F, 0x59, 0x40, 0x0F,
+  0x4D, 0xF6, 0xC9, 0x48, 0xA8, 0x77, 0x98, 0x78, 0x88, 0x87, 0x88, 0x88,
+  0x78, 0x88, 0x78, 0x88, 0x78, 0x88, 0x78, 0x88, 0x78, 0x88, 0x78, 0x87,
+  0x88, 0x78, 0x88, 0x68, 0x98, 0x48, 0xBF, 0x3D, 0xF2, 0xE8, 0x28, 0xD8,
+  0x28, 0xD8, 0x38, 0xC8, 0x39, 0xB8, 0x49, 0xA8, 0x58, 0xA8, 0x59, 0x98,
+  0x69, 0x88, 0x78, 0x88, 0x79, 0x78, 0x89, 0x68, 0x99, 0x4A, 0x89, 0x2E,
+  0x7A, 0x67, 0x61, 0x5C, 0x22, 0x45, 0x57, 0x34, 0x95, 0x24, 0xB4, 0x24,
+  0xC3, 0x15, 0xC3, 0x15, 0xD2, 0x15, 0xD2, 0x16, 0xD1, 0x17, 0xE9, 0xCB,
+  0xBC, 0x9E, 0x8F, 0x07, 0xF0, 0x7F, 0x08, 0xE9, 0xCB, 0xBC, 0x9D, 0x9E,
+  0x7E, 0x8E, 0x7E, 0x8D, 0x41, 0x3D, 0x41, 0x4B, 0x42, 0x59, 0x52, 0x76,
+  0x53, 0x13, 0xC5, 0x16, 0x77, 0x0F, 0xFF, 0xF2, 0x48, 0x4A, 0x68, 0x67,
+  0x78, 0x75, 0x88, 0x84, 0x88, 0x83, 0x98, 0x92, 0x98, 0x91, 0xA8, 0xF5,
+  0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5,
+  0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF5,
+  0x8F, 0x58, 0xF5, 0x8F, 0x58, 0xF4, 0xAF, 0x0F, 0x16, 0x0F, 0x06, 0x92,
+  0xAB, 0x55, 0x8D, 0x36, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26,
+  0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26,
+  0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26,
+  0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26, 0x8E, 0x26,
+  0x8D, 0x28, 0x8C, 0x28, 0x8C, 0x29, 0x7B, 0x2B, 0x79, 0x3C, 0x85, 0x4F,
+  0x0D, 0xF4, 0x9A, 0x0F, 0x17, 0xA2, 0xBD, 0x55, 0x9F, 0x03, 0x78, 0xF0,
+  0x29, 0x8D, 0x39, 0x8D, 0x2A, 0x8D, 0x2B, 0x8B, 0x2C, 0x8B, 0x2D, 0x8A,
+  0x2D, 0x89, 0x2F, 0x08, 0x82, 0xF0, 0x87, 0x2F, 0x18, 0x72, 0xF2, 0x86,
+  0x2F, 0x28, 0x52, 0xF4, 0x84, 0x2F, 0x48, 0x33, 0xF4, 0x83, 0x2F, 0x68,
+  0x22, 0xF6, 0x81, 0x2F, 0x8A, 0xF8, 0xAF, 0x98, 0xFA, 0x8F, 0xA7, 0xFC,
+  0x6F, 0xC6, 0xFD, 0x4F, 0xE4, 0xFF, 0x02, 0xFF, 0x12, 0xF0, 0x0D, 0x4F,
+  0x04, 0x91, 0xA8, 0xA9, 0x54, 0x8A, 0x8B, 0x36, 0x7B, 0x7B, 0x36, 0x8A,
+  0x8A, 0x36, 0x8A, 0x8A, 0x28, 0x7B, 0x7A, 0x28, 0x8A, 0x79, 0x38, 0x89,
+  0x98, 0x2A, 0x79, 0x98, 0x2A, 0x88, 0x97, 0x3A, 0x87, 0x21, 0x86, 0x2C,
+  0x77, 0x22, 0x76, 0x2C, 0x86, 0x22, 0x75, 0x3C, 0x85, 0x23, 0x84, 0x2E,
+  0x75, 0x24, 0x74, 0x2E, 0x83, 0x25, 0x73, 0x3F, 0x07, 0x32, 0x67, 0x22,
+  0xF1, 0x73, 0x26, 0x72, 0x2F, 0x18, 0x12, 0x77, 0x13, 0xF2, 0x71, 0x28,
+  0x61, 0x2F, 0x39, 0x99, 0xF3, 0x99, 0x9F, 0x48, 0xA7, 0xF5, 0x7B, 0x7F,
+  0x57, 0xB7, 0xF6, 0x6C, 0x5F, 0x75, 0xD5, 0xF7, 0x5D, 0x5F, 0x83, 0xF0,
+  0x3F, 0x93, 0xF0, 0x3F, 0x93, 0xF0, 0x3F, 0xA1, 0xF2, 0x1D, 0x0F, 0x14,
+  0xC2, 0xBA, 0x66, 0xAA, 0x49, 0x9A, 0x3A, 0x9A, 0x2C, 0x98, 0x3D, 0x96,
+  0x3E, 0x96, 0x2F, 0x19, 0x42, 0xF3, 0x92, 0x3F, 0x39, 0x22, 0xF5, 0xBF,
+  0x7A, 0xF7, 0x9F, 0x99, 0xF9, 0x8F, 0x99, 0xF9, 0x9F, 0x7A, 0xF7, 0xBF,
+  0x52, 0x28, 0xF4, 0x23, 0x9F, 0x23, 0x49, 0xF1, 0x26, 0x8F, 0x02, 0x79,
+  0xD3, 0x89, 0xB3, 0xA8, 0xA3, 0xB9, 0x93, 0xC9, 0x74, 0xC9, 0x57, 0xAB,
+  0x2C, 0x4F, 0x10, 0x0F, 0x16, 0xA1, 0xBD, 0x64, 0x9E, 0x36, 0x9E, 0x37,
+  0x8D, 0x38, 0x9C, 0x2A, 0x8C, 0x2A, 0x9A, 0x2C, 0x89, 0x3D, 0x88, 0x2E,
+  0x87, 0x2F, 0x18, 0x62, 0xF1, 0x94, 0x2F, 0x38, 0x33, 0xF3, 0x92, 0x2F,
+  0x58, 0x12, 0xF6, 0xBF, 0x79, 0xF8, 0x9F, 0x98, 0xF9, 0x8F, 0x98, 0xF9,
+  0x8F, 0x98, 0xF9, 0x8F, 0x98, 0xF9, 0x8F, 0x98, 0xF9, 0x8F, 0x98, 0xF8,
+  0xAF, 0x5E, 0x90, 0x2F, 0xA3, 0xF9, 0x47, 0x89, 0x45, 0xA8, 0x53, 0xB9,
+  0x53, 0xB8, 0x62, 0xB8, 0x63, 0xA9, 0x62, 0xB8, 0x72, 0xA9, 0xF3, 0x9F,
+  0x48, 0xF4, 0x9F, 0x48, 0xF4, 0x9F, 0x39, 0xF4, 0x8F, 0x49, 0xF3, 0x9F,
+  0x48, 0xF4, 0x9F, 0x48, 0xD1, 0x59, 0xC2, 0x49, 0xD2, 0x48, 0xE2, 0x39,
+  0xD3, 0x38, 0xD4, 0x29, 0xC4, 0x29, 0xC5, 0x28, 0xA8, 0x1F, 0xC1, 0xFC,
+  0x10, 0x0F, 0xD5, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0xF7, 0x04, 0xB5, 0xB4, 0xB4, 0xB5, 0xB4, 0xB4, 0xB5, 0xB4, 0xB4,
+  0xB5, 0xB4, 0xB4, 0xB5, 0xB4, 0xB4, 0xB5, 0xB4, 0xB4, 0xB5, 0xB4, 0xB4,
+  0xB4, 0xC4, 0xB4, 0xB4, 0xC4, 0xB4, 0xB4, 0xC4, 0xB4, 0xB4, 0xC4, 0x0F,
+  0x75, 0x66, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0xFC,
+  0x94, 0xF1, 0x5F, 0x16, 0xE7, 0xE8, 0xC4, 0x14, 0xC4, 0x24, 0xA4, 0x34,
+  0xA4, 0x44, 0x84, 0x54, 0x84, 0x64, 0x64, 0x74, 0x64, 0x84, 0x44, 0x94,
+  0x44, 0x95, 0x24, 0xB4, 0x24, 0xB5, 0x0F, 0xFF, 0xFC, 0x13, 0x75, 0x66,
+  0x56, 0x75, 0x75, 0x84, 0x84, 0x93, 0x68, 0xCC, 0x85, 0x46, 0x74, 0x66,
+  0x55, 0x75, 0x56, 0x66, 0x46, 0x66, 0x46, 0x66, 0x54, 0x76, 0xF1, 0x6E,
+  0x8B, 0xB9, 0x52, 0x67, 0x54, 0x65, 0x65, 0x64, 0x66, 0x64, 0x66, 0x63,
+  0x76, 0x63, 0x76, 0x63, 0x75, 0x73, 0x83, 0x84, 0xB1, 0x91, 0xA3, 0x65,
+  0x65, 0x53, 0x09, 0xF3, 0x7F, 0x46, 0xF4, 0x6F, 0x46, 0xF4, 0x6F, 0x46,
+  0xF4, 0x6F, 0x46, 0xF4, 0x63, 0x79, 0x61, 0xB7, 0x84, 0x76, 0x76, 0x75,
+  0x68, 0x65, 0x68, 0x74, 0x68, 0x74, 0x69, 0x73, 0x69, 0x73, 0x69, 0x73,
+  0x69, 0x73, 0x69, 0x73, 0x69, 0x73, 0x69, 0x73, 0x69, 0x73, 0x69, 0x64,
+  0x69, 0x64, 0x68, 0x74, 0x68, 0x65, 0x68, 0x65, 0x76, 0x66, 0x32, 0x34,
+  0x67, 0x24, 0xA9, 0x17, 0x68, 0x86, 0xBA, 0x75, 0x35, 0x55, 0x55, 0x35,
+  0x65, 0x35, 0x65, 0x25, 0x75, 0x25, 0x83, 0x35, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD7, 0xC7, 0xD7, 0xC7, 0xD7, 0x81, 0x48, 0x52, 0x4E, 0x7A,
+  0xB6, 0x60, 0xBA, 0xF2, 0x7F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36,
+  0xF3, 0x6F, 0x36, 0x96, 0x36, 0x89, 0x16, 0x67, 0x38, 0x66, 0x57, 0x56,
+  0x76, 0x47, 0x76, 0x46, 0x86, 0x46, 0x86, 0x37, 0x86, 0x37, 0x86, 0x37,
+  0x86, 0x37, 0x86, 0x37, 0x86, 0x37, 0x86, 0x37, 0x86, 0x37, 0x86, 0x37,
+  0x86, 0x46, 0x86, 0x47, 0x76, 0x56, 0x67, 0x56, 0x67, 0x66, 0x49, 0x6A,
+  0x19, 0x66, 0x33, 0x60, 0x66, 0xAA, 0x74, 0x44, 0x55, 0x45, 0x44, 0x64,
+  0x35, 0x65, 0x25, 0x65, 0x16, 0x65, 0x16, 0x6F, 0xFF, 0x3C, 0x6C, 0x6C,
+  0x6C, 0x7B, 0x7C, 0x6C, 0x78, 0x22, 0x67, 0x23, 0x84, 0x25, 0xC7, 0xAA,
+  0x66, 0x86, 0x9A, 0x65, 0x33, 0x55, 0x44, 0x45, 0x35, 0x36, 0x35, 0x36,
+  0x43, 0x46, 0xB6, 0xB6, 0xB6, 0x8D, 0x4D, 0x76, 0xB6, 0xB6, 0xB6, 0xB6,
+  0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+  0xB6, 0xA8, 0x7D, 0x40, 0x57, 0xAF, 0x12, 0x54, 0x81, 0x56, 0x44, 0x56,
+  0x52, 0x66, 0x61, 0x66, 0x61, 0x66, 0x61, 0x66, 0x61, 0x66, 0x62, 0x56,
+  0x62, 0x56, 0x54, 0x54, 0x65, 0x43, 0x68, 0x99, 0x2F, 0x03, 0xF0, 0x4F,
+  0x05, 0xDF, 0x04, 0xF2, 0x2F, 0x32, 0xF3, 0x2F, 0x24, 0xF0, 0x14, 0xA8,
+  0xC7, 0xC7, 0xB3, 0x25, 0x83, 0x4E, 0x79, 0x60, 0x09, 0xF2, 0x7F, 0x36,
+  0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x64, 0x68,
+  0x62, 0x97, 0x61, 0xB6, 0x93, 0x66, 0x76, 0x65, 0x67, 0x65, 0x67, 0x65,
+  0x67, 0x65, 0x67, 0x65, 0x67, 0x65, 0x67, 0x65, 0x67, 0x65, 0x67, 0x65,
+  0x67, 0x65, 0x67, 0x65, 0x67, 0x65, 0x67, 0x65, 0x67, 0x65, 0x67, 0x65,
+  0x67, 0x65, 0x67, 0x64, 0x85, 0x81, 0xB3, 0xA0, 0x44, 0x56, 0x48, 0x38,
+  0x38, 0x47, 0x64, 0xFF, 0xF2, 0x94, 0x75, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x64, 0x81, 0xB0, 0x93, 0x97, 0x68, 0x68, 0x68, 0x77, 0x85, 0xFF, 0xFF,
+  0x29, 0x77, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+  0x13, 0x4B, 0x35, 0x15, 0x35, 0x14, 0x45, 0x14, 0x35, 0x3A, 0x66, 0x50,
+  0x09, 0xF3, 0x7F, 0x46, 0xF4, 0x6F, 0x46, 0xF4, 0x6F, 0x46, 0xF4, 0x6F,
+  0x46, 0xF4, 0x6F, 0x46, 0x4A, 0x56, 0x66, 0x76, 0x73, 0x96, 0x72, 0xA6,
+  0x62, 0xB6, 0x52, 0xC6, 0x42, 0xD6, 0x33, 0xD6, 0x24, 0xD6, 0x16, 0xCE,
+  0xBE, 0xB6, 0x27, 0xA6, 0x37, 0x96, 0x37, 0x96, 0x47, 0x86, 0x57, 0x76,
+  0x58, 0x66, 0x67, 0x66, 0x68, 0x48, 0x59, 0x1B, 0x3B, 0x09, 0x47, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x48, 0x1B, 0xD6, 0x76, 0x59, 0x29, 0x49, 0x67, 0x1B,
+  0x2B, 0x68, 0x4A, 0x36, 0x67, 0x67, 0x66, 0x56, 0x76, 0x76, 0x56, 0x76,
+  0x76, 0x56, 0x76, 0x76, 0x56, 0x76, 0x76, 0x56, 0x76, 0x76, 0x56, 0x76,
+  0x76, 0x56, 0x76, 0x76, 0x56, 0x76, 0x76, 0x56, 0x76, 0x76, 0x56, 0x76,
+  0x76, 0x56, 0x76, 0x76, 0x56, 0x76, 0x76, 0x56, 0x76, 0x76, 0x56, 0x76,
+  0x76, 0x56, 0x76, 0x76, 0x56, 0x76, 0x76, 0x48, 0x58, 0x58, 0x1B, 0x3A,
+  0x3A, 0xD6, 0x59, 0x29, 0x67, 0x1B, 0x69, 0x36, 0x67, 0x66, 0x56, 0x76,
+  0x56, 0x76, 0x56, 0x76, 0x56, 0x76, 0x56, 0x76, 0x56, 0x76, 0x56, 0x76,
+  0x56, 0x76, 0x56, 0x76, 0x56, 0x76, 0x56, 0x76, 0x56, 0x76, 0x56, 0x76,
+  0x56, 0x76, 0x56, 0x76, 0x56, 0x76, 0x48, 0x58, 0x1B, 0x3A, 0x77, 0xCB,
+  0x95, 0x35, 0x75, 0x55, 0x56, 0x56, 0x45, 0x75, 0x36, 0x76, 0x26, 0x76,
+  0x17, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x77, 0x16, 0x76, 0x26,
+  0x76, 0x35, 0x75, 0x46, 0x56, 0x55, 0x55, 0x75, 0x35, 0x9B, 0xC7, 0x70,
+  0xC6, 0x69, 0x1A, 0x6A, 0x36, 0x67, 0x66, 0x57, 0x66, 0x56, 0x77, 0x46,
+  0x86, 0x46, 0x87, 0x36, 0x87, 0x36, 0x87, 0x36, 0x87, 0x36, 0x87, 0x36,
+  0x87, 0x36, 0x87, 0x36, 0x87, 0x36, 0x87, 0x36, 0x86, 0x46, 0x86, 0x46,
+  0x77, 0x46, 0x76, 0x57, 0x56, 0x68, 0x37, 0x66, 0x19, 0x86, 0x36, 0x96,
+  0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x28, 0xED, 0xB0, 0x85,
+  0x71, 0x8A, 0x42, 0x76, 0x33, 0x23, 0x66, 0x57, 0x56, 0x76, 0x56, 0x76,
+  0x47, 0x76, 0x46, 0x86, 0x46, 0x86, 0x37, 0x86, 0x37, 0x86, 0x37, 0x86,
+  0x37, 0x86, 0x37, 0x86, 0x37, 0x86, 0x37, 0x86, 0x37, 0x86, 0x46, 0x86,
+  0x47, 0x76, 0x47, 0x76, 0x57, 0x57, 0x67, 0x38, 0x7A, 0x16, 0x96, 0x36,
+  0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF2, 0x8E, 0xC0,
+  0xD4, 0x29, 0x27, 0x37, 0x19, 0x3F, 0x13, 0x82, 0x63, 0x74, 0x44, 0x6D,
+  0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+  0x6D, 0x6C, 0x89, 0xC7, 0x45, 0x41, 0x4B, 0x33, 0x45, 0x23, 0x73, 0x14,
+  0x82, 0x14, 0x82, 0x15, 0x81, 0x16, 0x98, 0x7A, 0x6B, 0x4C, 0x4C, 0x5A,
+  0x79, 0x88, 0x88, 0x87, 0x96, 0x97, 0x83, 0x15, 0x44, 0x22, 0x19, 0x31,
+  0x46, 0x40, 0x71, 0xC2, 0xB3, 0xB3, 0xA4, 0x95, 0x86, 0x77, 0x6C, 0x2C,
+  0x46, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x86, 0x86, 0x41, 0x36, 0x41, 0x37, 0x22, 0x49, 0x58, 0x75,
+  0x50, 0x09, 0x49, 0x57, 0x67, 0x66, 0x76, 0x66, 0x76, 0x66, 0x76, 0x66,
+  0x76, 0x66, 0x76, 0x66, 0x76, 0x66, 0x76, 0x66, 0x76, 0x66, 0x76, 0x66,
+  0x76, 0x66, 0x76, 0x66, 0x76, 0x66, 0x76, 0x66, 0x76, 0x66, 0x76, 0x66,
+  0x76, 0x66, 0x67, 0x67, 0x49, 0x6B, 0x19, 0x59, 0x25, 0xA6, 0x41, 0x80,
+  0x0C, 0x37, 0x28, 0x74, 0x38, 0x82, 0x57, 0x82, 0x57, 0x72, 0x77, 0x62,
+  0x77, 0x61, 0x96, 0x52, 0x97, 0x42, 0x97, 0x32, 0xB7, 0x22, 0xB7, 0x21,
+  0xD6, 0x12, 0xD9, 0xD8, 0xF0, 0x7F, 0x07, 0xF1, 0x5F, 0x25, 0xF2, 0x4F,
+  0x43, 0xF4, 0x3F, 0x51, 0xA0, 0x0B, 0x2B, 0x27, 0x19, 0x57, 0x63, 0x47,
+  0x67, 0x63, 0x56, 0x76, 0x62, 0x67, 0x66, 0x62, 0x67, 0x67, 0x51, 0x86,
+  0x67, 0x42, 0x87, 0x48, 0x42, 0x96, 0x48, 0x41, 0xA6, 0x41, 0x26, 0x22,
+  0xA7, 0x22, 0x26, 0x22, 0xB6, 0x22, 0x26, 0x12, 0xC9, 0x48, 0xC9, 0x47,
+  0xE7, 0x57, 0xE7, 0x57, 0xF0, 0x66, 0x5F, 0x15, 0x75, 0xF1, 0x57, 0x5F,
+  0x24, 0x83, 0xF3, 0x39, 0x3F, 0x33, 0x93, 0xF4, 0x1B, 0x1A, 0x0C, 0x28,
+  0x19, 0x64, 0x48, 0x63, 0x67, 0x62, 0x78, 0x42, 0x97, 0x32, 0xB7, 0x13,
+  0xBA, 0xD8, 0xE8, 0xF0, 0x8F, 0x07, 0xF0, 0x8D, 0xAC, 0x21, 0x7B, 0x22,
+  0x89, 0x24, 0x78, 0x35, 0x77, 0x26, 0x85, 0x37, 0x74, 0x47, 0x81, 0x83,
+  0xB0, 0x0B, 0x37, 0x18, 0x74, 0x37, 0x82, 0x47, 0x72, 0x66, 0x72, 0x67,
+  0x62, 0x67, 0x52, 0x86, 0x52, 0x87, 0x42, 0x87, 0x32, 0xA6, 0x32, 0xA7,
+  0x22, 0xB6, 0x12, 0xC9, 0xC8, 0xE7, 0xE7, 0xF0, 0x5F, 0x15, 0xF1, 0x5F,
+  0x23, 0xF3, 0x3F, 0x41, 0xF4, 0x2F, 0x42, 0xB3, 0x51, 0xB5, 0x32, 0xB5,
+  0x31, 0xC5, 0x22, 0xD7, 0xF0, 0x4F, 0x1F, 0x31, 0xF3, 0x14, 0x67, 0x22,
+  0x77, 0x32, 0x68, 0x31, 0x77, 0xB8, 0xB7, 0xB7, 0xC7, 0xB7, 0xB8, 0xB7,
+  0xB8, 0xB7, 0xB7, 0x72, 0x28, 0x72, 0x27, 0x72, 0x28, 0x63, 0x27, 0x55,
+  0x1F, 0x31, 0xF3, 0x10, 0x95, 0x76, 0x75, 0x95, 0x85, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x85, 0x94,
+  0x84, 0x95, 0xC4, 0xA5, 0xA5, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xA5, 0x95, 0xA6, 0xA5, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x05, 0xA6, 0xA5, 0x95, 0xA5, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xA5, 0xA4, 0xC4,
+  0xA5, 0x74, 0x95, 0x85, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x85, 0x95, 0x76, 0x75, 0x90, 0x45, 0xF0,
+  0xA7, 0x13, 0xD4, 0x32, 0xF6, 0x13, 0x5C, 0x31, 0x89, 0xF1, 0x53 };
 
 const GFXglyph FreeSerifBold24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
   {     0,   8,  34,  16,    4,  -32 },   // 0x21 '!'
-  {    34,  17,  13,  26,    4,  -32 },   // 0x22 '"'
-  {    62,  23,  33,  23,    0,  -32 },   // 0x23 '#'
-  {   157,  21,  39,  24,    1,  -34 },   // 0x24 '$'
-  {   260,  35,  34,  47,    6,  -32 },   // 0x25 '%'
-  {   409,  34,  34,  39,    3,  -32 },   // 0x26 '&'
-  {   554,   5,  13,  13,    4,  -32 },   // 0x27 '''
-  {   563,  12,  41,  16,    2,  -32 },   // 0x28 '('
-  {   625,  12,  41,  16,    1,  -32 },   // 0x29 ')'
-  {   687,  18,  21,  24,    3,  -32 },   // 0x2A '*'
-  {   735,  26,  25,  32,    3,  -24 },   // 0x2B '+'
-  {   817,   8,  15,  12,    2,   -6 },   // 0x2C ','
-  {   832,  11,   5,  16,    2,  -12 },   // 0x2D '-'
-  {   839,   8,   8,  12,    2,   -6 },   // 0x2E '.'
-  {   847,  15,  33,  13,   -1,  -32 },   // 0x2F '/'
-  {   909,  22,  34,  23,    1,  -32 },   // 0x30 '0'
-  {  1003,  18,  33,  23,    3,  -32 },   // 0x31 '1'
-  {  1078,  21,  33,  24,    1,  -32 },   // 0x32 '2'
-  {  1165,  21,  34,  24,    1,  -32 },   // 0x33 '3'
-  {  1255,  21,  33,  24,    1,  -32 },   // 0x34 '4'
-  {  1342,  20,  32,  23,    2,  -31 },   // 0x35 '5'
-  {  1422,  21,  34,  24,    1,  -32 },   // 0x36 '6'
-  {  1512,  21,  32,  23,    1,  -31 },   // 0x37 '7'
-  {  1596,  21,  34,  23,    1,  -32 },   // 0x38 '8'
-  {  1686,  22,  34,  23,    1,  -32 },   // 0x39 '9'
-  {  1780,   8,  24,  16,    4,  -22 },   // 0x3A ':'
-  {  1804,   9,  31,  16,    3,  -22 },   // 0x3B ';'
-  {  1839,  26,  26,  32,    3,  -24 },   // 0x3C '<'
-  {  1924,  26,  17,  32,    3,  -20 },   // 0x3D '='
-  {  1980,  26,  26,  32,    3,  -24 },   // 0x3E '>'
-  {  2065,  18,  34,  24,    3,  -32 },   // 0x3F '?'
-  {  2142,  33,  34,  44,    5,  -32 },   // 0x40 '@'
-  {  2283,  32,  33,  34,    1,  -32 },   // 0x41 'A'
-  {  2415,  28,  32,  31,    1,  -31 },   // 0x42 'B'
-  {  2527,  30,  34,  33,    2,  -32 },   // 0x43 'C'
-  {  2655,  32,  32,  34,    1,  -31 },   // 0x44 'D'
-  {  2783,  28,  32,  32,    2,  -31 },   // 0x45 'E'
-  {  2895,  25,  32,  29,    2,  -31 },   // 0x46 'F'
-  {  2995,  33,  34,  36,    2,  -32 },   // 0x47 'G'
-  {  3136,  33,  32,  37,    2,  -31 },   // 0x48 'H'
-  {  3268,  15,  32,  18,    2,  -31 },   // 0x49 'I'
-  {  3328,  22,  37,  24,    0,  -31 },   // 0x4A 'J'
-  {  3430,  34,  32,  36,    2,  -31 },   // 0x4B 'K'
-  {  3566,  28,  32,  31,    2,  -31 },   // 0x4C 'L'
-  {  3678,  43,  32,  45,    0,  -31 },   // 0x4D 'M'
-  {  3850,  31,  32,  34,    1,  -31 },   // 0x4E 'N'
-  {  3974,  33,  34,  37,    2,  -32 },   // 0x4F 'O'
-  {  4115,  26,  32,  30,    2,  -31 },   // 0x50 'P'
-  {  4219,  33,  41,  37,    2,  -32 },   // 0x51 'Q'
-  {  4389,  31,  32,  34,    2,  -31 },   // 0x52 'R'
-  {  4513,  21,  34,  27,    3,  -32 },   // 0x53 'S'
-  {  4603,  28,  32,  30,    1,  -31 },   // 0x54 'T'
-  {  4715,  30,  33,  34,    2,  -31 },   // 0x55 'U'
-  {  4839,  33,  32,  33,    0,  -31 },   // 0x56 'V'
-  {  4971,  45,  33,  46,    1,  -31 },   // 0x57 'W'
-  {  5157,  32,  32,  34,    1,  -31 },   // 0x58 'X'
-  {  5285,  32,  32,  33,    1,  -31 },   // 0x59 'Y'
-  {  5413,  28,  32,  30,    1,  -31 },   // 0x5A 'Z'
-  {  5525,  11,  39,  16,    3,  -31 },   // 0x5B '['
-  {  5579,  15,  33,  13,   -1,  -32 },   // 0x5C '\'
-  {  5641,  11,  39,  16,    2,  -31 },   // 0x5D ']'
-  {  5695,  21,  17,  27,    3,  -31 },   // 0x5E '^'
-  {  5740,  24,   3,  23,    0,    5 },   // 0x5F '_'
-  {  5749,  11,   9,  16,    0,  -33 },   // 0x60 '`'
-  {  5762,  22,  24,  23,    1,  -22 },   // 0x61 'a'
-  {  5828,  25,  33,  26,    0,  -31 },   // 0x62 'b'
-  {  5932,  19,  24,  20,    1,  -22 },   // 0x63 'c'
-  {  5989,  24,  33,  26,    1,  -31 },   // 0x64 'd'
-  {  6088,  18,  24,  21,    1,  -22 },   // 0x65 'e'
-  {  6142,  17,  33,  18,    1,  -32 },   // 0x66 'f'
-  {  6213,  19,  32,  24,    2,  -22 },   // 0x67 'g'
-  {  6289,  24,  32,  26,    0,  -31 },   // 0x68 'h'
-  {  6385,  11,  33,  14,    1,  -32 },   // 0x69 'i'
-  {  6431,  14,  42,  18,    0,  -32 },   // 0x6A 'j'
-  {  6505,  25,  32,  26,    0,  -31 },   // 0x6B 'k'
-  {  6605,  11,  32,  13,    0,  -31 },   // 0x6C 'l'
-  {  6649,  37,  23,  39,    0,  -22 },   // 0x6D 'm'
-  {  6756,  24,  23,  26,    0,  -22 },   // 0x6E 'n'
-  {  6825,  21,  24,  24,    1,  -22 },   // 0x6F 'o'
-  {  6888,  24,  32,  26,    0,  -22 },   // 0x70 'p'
-  {  6984,  24,  32,  26,    1,  -22 },   // 0x71 'q'
-  {  7080,  19,  23,  20,    0,  -22 },   // 0x72 'r'
-  {  7135,  15,  24,  19,    2,  -22 },   // 0x73 's'
-  {  7180,  14,  31,  16,    1,  -29 },   // 0x74 't'
-  {  7235,  25,  23,  27,    0,  -21 },   // 0x75 'u'
-  {  7307,  22,  23,  23,    0,  -21 },   // 0x76 'v'
-  {  7371,  33,  23,  33,    0,  -21 },   // 0x77 'w'
-  {  7466,  22,  22,  24,    1,  -21 },   // 0x78 'x'
-  {  7527,  21,  31,  23,    0,  -21 },   // 0x79 'y'
-  {  7609,  19,  22,  21,    1,  -21 },   // 0x7A 'z'
-  {  7662,  14,  42,  19,    1,  -33 },   // 0x7B '{'
-  {  7736,   4,  33,  10,    3,  -32 },   // 0x7C '|'
-  {  7753,  14,  42,  19,    4,  -33 },   // 0x7D '}'
-  {  7827,  22,   7,  24,    1,  -14 } }; // 0x7E '~'
+  {    27,  17,  13,  26,    4,  -32 },   // 0x22 '"'
+  {    49,  23,  33,  23,    0,  -32 },   // 0x23 '#'
+  {   113,  21,  39,  24,    1,  -34 },   // 0x24 '$'
+  {   191,  35,  34,  47,    6,  -32 },   // 0x25 '%'
+  {   291,  34,  34,  39,    3,  -32 },   // 0x26 '&'
+  {   372,   5,  13,  13,    4,  -32 },   // 0x27 '''
+  {   382,  12,  41,  16,    2,  -32 },   // 0x28 '('
+  {   423,  12,  41,  16,    1,  -32 },   // 0x29 ')'
+  {   464,  18,  21,  24,    3,  -32 },   // 0x2A '*'
+  {   502,  26,  25,  32,    3,  -24 },   // 0x2B '+'
+  {   537,   8,  15,  12,    2,   -6 },   // 0x2C ','
+  {   551,  11,   5,  16,    2,  -12 },   // 0x2D '-'
+  {   554,   8,   8,  12,    2,   -6 },   // 0x2E '.'
+  {   561,  15,  33,  13,   -1,  -32 },   // 0x2F '/'
+  {   595,  22,  34,  23,    1,  -32 },   // 0x30 '0'
+  {   657,  18,  33,  23,    3,  -32 },   // 0x31 '1'
+  {   692,  21,  33,  24,    1,  -32 },   // 0x32 '2'
+  {   745,  21,  34,  24,    1,  -32 },   // 0x33 '3'
+  {   793,  21,  33,  24,    1,  -32 },   // 0x34 '4'
+  {   845,  20,  32,  23,    2,  -31 },   // 0x35 '5'
+  {   891,  21,  34,  24,    1,  -32 },   // 0x36 '6'
+  {   942,  21,  32,  23,    1,  -31 },   // 0x37 '7'
+  {   993,  21,  34,  23,    1,  -32 },   // 0x38 '8'
+  {  1047,  22,  34,  23,    1,  -32 },   // 0x39 '9'
+  {  1101,   8,  24,  16,    4,  -22 },   // 0x3A ':'
+  {  1116,   9,  31,  16,    3,  -22 },   // 0x3B ';'
+  {  1141,  26,  26,  32,    3,  -24 },   // 0x3C '<'
+  {  1177,  26,  17,  32,    3,  -20 },   // 0x3D '='
+  {  1193,  26,  26,  32,    3,  -24 },   // 0x3E '>'
+  {  1229,  18,  34,  24,    3,  -32 },   // 0x3F '?'
+  {  1271,  33,  34,  44,    5,  -32 },   // 0x40 '@'
+  {  1368,  32,  33,  34,    1,  -32 },   // 0x41 'A'
+  {  1433,  28,  32,  31,    1,  -31 },   // 0x42 'B'
+  {  1495,  30,  34,  33,    2,  -32 },   // 0x43 'C'
+  {  1561,  32,  32,  34,    1,  -31 },   // 0x44 'D'
+  {  1624,  28,  32,  32,    2,  -31 },   // 0x45 'E'
+  {  1688,  25,  32,  29,    2,  -31 },   // 0x46 'F'
+  {  1746,  33,  34,  36,    2,  -32 },   // 0x47 'G'
+  {  1813,  33,  32,  37,    2,  -31 },   // 0x48 'H'
+  {  1876,  15,  32,  18,    2,  -31 },   // 0x49 'I'
+  {  1909,  22,  37,  24,    0,  -31 },   // 0x4A 'J'
+  {  1954,  34,  32,  36,    2,  -31 },   // 0x4B 'K'
+  {  2023,  28,  32,  31,    2,  -31 },   // 0x4C 'L'
+  {  2078,  43,  32,  45,    0,  -31 },   // 0x4D 'M'
+  {  2190,  31,  32,  34,    1,  -31 },   // 0x4E 'N'
+  {  2271,  33,  34,  37,    2,  -32 },   // 0x4F 'O'
+  {  2344,  26,  32,  30,    2,  -31 },   // 0x50 'P'
+  {  2399,  33,  41,  37,    2,  -32 },   // 0x51 'Q'
+  {  2483,  31,  32,  34,    2,  -31 },   // 0x52 'R'
+  {  2545,  21,  34,  27,    3,  -32 },   // 0x53 'S'
+  {  2597,  28,  32,  30,    1,  -31 },   // 0x54 'T'
+  {  2649,  30,  33,  34,    2,  -31 },   // 0x55 'U'
+  {  2715,  33,  32,  33,    0,  -31 },   // 0x56 'V'
+  {  2782,  45,  33,  46,    1,  -31 },   // 0x57 'W'
+  {  2890,  32,  32,  34,    1,  -31 },   // 0x58 'X'
+  {  2955,  32,  32,  33,    1,  -31 },   // 0x59 'Y'
+  {  3015,  28,  32,  30,    1,  -31 },   // 0x5A 'Z'
+  {  3073,  11,  39,  16,    3,  -31 },   // 0x5B '['
+  {  3110,  15,  33,  13,   -1,  -32 },   // 0x5C '\'
+  {  3143,  11,  39,  16,    2,  -31 },   // 0x5D ']'
+  {  3180,  21,  17,  27,    3,  -31 },   // 0x5E '^'
+  {  3210,  24,   3,  23,    0,    5 },   // 0x5F '_'
+  {  3213,  11,   9,  16,    0,  -33 },   // 0x60 '`'
+  {  3222,  22,  24,  23,    1,  -22 },   // 0x61 'a'
+  {  3266,  25,  33,  26,    0,  -31 },   // 0x62 'b'
+  {  3329,  19,  24,  20,    1,  -22 },   // 0x63 'c'
+  {  3362,  24,  33,  26,    1,  -31 },   // 0x64 'd'
+  {  3424,  18,  24,  21,    1,  -22 },   // 0x65 'e'
+  {  3457,  17,  33,  18,    1,  -32 },   // 0x66 'f'
+  {  3496,  19,  32,  24,    2,  -22 },   // 0x67 'g'
+  {  3548,  24,  32,  26,    0,  -31 },   // 0x68 'h'
+  {  3608,  11,  33,  14,    1,  -32 },   // 0x69 'i'
+  {  3639,  14,  42,  18,    0,  -32 },   // 0x6A 'j'
+  {  3684,  25,  32,  26,    0,  -31 },   // 0x6B 'k'
+  {  3741,  11,  32,  13,    0,  -31 },   // 0x6C 'l'
+  {  3773,  37,  23,  39,    0,  -22 },   // 0x6D 'm'
+  {  3841,  24,  23,  26,    0,  -22 },   // 0x6E 'n'
+  {  3886,  21,  24,  24,    1,  -22 },   // 0x6F 'o'
+  {  3924,  24,  32,  26,    0,  -22 },   // 0x70 'p'
+  {  3983,  24,  32,  26,    1,  -22 },   // 0x71 'q'
+  {  4044,  19,  23,  20,    0,  -22 },   // 0x72 'r'
+  {  4072,  15,  24,  19,    2,  -22 },   // 0x73 's'
+  {  4106,  14,  31,  16,    1,  -29 },   // 0x74 't'
+  {  4141,  25,  23,  27,    0,  -21 },   // 0x75 'u'
+  {  4188,  22,  23,  23,    0,  -21 },   // 0x76 'v'
+  {  4229,  33,  23,  33,    0,  -21 },   // 0x77 'w'
+  {  4294,  22,  22,  24,    1,  -21 },   // 0x78 'x'
+  {  4333,  21,  31,  23,    0,  -21 },   // 0x79 'y'
+  {  4386,  19,  22,  21,    1,  -21 },   // 0x7A 'z'
+  {  4420,  14,  42,  19,    1,  -33 },   // 0x7B '{'
+  {  4462,   4,  33,  10,    3,  -32 },   // 0x7C '|'
+  {  4467,  14,  42,  19,    4,  -33 },   // 0x7D '}'
+  {  4510,  22,   7,  24,    1,  -14 } }; // 0x7E '~'
 
 const GFXfont FreeSerifBold24pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold24pt7bBitmaps,
   (GFXglyph *)FreeSerifBold24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56, 1 };
 
-// Approx. 8519 bytes
+// Approx. 5195 bytes
@@ -1,450 +1,367 @@
 const uint8_t FreeSerifItalic18pt7bBitmaps[] PROGMEM = {
-  0x01, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x81, 0xE0, 0x70, 0x1C, 0x06, 0x01,
-  0x80, 0xC0, 0x30, 0x0C, 0x02, 0x01, 0x80, 0x40, 0x10, 0x00, 0x00, 0x01,
-  0x80, 0xF0, 0x3C, 0x06, 0x00, 0x38, 0x77, 0x8F, 0x78, 0xF7, 0x0E, 0x60,
-  0xE6, 0x0C, 0xC1, 0x8C, 0x18, 0x81, 0x00, 0x00, 0x60, 0xC0, 0x0C, 0x38,
-  0x03, 0x86, 0x00, 0x60, 0xC0, 0x0C, 0x38, 0x03, 0x06, 0x00, 0x60, 0xC0,
-  0xFF, 0xFF, 0x1F, 0xFF, 0xE0, 0x61, 0xC0, 0x1C, 0x30, 0x03, 0x06, 0x00,
-  0x61, 0xC0, 0x18, 0x30, 0x3F, 0xFF, 0xC7, 0xFF, 0xF8, 0x18, 0x30, 0x03,
-  0x0E, 0x00, 0xE1, 0x80, 0x18, 0x30, 0x03, 0x0C, 0x00, 0xC1, 0x80, 0x18,
-  0x70, 0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0x40, 0x0F, 0xC0, 0x61, 0xE1,
-  0x86, 0xC6, 0x0D, 0x8C, 0x1A, 0x18, 0x24, 0x38, 0xC0, 0x39, 0x80, 0x7F,
-  0x00, 0x7E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xDC, 0x03, 0x38,
-  0x06, 0x32, 0x0C, 0x64, 0x18, 0xDC, 0x71, 0xB8, 0xC6, 0x39, 0x8C, 0x3F,
-  0x30, 0x1F, 0x80, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x07, 0x80, 0x60,
-  0x0F, 0xE0, 0xE0, 0x0F, 0x0F, 0xB0, 0x0E, 0x04, 0x30, 0x07, 0x02, 0x18,
-  0x07, 0x01, 0x18, 0x03, 0x00, 0x8C, 0x01, 0x80, 0x8C, 0x00, 0xC0, 0x4C,
-  0x00, 0x60, 0x66, 0x1F, 0x30, 0x66, 0x1F, 0xCC, 0x63, 0x1C, 0x67, 0xE3,
-  0x1C, 0x19, 0xE1, 0x1C, 0x04, 0x01, 0x8C, 0x02, 0x00, 0x8E, 0x01, 0x00,
-  0xC7, 0x00, 0x80, 0xC3, 0x00, 0x80, 0x61, 0x80, 0xC0, 0x60, 0xC0, 0xC0,
-  0x20, 0x70, 0xE0, 0x30, 0x1F, 0xC0, 0x10, 0x07, 0xC0, 0x00, 0x1E, 0x00,
-  0x00, 0xFC, 0x00, 0x07, 0x18, 0x00, 0x18, 0x60, 0x00, 0xE1, 0x80, 0x03,
-  0x8C, 0x00, 0x0E, 0x60, 0x00, 0x3B, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80,
-  0x00, 0x7F, 0x1F, 0xC3, 0x3C, 0x1C, 0x38, 0x70, 0x61, 0xE1, 0xE3, 0x87,
-  0x07, 0x8C, 0x3C, 0x0F, 0x60, 0xF0, 0x3D, 0x03, 0xC0, 0x78, 0x0F, 0x01,
-  0xE0, 0x3E, 0x07, 0xC0, 0x7C, 0x77, 0x84, 0xFF, 0x8F, 0xE1, 0xF8, 0x0F,
-  0x00, 0x3B, 0xDE, 0xE7, 0x33, 0x18, 0x80, 0x00, 0x80, 0x80, 0x80, 0x80,
-  0xC0, 0xC0, 0xE0, 0x60, 0x70, 0x38, 0x18, 0x0C, 0x0E, 0x07, 0x03, 0x01,
-  0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x01, 0x00, 0x80, 0x40, 0x30,
-  0x08, 0x04, 0x02, 0x00, 0x04, 0x01, 0x00, 0x80, 0x60, 0x10, 0x08, 0x04,
-  0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x0E, 0x07, 0x03, 0x81,
-  0x80, 0xC0, 0xE0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x08, 0x08, 0x08, 0x08,
-  0x00, 0x06, 0x00, 0x60, 0x06, 0x0C, 0x43, 0xE4, 0xF1, 0x58, 0x0E, 0x00,
-  0xF0, 0x74, 0xEE, 0x47, 0xC4, 0x30, 0x60, 0x06, 0x00, 0x60, 0x01, 0x80,
-  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-  0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x31, 0xCE,
-  0x31, 0x08, 0x98, 0xFF, 0xFF, 0x6F, 0xF6, 0x00, 0x06, 0x00, 0x0E, 0x00,
-  0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00,
-  0xE0, 0x00, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06,
-  0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70,
-  0x00, 0x60, 0x00, 0xE0, 0x00, 0x00, 0x78, 0x00, 0xC3, 0x00, 0xC1, 0xC0,
-  0xC0, 0x60, 0xE0, 0x30, 0xE0, 0x1C, 0x70, 0x0E, 0x70, 0x07, 0x38, 0x03,
-  0xBC, 0x01, 0xDC, 0x01, 0xEE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3B, 0x80,
-  0x1D, 0xC0, 0x1E, 0xE0, 0x0E, 0x70, 0x0F, 0x38, 0x07, 0x1C, 0x07, 0x06,
-  0x03, 0x83, 0x83, 0x80, 0xC3, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x7F, 0x00,
-  0x70, 0x07, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x01,
-  0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x0E,
-  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x1E, 0x0F, 0xF8, 0x01, 0xF0, 0x07, 0xFC,
-  0x0C, 0x3E, 0x10, 0x1F, 0x20, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
-  0x00, 0x1E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0xE0,
-  0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x04,
-  0x30, 0x0C, 0x7F, 0xF8, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0xC3,
-  0xC0, 0x80, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
-  0x38, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x01, 0xE0,
-  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x07,
-  0x00, 0x03, 0x07, 0x87, 0x03, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x80,
-  0x01, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x01, 0xF0, 0x01, 0xB0, 0x01, 0xB8,
-  0x01, 0x9C, 0x01, 0x8C, 0x00, 0x86, 0x00, 0x87, 0x00, 0x83, 0x80, 0x81,
-  0x80, 0x81, 0xC0, 0xC0, 0xE0, 0xC0, 0x70, 0xFF, 0xFF, 0x7F, 0xFF, 0x00,
-  0x1C, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0x80,
-  0x01, 0xFF, 0x01, 0xFF, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x07, 0x00,
-  0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0xF8, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C,
-  0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18,
-  0x00, 0x30, 0x00, 0x30, 0x70, 0xE0, 0xFF, 0x80, 0x7E, 0x00, 0x00, 0x03,
-  0x80, 0x1F, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-  0x00, 0x3C, 0x00, 0x3D, 0xF0, 0x1F, 0xFE, 0x1F, 0x0F, 0x8E, 0x03, 0xC7,
-  0x00, 0xF7, 0x00, 0x7B, 0x80, 0x3D, 0x80, 0x1E, 0xC0, 0x0F, 0x60, 0x0F,
-  0xB0, 0x07, 0x98, 0x03, 0xC4, 0x03, 0xC3, 0x03, 0xC0, 0xC3, 0x80, 0x1F,
-  0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x40, 0x0E, 0x80, 0x0C, 0x00, 0x18, 0x00,
-  0x18, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0xC0, 0x01, 0xC0, 0x01,
-  0x80, 0x03, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C,
-  0x00, 0x18, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0x00,
-  0xF8, 0x03, 0x0E, 0x06, 0x06, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,
-  0x03, 0x0E, 0x06, 0x07, 0x8E, 0x07, 0xD8, 0x03, 0xE0, 0x07, 0xF0, 0x1C,
-  0xF8, 0x30, 0x3C, 0x60, 0x1C, 0x60, 0x0E, 0xC0, 0x06, 0xC0, 0x06, 0xC0,
-  0x06, 0xC0, 0x06, 0xE0, 0x0C, 0x60, 0x18, 0x38, 0x30, 0x0F, 0xC0, 0x01,
-  0xF8, 0x07, 0x8C, 0x0E, 0x06, 0x1E, 0x02, 0x3C, 0x03, 0x3C, 0x03, 0x78,
-  0x03, 0x78, 0x03, 0x78, 0x03, 0x78, 0x07, 0x78, 0x07, 0x78, 0x07, 0x3C,
-  0x0E, 0x3E, 0x1E, 0x1F, 0xEE, 0x07, 0x9C, 0x00, 0x38, 0x00, 0x78, 0x00,
-  0x70, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x0C,
-  0x3C, 0x78, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x1E, 0x18,
-  0x00, 0x07, 0x03, 0xC1, 0xE0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x03, 0x81, 0xC0, 0xE0, 0x30, 0x10, 0x10, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0xC0, 0x01, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0x01,
-  0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-  0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-  0x00, 0x03, 0xC0, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC0, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07,
-  0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0x01,
-  0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x03, 0xF0, 0x03,
-  0xF0, 0x00, 0xF0, 0x00, 0x20, 0x00, 0x00, 0x0F, 0x81, 0x86, 0x30, 0x33,
-  0x03, 0x30, 0x30, 0x03, 0x00, 0x60, 0x0E, 0x01, 0xC0, 0x38, 0x06, 0x00,
-  0xC0, 0x08, 0x01, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-  0x00, 0xF0, 0x0F, 0x00, 0x60, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0xE0,
-  0x07, 0x80, 0xF0, 0x0E, 0x00, 0x38, 0x1C, 0x00, 0x0C, 0x38, 0x0E, 0x06,
-  0x70, 0x3F, 0xE2, 0x70, 0x71, 0xE3, 0xF0, 0x60, 0xE1, 0xE0, 0xC0, 0xC1,
-  0xE0, 0xC0, 0xC1, 0xE1, 0x81, 0xC1, 0xE1, 0x81, 0xC1, 0xE1, 0x81, 0x82,
-  0xE1, 0x83, 0x82, 0x71, 0x83, 0x86, 0x71, 0xC7, 0x8C, 0x38, 0xF9, 0xF8,
-  0x3C, 0xF0, 0xF0, 0x1E, 0x00, 0x00, 0x0F, 0x80, 0x30, 0x03, 0xFF, 0xE0,
-  0x00, 0x7F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x01, 0xC0, 0x00,
-  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x5E, 0x00, 0x04, 0xF0,
-  0x00, 0x63, 0x80, 0x02, 0x1C, 0x00, 0x20, 0xE0, 0x01, 0x07, 0x00, 0x10,
-  0x3C, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xC0, 0x38, 0x04, 0x01, 0xC0,
-  0x60, 0x0E, 0x06, 0x00, 0x78, 0x30, 0x03, 0xC3, 0x00, 0x1E, 0x38, 0x00,
-  0xFB, 0xF0, 0x1F, 0xE0, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x78, 0x3C,
-  0x03, 0xC0, 0xF0, 0x1E, 0x07, 0x80, 0xE0, 0x3C, 0x07, 0x01, 0xE0, 0x78,
-  0x1E, 0x03, 0x83, 0xE0, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0x0F, 0x00,
-  0x70, 0x3C, 0x03, 0x80, 0xF0, 0x3C, 0x07, 0x81, 0xC0, 0x3C, 0x0E, 0x01,
-  0xE0, 0xF0, 0x0F, 0x07, 0x80, 0xF0, 0x38, 0x0F, 0x81, 0xC1, 0xF8, 0x1F,
-  0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x08, 0x07, 0xFF, 0xC0, 0xF8,
-  0x3E, 0x0F, 0x00, 0x70, 0xF0, 0x03, 0x8F, 0x00, 0x08, 0xF0, 0x00, 0x47,
-  0x80, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00,
-  0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0,
-  0x00, 0x03, 0x80, 0x02, 0x1E, 0x00, 0x20, 0x78, 0x02, 0x03, 0xE0, 0x60,
-  0x07, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFC,
-  0x00, 0x78, 0x1F, 0x00, 0x3C, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0E, 0x00,
-  0x78, 0x07, 0x00, 0x1E, 0x07, 0x80, 0x0F, 0x03, 0x80, 0x07, 0x81, 0xC0,
-  0x03, 0xC1, 0xE0, 0x01, 0xE0, 0xF0, 0x00, 0xF0, 0x70, 0x00, 0x78, 0x38,
-  0x00, 0x78, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x3E, 0x0E, 0x00, 0x1E, 0x0F,
-  0x00, 0x1E, 0x07, 0x80, 0x1E, 0x03, 0x80, 0x3E, 0x01, 0xC0, 0x7E, 0x01,
-  0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF0,
-  0x1E, 0x01, 0xC0, 0x78, 0x02, 0x01, 0xE0, 0x08, 0x07, 0x00, 0x00, 0x1C,
-  0x08, 0x00, 0xF0, 0x60, 0x03, 0x83, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xF0,
-  0x01, 0xE0, 0xC0, 0x07, 0x03, 0x00, 0x1C, 0x08, 0x00, 0xF0, 0x20, 0x03,
-  0x80, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x81, 0xE0, 0x06, 0x07, 0x00,
-  0x38, 0x1C, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-  0xFC, 0x07, 0xFF, 0xF0, 0x1E, 0x01, 0xC0, 0x78, 0x02, 0x01, 0xE0, 0x08,
-  0x07, 0x00, 0x20, 0x1C, 0x00, 0x00, 0xF0, 0x20, 0x03, 0x81, 0x80, 0x0E,
-  0x0C, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0x03, 0x00, 0x1C, 0x0C,
-  0x00, 0xF0, 0x20, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x01,
-  0xE0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xF8,
-  0x00, 0x00, 0x00, 0x3F, 0x02, 0x01, 0xFF, 0x88, 0x0F, 0x81, 0xF0, 0x3C,
-  0x01, 0xE0, 0xF0, 0x01, 0xC3, 0xC0, 0x01, 0x0F, 0x80, 0x02, 0x1E, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00,
-  0x0F, 0x00, 0x3F, 0xFE, 0x00, 0x1E, 0x3C, 0x00, 0x38, 0x78, 0x00, 0x70,
-  0xF0, 0x00, 0xE0, 0xE0, 0x01, 0xC1, 0xE0, 0x07, 0x01, 0xE0, 0x0E, 0x01,
-  0xF0, 0x3C, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F,
-  0xE0, 0x3E, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x03, 0x80, 0x1C,
-  0x00, 0xF0, 0x03, 0x80, 0x1E, 0x00, 0x70, 0x03, 0x80, 0x1E, 0x00, 0x70,
-  0x03, 0x80, 0x1E, 0x00, 0x70, 0x03, 0x80, 0x1F, 0xFF, 0xF0, 0x03, 0xFF,
-  0xFE, 0x00, 0x70, 0x03, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0xC0, 0x0E, 0x00,
-  0x70, 0x03, 0xC0, 0x0E, 0x00, 0x78, 0x03, 0xC0, 0x0E, 0x00, 0x78, 0x01,
-  0xC0, 0x0E, 0x00, 0x78, 0x01, 0xC0, 0x0E, 0x00, 0x78, 0x03, 0xE0, 0x3F,
-  0xE1, 0xFF, 0x00, 0x07, 0xFC, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x01, 0xC0,
-  0x07, 0x00, 0x1C, 0x00, 0xF0, 0x03, 0x80, 0x0E, 0x00, 0x78, 0x01, 0xE0,
-  0x07, 0x00, 0x1C, 0x00, 0xF0, 0x03, 0x80, 0x0E, 0x00, 0x78, 0x01, 0xE0,
-  0x07, 0x00, 0x1C, 0x00, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x0F,
-  0x00, 0x07, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
-  0x70, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0F, 0x00,
-  0x07, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x70,
-  0x1E, 0x78, 0x0F, 0x38, 0x07, 0xF8, 0x01, 0xF0, 0x00, 0x07, 0xFC, 0x7F,
-  0x80, 0xF8, 0x0F, 0x00, 0x38, 0x07, 0x00, 0x3C, 0x07, 0x00, 0x1C, 0x06,
-  0x00, 0x0E, 0x06, 0x00, 0x07, 0x0C, 0x00, 0x07, 0x8C, 0x00, 0x03, 0x9C,
-  0x00, 0x01, 0xD8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x73,
-  0x80, 0x00, 0x39, 0xE0, 0x00, 0x3C, 0x78, 0x00, 0x1C, 0x1C, 0x00, 0x0E,
-  0x0F, 0x00, 0x07, 0x03, 0x80, 0x07, 0x81, 0xE0, 0x03, 0x80, 0x70, 0x01,
-  0xC0, 0x3C, 0x01, 0xE0, 0x1F, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x00,
-  0x1F, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00,
-  0x01, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x80,
-  0x00, 0x78, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x00, 0xE0,
-  0x00, 0x0E, 0x00, 0x11, 0xE0, 0x03, 0x1E, 0x00, 0x61, 0xC0, 0x06, 0x1C,
-  0x01, 0xE3, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x7E, 0x03,
-  0xE0, 0x01, 0xF0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x80, 0x0F, 0x80, 0x1F,
-  0x00, 0x37, 0x00, 0x2E, 0x00, 0x5E, 0x00, 0x5C, 0x01, 0xB8, 0x01, 0xB8,
-  0x06, 0x70, 0x02, 0x78, 0x09, 0xE0, 0x04, 0x70, 0x33, 0xC0, 0x08, 0xE0,
-  0xC7, 0x00, 0x31, 0xC1, 0x0E, 0x00, 0x43, 0x86, 0x3C, 0x00, 0x87, 0x18,
-  0x70, 0x03, 0x0E, 0x20, 0xE0, 0x06, 0x1C, 0xC3, 0xC0, 0x08, 0x3B, 0x07,
-  0x80, 0x10, 0x7C, 0x0E, 0x00, 0x60, 0x78, 0x1C, 0x00, 0x80, 0xE0, 0x78,
-  0x03, 0x01, 0x80, 0xF0, 0x07, 0x03, 0x03, 0xE0, 0x3F, 0x84, 0x1F, 0xF0,
-  0x00, 0x07, 0xC0, 0x3F, 0xC0, 0x78, 0x03, 0xE0, 0x0E, 0x00, 0x70, 0x03,
-  0xC0, 0x18, 0x01, 0xF0, 0x0E, 0x00, 0x6C, 0x03, 0x00, 0x1B, 0x80, 0xC0,
-  0x0C, 0xE0, 0x30, 0x03, 0x18, 0x1C, 0x00, 0xC7, 0x06, 0x00, 0x30, 0xC1,
-  0x80, 0x18, 0x38, 0xE0, 0x06, 0x06, 0x30, 0x01, 0x81, 0x8C, 0x00, 0xC0,
-  0x73, 0x00, 0x30, 0x0D, 0xC0, 0x0C, 0x03, 0xE0, 0x03, 0x00, 0x78, 0x01,
-  0x80, 0x1E, 0x00, 0x60, 0x07, 0x00, 0x38, 0x00, 0xC0, 0x0E, 0x00, 0x30,
-  0x0F, 0xE0, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x07, 0xC1,
-  0xE0, 0x1E, 0x01, 0xE0, 0x78, 0x01, 0xC1, 0xE0, 0x03, 0xC7, 0x80, 0x07,
-  0x9F, 0x00, 0x0F, 0x3C, 0x00, 0x1E, 0xF8, 0x00, 0x3D, 0xE0, 0x00, 0xFF,
-  0xC0, 0x01, 0xEF, 0x80, 0x03, 0xDE, 0x00, 0x0F, 0xBC, 0x00, 0x1E, 0x78,
-  0x00, 0x7C, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xC1, 0xC0, 0x0F, 0x03, 0xC0,
-  0x3C, 0x03, 0xC1, 0xF0, 0x03, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x07,
-  0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x0E, 0x0F, 0x80, 0x78, 0x1F, 0x01, 0xC0,
-  0x3C, 0x07, 0x00, 0xF0, 0x1C, 0x03, 0xC0, 0xF0, 0x0F, 0x03, 0x80, 0x78,
-  0x0E, 0x01, 0xE0, 0x78, 0x1F, 0x01, 0xFF, 0xF8, 0x07, 0x7F, 0x00, 0x1C,
-  0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00,
-  0x01, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xC1, 0xE0,
-  0x1E, 0x01, 0xC0, 0x78, 0x03, 0xC1, 0xE0, 0x03, 0x87, 0x80, 0x07, 0x8F,
-  0x00, 0x0F, 0x3C, 0x00, 0x1E, 0x78, 0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xC0,
-  0x01, 0xFF, 0x80, 0x03, 0xDE, 0x00, 0x07, 0xBC, 0x00, 0x1F, 0x78, 0x00,
-  0x3C, 0xF0, 0x00, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x07, 0x83, 0x80, 0x1E,
-  0x07, 0x80, 0x78, 0x07, 0x01, 0xC0, 0x03, 0xDE, 0x00, 0x01, 0xC0, 0x00,
-  0x06, 0x00, 0x00, 0x18, 0x00, 0x10, 0x7F, 0xC0, 0xC3, 0xFF, 0xFF, 0x08,
-  0x07, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x78, 0x3C, 0x03,
-  0xC0, 0xF0, 0x1E, 0x07, 0x80, 0xE0, 0x3C, 0x07, 0x01, 0xE0, 0x78, 0x1E,
-  0x03, 0x83, 0xF0, 0x1F, 0xFE, 0x01, 0xFF, 0xC0, 0x0F, 0x38, 0x00, 0x71,
-  0xE0, 0x03, 0x87, 0x00, 0x3C, 0x38, 0x01, 0xC1, 0xE0, 0x0E, 0x07, 0x00,
-  0xF0, 0x3C, 0x07, 0x81, 0xE0, 0x38, 0x07, 0x01, 0xC0, 0x3C, 0x1E, 0x00,
-  0xF3, 0xFC, 0x07, 0xC0, 0x00, 0xF8, 0x81, 0xFF, 0xC1, 0xE1, 0xE1, 0xE0,
-  0x70, 0xF0, 0x10, 0x78, 0x08, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x01,
-  0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xF8,
-  0x80, 0x3C, 0x40, 0x1E, 0x20, 0x0F, 0x38, 0x07, 0x9E, 0x07, 0x8F, 0x87,
-  0x84, 0x7F, 0xC2, 0x0F, 0x80, 0x3F, 0xFF, 0xF7, 0xFF, 0xFF, 0x70, 0x78,
-  0x76, 0x07, 0x02, 0xC0, 0x70, 0x28, 0x0F, 0x02, 0x00, 0xF0, 0x00, 0x0E,
-  0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x03,
-  0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00,
-  0x70, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00,
-  0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0xFE, 0x3F, 0x00, 0x78, 0x3C, 0x00, 0x60,
-  0xF0, 0x01, 0x81, 0xE0, 0x03, 0x03, 0xC0, 0x06, 0x07, 0x00, 0x08, 0x1E,
-  0x00, 0x30, 0x3C, 0x00, 0x60, 0x70, 0x00, 0x81, 0xE0, 0x01, 0x03, 0xC0,
-  0x06, 0x07, 0x80, 0x0C, 0x0E, 0x00, 0x10, 0x3C, 0x00, 0x60, 0x78, 0x00,
-  0xC0, 0xF0, 0x01, 0x01, 0xE0, 0x06, 0x03, 0xC0, 0x08, 0x03, 0xC0, 0x30,
-  0x07, 0xC1, 0xC0, 0x07, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x01,
-  0xFB, 0xE0, 0x07, 0x8E, 0x00, 0x18, 0x78, 0x01, 0x83, 0xC0, 0x0C, 0x1E,
-  0x00, 0xC0, 0xF0, 0x06, 0x03, 0x80, 0x60, 0x1C, 0x02, 0x00, 0xE0, 0x30,
-  0x07, 0x83, 0x00, 0x3C, 0x10, 0x01, 0xE1, 0x80, 0x07, 0x08, 0x00, 0x38,
-  0x80, 0x01, 0xC4, 0x00, 0x0E, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
-  0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF,
-  0x3F, 0xC3, 0xFB, 0xE0, 0x78, 0x07, 0x8E, 0x03, 0xC0, 0x18, 0x78, 0x0E,
-  0x01, 0x83, 0xC0, 0x70, 0x0C, 0x1E, 0x03, 0x80, 0x40, 0xF0, 0x3C, 0x06,
-  0x03, 0x81, 0xE0, 0x60, 0x1C, 0x17, 0x83, 0x00, 0xE0, 0xBC, 0x30, 0x07,
-  0x09, 0xE1, 0x00, 0x38, 0x47, 0x18, 0x01, 0xE4, 0x38, 0x80, 0x0F, 0x21,
-  0xCC, 0x00, 0x7A, 0x0E, 0x40, 0x01, 0xD0, 0x76, 0x00, 0x0F, 0x03, 0xA0,
-  0x00, 0x78, 0x1F, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x1C, 0x07, 0x00, 0x00,
-  0xC0, 0x38, 0x00, 0x06, 0x00, 0x80, 0x00, 0x20, 0x04, 0x00, 0x00, 0x0F,
-  0xF8, 0x7F, 0x03, 0xE0, 0x3E, 0x01, 0xC0, 0x18, 0x01, 0xE0, 0x30, 0x01,
-  0xE0, 0x60, 0x00, 0xE0, 0xC0, 0x00, 0xF1, 0xC0, 0x00, 0x71, 0x80, 0x00,
-  0x7B, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0x3C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xCE, 0x00, 0x01, 0x8F, 0x00, 0x01,
-  0x07, 0x00, 0x03, 0x07, 0x00, 0x06, 0x07, 0x80, 0x0C, 0x03, 0x80, 0x18,
-  0x03, 0xC0, 0x78, 0x03, 0xE0, 0xFE, 0x1F, 0xF8, 0xFF, 0x87, 0xE7, 0xC0,
-  0x38, 0x70, 0x06, 0x0E, 0x01, 0x81, 0xE0, 0x30, 0x1C, 0x0C, 0x03, 0x83,
-  0x00, 0x78, 0xC0, 0x07, 0x30, 0x00, 0xE4, 0x00, 0x1D, 0x80, 0x03, 0xE0,
-  0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00,
-  0x01, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00,
-  0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xE0, 0xE0, 0x0F, 0x82,
-  0x00, 0x3C, 0x18, 0x01, 0xE0, 0x40, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03,
-  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
-  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x07,
-  0x80, 0x00, 0x3C, 0x00, 0xC1, 0xE0, 0x02, 0x0F, 0x00, 0x18, 0x38, 0x01,
-  0xE1, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x0C, 0x00, 0xC0,
-  0x06, 0x00, 0x30, 0x01, 0x80, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x03,
-  0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x60, 0x03, 0x00, 0x18, 0x01, 0xC0,
-  0x0C, 0x00, 0x60, 0x03, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x06,
-  0x00, 0x30, 0x01, 0xF8, 0x00, 0xE0, 0x0E, 0x00, 0x60, 0x07, 0x00, 0x30,
-  0x03, 0x80, 0x18, 0x01, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x60, 0x07,
-  0x00, 0x30, 0x03, 0x80, 0x18, 0x01, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00,
-  0x60, 0x07, 0x00, 0x30, 0x03, 0xF0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
-  0x0E, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x01, 0x80, 0x18, 0x01, 0x80,
-  0x18, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x60, 0x06, 0x00,
-  0x60, 0x06, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x0F, 0xC0, 0x03, 0x80,
-  0x07, 0x00, 0x1F, 0x00, 0x36, 0x00, 0xCE, 0x01, 0x8C, 0x06, 0x1C, 0x0C,
-  0x18, 0x38, 0x38, 0x60, 0x31, 0xC0, 0x73, 0x00, 0x6E, 0x00, 0xE0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0xE3, 0x8F, 0x0E, 0x18, 0x30, 0x01, 0xEC, 0x0E,
-  0x58, 0x30, 0x70, 0xE0, 0xC3, 0x81, 0x86, 0x07, 0x1C, 0x0C, 0x38, 0x18,
-  0xE0, 0x71, 0xC0, 0xE3, 0x83, 0x87, 0x0B, 0x2F, 0x36, 0xCF, 0xCF, 0x1F,
-  0x1C, 0x00, 0x03, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00,
-  0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x7C, 0x1C, 0xFE,
-  0x19, 0x8F, 0x1A, 0x07, 0x3C, 0x07, 0x38, 0x07, 0x38, 0x07, 0x70, 0x0E,
-  0x70, 0x0E, 0x70, 0x1C, 0x60, 0x18, 0xE0, 0x30, 0xE0, 0x60, 0xE1, 0xC0,
-  0x3F, 0x00, 0x01, 0xF0, 0x38, 0xC3, 0x8E, 0x78, 0x73, 0x80, 0x3C, 0x01,
-  0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x47, 0x84, 0x3F,
-  0xC0, 0x7C, 0x00, 0x00, 0x01, 0x80, 0x07, 0xC0, 0x00, 0xE0, 0x00, 0x60,
-  0x00, 0x30, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0xF7,
-  0x01, 0xC7, 0x81, 0xC3, 0x81, 0xC1, 0xC1, 0xE0, 0xE0, 0xE0, 0x60, 0xF0,
-  0x30, 0x78, 0x38, 0x78, 0x18, 0x3C, 0x0C, 0x1E, 0x0C, 0x0F, 0x0E, 0x27,
-  0xCB, 0x21, 0xF9, 0xE0, 0x78, 0xE0, 0x00, 0xF0, 0x1C, 0xC3, 0x86, 0x38,
-  0x33, 0xC3, 0x1C, 0x31, 0xE3, 0x1F, 0xE0, 0xF0, 0x07, 0x80, 0x3C, 0x01,
-  0xE0, 0x47, 0x84, 0x3F, 0xC0, 0x7C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x33,
-  0x00, 0x06, 0x30, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x01, 0xC0, 0x00, 0x18,
-  0x00, 0x01, 0x80, 0x00, 0x38, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x03,
-  0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x06, 0x00, 0x00,
-  0x60, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00,
-  0x1C, 0x00, 0x01, 0xC0, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x18, 0x00,
-  0x03, 0x00, 0x00, 0x30, 0x00, 0xC6, 0x00, 0x0C, 0xC0, 0x00, 0x78, 0x00,
-  0x00, 0x01, 0xF8, 0x07, 0x1F, 0x0E, 0x0F, 0x0C, 0x0E, 0x18, 0x0E, 0x18,
-  0x0E, 0x18, 0x1E, 0x18, 0x3C, 0x0C, 0x78, 0x07, 0xE0, 0x08, 0x00, 0x18,
-  0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x13, 0xF0, 0x60, 0x78, 0xC0, 0x38, 0xC0,
-  0x18, 0xC0, 0x18, 0xC0, 0x30, 0x60, 0x60, 0x3F, 0x80, 0x03, 0x00, 0x1F,
-  0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0E,
-  0x00, 0x0C, 0x00, 0x1C, 0x38, 0x1C, 0x7C, 0x1C, 0xCC, 0x19, 0x0C, 0x3A,
-  0x0C, 0x3C, 0x1C, 0x3C, 0x18, 0x38, 0x18, 0x70, 0x38, 0x70, 0x38, 0x70,
-  0x30, 0x60, 0x72, 0xE0, 0x76, 0xE0, 0x7C, 0xC0, 0x70, 0x03, 0x03, 0xC1,
-  0xE0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x7E, 0x0F, 0x03, 0x81, 0x81,
-  0xC0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x1C, 0x4C, 0x47, 0xC3, 0xC0, 0x00,
-  0x0C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0x03, 0xF0, 0x00, 0xE0, 0x01, 0x80, 0x03, 0x00,
-  0x0E, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x60, 0x01, 0xC0, 0x03, 0x80, 0x06,
-  0x00, 0x0C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xC0, 0x03, 0x80, 0x06, 0x00,
-  0x0C, 0x06, 0x30, 0x0C, 0xC0, 0x0F, 0x00, 0x00, 0x03, 0x00, 0x3E, 0x00,
-  0x1C, 0x00, 0x38, 0x00, 0x60, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0C,
-  0x00, 0x38, 0xFC, 0x70, 0x60, 0xE1, 0x81, 0x86, 0x07, 0x10, 0x0E, 0x40,
-  0x1B, 0x80, 0x3F, 0x00, 0xE7, 0x01, 0xCE, 0x03, 0x0C, 0x06, 0x1C, 0x5C,
-  0x1D, 0x38, 0x3E, 0x60, 0x38, 0x03, 0x1F, 0x07, 0x07, 0x06, 0x0E, 0x0E,
-  0x0E, 0x0C, 0x1C, 0x1C, 0x18, 0x38, 0x38, 0x38, 0x30, 0x70, 0x70, 0x70,
-  0x64, 0xE4, 0xE8, 0xF0, 0xE0, 0x00, 0x06, 0x18, 0x1E, 0x3E, 0x3C, 0x3F,
-  0x0E, 0x4C, 0x47, 0x0C, 0x8C, 0x8E, 0x1D, 0x0D, 0x0E, 0x1E, 0x1A, 0x0E,
-  0x1C, 0x1E, 0x0C, 0x3C, 0x1C, 0x1C, 0x38, 0x38, 0x1C, 0x38, 0x38, 0x1C,
-  0x30, 0x38, 0x18, 0x70, 0x30, 0x39, 0x70, 0x70, 0x32, 0x60, 0x70, 0x3C,
-  0x60, 0x60, 0x38, 0x06, 0x0E, 0x1F, 0x1F, 0x83, 0x99, 0xC1, 0x98, 0xC1,
-  0xD8, 0xE0, 0xE8, 0x70, 0x78, 0x30, 0x38, 0x38, 0x3C, 0x1C, 0x1C, 0x0E,
-  0x0E, 0x06, 0x0E, 0x03, 0x17, 0x01, 0xB3, 0x80, 0xF1, 0x80, 0x70, 0x01,
-  0xF0, 0x0E, 0x38, 0x38, 0x30, 0xE0, 0x73, 0x80, 0xEE, 0x01, 0xDC, 0x03,
-  0xF8, 0x0F, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0xE7, 0x03, 0x8E, 0x06, 0x0E,
-  0x38, 0x07, 0xC0, 0x00, 0x00, 0xE7, 0xC0, 0x7C, 0xFE, 0x01, 0xD1, 0xF0,
-  0x1E, 0x0F, 0x01, 0xC0, 0xF0, 0x38, 0x0F, 0x03, 0x80, 0xF0, 0x38, 0x0E,
-  0x03, 0x01, 0xE0, 0x70, 0x1C, 0x07, 0x03, 0xC0, 0x60, 0x78, 0x06, 0x0F,
-  0x00, 0xE1, 0xC0, 0x0F, 0xF0, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xC0,
-  0x00, 0x1C, 0x00, 0x01, 0x80, 0x00, 0x38, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0xF7, 0x03, 0xCE, 0x0F, 0x06, 0x1E, 0x06, 0x1C, 0x04, 0x3C, 0x04, 0x78,
-  0x04, 0x78, 0x0C, 0xF0, 0x08, 0xF0, 0x18, 0xF0, 0x38, 0xF0, 0xF0, 0xF9,
-  0x70, 0x7E, 0x70, 0x3C, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xE0, 0x00,
-  0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x0F, 0xF0, 0x7C, 0x70, 0xE7, 0xC7, 0x4C,
-  0x34, 0x01, 0xA0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x78, 0x03, 0x80, 0x1C,
-  0x00, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x00, 0x07, 0x88, 0x63, 0x86,
-  0x0C, 0x30, 0x21, 0xC1, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x1C,
-  0x10, 0x60, 0x83, 0x06, 0x18, 0x71, 0x82, 0x78, 0x00, 0x02, 0x03, 0x03,
-  0x07, 0xF7, 0xF8, 0xE0, 0x60, 0x70, 0x38, 0x1C, 0x0C, 0x0E, 0x07, 0x03,
-  0x01, 0x91, 0xC8, 0xF8, 0x78, 0x00, 0x1C, 0x0D, 0xF8, 0x38, 0x60, 0x70,
-  0xC1, 0xC3, 0x83, 0x87, 0x07, 0x0C, 0x1E, 0x38, 0x78, 0x70, 0xB0, 0xE2,
-  0x61, 0x8D, 0xC7, 0x33, 0x2C, 0xC6, 0x5F, 0x0F, 0x38, 0x1C, 0x00, 0x18,
-  0x1B, 0xE0, 0x73, 0x81, 0xC6, 0x03, 0x18, 0x0C, 0x70, 0x21, 0xC1, 0x83,
-  0x0C, 0x0C, 0x20, 0x31, 0x00, 0xC8, 0x03, 0x40, 0x0E, 0x00, 0x30, 0x00,
-  0x80, 0x00, 0x18, 0x04, 0x1B, 0xE0, 0x30, 0x71, 0x80, 0xC1, 0xC6, 0x07,
-  0x01, 0x1C, 0x2C, 0x08, 0x70, 0xB0, 0x20, 0xC4, 0xC1, 0x03, 0x21, 0x84,
-  0x0D, 0x86, 0x20, 0x34, 0x19, 0x00, 0xE0, 0x68, 0x03, 0x81, 0xA0, 0x0C,
-  0x07, 0x00, 0x30, 0x18, 0x00, 0x80, 0x40, 0x00, 0x03, 0x07, 0x0F, 0x8F,
-  0x13, 0x93, 0x01, 0xB0, 0x01, 0xE0, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-  0x01, 0xC0, 0x03, 0xE0, 0x02, 0x60, 0x04, 0x62, 0x08, 0x64, 0xF0, 0x7C,
-  0xE0, 0x30, 0x06, 0x06, 0x3F, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x81,
-  0x03, 0x82, 0x01, 0x82, 0x01, 0xC4, 0x01, 0xC4, 0x01, 0xC8, 0x00, 0xC8,
-  0x00, 0xD0, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80,
-  0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x78, 0x00, 0x70, 0x00, 0x1F, 0xFC,
-  0x7F, 0xE1, 0x01, 0x08, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80,
-  0x06, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x38, 0x01, 0xF0, 0x0B, 0xE0,
-  0x01, 0xC6, 0x03, 0x98, 0x03, 0x80, 0x00, 0x70, 0x0C, 0x01, 0x80, 0x38,
-  0x03, 0x80, 0x30, 0x07, 0x00, 0x70, 0x07, 0x00, 0x60, 0x0E, 0x00, 0xE0,
-  0x0C, 0x01, 0xC0, 0x1C, 0x07, 0x80, 0x30, 0x04, 0x00, 0x20, 0x03, 0x00,
-  0x30, 0x07, 0x00, 0x70, 0x06, 0x00, 0x60, 0x0E, 0x00, 0xE0, 0x0C, 0x00,
-  0xC0, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x06,
-  0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x70, 0x07, 0x00, 0x70, 0x06,
-  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0C, 0x00, 0x40, 0x04, 0x00, 0xC0, 0x1E,
-  0x03, 0x80, 0x38, 0x03, 0x00, 0x70, 0x07, 0x00, 0x70, 0x06, 0x00, 0xE0,
-  0x0E, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x70, 0x00, 0x1E, 0x00, 0x3F, 0xE1,
-  0xF8, 0x7F, 0xC0, 0x07, 0x80 };
+  0x73, 0x64, 0x64, 0x64, 0x63, 0x64, 0x63, 0x73, 0x72, 0x82, 0x72, 0x82,
+  0x82, 0x81, 0x82, 0x81, 0x91, 0xFC, 0x27, 0x46, 0x47, 0x27, 0x23, 0x43,
+  0x14, 0x34, 0x14, 0x34, 0x13, 0x43, 0x22, 0x53, 0x22, 0x52, 0x22, 0x52,
+  0x32, 0x52, 0x31, 0x61, 0x40, 0x92, 0x52, 0xA2, 0x43, 0x93, 0x42, 0xA2,
+  0x52, 0xA2, 0x43, 0x92, 0x52, 0xA2, 0x52, 0x6F, 0x13, 0xF1, 0x62, 0x43,
+  0x93, 0x42, 0xA2, 0x52, 0xA2, 0x43, 0x92, 0x52, 0x6F, 0x13, 0xF1, 0x62,
+  0x52, 0xA2, 0x43, 0x93, 0x42, 0xA2, 0x52, 0xA2, 0x42, 0xA2, 0x52, 0xA2,
+  0x43, 0x90, 0xC1, 0xD2, 0xD1, 0xA6, 0x72, 0x44, 0x42, 0x42, 0x12, 0x32,
+  0x52, 0x12, 0x32, 0x52, 0x11, 0x42, 0x51, 0x21, 0x43, 0x32, 0x83, 0x22,
+  0x87, 0x96, 0xB5, 0xB5, 0xA5, 0xA2, 0x13, 0x82, 0x23, 0x82, 0x32, 0x21,
+  0x52, 0x32, 0x21, 0x52, 0x32, 0x13, 0x33, 0x32, 0x13, 0x32, 0x32, 0x33,
+  0x22, 0x32, 0x46, 0x22, 0x76, 0xA2, 0xD2, 0xD2, 0x80, 0x54, 0x82, 0x97,
+  0x53, 0x94, 0x45, 0x12, 0x83, 0x61, 0x42, 0x93, 0x61, 0x42, 0x83, 0x71,
+  0x32, 0x92, 0x81, 0x32, 0x92, 0x71, 0x32, 0xA2, 0x71, 0x22, 0xB2, 0x62,
+  0x22, 0x45, 0x22, 0x52, 0x22, 0x47, 0x22, 0x32, 0x32, 0x33, 0x32, 0x26,
+  0x32, 0x33, 0x52, 0x24, 0x41, 0x33, 0x71, 0x92, 0x32, 0x81, 0x91, 0x33,
+  0x81, 0x82, 0x33, 0x81, 0x72, 0x42, 0x81, 0x82, 0x42, 0x72, 0x72, 0x52,
+  0x62, 0x81, 0x63, 0x43, 0x72, 0x77, 0x91, 0x95, 0x50, 0xB4, 0xF2, 0x6F,
+  0x03, 0x32, 0xE2, 0x42, 0xD3, 0x42, 0xD3, 0x32, 0xE3, 0x22, 0xF0, 0x31,
+  0x2F, 0x14, 0xF2, 0x4F, 0x17, 0x37, 0x42, 0x24, 0x53, 0x43, 0x43, 0x52,
+  0x44, 0x44, 0x33, 0x43, 0x54, 0x32, 0x44, 0x64, 0x12, 0x54, 0x64, 0x11,
+  0x64, 0x74, 0x74, 0x74, 0x75, 0x65, 0x75, 0x33, 0x14, 0x41, 0x29, 0x37,
+  0x46, 0x74, 0x20, 0x23, 0x14, 0x14, 0x13, 0x23, 0x22, 0x22, 0x32, 0x31,
+  0x40, 0x81, 0x71, 0x71, 0x71, 0x72, 0x62, 0x63, 0x62, 0x63, 0x63, 0x62,
+  0x72, 0x63, 0x63, 0x62, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x81,
+  0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x60, 0x51, 0x91, 0x81, 0x82, 0x81,
+  0x81, 0x81, 0x82, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x63, 0x63, 0x63,
+  0x62, 0x72, 0x63, 0x62, 0x72, 0x62, 0x72, 0x62, 0x71, 0x71, 0x71, 0x71,
+  0x80, 0x52, 0xA2, 0xA2, 0x52, 0x31, 0x45, 0x21, 0x24, 0x31, 0x11, 0x12,
+  0x73, 0x94, 0x53, 0x11, 0x23, 0x13, 0x21, 0x35, 0x31, 0x42, 0x52, 0xA2,
+  0xA2, 0x50, 0x72, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x7F, 0xF2,
+  0x72, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x70, 0x22, 0x33, 0x23,
+  0x32, 0x31, 0x41, 0x31, 0x22, 0x30, 0x0F, 0x10, 0x12, 0x18, 0x12, 0x10,
+  0xD2, 0xD3, 0xD2, 0xD3, 0xC3, 0xD2, 0xD3, 0xD2, 0xD3, 0xD2, 0xD3, 0xC3,
+  0xD2, 0xD3, 0xD2, 0xD3, 0xD2, 0xD3, 0xC3, 0xD2, 0xD3, 0xD2, 0xD3, 0xD0,
+  0x94, 0xB2, 0x42, 0x82, 0x53, 0x62, 0x72, 0x53, 0x72, 0x43, 0x83, 0x33,
+  0x83, 0x23, 0x93, 0x23, 0x93, 0x14, 0x93, 0x13, 0x94, 0x13, 0x98, 0x98,
+  0x93, 0x13, 0xA3, 0x13, 0x94, 0x13, 0x93, 0x23, 0x84, 0x23, 0x83, 0x33,
+  0x73, 0x52, 0x73, 0x53, 0x53, 0x72, 0x42, 0xB5, 0x80, 0x84, 0x57, 0x93,
+  0x93, 0x83, 0x93, 0x93, 0x93, 0x83, 0x93, 0x93, 0x83, 0x93, 0x93, 0x93,
+  0x83, 0x93, 0x93, 0x83, 0x93, 0x93, 0x93, 0x84, 0x59, 0x30, 0x75, 0x99,
+  0x62, 0x45, 0x41, 0x75, 0x21, 0x94, 0xC4, 0xC4, 0xC4, 0xB4, 0xC3, 0xC3,
+  0xD2, 0xD3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x81, 0x42, 0x82,
+  0x3C, 0x3C, 0x40, 0x95, 0xA8, 0x82, 0x44, 0x61, 0x74, 0xD4, 0xD4, 0xD3,
+  0xD3, 0xC3, 0xB4, 0xA8, 0xD5, 0xE4, 0xD4, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2,
+  0xE3, 0xE2, 0x54, 0x43, 0x6A, 0x86, 0xA0, 0xF0, 0x2E, 0x2E, 0x3D, 0x4C,
+  0x5B, 0x21, 0x2B, 0x21, 0x3A, 0x22, 0x39, 0x23, 0x2A, 0x14, 0x29, 0x14,
+  0x38, 0x15, 0x37, 0x16, 0x27, 0x16, 0x36, 0x26, 0x35, 0x27, 0x34, 0xF1,
+  0x1F, 0x0B, 0x3E, 0x2E, 0x3E, 0x3E, 0x3E, 0x27, 0x79, 0x79, 0x61, 0xF0,
+  0x1E, 0x2E, 0x3C, 0x6A, 0x8C, 0x5D, 0x3E, 0x3D, 0x3E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x1E, 0x2D, 0x2E, 0x25, 0x34, 0x35, 0x98, 0x69, 0xE3, 0xA5, 0xA4,
+  0xC4, 0xC3, 0xD3, 0xD3, 0xD4, 0xC4, 0x15, 0x7C, 0x45, 0x45, 0x33, 0x74,
+  0x33, 0x84, 0x13, 0x94, 0x13, 0x94, 0x12, 0xA4, 0x12, 0xA4, 0x12, 0x95,
+  0x12, 0x94, 0x22, 0x94, 0x31, 0x84, 0x42, 0x64, 0x62, 0x43, 0xA5, 0x80,
+  0x2E, 0x1E, 0x21, 0xA3, 0x11, 0xB2, 0xD2, 0xE2, 0xD2, 0xD3, 0xD2, 0xD2,
+  0xD3, 0xD2, 0xD3, 0xD2, 0xD2, 0xD3, 0xD2, 0xD3, 0xD2, 0xD2, 0xD3, 0xD2,
+  0xD3, 0xD0, 0x85, 0x92, 0x43, 0x62, 0x62, 0x52, 0x82, 0x42, 0x82, 0x42,
+  0x82, 0x42, 0x82, 0x43, 0x62, 0x64, 0x33, 0x65, 0x12, 0x95, 0xA7, 0x73,
+  0x25, 0x52, 0x64, 0x32, 0x83, 0x32, 0x93, 0x12, 0xB2, 0x12, 0xB2, 0x12,
+  0xB2, 0x12, 0xB2, 0x13, 0x92, 0x32, 0x82, 0x53, 0x52, 0x86, 0x60, 0x76,
+  0x84, 0x32, 0x63, 0x62, 0x44, 0x71, 0x34, 0x82, 0x24, 0x82, 0x14, 0x92,
+  0x14, 0x92, 0x14, 0x92, 0x14, 0x83, 0x14, 0x83, 0x14, 0x83, 0x24, 0x63,
+  0x35, 0x44, 0x48, 0x13, 0x64, 0x23, 0xC3, 0xC4, 0xC3, 0xB4, 0xB4, 0xA4,
+  0xA4, 0xA3, 0xD0, 0x42, 0x44, 0x34, 0x42, 0xFF, 0xF6, 0x24, 0x43, 0x44,
+  0x24, 0x53, 0x64, 0x54, 0x62, 0xFF, 0xFF, 0x71, 0x73, 0x63, 0x63, 0x72,
+  0x71, 0x71, 0x71, 0xF1, 0xF1, 0x2D, 0x5B, 0x6A, 0x6A, 0x5B, 0x5A, 0x6A,
+  0x6C, 0x4E, 0x5E, 0x6E, 0x6F, 0x05, 0xF0, 0x5F, 0x06, 0xE6, 0xE4, 0xF2,
+  0x10, 0x0F, 0xF6, 0xFF, 0xFF, 0xFF, 0x0F, 0xF6, 0x02, 0xF1, 0x4F, 0x06,
+  0xE6, 0xE6, 0xF0, 0x5F, 0x05, 0xF0, 0x6E, 0x4D, 0x5B, 0x6A, 0x6A, 0x5B,
+  0x5A, 0x6A, 0x6C, 0x4E, 0x1F, 0x20, 0x45, 0x62, 0x42, 0x32, 0x62, 0x22,
+  0x62, 0x22, 0x62, 0xA2, 0x92, 0x93, 0x83, 0x83, 0x82, 0x92, 0xA1, 0xA1,
+  0xB1, 0xA1, 0xFF, 0xF1, 0x29, 0x48, 0x49, 0x29, 0x97, 0xED, 0xA4, 0x74,
+  0x83, 0xB3, 0x63, 0xE2, 0x43, 0x73, 0x62, 0x23, 0x69, 0x31, 0x23, 0x53,
+  0x34, 0x36, 0x52, 0x53, 0x44, 0x52, 0x62, 0x54, 0x52, 0x62, 0x54, 0x42,
+  0x63, 0x54, 0x42, 0x63, 0x54, 0x42, 0x62, 0x51, 0x13, 0x42, 0x53, 0x51,
+  0x23, 0x32, 0x53, 0x42, 0x23, 0x33, 0x34, 0x32, 0x43, 0x35, 0x26, 0x54,
+  0x24, 0x44, 0x74, 0xF6, 0x59, 0x2A, 0xDE, 0x78, 0xE2, 0xF4, 0x2F, 0x33,
+  0xF2, 0x4F, 0x24, 0xF1, 0x5F, 0x11, 0x14, 0xE1, 0x24, 0xD2, 0x33, 0xD1,
+  0x43, 0xC1, 0x53, 0xC1, 0x53, 0xB1, 0x64, 0x9C, 0x9C, 0x82, 0x83, 0x81,
+  0x93, 0x72, 0x93, 0x62, 0xA4, 0x52, 0xA4, 0x42, 0xB4, 0x33, 0xB5, 0x16,
+  0x78, 0x5C, 0xBC, 0x94, 0x54, 0x84, 0x64, 0x74, 0x64, 0x73, 0x74, 0x73,
+  0x74, 0x64, 0x64, 0x73, 0x55, 0x8A, 0xAB, 0xA4, 0x44, 0x93, 0x64, 0x83,
+  0x74, 0x64, 0x74, 0x63, 0x84, 0x63, 0x84, 0x54, 0x84, 0x54, 0x74, 0x63,
+  0x75, 0x63, 0x56, 0x6E, 0x5D, 0x80, 0xA6, 0x41, 0x8D, 0x65, 0x55, 0x54,
+  0x93, 0x44, 0xA3, 0x34, 0xC1, 0x34, 0xD1, 0x34, 0xF1, 0x4F, 0x24, 0xF2,
+  0x4F, 0x14, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x33, 0xD1,
+  0x44, 0xB1, 0x64, 0x91, 0x75, 0x62, 0xAA, 0xD6, 0x90, 0x5D, 0xEE, 0xB4,
+  0x65, 0xA4, 0x84, 0x94, 0x94, 0x83, 0xA4, 0x83, 0xB4, 0x64, 0xB4, 0x63,
+  0xC4, 0x63, 0xC4, 0x54, 0xC4, 0x54, 0xC4, 0x53, 0xD4, 0x53, 0xC4, 0x54,
+  0xC4, 0x54, 0xB5, 0x53, 0xC4, 0x54, 0xB4, 0x64, 0xA4, 0x73, 0x95, 0x83,
+  0x76, 0x8F, 0x08, 0xEB, 0x5F, 0x27, 0xF0, 0x74, 0x83, 0x74, 0x91, 0x84,
+  0x91, 0x83, 0xF4, 0x36, 0x1B, 0x45, 0x2B, 0x35, 0x3B, 0xAB, 0xBB, 0x45,
+  0x2B, 0x36, 0x2B, 0x36, 0x1B, 0x46, 0x1B, 0x3F, 0x43, 0xF3, 0x4B, 0x16,
+  0x4A, 0x26, 0x3A, 0x36, 0x38, 0x46, 0xF1, 0x4F, 0x34, 0x5F, 0x27, 0xF0,
+  0x74, 0x83, 0x74, 0x91, 0x84, 0x91, 0x83, 0xA1, 0x83, 0xF3, 0x46, 0x1B,
+  0x36, 0x2B, 0x35, 0x2B, 0xBB, 0xBB, 0x36, 0x2B, 0x36, 0x2A, 0x46, 0x1B,
+  0x4F, 0x33, 0xF3, 0x4F, 0x34, 0xF3, 0x3F, 0x43, 0xF3, 0x5F, 0x09, 0xD0,
+  0xA6, 0x61, 0x8A, 0x31, 0x75, 0x65, 0x64, 0x94, 0x54, 0xB3, 0x44, 0xD1,
+  0x45, 0xD1, 0x44, 0xF3, 0x5F, 0x34, 0xF4, 0x4F, 0x35, 0xF3, 0x4A, 0xDC,
+  0x43, 0x4C, 0x34, 0x4C, 0x34, 0x4C, 0x35, 0x3C, 0x35, 0x4A, 0x37, 0x49,
+  0x38, 0x56, 0x49, 0xDC, 0x89, 0x59, 0x49, 0x75, 0x94, 0x94, 0xA3, 0xA4,
+  0xA3, 0xA3, 0xA4, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4, 0xA3,
+  0xA3, 0xAF, 0x2A, 0xF2, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4,
+  0xA3, 0xA4, 0x94, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4, 0x95,
+  0x79, 0x49, 0x50, 0x59, 0x75, 0x94, 0xA4, 0xA3, 0xB3, 0xB3, 0xA4, 0xA3,
+  0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0xA3, 0xB3,
+  0xA4, 0x89, 0x50, 0x89, 0xB4, 0xD4, 0xD3, 0xE3, 0xD4, 0xD4, 0xD3, 0xE3,
+  0xD4, 0xD3, 0xE3, 0xD4, 0xD4, 0xD3, 0xE3, 0xD4, 0xD3, 0xE3, 0x74, 0x24,
+  0x74, 0x23, 0x88, 0xA5, 0xB0, 0x59, 0x38, 0x75, 0x74, 0xA3, 0x83, 0xA4,
+  0x73, 0xB3, 0x72, 0xD3, 0x62, 0xE3, 0x42, 0xF0, 0x43, 0x2F, 0x13, 0x23,
+  0xF2, 0x31, 0x2F, 0x37, 0xF3, 0x8F, 0x23, 0x23, 0xF2, 0x32, 0x4F, 0x04,
+  0x34, 0xE3, 0x53, 0xE3, 0x54, 0xD3, 0x63, 0xC4, 0x64, 0xB3, 0x83, 0xB3,
+  0x84, 0x94, 0x85, 0x69, 0x39, 0x40, 0x59, 0xD5, 0xF0, 0x4F, 0x14, 0xF1,
+  0x3F, 0x23, 0xF2, 0x3F, 0x14, 0xF1, 0x3F, 0x23, 0xF1, 0x4F, 0x14, 0xF1,
+  0x3F, 0x23, 0xF1, 0x4F, 0x13, 0xF2, 0x3C, 0x13, 0x4B, 0x23, 0x4A, 0x24,
+  0x3B, 0x24, 0x39, 0x43, 0xF1, 0x2F, 0x32, 0x57, 0xD6, 0x75, 0xC5, 0xA4,
+  0xC5, 0xA4, 0xB5, 0xA5, 0xA2, 0x13, 0xA1, 0x13, 0xA1, 0x14, 0xA1, 0x13,
+  0x92, 0x13, 0xA2, 0x13, 0x82, 0x23, 0xA1, 0x24, 0x71, 0x24, 0xA1, 0x33,
+  0x62, 0x24, 0xA1, 0x33, 0x52, 0x33, 0xA2, 0x33, 0x51, 0x43, 0xA1, 0x43,
+  0x42, 0x34, 0xA1, 0x43, 0x32, 0x43, 0xA2, 0x43, 0x31, 0x53, 0xA2, 0x43,
+  0x22, 0x44, 0xA1, 0x53, 0x12, 0x54, 0xA1, 0x55, 0x63, 0xA2, 0x64, 0x63,
+  0xA1, 0x73, 0x64, 0x92, 0x72, 0x74, 0x93, 0x62, 0x65, 0x77, 0x41, 0x59,
+  0x50, 0x55, 0x88, 0x74, 0x95, 0x93, 0xA3, 0xA4, 0x92, 0xA5, 0x83, 0xA2,
+  0x12, 0x82, 0xB2, 0x13, 0x72, 0xA2, 0x23, 0x72, 0xA2, 0x32, 0x63, 0xA2,
+  0x33, 0x52, 0xB2, 0x42, 0x52, 0xA2, 0x53, 0x33, 0xA2, 0x62, 0x32, 0xB2,
+  0x62, 0x32, 0xA2, 0x73, 0x22, 0xA2, 0x82, 0x13, 0xA2, 0x85, 0xB2, 0x94,
+  0xA2, 0xA4, 0xA2, 0xA3, 0xA3, 0xB2, 0xA3, 0xB2, 0x87, 0xA1, 0x80, 0xC6,
+  0xEB, 0xA5, 0x54, 0x84, 0x84, 0x64, 0xA3, 0x54, 0xB4, 0x34, 0xC4, 0x25,
+  0xC4, 0x24, 0xD4, 0x15, 0xD4, 0x14, 0xDA, 0xD4, 0x15, 0xD4, 0x14, 0xD5,
+  0x14, 0xD4, 0x24, 0xC5, 0x24, 0xC4, 0x34, 0xB4, 0x53, 0xA4, 0x64, 0x84,
+  0x84, 0x55, 0xAB, 0xE7, 0xB0, 0x5D, 0xBD, 0xA3, 0x55, 0x84, 0x65, 0x73,
+  0x84, 0x73, 0x84, 0x73, 0x84, 0x64, 0x84, 0x63, 0x84, 0x73, 0x84, 0x64,
+  0x65, 0x7E, 0x83, 0x17, 0xB3, 0xF3, 0x4F, 0x33, 0xF4, 0x3F, 0x34, 0xF3,
+  0x4F, 0x33, 0xF4, 0x3F, 0x34, 0xF1, 0x8E, 0xC6, 0xEB, 0xB4, 0x54, 0x84,
+  0x83, 0x74, 0x94, 0x54, 0xB3, 0x44, 0xC4, 0x34, 0xC4, 0x24, 0xD4, 0x24,
+  0xD4, 0x14, 0xE4, 0x14, 0xDA, 0xD4, 0x14, 0xE4, 0x14, 0xD5, 0x14, 0xD4,
+  0x24, 0xC4, 0x34, 0xC4, 0x34, 0xB4, 0x53, 0xA4, 0x64, 0x84, 0x83, 0x73,
+  0xC4, 0x14, 0xF1, 0x3F, 0x42, 0xF5, 0x2E, 0x15, 0x96, 0x24, 0xF3, 0x41,
+  0x87, 0x70, 0x5C, 0xBC, 0x94, 0x54, 0x84, 0x64, 0x74, 0x64, 0x73, 0x74,
+  0x73, 0x74, 0x64, 0x64, 0x73, 0x56, 0x7C, 0x8B, 0xA4, 0x23, 0xC3, 0x34,
+  0xB3, 0x43, 0xA4, 0x43, 0xA3, 0x54, 0x93, 0x63, 0x84, 0x64, 0x74, 0x64,
+  0x73, 0x83, 0x73, 0x84, 0x54, 0x94, 0x28, 0x75, 0x10, 0x85, 0x31, 0x6B,
+  0x54, 0x44, 0x44, 0x63, 0x44, 0x71, 0x54, 0x71, 0x54, 0xD5, 0xD4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xD5, 0x31, 0x94, 0x31, 0x94, 0x31, 0x94, 0x23,
+  0x84, 0x24, 0x64, 0x35, 0x44, 0x41, 0x39, 0x41, 0x55, 0x60, 0x2F, 0x31,
+  0xF4, 0x13, 0x54, 0x43, 0x12, 0x63, 0x61, 0x12, 0x73, 0x61, 0x11, 0x74,
+  0x61, 0x94, 0xF1, 0x3F, 0x14, 0xF1, 0x4F, 0x13, 0xF2, 0x3F, 0x14, 0xF1,
+  0x4F, 0x13, 0xF2, 0x3F, 0x14, 0xF1, 0x3F, 0x23, 0xF1, 0x4F, 0x14, 0xF0,
+  0x5C, 0xB9, 0x1A, 0x57, 0x36, 0x94, 0x54, 0xB2, 0x54, 0xB2, 0x64, 0xB2,
+  0x64, 0xB2, 0x63, 0xC1, 0x64, 0xB2, 0x64, 0xB2, 0x63, 0xC1, 0x64, 0xC1,
+  0x64, 0xB2, 0x64, 0xB2, 0x63, 0xC1, 0x64, 0xB2, 0x64, 0xB2, 0x64, 0xB1,
+  0x74, 0xA2, 0x74, 0xA1, 0x94, 0x82, 0x95, 0x53, 0xBB, 0xE7, 0xC0, 0x08,
+  0x76, 0x15, 0xA4, 0x33, 0xC2, 0x44, 0xA2, 0x54, 0xA2, 0x54, 0x92, 0x64,
+  0x92, 0x73, 0x82, 0x83, 0x81, 0x93, 0x72, 0x94, 0x52, 0xA4, 0x51, 0xB4,
+  0x42, 0xC3, 0x41, 0xD3, 0x31, 0xE3, 0x31, 0xE3, 0x21, 0xF0, 0x5F, 0x15,
+  0xF2, 0x3F, 0x33, 0xF3, 0x2F, 0x41, 0xF0, 0x08, 0x28, 0x47, 0x15, 0x64,
+  0x84, 0x33, 0x74, 0x92, 0x44, 0x73, 0x82, 0x54, 0x73, 0x82, 0x54, 0x73,
+  0x81, 0x64, 0x64, 0x72, 0x73, 0x64, 0x62, 0x83, 0x51, 0x14, 0x52, 0x83,
+  0x51, 0x14, 0x42, 0x93, 0x41, 0x24, 0x41, 0xA3, 0x41, 0x33, 0x32, 0xA4,
+  0x21, 0x43, 0x31, 0xB4, 0x21, 0x43, 0x22, 0xB4, 0x11, 0x53, 0x21, 0xD3,
+  0x11, 0x53, 0x12, 0xD4, 0x63, 0x11, 0xE4, 0x65, 0xE3, 0x74, 0xF0, 0x37,
+  0x3F, 0x12, 0x83, 0xF1, 0x29, 0x1F, 0x21, 0xA1, 0xD0, 0x49, 0x47, 0x65,
+  0x75, 0x83, 0x92, 0xA4, 0x72, 0xB4, 0x62, 0xD3, 0x52, 0xE4, 0x33, 0xF0,
+  0x33, 0x2F, 0x14, 0x12, 0xF3, 0x5F, 0x44, 0xF5, 0x4F, 0x54, 0xF4, 0x6F,
+  0x22, 0x23, 0xF1, 0x23, 0x4F, 0x01, 0x53, 0xE2, 0x53, 0xD2, 0x64, 0xB2,
+  0x83, 0xA2, 0x94, 0x74, 0x95, 0x57, 0x4A, 0x30, 0x09, 0x46, 0x25, 0x83,
+  0x43, 0x92, 0x53, 0x82, 0x64, 0x72, 0x73, 0x62, 0x83, 0x52, 0x94, 0x32,
+  0xB3, 0x22, 0xC3, 0x21, 0xD3, 0x12, 0xD5, 0xF0, 0x3F, 0x04, 0xF0, 0x3F,
+  0x13, 0xF1, 0x3F, 0x04, 0xF0, 0x3F, 0x13, 0xF0, 0x4E, 0x5C, 0xA9, 0x5F,
+  0x24, 0xF2, 0x53, 0x95, 0x51, 0xB4, 0x52, 0xA4, 0x61, 0xA4, 0xF2, 0x4F,
+  0x24, 0xF3, 0x3F, 0x34, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF3, 0x3F,
+  0x34, 0xF2, 0x4F, 0x24, 0xA2, 0x54, 0xB1, 0x54, 0xB2, 0x53, 0xA4, 0x4F,
+  0x24, 0xF3, 0x40, 0x76, 0x72, 0xA2, 0xB2, 0xB2, 0xB2, 0xA2, 0xB2, 0xB2,
+  0xB2, 0xA2, 0xB2, 0xB2, 0xB2, 0xA2, 0xB2, 0xB2, 0xA3, 0xA2, 0xB2, 0xB2,
+  0xA2, 0xB2, 0xB2, 0xB2, 0xA2, 0xB2, 0xB6, 0x70, 0x03, 0x93, 0xA2, 0xA3,
+  0xA2, 0xA3, 0xA2, 0xA3, 0xA2, 0xA2, 0xA3, 0xA2, 0xA3, 0xA2, 0xA3, 0xA2,
+  0xA3, 0xA2, 0xA2, 0xA3, 0xA2, 0xA3, 0xA2, 0x66, 0x92, 0xA2, 0xA2, 0xA2,
+  0x93, 0x92, 0xA2, 0xA2, 0xA2, 0x92, 0xA2, 0xA2, 0xA2, 0x92, 0xA2, 0xA2,
+  0xA2, 0xA2, 0x92, 0xA2, 0xA2, 0xA2, 0x92, 0xA2, 0xA2, 0xA2, 0x66, 0x60,
+  0x63, 0xC3, 0xB5, 0xA2, 0x12, 0x92, 0x23, 0x82, 0x32, 0x72, 0x43, 0x62,
+  0x52, 0x53, 0x53, 0x42, 0x72, 0x33, 0x73, 0x22, 0x92, 0x13, 0x93, 0x0F,
+  0xF6, 0x03, 0x33, 0x34, 0x43, 0x42, 0x52, 0x74, 0x12, 0x63, 0x21, 0x12,
+  0x52, 0x53, 0x43, 0x52, 0x43, 0x62, 0x42, 0x63, 0x33, 0x62, 0x43, 0x62,
+  0x33, 0x63, 0x33, 0x63, 0x33, 0x53, 0x43, 0x41, 0x12, 0x21, 0x14, 0x22,
+  0x12, 0x12, 0x26, 0x24, 0x35, 0x33, 0x30, 0x62, 0xB5, 0xD3, 0xD3, 0xD2,
+  0xD3, 0xD3, 0xD3, 0xD2, 0xD3, 0x35, 0x53, 0x27, 0x42, 0x22, 0x34, 0x32,
+  0x11, 0x63, 0x24, 0x73, 0x23, 0x83, 0x23, 0x83, 0x13, 0x83, 0x23, 0x83,
+  0x23, 0x73, 0x32, 0x82, 0x33, 0x72, 0x43, 0x62, 0x53, 0x43, 0x86, 0x80,
+  0x75, 0x63, 0x32, 0x43, 0x33, 0x24, 0x43, 0x23, 0x94, 0x93, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x61, 0x34, 0x41, 0x48, 0x75, 0x50, 0xF0, 0x2C, 0x5E,
+  0x3E, 0x2F, 0x02, 0xE3, 0xE3, 0xE2, 0xF0, 0x29, 0x41, 0x37, 0x33, 0x46,
+  0x34, 0x36, 0x35, 0x35, 0x45, 0x35, 0x36, 0x25, 0x46, 0x25, 0x45, 0x34,
+  0x46, 0x25, 0x46, 0x25, 0x45, 0x26, 0x44, 0x33, 0x12, 0x52, 0x11, 0x22,
+  0x14, 0x62, 0x46, 0x43, 0x35, 0x84, 0x73, 0x22, 0x43, 0x42, 0x33, 0x52,
+  0x24, 0x42, 0x33, 0x42, 0x34, 0x32, 0x38, 0x54, 0x94, 0x94, 0x94, 0x61,
+  0x34, 0x41, 0x48, 0x75, 0x50, 0xF0, 0x4F, 0x02, 0x22, 0xD2, 0x32, 0xC2,
+  0xF3, 0x2F, 0x23, 0xF2, 0x2F, 0x32, 0xF2, 0x3D, 0xB9, 0xBD, 0x2F, 0x23,
+  0xF2, 0x3F, 0x23, 0xF2, 0x2F, 0x32, 0xF2, 0x3F, 0x23, 0xF2, 0x2F, 0x32,
+  0xF2, 0x3F, 0x23, 0xF2, 0x2F, 0x32, 0xF3, 0x2F, 0x22, 0xF3, 0x2C, 0x23,
+  0x2D, 0x22, 0x2F, 0x04, 0xF0, 0x76, 0x83, 0x35, 0x43, 0x54, 0x42, 0x63,
+  0x42, 0x73, 0x42, 0x73, 0x42, 0x64, 0x42, 0x54, 0x62, 0x34, 0x86, 0x91,
+  0xE2, 0xE4, 0xD7, 0x81, 0x26, 0x52, 0x64, 0x32, 0x83, 0x32, 0x92, 0x32,
+  0x92, 0x32, 0x82, 0x52, 0x62, 0x77, 0x70, 0x62, 0xB5, 0xD3, 0xD3, 0xD2,
+  0xE2, 0xD3, 0xD3, 0xD2, 0xD3, 0x43, 0x63, 0x35, 0x53, 0x22, 0x22, 0x52,
+  0x21, 0x42, 0x43, 0x11, 0x52, 0x44, 0x53, 0x44, 0x52, 0x53, 0x62, 0x43,
+  0x63, 0x43, 0x63, 0x43, 0x62, 0x52, 0x63, 0x21, 0x13, 0x63, 0x12, 0x13,
+  0x65, 0x22, 0x73, 0x40, 0x62, 0x64, 0x54, 0x62, 0xFF, 0xB2, 0x36, 0x54,
+  0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x53, 0x31, 0x22, 0x31,
+  0x35, 0x44, 0x50, 0xC2, 0xC4, 0xB4, 0xC2, 0xFF, 0xFF, 0xC2, 0x96, 0xC3,
+  0xC2, 0xD2, 0xC3, 0xC3, 0xC2, 0xD2, 0xC3, 0xC3, 0xC2, 0xD2, 0xC3, 0xC3,
+  0xC2, 0xC3, 0xC2, 0xD2, 0x72, 0x32, 0x82, 0x22, 0xA4, 0xA0, 0x62, 0xA5,
+  0xC3, 0xC3, 0xC2, 0xC3, 0xC3, 0xC3, 0xC2, 0xC3, 0x36, 0x33, 0x52, 0x53,
+  0x42, 0x62, 0x42, 0x63, 0x31, 0x83, 0x21, 0x92, 0x13, 0x96, 0x83, 0x23,
+  0x73, 0x23, 0x72, 0x42, 0x72, 0x43, 0x31, 0x13, 0x53, 0x11, 0x23, 0x55,
+  0x22, 0x73, 0x30, 0x62, 0x35, 0x53, 0x53, 0x52, 0x53, 0x53, 0x53, 0x52,
+  0x53, 0x53, 0x52, 0x53, 0x53, 0x53, 0x52, 0x53, 0x53, 0x53, 0x52, 0x21,
+  0x23, 0x21, 0x23, 0x11, 0x34, 0x43, 0xD0, 0x52, 0x42, 0x64, 0x35, 0x34,
+  0x46, 0x43, 0x21, 0x22, 0x31, 0x33, 0x42, 0x21, 0x32, 0x21, 0x33, 0x43,
+  0x11, 0x42, 0x11, 0x43, 0x44, 0x42, 0x11, 0x53, 0x43, 0x54, 0x52, 0x44,
+  0x53, 0x53, 0x43, 0x53, 0x63, 0x43, 0x53, 0x63, 0x42, 0x63, 0x62, 0x43,
+  0x62, 0x63, 0x21, 0x13, 0x53, 0x62, 0x21, 0x22, 0x63, 0x64, 0x32, 0x62,
+  0x73, 0x30, 0x52, 0x53, 0x45, 0x36, 0x53, 0x22, 0x23, 0x52, 0x22, 0x32,
+  0x53, 0x12, 0x33, 0x53, 0x11, 0x43, 0x54, 0x52, 0x63, 0x53, 0x54, 0x53,
+  0x53, 0x63, 0x53, 0x62, 0x53, 0x72, 0x31, 0x13, 0x72, 0x12, 0x23, 0x74,
+  0x32, 0x83, 0x30, 0x75, 0x83, 0x33, 0x53, 0x52, 0x43, 0x63, 0x23, 0x73,
+  0x13, 0x83, 0x13, 0x87, 0x77, 0x83, 0x13, 0x83, 0x13, 0x73, 0x23, 0x63,
+  0x33, 0x62, 0x53, 0x33, 0x85, 0x70, 0x83, 0x25, 0x75, 0x27, 0x83, 0x11,
+  0x35, 0x74, 0x54, 0x73, 0x64, 0x63, 0x74, 0x63, 0x74, 0x63, 0x73, 0x72,
+  0x74, 0x63, 0x73, 0x73, 0x64, 0x72, 0x64, 0x82, 0x54, 0x83, 0x43, 0xA8,
+  0xC2, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x22, 0xF2, 0x3F, 0x08, 0xC0, 0x84,
+  0x13, 0x64, 0x23, 0x54, 0x52, 0x44, 0x62, 0x43, 0x71, 0x44, 0x71, 0x34,
+  0x81, 0x34, 0x72, 0x24, 0x81, 0x34, 0x72, 0x34, 0x63, 0x34, 0x44, 0x45,
+  0x21, 0x13, 0x56, 0x23, 0x64, 0x33, 0xD2, 0xD3, 0xD3, 0xD2, 0xD3, 0xD3,
+  0xA8, 0x40, 0x15, 0x33, 0x43, 0x25, 0x33, 0x11, 0x22, 0x42, 0x11, 0x92,
+  0x11, 0x84, 0x94, 0x93, 0x94, 0x93, 0xA3, 0xA2, 0xA3, 0xA3, 0xA3, 0xA0,
+  0x54, 0x31, 0x42, 0x33, 0x42, 0x52, 0x42, 0x61, 0x43, 0x51, 0x43, 0xB3,
+  0xB3, 0xB3, 0xA3, 0x51, 0x52, 0x51, 0x52, 0x52, 0x42, 0x43, 0x32, 0x51,
+  0x24, 0x60, 0x61, 0x72, 0x62, 0x57, 0x18, 0x33, 0x62, 0x63, 0x63, 0x63,
+  0x62, 0x63, 0x63, 0x62, 0x72, 0x21, 0x33, 0x21, 0x35, 0x44, 0x50, 0x33,
+  0x62, 0x16, 0x53, 0x42, 0x63, 0x42, 0x53, 0x43, 0x53, 0x43, 0x53, 0x42,
+  0x54, 0x33, 0x44, 0x43, 0x41, 0x12, 0x43, 0x31, 0x22, 0x42, 0x32, 0x13,
+  0x33, 0x22, 0x22, 0x21, 0x12, 0x22, 0x32, 0x21, 0x15, 0x44, 0x23, 0x63,
+  0x30, 0x32, 0x62, 0x15, 0x63, 0x23, 0x63, 0x32, 0x72, 0x32, 0x72, 0x33,
+  0x61, 0x43, 0x52, 0x52, 0x42, 0x62, 0x41, 0x72, 0x31, 0x82, 0x21, 0x92,
+  0x11, 0xA3, 0xB2, 0xC1, 0x90, 0x32, 0x81, 0x52, 0x15, 0x72, 0x53, 0x32,
+  0x72, 0x53, 0x32, 0x63, 0x71, 0x33, 0x41, 0x12, 0x61, 0x43, 0x41, 0x12,
+  0x61, 0x52, 0x31, 0x22, 0x51, 0x62, 0x21, 0x42, 0x41, 0x62, 0x12, 0x42,
+  0x31, 0x72, 0x11, 0x52, 0x21, 0x83, 0x62, 0x11, 0x93, 0x62, 0x11, 0x92,
+  0x73, 0xA2, 0x72, 0xB1, 0x81, 0x80, 0x62, 0x53, 0x45, 0x34, 0x31, 0x23,
+  0x21, 0x22, 0x72, 0x12, 0xB4, 0xC3, 0xE2, 0xE2, 0xD3, 0xC5, 0xB1, 0x22,
+  0xA1, 0x32, 0x31, 0x51, 0x42, 0x21, 0x24, 0x55, 0x23, 0x72, 0x40, 0x52,
+  0x62, 0x36, 0x53, 0x53, 0x53, 0x53, 0x62, 0x63, 0x61, 0x63, 0x51, 0x82,
+  0x51, 0x83, 0x31, 0x93, 0x31, 0x93, 0x21, 0xB2, 0x21, 0xB2, 0x11, 0xC4,
+  0xC3, 0xD2, 0xE2, 0xE1, 0xE1, 0xE1, 0xE1, 0xB4, 0xC3, 0xC0, 0x3B, 0x3A,
+  0x41, 0x71, 0x41, 0x71, 0xC1, 0xC1, 0xC1, 0xC1, 0xC2, 0xC1, 0xC1, 0xC1,
+  0xC3, 0xA5, 0x81, 0x15, 0xC3, 0x32, 0x73, 0x22, 0x93, 0x30, 0x93, 0x82,
+  0x92, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x92, 0x93,
+  0x93, 0x74, 0x92, 0x91, 0xC1, 0xB2, 0xA2, 0x93, 0x93, 0x92, 0xA2, 0x93,
+  0x93, 0x92, 0xA2, 0xB3, 0x80, 0x0F, 0xFF, 0x10, 0x82, 0xB2, 0xB2, 0xA2,
+  0xA2, 0xA2, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0xB1, 0xB1,
+  0xA2, 0x94, 0x73, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x92,
+  0x93, 0x92, 0x83, 0x80, 0x34, 0xB9, 0x46, 0x49, 0xB4, 0x30 };
 
 const GFXglyph FreeSerifItalic18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
   {     0,  10,  23,  12,    1,  -22 },   // 0x21 '!'
-  {    29,  12,   9,  12,    4,  -22 },   // 0x22 '"'
-  {    43,  19,  23,  17,    0,  -22 },   // 0x23 '#'
-  {    98,  15,  29,  17,    1,  -25 },   // 0x24 '$'
-  {   153,  25,  23,  29,    3,  -22 },   // 0x25 '%'
-  {   225,  22,  23,  27,    3,  -22 },   // 0x26 '&'
-  {   289,   5,   9,   7,    4,  -22 },   // 0x27 '''
-  {   295,   9,  29,  12,    1,  -22 },   // 0x28 '('
-  {   328,   9,  29,  12,    1,  -22 },   // 0x29 ')'
-  {   361,  12,  14,  18,    5,  -22 },   // 0x2A '*'
-  {   382,  16,  18,  24,    4,  -17 },   // 0x2B '+'
-  {   418,   5,   8,   9,   -1,   -2 },   // 0x2C ','
-  {   423,   8,   2,  12,    2,   -8 },   // 0x2D '-'
-  {   425,   4,   4,   9,    1,   -3 },   // 0x2E '.'
-  {   427,  16,  23,  10,    0,  -22 },   // 0x2F '/'
-  {   473,  17,  24,  17,    1,  -23 },   // 0x30 '0'
-  {   524,  12,  24,  17,    2,  -23 },   // 0x31 '1'
-  {   560,  16,  23,  17,    1,  -22 },   // 0x32 '2'
-  {   606,  17,  24,  18,    0,  -23 },   // 0x33 '3'
-  {   657,  17,  24,  17,    0,  -23 },   // 0x34 '4'
-  {   708,  16,  23,  18,    0,  -22 },   // 0x35 '5'
-  {   754,  17,  24,  18,    1,  -23 },   // 0x36 '6'
-  {   805,  16,  23,  17,    3,  -22 },   // 0x37 '7'
-  {   851,  16,  24,  18,    1,  -23 },   // 0x38 '8'
-  {   899,  16,  24,  17,    1,  -23 },   // 0x39 '9'
-  {   947,   7,  15,   9,    2,  -14 },   // 0x3A ':'
-  {   961,   9,  20,   9,    1,  -14 },   // 0x3B ';'
-  {   984,  18,  18,  20,    2,  -17 },   // 0x3C '<'
-  {  1025,  18,   9,  23,    3,  -12 },   // 0x3D '='
-  {  1046,  18,  18,  20,    2,  -17 },   // 0x3E '>'
-  {  1087,  12,  23,  16,    4,  -22 },   // 0x3F '?'
-  {  1122,  24,  23,  27,    2,  -22 },   // 0x40 '@'
-  {  1191,  21,  23,  23,    0,  -22 },   // 0x41 'A'
-  {  1252,  21,  23,  21,    0,  -22 },   // 0x42 'B'
-  {  1313,  21,  23,  21,    2,  -22 },   // 0x43 'C'
-  {  1374,  25,  23,  25,    0,  -22 },   // 0x44 'D'
-  {  1446,  22,  23,  20,    0,  -22 },   // 0x45 'E'
-  {  1510,  22,  23,  20,    0,  -22 },   // 0x46 'F'
-  {  1574,  23,  23,  24,    2,  -22 },   // 0x47 'G'
-  {  1641,  27,  23,  25,    0,  -22 },   // 0x48 'H'
-  {  1719,  14,  23,  11,    0,  -22 },   // 0x49 'I'
-  {  1760,  17,  23,  15,    0,  -22 },   // 0x4A 'J'
-  {  1809,  25,  23,  22,    0,  -22 },   // 0x4B 'K'
-  {  1881,  20,  23,  20,    0,  -22 },   // 0x4C 'L'
-  {  1939,  31,  23,  29,    0,  -22 },   // 0x4D 'M'
-  {  2029,  26,  23,  24,    0,  -22 },   // 0x4E 'N'
-  {  2104,  23,  23,  23,    1,  -22 },   // 0x4F 'O'
-  {  2171,  22,  23,  20,    0,  -22 },   // 0x50 'P'
-  {  2235,  23,  29,  23,    1,  -22 },   // 0x51 'Q'
-  {  2319,  21,  23,  22,    0,  -22 },   // 0x52 'R'
-  {  2380,  17,  23,  16,    0,  -22 },   // 0x53 'S'
-  {  2429,  20,  23,  21,    3,  -22 },   // 0x54 'T'
-  {  2487,  23,  23,  25,    4,  -22 },   // 0x55 'U'
-  {  2554,  21,  23,  23,    5,  -22 },   // 0x56 'V'
-  {  2615,  29,  23,  31,    5,  -22 },   // 0x57 'W'
-  {  2699,  24,  23,  23,    0,  -22 },   // 0x58 'X'
-  {  2768,  19,  23,  21,    4,  -22 },   // 0x59 'Y'
-  {  2823,  22,  23,  20,    0,  -22 },   // 0x5A 'Z'
-  {  2887,  13,  28,  14,    1,  -22 },   // 0x5B '['
-  {  2933,  12,  23,  17,    4,  -22 },   // 0x5C '\'
-  {  2968,  12,  28,  14,    1,  -22 },   // 0x5D ']'
-  {  3010,  15,  13,  15,    0,  -22 },   // 0x5E '^'
-  {  3035,  18,   2,  17,    0,    3 },   // 0x5F '_'
-  {  3040,   6,   6,   9,    5,  -22 },   // 0x60 '`'
-  {  3045,  15,  15,  17,    1,  -14 },   // 0x61 'a'
-  {  3074,  16,  24,  17,    1,  -23 },   // 0x62 'b'
-  {  3122,  13,  15,  14,    1,  -14 },   // 0x63 'c'
-  {  3147,  17,  24,  18,    1,  -23 },   // 0x64 'd'
-  {  3198,  13,  15,  14,    1,  -14 },   // 0x65 'e'
-  {  3223,  20,  31,  15,   -3,  -23 },   // 0x66 'f'
-  {  3301,  16,  22,  15,   -1,  -14 },   // 0x67 'g'
-  {  3345,  16,  24,  17,    1,  -23 },   // 0x68 'h'
-  {  3393,   9,  23,   9,    1,  -22 },   // 0x69 'i'
-  {  3419,  15,  30,  10,   -3,  -22 },   // 0x6A 'j'
-  {  3476,  15,  24,  16,    1,  -23 },   // 0x6B 'k'
-  {  3521,   8,  25,   9,    1,  -23 },   // 0x6C 'l'
-  {  3546,  24,  15,  25,    0,  -14 },   // 0x6D 'm'
-  {  3591,  17,  15,  17,    0,  -14 },   // 0x6E 'n'
-  {  3623,  15,  15,  17,    1,  -14 },   // 0x6F 'o'
-  {  3652,  20,  22,  16,   -3,  -14 },   // 0x70 'p'
-  {  3707,  16,  22,  17,    1,  -14 },   // 0x71 'q'
-  {  3751,  13,  15,  13,    1,  -14 },   // 0x72 'r'
-  {  3776,  13,  15,  12,    0,  -14 },   // 0x73 's'
-  {  3801,   9,  18,   8,    1,  -17 },   // 0x74 't'
-  {  3822,  15,  15,  17,    1,  -14 },   // 0x75 'u'
-  {  3851,  14,  15,  16,    2,  -14 },   // 0x76 'v'
-  {  3878,  22,  15,  24,    1,  -14 },   // 0x77 'w'
-  {  3920,  16,  15,  15,   -1,  -14 },   // 0x78 'x'
-  {  3950,  16,  22,  16,    0,  -14 },   // 0x79 'y'
-  {  3994,  14,  18,  14,    0,  -14 },   // 0x7A 'z'
-  {  4026,  12,  30,  14,    2,  -23 },   // 0x7B '{'
-  {  4071,   2,  23,  10,    4,  -22 },   // 0x7C '|'
-  {  4077,  12,  31,  14,    0,  -24 },   // 0x7D '}'
-  {  4124,  17,   4,  19,    1,  -10 } }; // 0x7E '~'
+  {    22,  12,   9,  12,    4,  -22 },   // 0x22 '"'
+  {    41,  19,  23,  17,    0,  -22 },   // 0x23 '#'
+  {    86,  15,  29,  17,    1,  -25 },   // 0x24 '$'
+  {   141,  25,  23,  29,    3,  -22 },   // 0x25 '%'
+  {   213,  22,  23,  27,    3,  -22 },   // 0x26 '&'
+  {   267,   5,   9,   7,    4,  -22 },   // 0x27 '''
+  {   277,   9,  29,  12,    1,  -22 },   // 0x28 '('
+  {   307,   9,  29,  12,    1,  -22 },   // 0x29 ')'
+  {   337,  12,  14,  18,    5,  -22 },   // 0x2A '*'
+  {   362,  16,  18,  24,    4,  -17 },   // 0x2B '+'
+  {   381,   5,   8,   9,   -1,   -2 },   // 0x2C ','
+  {   390,   8,   2,  12,    2,   -8 },   // 0x2D '-'
+  {   392,   4,   4,   9,    1,   -3 },   // 0x2E '.'
+  {   396,  16,  23,  10,    0,  -22 },   // 0x2F '/'
+  {   420,  17,  24,  17,    1,  -23 },   // 0x30 '0'
+  {   465,  12,  24,  17,    2,  -23 },   // 0x31 '1'
+  {   490,  16,  23,  17,    1,  -22 },   // 0x32 '2'
+  {   519,  17,  24,  18,    0,  -23 },   // 0x33 '3'
+  {   547,  17,  24,  17,    0,  -23 },   // 0x34 '4'
+  {   584,  16,  23,  18,    0,  -22 },   // 0x35 '5'
+  {   609,  17,  24,  18,    1,  -23 },   // 0x36 '6'
+  {   648,  16,  23,  17,    3,  -22 },   // 0x37 '7'
+  {   674,  16,  24,  18,    1,  -23 },   // 0x38 '8'
+  {   719,  16,  24,  17,    1,  -23 },   // 0x39 '9'
+  {   759,   7,  15,   9,    2,  -14 },   // 0x3A ':'
+  {   769,   9,  20,   9,    1,  -14 },   // 0x3B ';'
+  {   784,  18,  18,  20,    2,  -17 },   // 0x3C '<'
+  {   805,  18,   9,  23,    3,  -12 },   // 0x3D '='
+  {   812,  18,  18,  20,    2,  -17 },   // 0x3E '>'
+  {   834,  12,  23,  16,    4,  -22 },   // 0x3F '?'
+  {   860,  24,  23,  27,    2,  -22 },   // 0x40 '@'
+  {   920,  21,  23,  23,    0,  -22 },   // 0x41 'A'
+  {   961,  21,  23,  21,    0,  -22 },   // 0x42 'B'
+  {  1002,  21,  23,  21,    2,  -22 },   // 0x43 'C'
+  {  1041,  25,  23,  25,    0,  -22 },   // 0x44 'D'
+  {  1084,  22,  23,  20,    0,  -22 },   // 0x45 'E'
+  {  1125,  22,  23,  20,    0,  -22 },   // 0x46 'F'
+  {  1164,  23,  23,  24,    2,  -22 },   // 0x47 'G'
+  {  1205,  27,  23,  25,    0,  -22 },   // 0x48 'H'
+  {  1251,  14,  23,  11,    0,  -22 },   // 0x49 'I'
+  {  1275,  17,  23,  15,    0,  -22 },   // 0x4A 'J'
+  {  1301,  25,  23,  22,    0,  -22 },   // 0x4B 'K'
+  {  1350,  20,  23,  20,    0,  -22 },   // 0x4C 'L'
+  {  1387,  31,  23,  29,    0,  -22 },   // 0x4D 'M'
+  {  1465,  26,  23,  24,    0,  -22 },   // 0x4E 'N'
+  {  1523,  23,  23,  23,    1,  -22 },   // 0x4F 'O'
+  {  1565,  22,  23,  20,    0,  -22 },   // 0x50 'P'
+  {  1603,  23,  29,  23,    1,  -22 },   // 0x51 'Q'
+  {  1658,  21,  23,  22,    0,  -22 },   // 0x52 'R'
+  {  1701,  17,  23,  16,    0,  -22 },   // 0x53 'S'
+  {  1738,  20,  23,  21,    3,  -22 },   // 0x54 'T'
+  {  1778,  23,  23,  25,    4,  -22 },   // 0x55 'U'
+  {  1823,  21,  23,  23,    5,  -22 },   // 0x56 'V'
+  {  1867,  29,  23,  31,    5,  -22 },   // 0x57 'W'
+  {  1941,  24,  23,  23,    0,  -22 },   // 0x58 'X'
+  {  1988,  19,  23,  21,    4,  -22 },   // 0x59 'Y'
+  {  2027,  22,  23,  20,    0,  -22 },   // 0x5A 'Z'
+  {  2067,  13,  28,  14,    1,  -22 },   // 0x5B '['
+  {  2096,  12,  23,  17,    4,  -22 },   // 0x5C '\'
+  {  2119,  12,  28,  14,    1,  -22 },   // 0x5D ']'
+  {  2148,  15,  13,  15,    0,  -22 },   // 0x5E '^'
+  {  2171,  18,   2,  17,    0,    3 },   // 0x5F '_'
+  {  2173,   6,   6,   9,    5,  -22 },   // 0x60 '`'
+  {  2179,  15,  15,  17,    1,  -14 },   // 0x61 'a'
+  {  2215,  16,  24,  17,    1,  -23 },   // 0x62 'b'
+  {  2256,  13,  15,  14,    1,  -14 },   // 0x63 'c'
+  {  2277,  17,  24,  18,    1,  -23 },   // 0x64 'd'
+  {  2321,  13,  15,  14,    1,  -14 },   // 0x65 'e'
+  {  2345,  20,  31,  15,   -3,  -23 },   // 0x66 'f'
+  {  2393,  16,  22,  15,   -1,  -14 },   // 0x67 'g'
+  {  2431,  16,  24,  17,    1,  -23 },   // 0x68 'h'
+  {  2476,   9,  23,   9,    1,  -22 },   // 0x69 'i'
+  {  2499,  15,  30,  10,   -3,  -22 },   // 0x6A 'j'
+  {  2530,  15,  24,  16,    1,  -23 },   // 0x6B 'k'
+  {  2571,   8,  25,   9,    1,  -23 },   // 0x6C 'l'
+  {  2599,  24,  15,  25,    0,  -14 },   // 0x6D 'm'
+  {  2654,  17,  15,  17,    0,  -14 },   // 0x6E 'n'
+  {  2691,  15,  15,  17,    1,  -14 },   // 0x6F 'o'
+  {  2718,  20,  22,  16,   -3,  -14 },   // 0x70 'p'
+  {  2759,  16,  22,  17,    1,  -14 },   // 0x71 'q'
+  {  2798,  13,  15,  13,    1,  -14 },   // 0x72 'r'
+  {  2820,  13,  15,  12,    0,  -14 },   // 0x73 's'
+  {  2846,   9,  18,   8,    1,  -17 },   // 0x74 't'
+  {  2867,  15,  15,  17,    1,  -14 },   // 0x75 'u'
+  {  2905,  14,  15,  16,    2,  -14 },   // 0x76 'v'
+  {  2933,  22,  15,  24,    1,  -14 },   // 0x77 'w'
+  {  2982,  16,  15,  15,   -1,  -14 },   // 0x78 'x'
+  {  3011,  16,  22,  16,    0,  -14 },   // 0x79 'y'
+  {  3046,  14,  18,  14,    0,  -14 },   // 0x7A 'z'
+  {  3070,  12,  30,  14,    2,  -23 },   // 0x7B '{'
+  {  3101,   2,  23,  10,    4,  -22 },   // 0x7C '|'
+  {  3104,  12,  31,  14,    0,  -24 },   // 0x7D '}'
+  {  3136,  17,   4,  19,    1,  -10 } }; // 0x7E '~'
 
 const GFXfont FreeSerifItalic18pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic18pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42, 1 };
 
-// Approx. 4805 bytes
+// Approx. 3814 bytes
@@ -118,6 +118,6 @@ const GFXglyph PicopixelGlyphs[] PROGMEM = {
 const GFXfont Picopixel PROGMEM = {
   (uint8_t  *)PicopixelBitmaps,
   (GFXglyph *)PicopixelGlyphs,
-  0x20, 0x7E, 7 };
+  0x20, 0x7E, 7, 0 };
 
 // Approx. 852 bytes
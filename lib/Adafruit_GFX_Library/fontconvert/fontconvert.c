@@ -8,6 +8,12 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+With -r as the first argument, glyph bitmaps are run-length encoded (see
+gfxfont.h) instead of bit-packed.  This pays off for larger sizes (roughly
+18pt and up), where it also draws faster as every run is a single line.
+Each encoded glyph is decoded again and compared against the rendered
+bitmap, and the sizes of both formats are reported on stderr.
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -19,37 +25,47 @@ See notes at end for glyph nomenclature & other tidbits.
 #ifndef ARDUINO
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <stdint.h>
 #include <ft2build.h>
 #include FT_GLYPH_H
 #include "../gfxfont.h" // Adafruit_GFX font structures
+#include "rle.h"        // Run-length encoding of glyphs
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
+// Hexadecimal byte write, formatted as a table
+void enbyte(uint8_t value) {
+	static uint8_t row = 0, firstCall = 1;
+	if(!firstCall) { // Format output table nicely
+		if(++row >= 12) {        // Last entry on line?
+			printf(",\n  "); //   Newline format output
+			row = 0;         //   Reset row counter
+		} else {                 // Not end of line
+			printf(", ");    //   Simple comma delim
+		}
+	}
+	printf("0x%02X", value); // Write byte value
+	firstCall = 0;           // Formatting flag
+}
+
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
-	static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+	static uint8_t sum = 0, bit = 0x80;
 	if(value) sum |= bit;    // Set bit if needed
 	if(!(bit >>= 1)) {       // Advance to next bit, end of byte reached?
-		if(!firstCall) { // Format output table nicely
-			if(++row >= 12) {        // Last entry on line?
-				printf(",\n  "); //   Newline format output
-				row = 0;         //   Reset row counter
-			} else {                 // Not end of line
-				printf(", ");    //   Simple comma delim
-			}
-		}
-		printf("0x%02X", sum); // Write byte value
-		sum       = 0;         // Clear for next byte
-		bit       = 0x80;      // Reset bit counter
-		firstCall = 0;         // Formatting flag
+		enbyte(sum);     // Write byte value
+		sum       = 0;   // Clear for next byte
+		bit       = 0x80; // Reset bit counter
 	}
 }
 
 int main(int argc, char *argv[]) {
 	int                i, j, err, size, first=' ', last='~',
-	                   bitmapOffset = 0, x, y, byte;
+	                   bitmapOffset = 0, x, y, byte,
+	                   compress = 0, rawSize = 0, count;
 	char              *fontName, c, *ptr;
 	FT_Library         library;
 	FT_Face            face;
@@ -57,17 +73,24 @@ int main(int argc, char *argv[]) {
 	FT_Bitmap         *bitmap;
 	FT_BitmapGlyphRec *g;
 	GFXglyph          *table;
-	uint8_t            bit;
+	uint8_t            bit, *pixels, *runs, *check;
+	int                n;
 
 	// Parse command line.  Valid syntaxes are:
-	//   fontconvert [filename] [size]
-	//   fontconvert [filename] [size] [last char]
-	//   fontconvert [filename] [size] [first char] [last char]
+	//   fontconvert [-r] [filename] [size]
+	//   fontconvert [-r] [filename] [size] [last char]
+	//   fontconvert [-r] [filename] [size] [first char] [last char]
 	// Unless overridden, default first and last chars are
 	// ' ' (space) and '~', respectively
 
+	if((argc > 1) && !strcmp(argv[1], "-r")) {
+		compress = 1;
+		argv++;
+		argc--;
+	}
+
 	if(argc < 3) {
-		fprintf(stderr, "Usage: %s fontfile size [first] [last]\n",
+		fprintf(stderr, "Usage: %s [-r] fontfile size [first] [last]\n",
 		  argv[0]);
 		return 1;
 	}
@@ -159,6 +182,7 @@ int main(int argc, char *argv[]) {
 
 		bitmap = &face->glyph->bitmap;
 		g      = (FT_BitmapGlyphRec *)glyph;
+		count  = bitmap->width * bitmap->rows;
 
 		// Minimal font and per-glyph information is stored to
 		// reduce flash space requirements.  Glyph bitmaps are
@@ -175,22 +199,61 @@ int main(int argc, char *argv[]) {
 		table[j].xOffset      = g->left;
 		table[j].yOffset      = 1 - g->top;
 
-		for(y=0; y < bitmap->rows; y++) {
-			for(x=0;x < bitmap->width; x++) {
-				byte = x / 8;
-				bit  = 0x80 >> (x & 7);
-				enbit(bitmap->buffer[
-				  y * bitmap->pitch + byte] & bit);
+		if(compress) {
+			// Worst case is one nibble per pixel plus the last run
+			if((!(pixels = malloc(count + 1))) ||
+			   (!(runs   = malloc(count + 1))) ||
+			   (!(check  = malloc(count + 1)))) {
+				fprintf(stderr, "Malloc error\n");
+				return 1;
+			}
+			for(y=0; y < bitmap->rows; y++) {
+				for(x=0;x < bitmap->width; x++) {
+					byte = x / 8;
+					bit  = 0x80 >> (x & 7);
+					pixels[y * bitmap->width + x] =
+					  (bitmap->buffer[
+					  y * bitmap->pitch + byte] & bit) != 0;
+				}
+			}
+
+			n = rle_encode(pixels, count, runs);
+			if(!rle_decode(runs, n, check, count) ||
+			   memcmp(pixels, check, count)) {
+				fprintf(stderr, "RLE round trip failed for "
+				  "char '%c'\n", i);
+				return 1;
+			}
+
+			// Two nibbles per byte, pad the last one with 0
+			for(x=0; x < n; x += 2) {
+				enbyte((runs[x] << 4) |
+				  ((x + 1 < n) ? runs[x + 1] : 0));
+			}
+			bitmapOffset += (n + 1) / 2;
+			rawSize      += (count + 7) / 8;
+
+			free(pixels);
+			free(runs);
+			free(check);
+		} else {
+			for(y=0; y < bitmap->rows; y++) {
+				for(x=0;x < bitmap->width; x++) {
+					byte = x / 8;
+					bit  = 0x80 >> (x & 7);
+					enbit(bitmap->buffer[
+					  y * bitmap->pitch + byte] & bit);
+				}
 			}
-		}
 
-		// Pad end of char bitmap to next byte boundary if needed
-		int n = (bitmap->width * bitmap->rows) & 7;
-		if(n) { // Pixel count not an even multiple of 8?
-			n = 8 - n; // # bits to next multiple
-			while(n--) enbit(0);
+			// Pad end of char bitmap to next byte boundary if needed
+			n = count & 7;
+			if(n) { // Pixel count not an even multiple of 8?
+				n = 8 - n; // # bits to next multiple
+				while(n--) enbit(0);
+			}
+			bitmapOffset += (count + 7) / 8;
 		}
-		bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
 
 		FT_Done_Glyph(glyph);
 	}
@@ -225,17 +288,26 @@ int main(int argc, char *argv[]) {
 	printf("  (GFXglyph *)%sGlyphs,\n", fontName);
 	if (face->size->metrics.height == 0) {
       // No face height info, assume fixed width and get from a glyph.
-		printf("  0x%02X, 0x%02X, %d };\n\n",
-			first, last, table[0].height);
+		printf("  0x%02X, 0x%02X, %d, %d };\n\n",
+			first, last, table[0].height, compress);
 	} else {
-		printf("  0x%02X, 0x%02X, %ld };\n\n",
-			first, last, face->size->metrics.height >> 6);
+		printf("  0x%02X, 0x%02X, %ld, %d };\n\n",
+			first, last, face->size->metrics.height >> 6, compress);
 	}
 	printf("// Approx. %d bytes\n",
 	  bitmapOffset + (last - first + 1) * 7 + 7);
 	// Size estimate is based on AVR struct and pointer sizes;
 	// actual size may vary.
 
+	if(compress) {
+		fprintf(stderr, "%s: %d bitmap bytes run-length encoded, "
+		  "%d bytes bit-packed\n", fontName, bitmapOffset, rawSize);
+		if(bitmapOffset > rawSize) {
+			fprintf(stderr, "Warning: run-length encoding is larger "
+			  "for this font, consider leaving out -r\n");
+		}
+	}
+
 	FT_Done_FreeType(library);
 
 	return 0;
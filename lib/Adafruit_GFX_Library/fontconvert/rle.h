@@ -0,0 +1,41 @@
+// Run-length encoding of glyph bitmaps for 'fontconvert -r' (see gfxfont.h).
+// Shared with tools/framebuffer, which expands a bundled run-length encoded
+// font with it to check Adafruit_GFX::drawChar() against bit-packed glyphs.
+
+#ifndef _RLE_H_
+#define _RLE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define RUN_MAX 15 // Longest run in one nibble, also means 'continued'
+
+// Run-length encode 'n' pixels (one byte each, nonzero is set) into
+// nibbles, one per byte of 'runs'.  Returns the number of nibbles.
+static inline int rle_encode(const uint8_t *pixels, int n, uint8_t *runs) {
+	int     i = 0, count = 0, run;
+	uint8_t set = 0;
+	while(i < n) {
+		for(run = 0; (i < n) && (!pixels[i] == !set); i++) run++;
+		for(; run >= RUN_MAX; run -= RUN_MAX) runs[count++] = RUN_MAX;
+		if(run || (i < n)) runs[count++] = run; // May be 0
+		set = !set;
+	}
+	return count;
+}
+
+// Decode nibbles back into 'n' pixels the same way Adafruit_GFX::drawChar()
+// does.  Returns 0 if the nibbles don't cover exactly 'n' pixels.
+static inline int rle_decode(const uint8_t *runs, int count, uint8_t *pixels, int n) {
+	int     i, j = 0;
+	uint8_t set = 0;
+	for(i = 0; (i < count) && (j < n); i++) {
+		if(j + runs[i] > n) return 0;
+		memset(&pixels[j], set, runs[i]);
+		j += runs[i];
+		if(runs[i] != RUN_MAX) set = !set;
+	}
+	return (i == count) && (j == n);
+}
+
+#endif // _RLE_H_
@@ -0,0 +1,61 @@
+// Span tables for filled circles of a fixed radius.
+// A span table holds, for every row from the center of the circle outwards,
+// the half-width of the filled circle on that row. The rows are identical to
+// the midpoint circle drawn by Adafruit_GFX::fillCircle(), so code that draws
+// a circle of a known radius row by row can read its spans from a table
+// instead of running the midpoint algorithm on every call. GFXcircle<r>::spans
+// builds the table for radius 'r' at compile time and stores it in PROGMEM.
+
+#ifndef _GFXCIRCLE_H_
+#define _GFXCIRCLE_H_
+
+/// @cond GFXCIRCLE_INTERNAL
+constexpr int16_t gfxCircleMax(int16_t a, int16_t b) {
+	return a > b ? a : b;
+}
+
+constexpr int16_t gfxCircleWalk(int16_t d, int16_t x, int16_t y, int16_t f,
+  int16_t w);
+
+// One step of the midpoint algorithm, f is the decision variable.
+constexpr int16_t gfxCircleStep(int16_t d, int16_t x, int16_t y, int16_t f,
+  int16_t w) {
+	return f >= 0
+	  ? gfxCircleWalk(d, x + 1, y - 1, f - 2 * (y - 1) + 2 * (x + 1) + 1, w)
+	  : gfxCircleWalk(d, x + 1, y, f + 2 * (x + 1) + 1, w);
+}
+
+// Every octant point (x, y) covers the rows up to y with a half-width of x,
+// and (mirrored) the rows up to x with a half-width of y.
+constexpr int16_t gfxCircleWalk(int16_t d, int16_t x, int16_t y, int16_t f,
+  int16_t w) {
+	return x > y ? w : gfxCircleStep(d, x, y, f,
+	  gfxCircleMax(w, x >= d ? y : (y >= d ? x : -1)));
+}
+/// @endcond
+
+/// Half-width of the row 'd' rows away from the center of a circle of radius 'r'
+constexpr int16_t gfxCircleHalfWidth(int16_t r, int16_t d) {
+	return gfxCircleWalk(d, 0, r, 1 - r, -1);
+}
+
+/// @cond GFXCIRCLE_INTERNAL
+template <int16_t R, uint8_t N, uint8_t... D>
+struct GFXcircleTable : GFXcircleTable<R, N - 1, N - 1, D...> {};
+
+template <int16_t R, uint8_t... D>
+struct GFXcircleTable<R, 0, D...> {
+	static const uint8_t spans[sizeof...(D)] PROGMEM;
+};
+
+template <int16_t R, uint8_t... D>
+const uint8_t GFXcircleTable<R, 0, D...>::spans[sizeof...(D)] PROGMEM = {
+	(uint8_t)gfxCircleHalfWidth(R, D)...
+};
+/// @endcond
+
+/// Compile-time span table (r + 1 entries, in PROGMEM) for a circle of radius R
+template <int16_t R>
+struct GFXcircle : GFXcircleTable<R, R + 1> {};
+
+#endif // _GFXCIRCLE_H_
@@ -3,6 +3,13 @@
 // To use a font in your Arduino sketch, #include the corresponding .h
 // file and pass address of GFXfont struct to setFont().  Pass NULL to
 // revert to 'classic' fixed-space bitmap font.
+//
+// Fonts converted with 'fontconvert -r' store each glyph bitmap as 4-bit
+// run lengths instead of bits, high nibble first. Runs alternate between
+// unset and set pixels, starting with unset ones, and continue from the end
+// of one row into the next. A run of 15 is followed by more pixels of the
+// same kind, so longer runs are split as 15, 15, ..., remainder (which can
+// be 0). Every glyph starts on a byte boundary.
 
 #ifndef _GFXFONT_H_
 #define _GFXFONT_H_
@@ -24,6 +31,7 @@ typedef struct {
 	uint8_t   first;       ///< ASCII extents (first char)
         uint8_t   last;        ///< ASCII extents (last char)
 	uint8_t   yAdvance;    ///< Newline distance (y axis)
+	uint8_t   compressed;  ///< Nonzero if bitmaps are run-length encoded
 } GFXfont;
 
 #endif // _GFXFONT_H_
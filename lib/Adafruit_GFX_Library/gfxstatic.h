@@ -0,0 +1,66 @@
+// Statically bound drawing primitives for address-window displays.
+// Adafruit_GFX reaches the transaction primitives through virtual functions,
+// so every rectangle or line costs an indirect call and nothing can be
+// inlined into the caller. A display class D derives from GFXstatic<D> next
+// to Adafruit_SPITFT and pulls the primitives below into its own scope with
+// using-declarations: calls made on an object of type D then compile to
+// direct calls of D::setAddrWindow() and writeColor(), with the clipping
+// inlined, while calls through an Adafruit_GFX pointer or reference still go
+// through the virtual functions and behave exactly as before.
+//
+// Only rectangles and lines are covered. Text, circles (fillCircleHelper())
+// and everything else Adafruit_GFX draws still reach the display through
+// virtual calls. The calls are qualified with D::, so they stay direct in
+// classes derived from D as well.
+
+#ifndef _GFXSTATIC_H_
+#define _GFXSTATIC_H_
+
+/// Compile-time bound transaction primitives of display class D (CRTP)
+template <class D>
+class GFXstatic {
+  public:
+	/// Write a filled rectangle, clipped like Adafruit_GFX::clipRect() (must have a transaction in progress)
+	inline void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+	  uint16_t color) {
+		D &d = display();
+		if(!d.clipRect(&x, &y, &w, &h)) return;
+
+		d.D::setAddrWindow(x, y, w, h);
+		d.writeColor(color, (uint32_t)w * h);
+	}
+
+	/// Write a horizontal line (must have a transaction in progress)
+	inline void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+		writeFillRect(x, y, w, 1, color);
+	}
+
+	/// Write a vertical line (must have a transaction in progress)
+	inline void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+		writeFillRect(x, y, 1, h, color);
+	}
+
+	/// Fill a rectangle in a transaction of its own
+	inline void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+	  uint16_t color) {
+		D &d = display();
+		d.D::startWrite();
+		writeFillRect(x, y, w, h, color);
+		d.D::endWrite();
+	}
+
+	/// Draw a horizontal line in a transaction of its own
+	inline void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+		fillRect(x, y, w, 1, color);
+	}
+
+	/// Draw a vertical line in a transaction of its own
+	inline void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+		fillRect(x, y, 1, h, color);
+	}
+
+  private:
+	inline D &display(void) { return static_cast<D &>(*this); }
+};
+
+#endif // _GFXSTATIC_H_
@@ -77,6 +77,8 @@
 #define MADCTL_BGR 0x08  ///< Blue-Green-Red pixel order
 #define MADCTL_MH  0x04  ///< LCD refresh right to left
 
+#define WINDOW_UNKNOWN 0xFFFFFFFF  ///< Address arguments no window can have
+
 /**************************************************************************/
 /*!
     @brief  Instantiate Adafruit ILI9341 driver with software SPI
@@ -90,6 +92,8 @@
 /**************************************************************************/
 Adafruit_ILI9341::Adafruit_ILI9341(int8_t cs, int8_t dc, int8_t mosi,
         int8_t sclk, int8_t rst, int8_t miso) : Adafruit_SPITFT(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT, cs, dc, mosi, sclk, rst, miso) {
+    _stripOpen = false;
+    _windowColumns = _windowPages = WINDOW_UNKNOWN;
 }
 
 /**************************************************************************/
@@ -101,6 +105,8 @@ Adafruit_ILI9341::Adafruit_ILI9341(int8_t cs, int8_t dc, int8_t mosi,
 */
 /**************************************************************************/
 Adafruit_ILI9341::Adafruit_ILI9341(int8_t cs, int8_t dc, int8_t rst) : Adafruit_SPITFT(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT, cs, dc, rst) {
+    _stripOpen = false;
+    _windowColumns = _windowPages = WINDOW_UNKNOWN;
 }
 
 static const uint8_t PROGMEM initcmd[] = {
@@ -227,7 +233,27 @@ void Adafruit_ILI9341::scrollTo(uint16_t y) {
 
 /**************************************************************************/
 /*!
-    @brief   Set the "address window" - the rectangle we will write to RAM with the next chunk of SPI data writes. The ILI9341 will automatically wrap the data as each row is filled
+    @brief   Set the fixed areas at both ends of the scrolling area. Lines in
+             between scroll as a ring with scrollTo(); they run along the long
+             side of the panel, so landscape rotations scroll sideways.
+    @param   top     Fixed lines before the scrolling area
+    @param   bottom  Fixed lines after the scrolling area
+*/
+/**************************************************************************/
+void Adafruit_ILI9341::setScrollMargins(uint16_t top, uint16_t bottom) {
+    if(top + bottom > ILI9341_TFTHEIGHT) return;
+    startWrite();
+    writeCommand(ILI9341_VSCRDEF);
+    SPI_WRITE16(top);
+    SPI_WRITE16(ILI9341_TFTHEIGHT - top - bottom);
+    SPI_WRITE16(bottom);
+    endWrite();
+}
+
+/**************************************************************************/
+/*!
+    @brief   Set the "address window" - the rectangle we will write to RAM with the next chunk of SPI data writes. The ILI9341 will automatically wrap the data as each row is filled.
+    The column and page ranges the controller already has are not sent again.
     @param   x  TFT memory 'x' origin
     @param   y  TFT memory 'y' origin
     @param   w  Width of rectangle
@@ -237,11 +263,68 @@ void Adafruit_ILI9341::scrollTo(uint16_t y) {
 void Adafruit_ILI9341::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     uint32_t xa = ((uint32_t)x << 16) | (x+w-1);
     uint32_t ya = ((uint32_t)y << 16) | (y+h-1);
-    writeCommand(ILI9341_CASET); // Column addr set
-    SPI_WRITE32(xa);
-    writeCommand(ILI9341_PASET); // Row addr set
-    SPI_WRITE32(ya);
-    writeCommand(ILI9341_RAMWR); // write to RAM
+    SPI_PROFILE_WINDOW();
+    if(xa != _windowColumns) {
+        Adafruit_SPITFT::writeCommand(ILI9341_CASET); // Column addr set
+        SPI_WRITE32(xa);
+        _windowColumns = xa;
+    } else {
+        SPI_PROFILE_ELIDED();
+    }
+    if(ya != _windowPages) {
+        Adafruit_SPITFT::writeCommand(ILI9341_PASET); // Row addr set
+        SPI_WRITE32(ya);
+        _windowPages = ya;
+    } else {
+        SPI_PROFILE_ELIDED();
+    }
+    Adafruit_SPITFT::writeCommand(ILI9341_RAMWR); // write to RAM
+    _stripOpen = false;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Start a strip: an address window for a run of adjacent tiles or
+    rows that is written in several parts. Write the pixels of the first part
+    like after setAddrWindow(), and use continueStrip() before every next part.
+    @param   x  TFT memory 'x' origin
+    @param   y  TFT memory 'y' origin
+    @param   w  Width of the strip
+    @param   h  Height of the strip
+*/
+/**************************************************************************/
+void Adafruit_ILI9341::startStrip(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    setAddrWindow(x, y, w, h);
+    _stripOpen = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Resume the pixel data of a strip with Memory Write Continue, so
+    the window does not have to be sent again. The transaction may have been
+    ended in between.
+    @return  False if another window was set or any other command was sent
+    since startStrip(). The strip has to be started again then.
+*/
+/**************************************************************************/
+boolean Adafruit_ILI9341::continueStrip(void) {
+    if(!_stripOpen) return false;
+    Adafruit_SPITFT::writeCommand(ILI9341_RAMWRC);
+    return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Write a command byte (must have a transaction in progress). Any
+    command may move the address window or the write position, so both are
+    forgotten; this covers begin(), setRotation(), scrollTo() and raw commands.
+    @param   cmd  The 8-bit command to send
+*/
+/**************************************************************************/
+void Adafruit_ILI9341::writeCommand(uint8_t cmd) {
+    _windowColumns = _windowPages = WINDOW_UNKNOWN;
+    _stripOpen = false;
+    Adafruit_SPITFT::writeCommand(cmd);
 }
 
 /**************************************************************************/
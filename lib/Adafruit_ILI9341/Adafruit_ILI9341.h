@@ -74,9 +74,11 @@
 #define ILI9341_RAMRD      0x2E     ///< Memory Read
 
 #define ILI9341_PTLAR      0x30     ///< Partial Area
+#define ILI9341_VSCRDEF    0x33     ///< Vertical Scrolling Definition
 #define ILI9341_MADCTL     0x36     ///< Memory Access Control
 #define ILI9341_VSCRSADD   0x37     ///< Vertical Scrolling Start Address
 #define ILI9341_PIXFMT     0x3A     ///< COLMOD: Pixel Format Set
+#define ILI9341_RAMWRC     0x3C     ///< Memory Write Continue
 
 #define ILI9341_FRMCTR1    0xB1     ///< Frame Rate Control (In Normal Mode/Full Colors)
 #define ILI9341_FRMCTR2    0xB2     ///< Frame Rate Control (In Idle Mode/8 colors)
@@ -123,7 +125,7 @@
 #define ILI9341_PINK        0xFC18  ///< 255, 130, 198
 
 ///< Class to manage hardware interface with ILI9341 chipset (also seems to work with ILI9340)
-class Adafruit_ILI9341 : public Adafruit_SPITFT {
+class Adafruit_ILI9341 : public Adafruit_SPITFT, public GFXstatic<Adafruit_ILI9341> {
     public:
         Adafruit_ILI9341(int8_t _CS, int8_t _DC, int8_t _MOSI, int8_t _SCLK, int8_t _RST = -1, int8_t _MISO = -1);
         Adafruit_ILI9341(int8_t _CS, int8_t _DC, int8_t _RST = -1);
@@ -132,11 +134,30 @@ class Adafruit_ILI9341 : public Adafruit_SPITFT {
         void    setRotation(uint8_t r);
         void    invertDisplay(boolean i);
         void    scrollTo(uint16_t y);
+        void    setScrollMargins(uint16_t top, uint16_t bottom);
 
         // Transaction API not used by GFX
         void    setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+        void    startStrip(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+        boolean continueStrip(void);
 
         uint8_t readcommand8(uint8_t reg, uint8_t index=0);
+
+        // Rectangles and lines, bound at compile time on an Adafruit_ILI9341
+        using   GFXstatic<Adafruit_ILI9341>::writeFillRect;
+        using   GFXstatic<Adafruit_ILI9341>::writeFastHLine;
+        using   GFXstatic<Adafruit_ILI9341>::writeFastVLine;
+        using   GFXstatic<Adafruit_ILI9341>::fillRect;
+        using   GFXstatic<Adafruit_ILI9341>::drawFastHLine;
+        using   GFXstatic<Adafruit_ILI9341>::drawFastVLine;
+
+    protected:
+        void    writeCommand(uint8_t cmd);
+
+    private:
+        boolean  _stripOpen;      ///< The write position is still where the strip stopped
+        uint32_t _windowColumns;  ///< CASET arguments the controller has, if known
+        uint32_t _windowPages;    ///< PASET arguments the controller has, if known
 };
 
 #endif // _ADAFRUIT_ILI9341H_
@@ -77,8 +77,9 @@ void bomb_explode(world_t *world, bomb_t *bomb) {
             x_temp += bomb_explode_addition[i][0];
             y_temp += bomb_explode_addition[i][1];
 
-            // Check if location is outside screen.
-            if (x_temp > WORLD_WIDTH || x_temp < 0 || y_temp > WORLD_HEIGHT || y_temp < 0)
+            // Check if location is outside screen. The location is unsigned, so
+            // going past the left or top edge wraps around to a large value.
+            if (x_temp > WORLD_WIDTH || y_temp > WORLD_HEIGHT)
                 continue;
 
             tile_t tile_temp = world_get_tile(world, x_temp, y_temp);
@@ -0,0 +1,160 @@
+#include "canvas.h"
+
+#include "defines.h"
+#include "render.h"
+#include "sprite.h"
+
+// The run of pixels that has not been sent yet.
+static uint16_t canvas_color;
+static uint32_t canvas_run;
+
+// The pending strip, in pixels, and the next row of it to draw.
+static canvas_cell_t canvas_strip_cells[RENDER_STRIP_SIZE];
+static int16_t canvas_strip_left;
+static int16_t canvas_strip_top;
+static int16_t canvas_strip_width;
+static int16_t canvas_strip_height;
+static int16_t canvas_strip_row = 0;
+
+/*******************
+ * Local functions *
+ *******************/
+
+// Add pixels to the stream. Pixels of the same color are sent as a single run,
+// also when they belong to different cells or rows.
+inline void canvas_emit(uint16_t color, uint16_t count) {
+    if (!count)
+        return;
+
+    if (canvas_run && color != canvas_color) {
+        tft.writeColor(canvas_color, canvas_run);
+        canvas_run = 0;
+    }
+    canvas_color = color;
+    canvas_run += count;
+}
+
+// Look up the colors of a row of cells. The player takes the place of the
+// circle of the tile, as both have the same shape. Nibbles that are no tile
+// come out black.
+static void canvas_load_row(world_t *world, uint8_t x, uint8_t y, uint8_t width, canvas_cell_t *cells) {
+    for (uint8_t i = 0; i < width; i++) {
+        canvas_cell_t *cell = &cells[i];
+        render_tile_colors(world_get_tile(world, x + i, y), &cell->background, &cell->foreground);
+
+        player_t *player = world_get_player(world, x + i, y);
+        if (player)
+            cell->foreground = render_player_color(player);
+    }
+}
+
+// Add one row of pixels of a row of cells to the stream, clipped to the given
+// width in pixels.
+static void canvas_emit_row(canvas_cell_t *cells, uint8_t row, int16_t pixel_width) {
+    for (uint8_t i = 0; pixel_width > 0; i++) {
+        int16_t cell_width = pixel_width < WORLD_TILE_SIZE ? pixel_width : WORLD_TILE_SIZE;
+        canvas_cell_t *cell = &cells[i];
+
+        if (cell->foreground == cell->background) {
+            canvas_emit(cell->background, cell_width);
+        } else {
+            uint8_t span_left, span_run;
+            sprite_read_span(row, cell_width, &span_left, &span_run);
+            canvas_emit(cell->background, span_left);
+            canvas_emit(cell->foreground, span_run);
+            canvas_emit(cell->background, cell_width - span_left - span_run);
+        }
+        pixel_width -= cell_width;
+    }
+}
+
+// Clip a rectangle of cells against the right and bottom edges of the screen.
+// Returns false if nothing of it is visible. In a scrolling view the rectangle
+// must not wrap around the scrolling area.
+static bool canvas_clip(uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                        int16_t *left, int16_t *top, int16_t *pixel_width, int16_t *pixel_height) {
+    *left = render_column_left(x);
+    *top = WORLD_TILE_SIZE * y;
+    *pixel_width = tft.width() - *left;
+    *pixel_height = tft.height() - *top;
+    if (*pixel_width <= 0 || *pixel_height <= 0)
+        return false;
+
+    if (*pixel_width > WORLD_TILE_SIZE * width)
+        *pixel_width = WORLD_TILE_SIZE * width;
+    if (*pixel_height > WORLD_TILE_SIZE * height)
+        *pixel_height = WORLD_TILE_SIZE * height;
+    return true;
+}
+
+/************************
+ * Accessible functions *
+ ************************/
+
+// Composite a rectangle of cells and stream it through a single address window,
+// one row of pixels at a time. Cells beyond the screen edges are clipped.
+void canvas_draw(world_t *world, uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
+    int16_t left, top, pixel_width, pixel_height;
+    if (!canvas_clip(x, y, width, height, &left, &top, &pixel_width, &pixel_height))
+        return;
+
+    canvas_cell_t cells[WORLD_WIDTH];
+
+    render_begin();
+    tft.setAddrWindow(left, top, pixel_width, pixel_height);
+    canvas_run = 0;
+
+    for (int16_t pixel_y = 0; pixel_y < pixel_height; pixel_y++) {
+        uint8_t row = pixel_y % WORLD_TILE_SIZE;
+        if (!row)
+            canvas_load_row(world, x, y + pixel_y / WORLD_TILE_SIZE, width, cells);
+        canvas_emit_row(cells, row, pixel_width);
+    }
+
+    if (canvas_run)
+        tft.writeColor(canvas_color, canvas_run);
+
+    render_end();
+}
+
+// Start a strip of cells. Nothing is sent until canvas_strip_draw().
+void canvas_strip_start(uint8_t x, uint8_t y, uint8_t width, const canvas_cell_t *cells) {
+    canvas_strip_row = 0;
+    if (!canvas_clip(x, y, width, 1, &canvas_strip_left, &canvas_strip_top, &canvas_strip_width, &canvas_strip_height))
+        canvas_strip_height = 0;
+    memcpy(canvas_strip_cells, cells, width * sizeof(canvas_cell_t));
+}
+
+// Draw the next row of pixels of the pending strip. The window is only sent for
+// the first row. The other rows follow the previous one, after a Memory Write
+// Continue if the transaction was ended in between. Returns true if more rows
+// are pending.
+bool canvas_strip_draw(bool resume) {
+    if (!canvas_strip_pending())
+        return false;
+
+    render_begin();
+    if (!canvas_strip_row) {
+        tft.startStrip(canvas_strip_left, canvas_strip_top, canvas_strip_width, canvas_strip_height);
+    } else if (resume && !tft.continueStrip()) {
+        tft.startStrip(canvas_strip_left, canvas_strip_top + canvas_strip_row,
+                       canvas_strip_width, canvas_strip_height - canvas_strip_row);
+    }
+
+    canvas_run = 0;
+    canvas_emit_row(canvas_strip_cells, canvas_strip_row, canvas_strip_width);
+    if (canvas_run)
+        tft.writeColor(canvas_color, canvas_run);
+    render_end();
+
+    return ++canvas_strip_row < canvas_strip_height;
+}
+
+bool canvas_strip_pending() {
+    return canvas_strip_row < canvas_strip_height;
+}
+
+// Drop the pending strip, for when it is about to be drawn over anyway.
+void canvas_strip_cancel() {
+    canvas_strip_row = canvas_strip_height = 0;
+}
@@ -0,0 +1,28 @@
+#ifndef CANVAS_H
+#define CANVAS_H
+
+#include "world.h"
+
+// The canvas is the field itself: every cell is the tile nibble in
+// world_t::tiles with the player standing on it (if any). A tile nibble is an
+// index into the tile table render_tiles in render.h, and the compositor turns
+// it into RGB565 on the fly, so no pixels are ever stored.
+void canvas_draw(world_t *world, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+
+// The colors of one cell: the background and the circle on top of it.
+typedef struct {
+    uint16_t background;
+    uint16_t foreground;
+} canvas_cell_t;
+
+// A strip is a row of up to RENDER_STRIP_SIZE cells with the given colors, which
+// shares one address window. It is drawn one row of pixels per call to
+// canvas_strip_draw(). If the transaction was ended since the previous row, the
+// next row has to be drawn with resume set. Only one strip can be pending at a
+// time, and nothing else may be drawn until it is done.
+void canvas_strip_start(uint8_t x, uint8_t y, uint8_t width, const canvas_cell_t *cells);
+bool canvas_strip_draw(bool resume);
+bool canvas_strip_pending();
+void canvas_strip_cancel();
+
+#endif /* CANVAS_H */
@@ -42,10 +42,52 @@
 #define INPUT_JOY_THRESHOLD_PERCENTAGE 0.25
 #define INPUT_JOY_THRESHOLD (GAME_INPUT_FACTOR * (INPUT_JOY_MAX / 2) * INPUT_JOY_THRESHOLD_PERCENTAGE)
 
-// The size of one tile, possible other size: 14, width: 23, height 17.
+// The size of one tile and the field in tiles, which can all be set from the
+// compiler flags. Everything that depends on the tile size is worked out at
+// compile time (see sprite.cpp), so smaller tiles only cost the extra cells:
+// for example 14 pixel tiles with a field of 21 by 17.
+#ifndef WORLD_TILE_SIZE
 #define WORLD_TILE_SIZE 19
+#endif
+#ifndef WORLD_WIDTH
 #define WORLD_WIDTH 17
+#endif
+#ifndef WORLD_HEIGHT
 #define WORLD_HEIGHT 13
+#endif
+
+// The columns of the world that are on the screen at once. A wider world
+// scrolls sideways to follow the local player; the columns then have to fit
+// in the 320 pixels of the panel, for example 16 columns with the 19 pixel
+// tiles. The height of the world is not scrolled.
+//
+// The scroll direction of the panel in landscape has only been worked out from
+// the datasheet and the host framebuffer, not seen on a panel. Until it has
+// been, a scrolling view is off unless RENDER_HARDWARE_SCROLL is set as well.
+#ifndef WORLD_VIEW_WIDTH
+#define WORLD_VIEW_WIDTH WORLD_WIDTH
+#endif
+
+// The amount of changed tiles that can wait to be drawn in between game updates.
+#define RENDER_QUEUE_SIZE 16
+
+// The most queued tiles next to each other in a row that are drawn as one strip.
+#define RENDER_STRIP_SIZE 8
+
+// Whether whole sprites are streamed with every run unrolled for the tile size
+// (see sprite_rows in sprite.cpp). That puts a call for every run in flash, 30
+// of them for 19 pixel tiles; with 0 every sprite is streamed by a loop.
+#ifndef SPRITE_UNROLL
+#define SPRITE_UNROLL 1
+#endif
+
+// How long render_update() may draw queued tiles before it returns to the main
+// loop: half of the time between two input polls.
+#define RENDER_BUDGET_MICROS (1000000UL / GAME_UPDATE_FREQUENCY / GAME_INPUT_FACTOR / 2)
+
+// How many game updates a RENDER_PROFILE build sums up before it prints them.
+// Printing blocks the game for a while, so it is not done on every update.
+#define PROFILE_DUMP_TICKS (4 * GAME_UPDATE_FREQUENCY)
 
 // The properties a tile can have.
 #define TILE_MASK_IS_EXPLODING 0b0001
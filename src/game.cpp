@@ -3,12 +3,15 @@
 #include "defines.h"
 #include "network.h"
 #include "player.h"
+#include "profile.h"
 #include "render.h"
 #include "score.h"
 #include "segments.h"
 #include "touch.h"
 #include "world.h"
 
+#include <nunchuck_funcs.h>
+
 volatile bool should_poll = false;
 static int should_update = 0;
 static world_t *world;
@@ -68,7 +71,7 @@ inline void opponent_move(uint8_t x, uint8_t y) {
     }
 
     world_redraw_tile(world, oldx, oldy);
-    draw_player(player);
+    world_redraw_tile(world, x, y);
 }
 
 inline void opponent_place_bomb(uint8_t size) {
@@ -130,6 +133,9 @@ inline void receive_networking_data() {
                 default:
                     break;
             }
+
+            // Packets arrive in between game updates, so draw the changes right away.
+            world_flush(world);
         }
     }
 }
@@ -166,20 +172,22 @@ void game_init(button_mode_t game_mode) {
     player_t *player1 = player_new(1, 1, player1_is_host);
     player_show_lives(player1);
 
-    draw_player(player1);
-
     world->players[0] = player1;
+    world_redraw_tile(world, player1->x, player1->y);
 
     // Create the opponent if playing in multiplayer mode.
     if (multiplayer) {
-        player_t *player2 = player_new(15, 11, !player1_is_host);
+        player_t *player2 = player_new(WORLD_WIDTH - 2, WORLD_HEIGHT - 2, !player1_is_host);
 
         // Set the bomb count for the opponent to the maximum amount.
         player1_is_host ? player2->bomb_count = MAX_BOMB_COUNT : player1->bomb_count = MAX_BOMB_COUNT;
-        draw_player(player2);
 
         world->players[1] = player2;
+        world_redraw_tile(world, player2->x, player2->y);
     }
+
+    // Draw the players on top of the world.
+    world_flush(world);
 }
 
 player_t *game_get_local_player() {
@@ -246,6 +254,9 @@ bool game_update() {
     input_joy_x = 0;
     input_joy_y = 0;
 
+    // Print what was drawn every PROFILE_DUMP_TICKS updates.
+    profile_tick();
+
     // Update the world.
     world_update(world, inputs);
 
@@ -5,7 +5,6 @@
 #include "touch.h"
 
 #include <stdbool.h>
-#include <nunchuck_funcs.h>
 
 typedef enum {
     GAME_STATE_RUNNING,
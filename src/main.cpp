@@ -2,6 +2,7 @@
 #include "game.h"
 #include "logger.h"
 #include "network.h"
+#include "profile.h"
 #include "render.h"
 #include "score.h"
 #include "segments.h"
@@ -9,6 +10,7 @@
 #include "usart.h"
 
 #include <Arduino.h>
+#include <nunchuck_funcs.h>
 
 void timer1_init();
 void tft_brightness_init();
@@ -41,6 +43,9 @@ int main() {
     // Use the screen in landscape mode.
     tft.setRotation(1);
 
+    // Time the statically bound drawing primitives against the virtual ones.
+    profile_compare();
+
     // The main funtion method for the touch screen.
     menus_new();
 
@@ -52,10 +57,13 @@ int main() {
         // Set up the game.
         game_init(mode);
 
-        // Update the game until it ends.
-        while (!game_get_state())
+        // Update the game until it ends. Changed tiles are drawn one at a
+        // time in between, so polling and networking are not held up.
+        while (!game_get_state()) {
             if (network_update())
                 game_update();
+            render_update();
+        }
 
         if (!game_is_multiplayer()) {
             score_calculate();
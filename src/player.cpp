@@ -144,7 +144,7 @@ void player_update(world_t *world, player_t *player, uint8_t inputs) {
 
     // Redraw our player only if we have to.
     if (redraw)
-        draw_player(player);
+        world_redraw_tile(world, player->x, player->y);
 }
 
 // Whenever the player should take damage, we check if they are invincible and
@@ -0,0 +1,134 @@
+#include "profile.h"
+
+#ifdef RENDER_PROFILE
+
+#include "defines.h"
+#include "logger.h"
+#include "render.h"
+
+#if !DEBUG
+#error "RENDER_PROFILE prints through the logger, so DEBUG has to be enabled"
+#endif
+
+// The totals of one primitive since the last dump.
+typedef struct {
+    uint16_t count;
+    uint16_t windows;
+    uint32_t bytes;
+    uint32_t micros;
+} profile_entry_t;
+
+static profile_entry_t profile_entries[PROFILE_COUNT];
+
+// The nesting depth and the counters at the start of the outermost primitive.
+static uint8_t profile_depth = 0;
+static uint32_t profile_start_bytes;
+static uint16_t profile_start_windows;
+static uint32_t profile_start_micros;
+
+// The game updates since the last dump, and how long that dump took to print.
+static uint8_t profile_ticks = 0;
+static uint32_t profile_dump_micros = 0;
+
+// The names of the primitives after the tiles, in the order of profile_primitive_t.
+static const char *const profile_names[] = {
+    "player", "rect", "circle", "text", "backgr", "field", "strip", "image"
+};
+
+void profile_begin() {
+    if (profile_depth++)
+        return;
+
+    profile_start_bytes = Adafruit_SPITFT::profileBytes;
+    profile_start_windows = Adafruit_SPITFT::profileWindows;
+    profile_start_micros = micros();
+}
+
+void profile_end(profile_primitive_t primitive) {
+    if (--profile_depth)
+        return;
+
+    // Timer0 keeps running at 4us per count while the IR link uses it.
+    profile_entry_t *entry = &profile_entries[primitive];
+    entry->micros += micros() - profile_start_micros;
+    entry->bytes += Adafruit_SPITFT::profileBytes - profile_start_bytes;
+    entry->windows += Adafruit_SPITFT::profileWindows - profile_start_windows;
+    entry->count++;
+}
+
+// Called on every game update. Every PROFILE_DUMP_TICKS updates, print one line
+// per primitive that was used since the last dump, then start over. The dump
+// happens outside of any primitive and after the totals are taken, so the time
+// spent printing is never counted; it is reported on its own with the next dump.
+void profile_tick() {
+    if (++profile_ticks < PROFILE_DUMP_TICKS || profile_depth)
+        return;
+
+    uint32_t start = micros();
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < PROFILE_COUNT; i++)
+        total += profile_entries[i].micros;
+
+    debug("[profile] %u updates, the last dump took %lu us\n", profile_ticks, profile_dump_micros);
+    debug("[profile] prim        n   bytes  win      us\n");
+    for (uint8_t i = 0; i < PROFILE_COUNT; i++) {
+        profile_entry_t *entry = &profile_entries[i];
+        if (!entry->count)
+            continue;
+
+        if (i < PROFILE_PLAYER)
+            debug("[profile] tile %-2u ", i);
+        else
+            debug("[profile] %-7s ", profile_names[i - PROFILE_PLAYER]);
+        debug("%5u %7lu %4u %7lu\n", entry->count, entry->bytes, entry->windows, entry->micros);
+    }
+    debug("[profile] total us %lu\n", total);
+    debug("[profile] address commands elided %u\n", Adafruit_SPITFT::profileElided);
+
+    memset(profile_entries, 0, sizeof(profile_entries));
+    Adafruit_SPITFT::profileElided = 0;
+    profile_ticks = 0;
+    profile_dump_micros = micros() - start;
+}
+
+// How many rectangles profile_compare() draws through each path.
+#define PROFILE_COMPARE_RECTS 256
+
+// Print the CPU cycles per call of two paths, timed over PROFILE_COMPARE_RECTS calls.
+static void profile_compare_print(const char *name, uint32_t direct, uint32_t indirect) {
+    debug("[profile] %-14s cycles direct %lu virtual %lu\n", name,
+          direct * (F_CPU / 1000000) / PROFILE_COMPARE_RECTS,
+          indirect * (F_CPU / 1000000) / PROFILE_COMPARE_RECTS);
+}
+
+// Time one-pixel rectangles, where the call costs more than the pixel, drawn
+// through the statically bound primitives of the display (see gfxstatic.h)
+// and through the virtual functions of Adafruit_GFX. Called once at startup,
+// the menu is drawn over the pixels afterwards.
+void profile_compare() {
+    // Through a volatile pointer the compiler can't bind the calls itself.
+    Adafruit_GFX *volatile gfx = &tft;
+    uint32_t start, direct;
+
+    start = micros();
+    for (uint16_t i = 0; i < PROFILE_COMPARE_RECTS; i++)
+        tft.fillRect(i % 16, 0, 1, 1, ILI9341_BLACK);
+    direct = micros() - start;
+    start = micros();
+    for (uint16_t i = 0; i < PROFILE_COMPARE_RECTS; i++)
+        gfx->fillRect(i % 16, 0, 1, 1, ILI9341_BLACK);
+    profile_compare_print("fillRect", direct, micros() - start);
+
+    tft.startWrite();
+    start = micros();
+    for (uint16_t i = 0; i < PROFILE_COMPARE_RECTS; i++)
+        tft.writeFastHLine(0, i % 16, 1, ILI9341_BLACK);
+    direct = micros() - start;
+    start = micros();
+    for (uint16_t i = 0; i < PROFILE_COMPARE_RECTS; i++)
+        gfx->writeFastHLine(0, i % 16, 1, ILI9341_BLACK);
+    profile_compare_print("writeFastHLine", direct, micros() - start);
+    tft.endWrite();
+}
+
+#endif /* RENDER_PROFILE */
@@ -0,0 +1,36 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+// The drawing primitives that are profiled. Tiles get one entry per tile_t.
+typedef enum {
+    PROFILE_TILE = 0,
+    PROFILE_PLAYER = 16,
+    PROFILE_RECT,
+    PROFILE_CIRCLE,
+    PROFILE_TEXT,
+    PROFILE_BACKGROUND,
+    PROFILE_FIELD,
+    PROFILE_STRIP,
+    PROFILE_IMAGE,
+    PROFILE_COUNT,
+} profile_primitive_t;
+
+// Build with -D RENDER_PROFILE (see platformio.ini) to count the SPI bytes,
+// address windows and time spent in every primitive. Only the outermost
+// primitive is counted when they are nested, so a player cell includes the
+// circle drawn on it. Without RENDER_PROFILE all of this compiles to nothing.
+#ifdef RENDER_PROFILE
+void profile_begin();
+void profile_end(profile_primitive_t primitive);
+void profile_tick();
+void profile_compare();
+#else
+#define profile_begin()
+#define profile_end(primitive)
+#define profile_tick()
+#define profile_compare()
+#endif /* RENDER_PROFILE */
+
+#endif /* PROFILE_H */
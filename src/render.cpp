@@ -1,92 +1,593 @@
 #include "render.h"
 
+#include "canvas.h"
 #include "defines.h"
+#include "profile.h"
+#include "sprite.h"
+
+#if WORLD_VIEW_WIDTH < WORLD_WIDTH && !defined(RENDER_HARDWARE_SCROLL)
+#error "Scrolling has not been verified on a panel, set RENDER_HARDWARE_SCROLL to build it anyway"
+#endif
+#if WORLD_VIEW_WIDTH < WORLD_WIDTH && WORLD_VIEW_WIDTH * WORLD_TILE_SIZE > ILI9341_TFTHEIGHT
+#error "The columns of a scrolling view have to fit on the screen"
+#endif
 
 Adafruit_ILI9341 tft = Adafruit_ILI9341(TFT_CS, TFT_DC);
 
-// Draw any tile.
-void draw_tile(int x, int y, tile_t type) {
-    x = WORLD_TILE_SIZE * x;
-    y = WORLD_TILE_SIZE * y;
+// How many render_begin() calls have not yet been ended.
+static uint8_t render_depth = 0;
 
-    switch (type) {
-        case BOMB:
-            draw_rect(x, y, ILI9341_LIGHTGREY);
-            draw_circle(x, y, ILI9341_OLIVE);
-            break;
-        case WALL:
-            draw_rect(x, y, ILI9341_DARKGREY);
-            break;
-        case BOX:
-        case UPGRADE_BOX_BOMB_COUNT:
-        case UPGRADE_BOX_BOMB_SIZE:
-            draw_rect(x, y, ILI9341_BROWN);
-            break;
-        case EMPTY:
-            draw_rect(x, y, ILI9341_BLACK);
-            break;
-        case EXPLODING_BOMB:
-            draw_rect(x, y, ILI9341_WHITE);
-            break;
-        case BOMB_EXPLOSION:
-            draw_rect(x, y, ILI9341_WHITE);
-            draw_circle(x, y, ILI9341_OLIVE);
-            break;
-        case UPGRADE_EXPLOSION_BOMB_SIZE:
-            draw_rect(x,y, ILI9341_WHITE);
-            draw_circle(x,y, ILI9341_MAROON);
+// What is on the screen for every cell of the field once the queue has been
+// drawn: the tile in the low nibble, the player overlay in the next three bits
+// and a valid bit on top. A zero value is unknown and always gets drawn. See
+// render_shadow_get() and render_shadow_set() for how it is stored.
+#define RENDER_SHADOW_VALID 0x80
+#define RENDER_SHADOW_TILE 0x0F
+#define RENDER_SHADOW_OVERLAY 0x70
+
+// The tiles of the shadow, two cells to a byte with the even index in the low
+// nibble. No tile uses RENDER_SHADOW_UNKNOWN, which marks an unknown cell. The
+// nibbles are stored inverted, so a zero byte is unknown just like before.
+#define RENDER_SHADOW_UNKNOWN 0x0F
+static uint8_t render_shadow[(WORLD_WIDTH * WORLD_HEIGHT + 1) / 2];
+
+// The overlays of the shadow. Only the cells under a player have one: two
+// players, and the cell a player just left until it is queued again. A free
+// entry has no overlay, and a cell that does not fit is stored as unknown.
+#define RENDER_SHADOW_PLAYERS 4
+typedef struct {
+    uint16_t index;
+    uint8_t overlay;
+} render_shadow_player_t;
+static render_shadow_player_t render_shadow_players[RENDER_SHADOW_PLAYERS];
+
+// The amount of cells that were not drawn because they did not change.
+static uint16_t render_suppressed = 0;
+
+// The first column of the world on the screen, see render_column_left().
+static uint8_t render_camera = 0;
+
+constexpr render_tile_t render_tiles::table[16];
+
+// Every entry of the tile table has to sit at the nibble it describes.
+constexpr bool render_tiles_in_order(uint8_t i) {
+    return i == 16 || (render_tiles::table[i].tile == i && render_tiles_in_order(i + 1));
+}
+static_assert(render_tiles_in_order(0), "render_tiles is out of order with tile_t");
+
+// The colors of the player overlays, in the order of render_overlay().
+static const uint16_t render_player_colors[] = {
+    ILI9341_BLUE, ILI9341_CYAN, ILI9341_RED, ILI9341_ORANGE
+};
+
+// A cell that still has to be drawn, with the shadow value to draw there. Plain
+// cells with the same shadow next to each other, such as the rays of an
+// explosion, share one entry: the run is the amount of cells to the right of the
+// first one, or below it when RENDER_RUN_VERTICAL is set.
+#define RENDER_RUN_VERTICAL 0x80
+#define RENDER_RUN_LENGTH 0x7F
+typedef struct {
+    uint16_t index;
+    uint8_t shadow;
+    uint8_t run;
+} render_op_t;
+
+// Which queued cells are drawn first, the lowest first: the local player, the
+// opponent, bombs and explosions, and then everything else.
+#define RENDER_PRIORITY_LOCAL 0
+#define RENDER_PRIORITY_OPPONENT 1
+#define RENDER_PRIORITY_BOMB 2
+#define RENDER_PRIORITY_BACKGROUND 3
+
+// Set when the transaction was ended since the last row of the pending strip.
+static bool render_strip_paused = false;
+
+// Cells waiting to be drawn, oldest first.
+static render_op_t render_queue[RENDER_QUEUE_SIZE];
+static uint8_t render_queue_head = 0;
+static uint8_t render_queue_count = 0;
+
+/*******************
+ * Local functions *
+ *******************/
+
+// The overlay of a player: 0 without a player, else one of the four player colors.
+inline uint8_t render_overlay(player_t *player) {
+    if (!player)
+        return 0;
+    return 1 + (player->is_main ? 2 : 0) + (player->hit_duration ? 1 : 0);
+}
+
+// The overlay entry of a cell, or NULL if it has none.
+static render_shadow_player_t *render_shadow_player(uint16_t index) {
+    for (uint8_t i = 0; i < RENDER_SHADOW_PLAYERS; i++) {
+        if (render_shadow_players[i].overlay && render_shadow_players[i].index == index)
+            return &render_shadow_players[i];
+    }
+    return NULL;
+}
+
+// The shadow value of a cell, see render_shadow.
+static uint8_t render_shadow_get(uint16_t index) {
+    uint8_t tile = ~render_shadow[index / 2];
+    tile = index & 1 ? tile >> 4 : tile & RENDER_SHADOW_TILE;
+    if (tile == RENDER_SHADOW_UNKNOWN)
+        return 0;
+
+    render_shadow_player_t *entry = render_shadow_player(index);
+    return RENDER_SHADOW_VALID | (entry ? entry->overlay << 4 : 0) | tile;
+}
+
+// Store the shadow value of a cell, see render_shadow.
+static void render_shadow_set(uint16_t index, uint8_t shadow) {
+    uint8_t tile = shadow & RENDER_SHADOW_VALID ? shadow & RENDER_SHADOW_TILE : RENDER_SHADOW_UNKNOWN;
+    uint8_t overlay = tile == RENDER_SHADOW_UNKNOWN ? 0 : (shadow & RENDER_SHADOW_OVERLAY) >> 4;
+
+    // Reuse the overlay entry of the cell, or take a free one.
+    render_shadow_player_t *entry = render_shadow_player(index);
+    for (uint8_t i = 0; i < RENDER_SHADOW_PLAYERS && overlay && !entry; i++) {
+        if (!render_shadow_players[i].overlay)
+            entry = &render_shadow_players[i];
+    }
+    if (entry) {
+        entry->index = index;
+        entry->overlay = overlay;
+    } else if (overlay) {
+        tile = RENDER_SHADOW_UNKNOWN;
+    }
+
+    uint8_t *pair = &render_shadow[index / 2];
+    tile ^= RENDER_SHADOW_UNKNOWN;
+    if (index & 1)
+        *pair = (*pair & RENDER_SHADOW_TILE) | (tile << 4);
+    else
+        *pair = (*pair & ~RENDER_SHADOW_TILE) | tile;
+}
+
+// Whether a column of the field is on the screen.
+inline bool render_visible(uint8_t x) {
+    return WORLD_VIEW_WIDTH == WORLD_WIDTH || (uint8_t)(x - render_camera) < WORLD_VIEW_WIDTH;
+}
+
+// How soon a cell has to be drawn, which follows from what it shows.
+inline uint8_t render_priority(uint8_t shadow) {
+    uint8_t overlay = (shadow & RENDER_SHADOW_OVERLAY) >> 4;
+    if (overlay)
+        return overlay > 2 ? RENDER_PRIORITY_LOCAL : RENDER_PRIORITY_OPPONENT;
+
+    uint8_t type = shadow & RENDER_SHADOW_TILE;
+    if (type == BOMB || (type & TILE_MASK_IS_EXPLODING))
+        return RENDER_PRIORITY_BOMB;
+    return RENDER_PRIORITY_BACKGROUND;
+}
+
+// Whether a cell is one color, so that it can be part of a run.
+inline bool render_is_plain(uint8_t shadow) {
+    return !(shadow & RENDER_SHADOW_OVERLAY)
+        && pgm_read_byte(&render_tiles::table[shadow & RENDER_SHADOW_TILE].shape) == RENDER_SHAPE_NONE;
+}
+
+// Whether the queued entry covers the cell at the given index.
+static bool render_op_covers(render_op_t *op, uint16_t index) {
+    uint8_t length = op->run & RENDER_RUN_LENGTH;
+    uint8_t step = (op->run & RENDER_RUN_VERTICAL) ? WORLD_WIDTH : 1;
+    if (index < op->index || (index - op->index) % step)
+        return false;
+    if ((index - op->index) / step >= length)
+        return false;
+
+    // A horizontal run never wraps, but the cells of the next row would
+    // pass the checks above.
+    return step == WORLD_WIDTH || index / WORLD_WIDTH == op->index / WORLD_WIDTH;
+}
+
+// Extend a queued plain entry with the cell at the given coordinates if that is
+// the next cell to the right or below it. Returns false if it is not.
+static bool render_op_extend(render_op_t *op, uint8_t x, uint8_t y) {
+    uint8_t length = op->run & RENDER_RUN_LENGTH;
+    uint8_t op_x = op->index % WORLD_WIDTH;
+    uint8_t op_y = op->index / WORLD_WIDTH;
+
+    // A row of cells can't go on where the columns wrap around the scrolling area.
+    if (!(op->run & RENDER_RUN_VERTICAL) && y == op_y && x == op_x + length && render_column_left(x)) {
+        op->run++;
+    } else if ((length == 1 || (op->run & RENDER_RUN_VERTICAL)) && x == op_x && y == op_y + length) {
+        op->run = RENDER_RUN_VERTICAL | (length + 1);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Find the queued entry to draw next: the oldest one with the highest priority.
+// Returns its position in the queue.
+static uint8_t render_select() {
+    uint8_t best = 0;
+    uint8_t best_priority = render_priority(render_queue[render_queue_head].shadow);
+    for (uint8_t i = 1; i < render_queue_count && best_priority; i++) {
+        uint8_t priority = render_priority(render_queue[(render_queue_head + i) % RENDER_QUEUE_SIZE].shadow);
+        if (priority < best_priority) {
+            best = i;
+            best_priority = priority;
+        }
+    }
+
+    // A cell that was queued again while part of a run has to be drawn
+    // after that run.
+    render_op_t *op = &render_queue[(render_queue_head + best) % RENDER_QUEUE_SIZE];
+    if (op->run == 1) {
+        for (uint8_t i = 0; i < best; i++) {
+            if (render_op_covers(&render_queue[(render_queue_head + i) % RENDER_QUEUE_SIZE], op->index))
+                return i;
+        }
+    }
+    return best;
+}
+
+// Remove an entry from the queue. The order of the others stays the same.
+static void render_remove(uint8_t position) {
+    for (uint8_t i = position; i > 0; i--) {
+        render_queue[(render_queue_head + i) % RENDER_QUEUE_SIZE] =
+            render_queue[(render_queue_head + i - 1) % RENDER_QUEUE_SIZE];
+    }
+    render_queue_head = (render_queue_head + 1) % RENDER_QUEUE_SIZE;
+    render_queue_count--;
+}
+
+// Look up the colors of a queued cell. Returns false for unknown tiles.
+static bool render_cell_colors(uint8_t shadow, canvas_cell_t *cell) {
+    if (!render_tile_colors((tile_t)(shadow & RENDER_SHADOW_TILE), &cell->background, &cell->foreground))
+        return false;
+
+    uint8_t overlay = (shadow & RENDER_SHADOW_OVERLAY) >> 4;
+    if (overlay)
+        cell->foreground = render_player_colors[overlay - 1];
+    return true;
+}
+
+// Count the single cells from the given position on that are queued one after
+// the other and lie next to each other in a row, and look up their colors.
+// Cells that are queued again over an older run are left out, as they have to
+// be drawn after it.
+static uint8_t render_strip_cells(uint8_t position, canvas_cell_t *cells) {
+    uint16_t first = render_queue[(render_queue_head + position) % RENDER_QUEUE_SIZE].index;
+    uint8_t length = 0;
+
+    while (length < RENDER_STRIP_SIZE && position + length < render_queue_count) {
+        render_op_t *op = &render_queue[(render_queue_head + position + length) % RENDER_QUEUE_SIZE];
+        if (op->run != 1 || op->index != first + length)
             break;
-        case UPGRADE_BOMB_SIZE:
-            draw_rect(x,y, ILI9341_BLACK);
-            draw_circle(x, y, ILI9341_MAROON);
+        // Strips end at the edge of the field and where the columns wrap
+        // around the scrolling area.
+        if (length && !render_column_left(op->index % WORLD_WIDTH))
             break;
-        case UPGRADE_EXPLOSION_BOMB_COUNT:
-            draw_rect(x,y, ILI9341_WHITE);
-            draw_circle(x,y, ILI9341_CASET);
+        if (!render_cell_colors(op->shadow, &cells[length]))
             break;
-        case UPGRADE_BOMB_COUNT:
-            draw_rect(x,y, ILI9341_BLACK);
-            draw_circle(x, y, ILI9341_CASET);
+
+        bool covered = false;
+        for (uint8_t i = 0; i < position && !covered; i++)
+            covered = render_op_covers(&render_queue[(render_queue_head + i) % RENDER_QUEUE_SIZE], op->index);
+        if (covered)
             break;
+
+        length++;
+    }
+    return length;
+}
+
+// Draw the next part of the queue: a row of pixels of the pending strip, or the
+// most urgent queued cell. Cells that are queued next to it in the same row are
+// started as a strip with it, so they share one address window.
+static void render_draw_next() {
+    if (canvas_strip_pending()) {
+        profile_begin();
+        canvas_strip_draw(render_strip_paused);
+        profile_end(PROFILE_STRIP);
+        render_strip_paused = false;
+        return;
+    }
+
+    uint8_t position = render_select();
+    render_op_t *op = &render_queue[(render_queue_head + position) % RENDER_QUEUE_SIZE];
+    uint8_t x = op->index % WORLD_WIDTH;
+    uint8_t y = op->index / WORLD_WIDTH;
+    int16_t left = render_column_left(x);
+
+    canvas_cell_t cells[RENDER_STRIP_SIZE];
+    uint8_t strip = op->run == 1 ? render_strip_cells(position, cells) : 0;
+    if (strip > 1) {
+        for (uint8_t i = strip; i > 0; i--)
+            render_remove(position + i - 1);
+
+        canvas_strip_start(x, y, strip, cells);
+        profile_begin();
+        canvas_strip_draw(false);
+        profile_end(PROFILE_STRIP);
+        return;
+    }
+
+    tile_t type = (tile_t)(op->shadow & RENDER_SHADOW_TILE);
+    uint8_t overlay = (op->shadow & RENDER_SHADOW_OVERLAY) >> 4;
+    uint8_t length = op->run & RENDER_RUN_LENGTH;
+
+    uint16_t background, foreground;
+    if (length > 1) {
+        // A run is plain, so it is a single rectangle.
+        render_tile_colors(type, &background, &foreground);
+        if (op->run & RENDER_RUN_VERTICAL)
+            draw_rect(left, WORLD_TILE_SIZE * y, WORLD_TILE_SIZE, WORLD_TILE_SIZE * length, background);
+        else
+            draw_rect(left, WORLD_TILE_SIZE * y, WORLD_TILE_SIZE * length, WORLD_TILE_SIZE, background);
+    } else if (!overlay) {
+        draw_tile(x, y, type);
+    } else if (render_tile_colors(type, &background, &foreground)) {
+        // The player circle covers the circle of the tile exactly, so the
+        // cell is one sprite with the player color as its foreground and
+        // every pixel is written once.
+        profile_begin();
+        sprite_draw(left, WORLD_TILE_SIZE * y, background, render_player_colors[overlay - 1]);
+        profile_end(PROFILE_PLAYER);
+    } else {
+        profile_begin();
+        draw_circle(left, WORLD_TILE_SIZE * y, render_player_colors[overlay - 1]);
+        profile_end(PROFILE_PLAYER);
+    }
+
+    render_remove(position);
+}
+
+/************************
+ * Accessible functions *
+ ************************/
+
+void render_begin() {
+    // Only the outermost frame starts the transaction and pulls CS low.
+    if (!render_depth++)
+        tft.startWrite();
+}
+
+void render_end() {
+    if (!--render_depth) {
+        tft.endWrite();
+        render_strip_paused = true;
+    }
+}
+
+// Returns the amount of cells that were left alone since the last call.
+uint16_t render_take_suppressed() {
+    uint16_t suppressed = render_suppressed;
+    render_suppressed = 0;
+    return suppressed;
+}
+
+// Queue a cell of the field with the player standing on it (if any), unless the
+// screen already shows exactly that or the cell is outside of the view. Returns
+// false if nothing was queued.
+bool draw_cell(int x, int y, tile_t type, player_t *player) {
+    if (!render_visible(x))
+        return false;
+
+    uint16_t index = y * WORLD_WIDTH + x;
+    uint8_t shadow = RENDER_SHADOW_VALID | (render_overlay(player) << 4) | type;
+    if (render_shadow_get(index) == shadow) {
+        render_suppressed++;
+        return false;
+    }
+    render_shadow_set(index, shadow);
+
+    // A cell that is still queued on its own is drawn once, with its latest
+    // contents. Inside a run it is drawn again after the run.
+    render_op_t *covering = NULL;
+    for (uint8_t i = 0; i < render_queue_count; i++) {
+        render_op_t *op = &render_queue[(render_queue_head + i) % RENDER_QUEUE_SIZE];
+        if (render_op_covers(op, index))
+            covering = op;
+    }
+    if (covering && covering->run == 1) {
+        covering->shadow = shadow;
+        return true;
+    }
+
+    // Plain cells that nothing else covers join a run of the same shadow.
+    // The order they are drawn in does not matter then.
+    if (!covering && render_is_plain(shadow)) {
+        for (uint8_t i = 0; i < render_queue_count; i++) {
+            render_op_t *op = &render_queue[(render_queue_head + i) % RENDER_QUEUE_SIZE];
+            if (op->shadow == shadow && render_op_extend(op, x, y))
+                return true;
+        }
+    }
+
+    // Make room by drawing right away when the queue is full.
+    if (render_queue_count == RENDER_QUEUE_SIZE) {
+        render_begin();
+        while (render_queue_count == RENDER_QUEUE_SIZE)
+            render_draw_next();
+        render_end();
+    }
+
+    render_op_t *op = &render_queue[(render_queue_head + render_queue_count) % RENDER_QUEUE_SIZE];
+    op->index = index;
+    op->shadow = shadow;
+    op->run = 1;
+    render_queue_count++;
+    return true;
+}
+
+// Draw queued cells, most urgent first, until RENDER_BUDGET_MICROS have passed.
+// Called from the main loop, so input and networking are still handled in
+// between. Returns true if more cells are waiting.
+bool render_update() {
+    if (!render_queue_count && !canvas_strip_pending())
+        return false;
+
+    unsigned long start = micros();
+    render_begin();
+    do {
+        render_draw_next();
+    } while ((render_queue_count || canvas_strip_pending()) && micros() - start < RENDER_BUDGET_MICROS);
+    render_end();
+
+    return render_queue_count || canvas_strip_pending();
+}
+
+// Called at the start of every game update. Cells that are still queued missed
+// the previous update and are carried over, as does a strip that is still being
+// drawn. Returns how many queue entries and strips there are.
+uint8_t render_tick() {
+    return render_queue_count + (canvas_strip_pending() ? 1 : 0);
+}
+
+// Draw every queued cell, after this the screen shows the whole field as it is.
+void render_fence() {
+    if (!render_queue_count && !canvas_strip_pending())
+        return;
+
+    render_begin();
+    while (render_queue_count || canvas_strip_pending())
+        render_draw_next();
+    render_end();
+}
+
+// Draw whole columns of the field straight from the tiles of the world, one
+// rectangle for every stretch that does not wrap around the scrolling area.
+static void render_draw_columns(world_t *world, uint8_t first, uint8_t end) {
+    profile_begin();
+    for (uint8_t x = first; x < end; ) {
+        uint8_t width = end - x;
+        if (WORLD_VIEW_WIDTH < WORLD_WIDTH && WORLD_VIEW_WIDTH - x % WORLD_VIEW_WIDTH < width)
+            width = WORLD_VIEW_WIDTH - x % WORLD_VIEW_WIDTH;
+        canvas_draw(world, x, 0, width, WORLD_HEIGHT);
+        x += width;
     }
+    profile_end(PROFILE_FIELD);
+
+    for (uint8_t y = 0; y < WORLD_HEIGHT; y++) {
+        for (uint8_t x = first; x < end; x++) {
+            uint8_t overlay = render_overlay(world_get_player(world, x, y));
+            render_shadow_set(y * WORLD_WIDTH + x, RENDER_SHADOW_VALID | (overlay << 4) | world_get_tile(world, x, y));
+        }
+    }
+}
+
+// Draw the whole view at once, straight from the tiles of the world.
+void draw_field(world_t *world) {
+    // Everything that is queued is part of the field.
+    render_queue_count = 0;
+    canvas_strip_cancel();
+
+    render_draw_columns(world, render_camera, render_camera + WORLD_VIEW_WIDTH);
+}
+
+// Keep the given column of the world in the middle of the screen, as far as the
+// world reaches. The display scrolls by whole columns and only the columns that
+// come into view are drawn; without a scrolling view this does nothing.
+void render_follow(world_t *world, uint8_t x) {
+    if (WORLD_VIEW_WIDTH == WORLD_WIDTH)
+        return;
+
+    int16_t camera = (int16_t)x - WORLD_VIEW_WIDTH / 2;
+    if (camera > WORLD_WIDTH - WORLD_VIEW_WIDTH)
+        camera = WORLD_WIDTH - WORLD_VIEW_WIDTH;
+    if (camera < 0)
+        camera = 0;
+    if (camera == render_camera)
+        return;
+
+    // Queued cells belong to the columns that own their slots right now.
+    render_fence();
+
+    uint8_t previous = render_camera;
+    render_camera = camera;
+    tft.scrollTo(render_column_left(render_camera));
+
+    // The columns that came into view; all of them after a long jump.
+    uint8_t first = render_camera, end = render_camera + WORLD_VIEW_WIDTH;
+    if (render_camera > previous && render_camera < previous + WORLD_VIEW_WIDTH)
+        first = previous + WORLD_VIEW_WIDTH;
+    else if (render_camera < previous && previous < end)
+        end = previous;
+    render_draw_columns(world, first, end);
+}
+
+// The color of a player, depending on who it is and whether it was just hit.
+uint16_t render_player_color(player_t *player) {
+    return render_player_colors[render_overlay(player) - 1];
+}
+
+// Draw any tile.
+void draw_tile(int x, int y, tile_t type) {
+    uint16_t background, foreground;
+    profile_begin();
+    if (render_visible(x) && render_tile_colors(type, &background, &foreground))
+        sprite_draw(render_column_left(x), WORLD_TILE_SIZE * y, background, foreground);
+    profile_end((profile_primitive_t)(PROFILE_TILE + type));
 }
 
 void draw_rect(int x, int y, uint16_t color) {
-    tft.fillRect(x, y, WORLD_TILE_SIZE, WORLD_TILE_SIZE, color);
+    draw_rect(x, y, WORLD_TILE_SIZE, WORLD_TILE_SIZE, color);
 }
 
 void draw_rect(int x, int y, int width, int height, uint16_t color) {
-    tft.fillRect(x, y, width, height, color);
+    profile_begin();
+    render_begin();
+    tft.writeFillRect(x, y, width, height, color);
+    render_end();
+    profile_end(PROFILE_RECT);
 }
 
 void draw_circle(int x, int y, uint16_t color) {
-    x += (WORLD_TILE_SIZE / 2);
-    y += (WORLD_TILE_SIZE / 2);
+    profile_begin();
+    sprite_draw_circle(x, y, color);
+    profile_end(PROFILE_CIRCLE);
+}
 
-    tft.fillCircle(x, y, (WORLD_TILE_SIZE / 2), color);
+// Draw an image in the sprite format (see sprite.h) at the given position.
+void draw_image(int x, int y, const uint8_t *image) {
+    profile_begin();
+    sprite_blit(x, y, image);
+    profile_end(PROFILE_IMAGE);
 }
 
 void draw_background(int color) {
-    tft.fillScreen(color);
-}
+    // Queued cells would end up on top of the background, and it covers them anyway.
+    render_queue_count = 0;
+    canvas_strip_cancel();
+
+    // Menus are drawn unscrolled, and the next field starts at the left.
+    if (WORLD_VIEW_WIDTH < WORLD_WIDTH) {
+        tft.setScrollMargins(0, ILI9341_TFTHEIGHT - WORLD_VIEW_WIDTH * WORLD_TILE_SIZE);
+        tft.scrollTo(0);
+        render_camera = 0;
+    }
+
+    profile_begin();
+    draw_rect(0, 0, tft.width(), tft.height(), color);
+    profile_end(PROFILE_BACKGROUND);
 
-void draw_player(player_t *player) {
-    uint16_t color = player->is_main
-        ? (player->hit_duration ? ILI9341_ORANGE : ILI9341_RED)
-        : (player->hit_duration ? ILI9341_CYAN : ILI9341_BLUE);
-    draw_circle(WORLD_TILE_SIZE * player->x, WORLD_TILE_SIZE * player->y, color);
+    // Empty cells are plain black, anything else has to be drawn again.
+    memset(render_shadow, color == ILI9341_BLACK ? ~(EMPTY << 4 | EMPTY) : 0, sizeof(render_shadow));
+    memset(render_shadow_players, 0, sizeof(render_shadow_players));
 }
 
 void draw_button(int index, char *text) {
+    // Text is drawn directly, so nothing queued may be drawn over it later.
+    render_fence();
+
     index *= (TOUCH_COMPONENT_HEIGHT + TOUCH_COMPONENT_PADDING);
     draw_rect(TOUCH_BUTTON_START_X, index, TOUCH_COMPONENT_WIDTH, TOUCH_COMPONENT_HEIGHT, ILI9341_BLUE);
     tft.setCursor((TOUCH_BUTTON_START_X + TOUCH_COMPONENT_PADDING), index + TOUCH_COMPONENT_PADDING);
-    tft.setTextColor(ILI9341_WHITE);
+    // Opaque text is blitted one character cell at a time.
+    tft.setTextColor(ILI9341_WHITE, ILI9341_BLUE);
     tft.setTextSize(2);
+    profile_begin();
     tft.println(text);
+    profile_end(PROFILE_TEXT);
 }
 
 void draw_label(int index, char *text) {
+    render_fence();
+
     index *= (TOUCH_COMPONENT_HEIGHT + TOUCH_COMPONENT_PADDING);
     tft.setTextSize(2);
 
@@ -94,6 +595,8 @@ void draw_label(int index, char *text) {
     uint16_t w, h;
     tft.getTextBounds(text, 0, 0, &x, &y, &w, &h);
     tft.setCursor((tft.width() - w) / 2, index + TOUCH_COMPONENT_PADDING);
-    tft.setTextColor(ILI9341_WHITE);
+    tft.setTextColor(ILI9341_WHITE, ILI9341_NAVY);
+    profile_begin();
     tft.println(text);
+    profile_end(PROFILE_TEXT);
 }
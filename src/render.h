@@ -9,10 +9,100 @@
 
 extern Adafruit_ILI9341 tft;
 
-void draw_player(player_t *player);
+// Everything drawn between render_begin() and render_end() shares one SPI
+// transaction. Frames may be nested; only the outermost pair touches the bus.
+// Text is drawn by the GFX library with its own transactions, so draw_button()
+// and draw_label() may not be used inside a frame.
+void render_begin();
+void render_end();
+
+// Cells of the field are only drawn when they differ from what is on the screen.
+// They are queued and drawn by render_update() within a time budget, or all at
+// once by render_fence(). Cells with the local player go first, then the
+// opponent, bombs and explosions, and the rest. When the queue is full, the most
+// urgent cell is drawn right away. draw_background() drops the queue and forgets
+// what is on the screen.
+bool draw_cell(int x, int y, tile_t type, player_t *player);
+bool render_update();
+uint8_t render_tick();
+void render_fence();
+uint16_t render_take_suppressed();
+
+// What every tile looks like, indexed by the tile nibble: the background and the
+// shape and color of the overlay on top of it. A tile without an overlay has
+// its background as overlay color, so every tile is a sprite with two colors
+// and can be drawn without looking at its type. Nibbles that are no tile are
+// black and are left alone by the queue.
+typedef enum {
+    RENDER_SHAPE_NONE,
+    RENDER_SHAPE_CIRCLE,
+    RENDER_SHAPE_UNKNOWN
+} render_shape_t;
+
+typedef struct {
+    uint8_t tile;
+    uint16_t background;
+    uint16_t overlay;
+    uint8_t shape;
+} render_tile_t;
+
+constexpr render_tile_t render_tile(uint8_t tile, uint16_t background, render_shape_t shape, uint16_t overlay) {
+    return { tile, background, shape == RENDER_SHAPE_CIRCLE ? overlay : background, (uint8_t)shape };
+}
+
+// The circle color of the bomb count upgrades. The game has always drawn them
+// with ILI9341_CASET, the column address command, as color; this keeps that
+// value (a near-black blue) so the tiles look as they always did.
+#define RENDER_COLOR_COUNT_UPGRADE 0x2A
+
+// Every entry names its nibble, which render.cpp checks at compile time.
+struct render_tiles {
+    static constexpr render_tile_t table[16] PROGMEM = {
+        render_tile(EMPTY, ILI9341_BLACK, RENDER_SHAPE_NONE, 0),
+        render_tile(EXPLODING_BOMB, ILI9341_WHITE, RENDER_SHAPE_NONE, 0),
+        render_tile(BOMB, ILI9341_LIGHTGREY, RENDER_SHAPE_CIRCLE, ILI9341_OLIVE),
+        render_tile(BOMB_EXPLOSION, ILI9341_WHITE, RENDER_SHAPE_CIRCLE, ILI9341_OLIVE),
+        render_tile(BOX, ILI9341_BROWN, RENDER_SHAPE_NONE, 0),
+        render_tile(0b0101, ILI9341_BLACK, RENDER_SHAPE_UNKNOWN, 0),
+        render_tile(WALL, ILI9341_DARKGREY, RENDER_SHAPE_NONE, 0),
+        render_tile(0b0111, ILI9341_BLACK, RENDER_SHAPE_UNKNOWN, 0),
+        render_tile(UPGRADE_BOMB_SIZE, ILI9341_BLACK, RENDER_SHAPE_CIRCLE, ILI9341_MAROON),
+        render_tile(UPGRADE_EXPLOSION_BOMB_SIZE, ILI9341_WHITE, RENDER_SHAPE_CIRCLE, ILI9341_MAROON),
+        render_tile(UPGRADE_BOMB_COUNT, ILI9341_BLACK, RENDER_SHAPE_CIRCLE, RENDER_COLOR_COUNT_UPGRADE),
+        render_tile(UPGRADE_EXPLOSION_BOMB_COUNT, ILI9341_WHITE, RENDER_SHAPE_CIRCLE, RENDER_COLOR_COUNT_UPGRADE),
+        render_tile(UPGRADE_BOX_BOMB_SIZE, ILI9341_BROWN, RENDER_SHAPE_NONE, 0),
+        render_tile(0b1101, ILI9341_BLACK, RENDER_SHAPE_UNKNOWN, 0),
+        render_tile(UPGRADE_BOX_BOMB_COUNT, ILI9341_BROWN, RENDER_SHAPE_NONE, 0),
+        render_tile(0b1111, ILI9341_BLACK, RENDER_SHAPE_UNKNOWN, 0)
+    };
+};
+
+// Look up the colors of a tile: the background and the overlay on top of it.
+// Returns false for nibbles that are no tile.
+inline bool render_tile_colors(tile_t type, uint16_t *background, uint16_t *foreground) {
+    const render_tile_t *tile = &render_tiles::table[type & 0x0F];
+    *background = pgm_read_word(&tile->background);
+    *foreground = pgm_read_word(&tile->overlay);
+    return pgm_read_byte(&tile->shape) != RENDER_SHAPE_UNKNOWN;
+}
+uint16_t render_player_color(player_t *player);
+
+void draw_field(world_t *world);
+
+// The left edge of a column of the field on the screen. When the world is wider
+// than the view, the columns take turns in the WORLD_VIEW_WIDTH slots of the
+// scrolling area of the display, and the scroll offset puts the first visible
+// column on the left. render_follow() scrolls and draws the columns that come
+// into view; cells outside of the view are never drawn.
+inline int16_t render_column_left(uint8_t x) {
+    return WORLD_TILE_SIZE * (WORLD_VIEW_WIDTH < WORLD_WIDTH ? x % WORLD_VIEW_WIDTH : x);
+}
+void render_follow(world_t *world, uint8_t x);
+
 void draw_rect(int x, int y, uint16_t color);
 void draw_rect(int x, int y, int width, int height, uint16_t color);
 void draw_circle(int x, int y, uint16_t color);
+void draw_image(int x, int y, const uint8_t *image);
 void draw_background(int color);
 
 void draw_tile(int x, int y, tile_t type);
@@ -0,0 +1,230 @@
+#include "sprite.h"
+
+#include "defines.h"
+#include "render.h"
+
+// The overlay circle touches all four edges of the tile.
+#define SPRITE_RADIUS (WORLD_TILE_SIZE / 2)
+
+// One half-width per row distance from the center, rasterized at compile
+// time and shared by every tile type and player color.
+#define sprite_circle_spans (GFXcircle<SPRITE_RADIUS>::spans)
+
+/*******************
+ * Local functions *
+ *******************/
+
+// The circle span of a row of a tile of the given size, worked out at compile
+// time the same way as sprite_read_span().
+constexpr uint8_t sprite_span_half(uint8_t size, uint8_t row) {
+    return gfxCircleHalfWidth(size / 2, row > size / 2 ? row - size / 2 : size / 2 - row);
+}
+
+constexpr uint8_t sprite_span_left(uint8_t size, uint8_t row) {
+    return size / 2 - sprite_span_half(size, row);
+}
+
+constexpr uint8_t sprite_span_run(uint8_t size, uint8_t row) {
+    return sprite_span_left(size, row) + 2 * sprite_span_half(size, row) + 1 > size
+        ? size - sprite_span_left(size, row)
+        : 2 * sprite_span_half(size, row) + 1;
+}
+
+// Stream the rows of a whole tile-sized sprite, unrolled for the tile size: every
+// run length is a constant, and PENDING is the background that is still to be
+// sent from the rows before. The background to the right of one row and to the
+// left of the next is sent as one run.
+template <uint8_t SIZE, uint8_t ROW = 0, uint16_t PENDING = 0>
+struct sprite_rows {
+    static constexpr uint8_t left = sprite_span_left(SIZE, ROW);
+    static constexpr uint8_t run = sprite_span_run(SIZE, ROW);
+
+    static inline void draw(uint16_t background, uint16_t foreground) {
+        if (run) {
+            if (PENDING + left)
+                tft.writeColor(background, PENDING + left);
+            tft.writeColor(foreground, run);
+        }
+        sprite_rows<SIZE, ROW + 1, run ? SIZE - left - run : PENDING + SIZE>::draw(background, foreground);
+    }
+};
+
+template <uint8_t SIZE, uint16_t PENDING>
+struct sprite_rows<SIZE, SIZE, PENDING> {
+    static inline void draw(uint16_t background, uint16_t) {
+        if (PENDING)
+            tft.writeColor(background, PENDING);
+    }
+};
+
+// Clip the sprite at the given position against the screen and the clip
+// rectangle of the display. Returns false if nothing of the sprite is visible,
+// or if it is clipped at the left or top, which the streams below can't skip.
+inline bool sprite_clip(int x, int y, int16_t *width, int16_t *height) {
+    int16_t left = x, top = y;
+    *width = WORLD_TILE_SIZE;
+    *height = WORLD_TILE_SIZE;
+    return tft.clipRect(&left, &top, width, height) && left == x && top == y;
+}
+
+/************************
+ * Accessible functions *
+ ************************/
+
+// Read the circle span of a sprite row from flash: the pixels to the left of the
+// circle and the width of the circle on that row, clipped to the visible width.
+void sprite_read_span(int row, int16_t width, uint8_t *left, uint8_t *run) {
+    uint8_t half_width = pgm_read_byte(&sprite_circle_spans[row > SPRITE_RADIUS ? row - SPRITE_RADIUS : SPRITE_RADIUS - row]);
+    *left = SPRITE_RADIUS - half_width;
+    *run = 2 * half_width + 1;
+
+    // Besides the screen edge, even tile sizes have a circle that is one
+    // pixel wider than the tile itself.
+    if (*left > width)
+        *left = width;
+    if (*left + *run > width)
+        *run = width - *left;
+}
+
+// Draw a tile-sized sprite: the background with a circle in the foreground color
+// on top of it. The whole sprite is streamed through a single address window and
+// every pixel is written exactly once; an unclipped sprite is streamed by
+// sprite_rows, with the runs of the tile size worked out at compile time,
+// unless SPRITE_UNROLL is 0.
+void sprite_draw(int x, int y, uint16_t background, uint16_t foreground) {
+    int16_t width, height;
+    if (!sprite_clip(x, y, &width, &height)) {
+        // Clipped at the left or top: draw the rows span by span, every
+        // span clipped on its own.
+        render_begin();
+        for (int row = 0; row < WORLD_TILE_SIZE; row++) {
+            uint8_t left, run;
+            sprite_read_span(row, WORLD_TILE_SIZE, &left, &run);
+            tft.writeFillRect(x, y + row, left, 1, background);
+            tft.writeFillRect(x + left, y + row, run, 1, foreground);
+            tft.writeFillRect(x + left + run, y + row, WORLD_TILE_SIZE - left - run, 1, background);
+        }
+        render_end();
+        return;
+    }
+
+    render_begin();
+    tft.setAddrWindow(x, y, width, height);
+
+    if (foreground == background) {
+        // Without an overlay the whole sprite is one run.
+        tft.writeColor(background, (uint32_t)width * height);
+    } else if (SPRITE_UNROLL && width == WORLD_TILE_SIZE && height == WORLD_TILE_SIZE) {
+        sprite_rows<WORLD_TILE_SIZE>::draw(background, foreground);
+    } else {
+        // Clipped at the right or bottom, or not unrolled. The background to
+        // the right of one row and to the left of the next row are adjacent in
+        // the stream, so they are sent as one run.
+        uint16_t pending = 0;
+        for (int row = 0; row < height; row++) {
+            uint8_t left, run;
+            sprite_read_span(row, width, &left, &run);
+
+            pending += left;
+            if (run) {
+                if (pending)
+                    tft.writeColor(background, pending);
+                tft.writeColor(foreground, run);
+                pending = 0;
+            }
+            pending += width - left - run;
+        }
+
+        if (pending)
+            tft.writeColor(background, pending);
+    }
+
+    render_end();
+}
+
+// Draw only the circle of a sprite, leaving the background as it is. Rows
+// with the same span are drawn as a single rectangle, clipped by the display.
+void sprite_draw_circle(int x, int y, uint16_t color) {
+    render_begin();
+
+    int row = 0;
+    while (row < WORLD_TILE_SIZE) {
+        uint8_t left, run;
+        sprite_read_span(row, WORLD_TILE_SIZE, &left, &run);
+
+        // Find how many of the following rows share this span.
+        int rows = 1;
+        uint8_t next_left, next_run;
+        while (row + rows < WORLD_TILE_SIZE) {
+            sprite_read_span(row + rows, WORLD_TILE_SIZE, &next_left, &next_run);
+            if (next_left != left || next_run != run)
+                break;
+            rows++;
+        }
+
+        if (run)
+            tft.writeFillRect(x + left, y + row, run, rows, color);
+        row += rows;
+    }
+
+    render_end();
+}
+
+// Draw an image from flash, clipped against the screen and the clip rectangle
+// of the display. The runs are decoded straight into a single address window,
+// and runs of the same color are sent together, also from one row into the next.
+void sprite_blit(int x, int y, const uint8_t *image) {
+    uint8_t image_width = pgm_read_byte(&image[0]);
+    uint8_t image_height = pgm_read_byte(&image[1]);
+    const uint8_t *palette = &image[3];
+    const uint8_t *runs = palette + 2 * pgm_read_byte(&image[2]);
+
+    int16_t left = x, top = y, width = image_width, height = image_height;
+    if (!tft.clipRect(&left, &top, &width, &height))
+        return;
+
+    // The visible columns and rows of the image.
+    uint8_t first_column = left - x, end_column = first_column + width;
+    uint8_t first_row = top - y, end_row = first_row + height;
+
+    render_begin();
+    tft.setAddrWindow(left, top, width, height);
+
+    uint16_t color = 0, pending = 0;
+    uint8_t column = 0, row = 0;
+    while (row < end_row) {
+        uint8_t run = pgm_read_byte(runs++);
+        uint8_t length = (run >> 4) + 1;
+        uint16_t run_color = pgm_read_word(&palette[2 * (run & 0x0F)]);
+
+        // A run may cross the end of a row, and so the clipped columns.
+        while (length && row < end_row) {
+            uint8_t taken = image_width - column;
+            if (taken > length)
+                taken = length;
+
+            uint8_t from = column > first_column ? column : first_column;
+            uint8_t to = column + taken < end_column ? column + taken : end_column;
+            if (row >= first_row && from < to) {
+                if (pending && run_color != color) {
+                    tft.writeColor(color, pending);
+                    pending = 0;
+                }
+                color = run_color;
+                pending += to - from;
+            }
+
+            length -= taken;
+            column += taken;
+            if (column == image_width) {
+                column = 0;
+                row++;
+            }
+        }
+    }
+
+    if (pending)
+        tft.writeColor(color, pending);
+
+    render_end();
+}
@@ -0,0 +1,19 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+
+void sprite_draw(int x, int y, uint16_t background, uint16_t foreground);
+void sprite_draw_circle(int x, int y, uint16_t color);
+void sprite_read_span(int row, int16_t width, uint8_t *left, uint8_t *run);
+
+// An image in flash, as written by tools/spriteconvert: the width, the height,
+// the number of colors in the palette (up to 16), the RGB565 palette colors
+// (low byte first) and then one byte per run of up to 16 pixels, with the run
+// length minus one in the upper nibble and the palette index in the lower
+// nibble. Runs go on from the end of one row into the next.
+#define SPRITE_IMAGE_COLORS 16
+#define SPRITE_RUN_LENGTH 16
+void sprite_blit(int x, int y, const uint8_t *image);
+
+#endif /* SPRITE_H */
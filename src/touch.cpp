@@ -3,6 +3,7 @@
 #include "defines.h"
 #include "game.h"
 #include "logger.h"
+#include "profile.h"
 #include "score.h"
 #include "render.h"
 
@@ -16,6 +17,29 @@ menu_t *menu_win = NULL;
 menu_t *menu_lose = NULL;
 menu_t *menu_waiting = NULL;
 
+// What a slot of the menu on the screen holds.
+#define MENU_SLOT_EMPTY 0
+#define MENU_SLOT_BUTTON 1
+#define MENU_SLOT_LABEL 2
+
+// The title or a component as it was last drawn, and the area it covers. The
+// text is not copied: it points to the text of the menu that was drawn, which
+// stays as it is until menu_free() frees it and forgets the menu on the screen.
+typedef struct {
+    uint8_t kind;
+    const char *text;
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+} menu_slot_t;
+
+// The menu on the screen, if menu_shown is set. Switching menus only redraws
+// the slots that differ.
+static bool menu_shown = false;
+static menu_slot_t menu_shown_title;
+static menu_slot_t menu_shown_slots[TOUCH_COMPONENT_COUNT];
+
 component_t *button_new(const char *text, menu_t *target, button_mode_t mode) {
     component_t *button = (component_t *)malloc(sizeof(component_t));
     if (!button)
@@ -27,7 +51,7 @@ component_t *button_new(const char *text, menu_t *target, button_mode_t mode) {
     return button;
 }
 
-component_t *label_new(char *text) {
+component_t *label_new(const char *text) {
     component_t *label = (component_t *)malloc(sizeof(component_t));
     if (!label)
         return NULL;
@@ -64,6 +88,9 @@ void menu_free(menu_t *menu) {
     if (!menu)
         return;
 
+    // The menu on the screen may refer to the texts that are freed.
+    menu_forget();
+
     for (int i = 0; i < TOUCH_COMPONENT_COUNT; i++) {
         if (menu->components[i])
             component_free(menu->components[i]);
@@ -84,26 +111,104 @@ void menu_set_component(menu_t *menu, int index, component_t *component) {
     menu->components[index] = component;
 }
 
+// The area the title or a component covers on the screen.
+static void menu_text_bounds(const char *text, uint8_t size, int16_t y, menu_slot_t *slot) {
+    int16_t x0, y0;
+    tft.setTextSize(size);
+    tft.getTextBounds(text, 0, 0, &x0, &y0, &slot->width, &slot->height);
+    slot->x = (tft.width() - slot->width) / 2;
+    slot->y = y;
+}
+
+static void component_bounds(component_t *component, int index, menu_slot_t *slot) {
+    int16_t y = (index + 1) * (TOUCH_COMPONENT_HEIGHT + TOUCH_COMPONENT_PADDING);
+    if (component->target || component->mode) {
+        slot->x = TOUCH_BUTTON_START_X;
+        slot->y = y;
+        slot->width = TOUCH_COMPONENT_WIDTH;
+        slot->height = TOUCH_COMPONENT_HEIGHT;
+    } else {
+        menu_text_bounds(component->text, 2, y + TOUCH_COMPONENT_PADDING, slot);
+    }
+}
+
+// Compare what a slot shows with what it should show next. If it differs, clear
+// the part of the old area that the new one does not cover, remember the new
+// state and return true so the caller draws it.
+static bool menu_slot_update(menu_slot_t *shown, menu_slot_t *next, const char *text) {
+    next->text = text;
+    if (shown->kind == next->kind && shown->text && !strcmp(shown->text, text))
+        return false;
+
+    if (shown->width && shown->height) {
+        int16_t right = shown->x + shown->width;
+        int16_t next_right = next->x + next->width;
+
+        if (next->kind != MENU_SLOT_EMPTY && next->y <= shown->y
+        && next->y + next->height >= shown->y + shown->height) {
+            // The new area spans the old one vertically, so only the parts
+            // to the left and the right of it are vacated.
+            if (next->x > shown->x)
+                draw_rect(shown->x, shown->y, min(next->x, right) - shown->x, shown->height, ILI9341_NAVY);
+            if (next_right < right) {
+                int16_t left = max(next_right, shown->x);
+                draw_rect(left, shown->y, right - left, shown->height, ILI9341_NAVY);
+            }
+        } else {
+            draw_rect(shown->x, shown->y, shown->width, shown->height, ILI9341_NAVY);
+        }
+    }
+
+    *shown = *next;
+    return true;
+}
+
+// Draw a menu. If another menu is on the screen, only the title and components
+// that changed are drawn and only the areas they vacated are cleared.
 void menu_draw(menu_t *menu) {
-    draw_background(ILI9341_NAVY);
-    tft.setTextSize(3);
+    if (!menu_shown) {
+        draw_background(ILI9341_NAVY);
+        memset(&menu_shown_title, 0, sizeof(menu_shown_title));
+        memset(menu_shown_slots, 0, sizeof(menu_shown_slots));
+        menu_shown = true;
+    }
 
-    int16_t x, y;
-    uint16_t w, h;
-    tft.getTextBounds(menu->title, 0, 0, &x, &y, &w, &h);
-    tft.setCursor(((tft.width() - w) / 2), 10);
-    tft.setTextColor(ILI9341_WHITE);
-    tft.println(menu->title);
+    menu_slot_t next;
+    next.kind = MENU_SLOT_LABEL;
+    menu_text_bounds(menu->title, 3, 10, &next);
+    if (menu_slot_update(&menu_shown_title, &next, menu->title)) {
+        tft.setTextSize(3);
+        tft.setCursor(next.x, next.y);
+        tft.setTextColor(ILI9341_WHITE, ILI9341_NAVY);
+        profile_begin();
+        tft.println(menu->title);
+        profile_end(PROFILE_TEXT);
+    }
 
     for (int i = 0; i < TOUCH_COMPONENT_COUNT; i++) {
-        if (menu->components[i]) {
-            component_draw(menu->components[i], i);
+        component_t *component = menu->components[i];
+        if (component) {
+            next.kind = (component->target || component->mode) ? MENU_SLOT_BUTTON : MENU_SLOT_LABEL;
+            component_bounds(component, i, &next);
+        } else {
+            memset(&next, 0, sizeof(next));
         }
+
+        if (menu_slot_update(&menu_shown_slots[i], &next, component ? component->text : "") && component)
+            component_draw(component, i);
     }
 }
 
+// Forget the menu on the screen after something else was drawn over it, so the
+// next menu_draw() starts from an empty screen.
+void menu_forget() {
+    menu_shown = false;
+}
+
 button_mode_t menu_loop(menu_t *menu) {
-    // Draw the firt menu upon entering the menu loop.
+    // Draw the firt menu upon entering the menu loop. The game may have been
+    // drawn over the last menu since.
+    menu_forget();
     menu_draw(menu);
 
     // Loop on the current menu.
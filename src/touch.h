@@ -48,8 +48,8 @@ extern menu_t *menu_lose;
 extern menu_t *menu_waiting;
 
 // Component functions.
-component_t *button_new(char *text, menu_t *target, button_mode_t mode);
-component_t *label_new(char *text);
+component_t *button_new(const char *text, menu_t *target, button_mode_t mode);
+component_t *label_new(const char *text);
 void component_free(component_t *component);
 void component_draw(component_t *component, int index);
 
@@ -60,6 +60,7 @@ void menus_free();
 
 void menu_set_component(menu_t *menu, int index, component_t *component);
 void menu_draw(menu_t *menu);
+void menu_forget();
 button_mode_t menu_loop(menu_t *menu);
 int menu_await_input();
 
@@ -1,6 +1,7 @@
 #include "world.h"
 
 #include "defines.h"
+#include "logger.h"
 #include "network.h"
 #include "packet.h"
 #include "render.h"
@@ -59,8 +60,11 @@ void world_generate(world_t *world, uint16_t seed){
 }
 
 void world_generate(world_t *world, uint16_t seed, button_mode_t mode) {
-    // Clear the screen.
-    draw_background(ILI9341_BLACK);
+    // Clear the screen, unless the field is going to cover all of it. A scrolling
+    // view also has to start over at the left.
+    if (WORLD_VIEW_WIDTH < WORLD_WIDTH || WORLD_VIEW_WIDTH * WORLD_TILE_SIZE < tft.width() ||
+        WORLD_HEIGHT * WORLD_TILE_SIZE < tft.height())
+        draw_background(ILI9341_BLACK);
 
     // Set the seed for the generation of the map.
     randomSeed(seed);
@@ -102,6 +106,10 @@ void world_generate(world_t *world, uint16_t seed, button_mode_t mode) {
         world_set_tile(world, (WORLD_WIDTH - 2), (WORLD_HEIGHT - 1 - i), EMPTY);
     }
 
+    // Draw the generated map in one go, none of the tiles has to be drawn again.
+    draw_field(world);
+    memset(world->dirty, 0, WORLD_DIRTY_SIZE);
+
     world->boxes = world_count_boxes(world);
 }
 
@@ -142,6 +150,11 @@ uint8_t world_count_boxes(world_t *world) {
 }
 
 void world_update(world_t *world, uint8_t inputs) {
+    // Tiles that were not drawn since the previous update are carried over.
+    uint8_t carried = render_tick();
+    if (carried)
+        debug("[world] Deadline missed, %u tile draws carried over\n", carried);
+
     // Update all bombs first.
     player_t *player;
     for (int i = 0; i < world->player_count; i++) {
@@ -179,6 +192,18 @@ void world_update(world_t *world, uint8_t inputs) {
     for (int i = 0; i < world->player_count; i++) {
         player_update(world, world->players[i], inputs);
     }
+
+    // Keep the local player in view before anything is queued.
+    for (int i = 0; i < world->player_count; i++) {
+        if (world->players[i]->is_main)
+            render_follow(world, world->players[i]->x);
+    }
+
+    // Draw every tile that changed during this update exactly once.
+    uint16_t flushed = world_flush(world);
+    uint16_t suppressed = render_take_suppressed();
+    if (flushed || suppressed)
+        debug("[world] Queued %u tiles, %u unchanged\n", flushed, suppressed);
 }
 
 uint8_t world_set_tile(world_t *world, uint8_t x, uint8_t y, tile_t tile) {
@@ -232,18 +257,45 @@ tile_t world_get_tile(world_t *world, uint8_t x, uint8_t y) {
     return (tile_t)tile;
 }
 
+// Mark a tile as dirty, it will be redrawn during the next world_flush().
 void world_redraw_tile(world_t *world, uint8_t x, uint8_t y) {
-    draw_tile(x, y, world_get_tile(world, x, y));
+    uint16_t index = y * WORLD_WIDTH + x;
+    world->dirty[index / 8] |= 1 << (index % 8);
+}
+
+// Queue every dirty tile once to be redrawn, with the player standing on it (if
+// any). Returns the amount of tiles that have been queued, tiles that look the
+// same as before are skipped.
+uint16_t world_flush(world_t *world) {
+    uint16_t flushed = 0;
+
+    for (int i = 0; i < WORLD_DIRTY_SIZE; i++) {
+        // Most of the field is clean, so skip eight tiles at once.
+        if (!world->dirty[i])
+            continue;
+
+        for (int bit = 0; bit < 8; bit++) {
+            if (!(world->dirty[i] & (1 << bit)))
+                continue;
+
+            uint16_t index = i * 8 + bit;
+            uint8_t x = index % WORLD_WIDTH;
+            uint8_t y = index / WORLD_WIDTH;
+
+            if (draw_cell(x, y, world_get_tile(world, x, y), world_get_player(world, x, y)))
+                flushed++;
+        }
+        world->dirty[i] = 0;
+    }
 
-    player_t *player = world_get_player(world, x, y);
-    if (player)
-        draw_player(player);
+    return flushed;
 }
 
 player_t *world_get_player(world_t *world, uint8_t x, uint8_t y) {
     for (int i = 0; i < world->player_count; i++) {
         player_t *player = world->players[i];
-        if (player->x == x && player->y == y)
+        // The players are not yet created while the world is generated.
+        if (player && player->x == x && player->y == y)
             return player;
     }
     return NULL;
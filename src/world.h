@@ -30,9 +30,14 @@ struct world_t;
 
 #include "player.h"
 
+// The amount of bytes needed to store one dirty bit for every tile.
+#define WORLD_DIRTY_SIZE ((WORLD_WIDTH * WORLD_HEIGHT + 7) / 8)
+
 typedef struct world_t {
     uint8_t tiles[WORLD_WIDTH / 2 + 1][WORLD_HEIGHT];
     uint8_t tile_explosion_duration[(WORLD_WIDTH - 1) / 2][WORLD_HEIGHT - 2];
+    // One bit per tile that is set when the tile has to be redrawn.
+    uint8_t dirty[WORLD_DIRTY_SIZE];
     player_t **players;
     uint8_t player_count;
     uint8_t boxes;
@@ -52,6 +57,7 @@ void world_subtract_boxes(world_t *world, int subtraction_factor);
 int world_get_box_count(world_t *world);
 tile_t world_get_tile(world_t *world, uint8_t x, uint8_t y);
 void world_redraw_tile(world_t *world, uint8_t x, uint8_t y);
+uint16_t world_flush(world_t *world);
 player_t *world_get_player(world_t *world, uint8_t x, uint8_t y);
 uint8_t world_get_explosion_counter(world_t *world, uint8_t x, uint8_t y);
 void world_set_explosion_counter(world_t *world, uint8_t x, uint8_t y, uint8_t value);
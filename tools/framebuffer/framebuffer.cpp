@@ -0,0 +1,216 @@
+#include "framebuffer.h"
+
+#include "defines.h"
+
+#include <Adafruit_ILI9341.h>
+#include <SPI.h>
+
+#include <stdio.h>
+#include <string.h>
+
+SPIClass SPI;
+
+// The MADCTL bit that swaps rows and columns, set by the landscape rotations.
+#define FRAMEBUFFER_MADCTL_MV 0x20
+
+static uint16_t framebuffer[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT];
+
+// How often every pixel was written in this frame, saturating at 255.
+static uint8_t framebuffer_writes[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT];
+
+static framebuffer_stats_t framebuffer_counters;
+
+// The state of the display controller.
+static bool framebuffer_select = false;
+static bool framebuffer_data = true;
+static uint8_t framebuffer_command = ILI9341_NOP;
+static uint8_t framebuffer_argument = 0;
+static uint8_t framebuffer_madctl = 0;
+static uint16_t framebuffer_column[2];
+static uint16_t framebuffer_page[2];
+
+// The top fixed, scrolling and bottom fixed areas and the scroll start, along
+// the long side of the controller memory.
+static uint16_t framebuffer_scroll_area[3] = {0, FRAMEBUFFER_WIDTH, 0};
+static uint16_t framebuffer_scroll_start = 0;
+
+// The memory write position and the first half of a pixel, if any.
+static uint16_t framebuffer_x, framebuffer_y;
+static uint8_t framebuffer_high;
+static bool framebuffer_half = false;
+
+/*******************
+ * Local functions *
+ *******************/
+
+// Collect one half of a 16 bit column or page argument.
+inline void framebuffer_argument_word(uint16_t *range, uint8_t data) {
+    uint16_t *word = &range[framebuffer_argument / 2];
+    if (framebuffer_argument & 1)
+        *word = (*word & 0xFF00) | data;
+    else
+        *word = (*word & 0x00FF) | (data << 8);
+}
+
+// Store a pixel at the write position and advance it through the window.
+static void framebuffer_write_pixel(uint16_t color) {
+    // The controller memory is 240x320; in landscape the columns run along
+    // the long side.
+    uint16_t stride = (framebuffer_madctl & FRAMEBUFFER_MADCTL_MV) ? FRAMEBUFFER_WIDTH : FRAMEBUFFER_HEIGHT;
+    uint16_t rows = FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT / stride;
+
+    if (framebuffer_x >= stride || framebuffer_y >= rows) {
+        fprintf(stderr, "[framebuffer] Pixel written outside the screen at %u,%u\n", framebuffer_x, framebuffer_y);
+    } else {
+        uint32_t index = (uint32_t)framebuffer_y * stride + framebuffer_x;
+        framebuffer[index] = color;
+        if (framebuffer_writes[index])
+            framebuffer_counters.overdraw++;
+        if (framebuffer_writes[index] < 0xFF)
+            framebuffer_writes[index]++;
+    }
+    framebuffer_counters.pixels++;
+
+    // Wrap to the next page at the end of the column range, like the controller.
+    if (++framebuffer_x > framebuffer_column[1]) {
+        framebuffer_x = framebuffer_column[0];
+        framebuffer_y++;
+    }
+}
+
+// The index in the controller memory of the pixel that is shown at the given
+// position of the landscape screen, where the long side is scrolled.
+static uint32_t framebuffer_index(int x, int y) {
+    uint16_t top = framebuffer_scroll_area[0], height = framebuffer_scroll_area[1];
+    if (x >= top && x < top + height && framebuffer_scroll_start >= top && framebuffer_scroll_start < top + height)
+        x = top + (x - top + framebuffer_scroll_start - top) % height;
+    return (uint32_t)y * FRAMEBUFFER_WIDTH + x;
+}
+
+/************************
+ * Accessible functions *
+ ************************/
+
+void pinMode(uint8_t, uint8_t) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin == TFT_CS)
+        framebuffer_select = !value;
+    else if (pin == TFT_DC)
+        framebuffer_data = value;
+}
+
+void SPIClass::beginTransaction(SPISettings) {
+    framebuffer_counters.transactions++;
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+    if (!framebuffer_select) {
+        fprintf(stderr, "[framebuffer] Byte sent to a deselected display\n");
+        abort();
+    }
+    framebuffer_counters.bytes++;
+
+    if (!framebuffer_data) {
+        framebuffer_counters.commands++;
+        framebuffer_command = data;
+        framebuffer_argument = 0;
+        framebuffer_half = false;
+
+        // Memory write starts at the top left of the window; memory write
+        // continue resumes where the last write stopped.
+        if (data == ILI9341_RAMWR) {
+            framebuffer_counters.windows++;
+            framebuffer_x = framebuffer_column[0];
+            framebuffer_y = framebuffer_page[0];
+        }
+        return 0;
+    }
+
+    switch (framebuffer_command) {
+        case ILI9341_CASET:
+            if (framebuffer_argument < 4)
+                framebuffer_argument_word(framebuffer_column, data);
+            framebuffer_argument++;
+            break;
+        case ILI9341_PASET:
+            if (framebuffer_argument < 4)
+                framebuffer_argument_word(framebuffer_page, data);
+            framebuffer_argument++;
+            break;
+        case ILI9341_MADCTL:
+            framebuffer_madctl = data;
+            break;
+        case ILI9341_VSCRDEF:
+            if (framebuffer_argument < 6)
+                framebuffer_argument_word(framebuffer_scroll_area, data);
+            framebuffer_argument++;
+            break;
+        case ILI9341_VSCRSADD:
+            if (framebuffer_argument < 2)
+                framebuffer_argument_word(&framebuffer_scroll_start, data);
+            framebuffer_argument++;
+            break;
+        case ILI9341_RAMWR:
+        case 0x3C:
+            if (framebuffer_half)
+                framebuffer_write_pixel((framebuffer_high << 8) | data);
+            else
+                framebuffer_high = data;
+            framebuffer_half = !framebuffer_half;
+            break;
+    }
+    return 0;
+}
+
+// Start a new frame: clear the counters and forget which pixels were written.
+// The image itself is kept.
+void framebuffer_frame() {
+    memset(&framebuffer_counters, 0, sizeof(framebuffer_counters));
+    memset(framebuffer_writes, 0, sizeof(framebuffer_writes));
+}
+
+const framebuffer_stats_t *framebuffer_stats() {
+    return &framebuffer_counters;
+}
+
+// Print the counters of the current frame as one line.
+void framebuffer_print(const char *name) {
+    framebuffer_stats_t *s = &framebuffer_counters;
+    printf("%-20s %6u txn %6u cmd %8u bytes %6u windows %7u pixels %7u overdraw\n",
+           name, s->transactions, s->commands, s->bytes, s->windows, s->pixels, s->overdraw);
+}
+
+// The color shown at a position of the screen, after scrolling.
+uint16_t framebuffer_pixel(int x, int y) {
+    return framebuffer[framebuffer_index(x, y)];
+}
+
+// A 32 bit FNV-1a hash of the screen as shown, over the pixels row by row with
+// the low byte of every pixel first.
+uint32_t framebuffer_checksum() {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT; i++) {
+        uint16_t color = framebuffer_pixel(i % FRAMEBUFFER_WIDTH, i / FRAMEBUFFER_WIDTH);
+        hash = (hash ^ (color & 0xFF)) * 16777619u;
+        hash = (hash ^ (color >> 8)) * 16777619u;
+    }
+    return hash;
+}
+
+// Write the image as a binary PPM.
+bool framebuffer_dump(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return false;
+
+    fprintf(file, "P6 %d %d 255\n", FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    for (int i = 0; i < FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT; i++) {
+        uint16_t color = framebuffer_pixel(i % FRAMEBUFFER_WIDTH, i / FRAMEBUFFER_WIDTH);
+        fputc((color >> 11) << 3, file);
+        fputc(((color >> 5) & 0x3F) << 2, file);
+        fputc((color & 0x1F) << 3, file);
+    }
+    return fclose(file) == 0;
+}
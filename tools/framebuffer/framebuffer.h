@@ -0,0 +1,34 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The framebuffer stands in for the ILI9341 on the host. The unmodified display
+// library talks to it over the host SPI class, and it decodes the column, page
+// and memory write commands into a 320x240 RGB565 image in screen coordinates.
+// The scrolling commands are applied when the image is read back.
+#define FRAMEBUFFER_WIDTH 320
+#define FRAMEBUFFER_HEIGHT 240
+
+// What went over the bus since the last framebuffer_frame().
+typedef struct {
+    uint32_t transactions;
+    uint32_t commands;
+    uint32_t bytes;
+    uint32_t windows;
+    uint32_t pixels;
+
+    // Pixels that were written more than once.
+    uint32_t overdraw;
+} framebuffer_stats_t;
+
+void framebuffer_frame();
+const framebuffer_stats_t *framebuffer_stats();
+void framebuffer_print(const char *name);
+
+uint16_t framebuffer_pixel(int x, int y);
+uint32_t framebuffer_checksum();
+bool framebuffer_dump(const char *path);
+
+#endif /* FRAMEBUFFER_H */
@@ -0,0 +1,40 @@
+#ifndef GOLDEN_H
+#define GOLDEN_H
+
+#include "defines.h"
+
+#include <stdint.h>
+
+// The framebuffer_checksum() of the scenes as the original renderer drew them:
+// the game as it was before the tile queue, the sprites and the canvas, linked
+// against this framebuffer and driven through the same scenes. Scenes that
+// only the current renderer can draw have no entry. The original renderer only
+// knew the default field, so the field scenes are only checked there.
+#if WORLD_TILE_SIZE == 19 && WORLD_WIDTH == 17 && WORLD_HEIGHT == 13 && WORLD_VIEW_WIDTH == WORLD_WIDTH
+#define GOLDEN_FIELD 1
+#else
+#define GOLDEN_FIELD 0
+#endif
+
+typedef struct {
+    const char *scene;
+    bool field;
+    uint32_t checksum;
+} golden_t;
+
+static const golden_t golden[] = {
+    { "menu_main",         false, 0x8d8047d8 },
+    { "menu_play",         false, 0x51b0e369 },
+    { "menu_select_level", false, 0xe3eea0c8 },
+    { "menu_score",        false, 0xdd50a4f4 },
+    { "menu_win",          false, 0x73d77654 },
+    { "menu_lose",         false, 0x4223cee4 },
+    { "menu_label",        false, 0xc45f166c },
+    { "world_random",      true,  0x38b0dd56 },
+    { "world_plus",        true,  0x4288ef39 },
+    { "world_full",        true,  0xe33cac99 },
+    { "game_60_ticks",     true,  0x3d32eb0c },
+    { "explosion",         true,  0xb55a0704 }
+};
+
+#endif /* GOLDEN_H */
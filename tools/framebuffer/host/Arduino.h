@@ -0,0 +1,64 @@
+// Just enough of the Arduino core for the display code to build on the host.
+// Flash is ordinary memory here, so the PROGMEM accessors are plain loads.
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Print.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#define pgm_read_pointer(addr) (*(void * const *)(addr))
+
+#define _BV(bit) (1 << (bit))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define DEC 10
+
+#define PORTC2 2
+#define PORTC3 3
+extern volatile uint8_t DDRC, PORTC;
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+// The display pins are decoded by the framebuffer, see framebuffer.cpp.
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+inline int digitalRead(uint8_t) { return LOW; }
+
+inline void delay(unsigned long) {}
+unsigned long millis();
+unsigned long micros();
+
+inline long random(long howbig) { return howbig ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig) { return howsmall + random(howbig - howsmall); }
+inline void randomSeed(unsigned long seed) { srand(seed); }
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) { return fputc(c, stderr) == EOF ? 0 : 1; }
+};
+extern HardwareSerial Serial;
+
+#endif /* ARDUINO_H */
@@ -0,0 +1,39 @@
+#ifndef PRINT_H
+#define PRINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+class __FlashStringHelper;
+
+class String {
+public:
+    const char *c_str() const { return ""; }
+    unsigned int length() const { return 0; }
+};
+
+class Print {
+public:
+    virtual size_t write(uint8_t c) = 0;
+
+    size_t print(const char *s) {
+        size_t n = 0;
+        while (*s)
+            n += write(*s++);
+        return n;
+    }
+
+    size_t print(long n, int base) {
+        char buffer[34];
+        snprintf(buffer, sizeof(buffer), base == 16 ? "%lx" : "%ld", n);
+        return print(buffer);
+    }
+
+    size_t println(const char *s) {
+        size_t n = print(s);
+        return n + write('\n');
+    }
+};
+
+#endif /* PRINT_H */
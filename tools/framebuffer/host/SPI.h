@@ -0,0 +1,28 @@
+// Hardware SPI for the host: every byte ends up in the framebuffer decoder.
+
+#ifndef SPI_H
+#define SPI_H
+
+#include "Arduino.h"
+
+#define SPI_HAS_TRANSACTION 1
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings {
+public:
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+    SPISettings() {}
+};
+
+class SPIClass {
+public:
+    void begin() {}
+    void beginTransaction(SPISettings settings);
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data);
+};
+
+extern SPIClass SPI;
+
+#endif /* SPI_H */
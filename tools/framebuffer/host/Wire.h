@@ -0,0 +1,19 @@
+#ifndef WIRE_H
+#define WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire {
+public:
+    void begin() {}
+    void beginTransmission(uint8_t) {}
+    uint8_t endTransmission() { return 0; }
+    size_t write(uint8_t) { return 1; }
+    uint8_t requestFrom(int, int) { return 0; }
+    int available() { return 0; }
+    int read() { return 0; }
+};
+
+extern TwoWire Wire;
+
+#endif /* WIRE_H */
@@ -0,0 +1 @@
+// Nothing to declare on the host.
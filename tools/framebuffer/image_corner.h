@@ -0,0 +1,39 @@
+const uint8_t image_corner[] PROGMEM = {
+  76, 57, 4, // Width, height, colors
+  0xEF, 0x7B, // 0x7BEF
+  0x00, 0x00, // 0x0000
+  0x00, 0xF8, // 0xF800
+  0x00, 0x61, // 0x6100
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0xF1, 0x91, 0x42, 0xF1,
+  0x91, 0xF0, 0x20, 0xF1, 0x71, 0x82, 0xF1, 0x71, 0xF0, 0x20, 0xF1, 0x51,
+  0xC2, 0xF1, 0x51, 0xF0, 0x20, 0xF1, 0x41, 0xE2, 0xF1, 0x41, 0xF0, 0x20,
+  0xF1, 0x41, 0xE2, 0xF1, 0x41, 0xF0, 0x20, 0xF1, 0x31, 0xF2, 0x02, 0xF1,
+  0x31, 0xF0, 0x20, 0xF1, 0x31, 0xF2, 0x02, 0xF1, 0x31, 0xF0, 0x20, 0xF1,
+  0x21, 0xF2, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0x22, 0xF1,
+  0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF1,
+  0x21, 0xF2, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0x22, 0xF1,
+  0x21, 0xF0, 0x20, 0xF1, 0x31, 0xF2, 0x02, 0xF1, 0x31, 0xF0, 0x20, 0xF1,
+  0x31, 0xF2, 0x02, 0xF1, 0x31, 0xF0, 0x20, 0xF1, 0x41, 0xE2, 0xF1, 0x41,
+  0xF0, 0x20, 0xF1, 0x41, 0xE2, 0xF1, 0x41, 0xF0, 0x20, 0xF1, 0x51, 0xC2,
+  0xF1, 0x51, 0xF0, 0x20, 0xF1, 0x71, 0x82, 0xF1, 0x71, 0xF0, 0x20, 0xF1,
+  0x91, 0x42, 0xF1, 0x91, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+  0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21,
+  0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+  0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21,
+  0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+  0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21,
+  0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+  0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21,
+  0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+  0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21,
+  0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+  0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21,
+  0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+};
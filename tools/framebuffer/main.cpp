@@ -0,0 +1,546 @@
+// Draw the menus and a scripted game into the host framebuffer. Prints what
+// every scene sent over the bus and, when given a directory, writes every
+// scene to it as a PPM image.
+
+#include "framebuffer.h"
+#include "golden.h"
+
+#include "defines.h"
+#include "render.h"
+#include "sprite.h"
+#include "touch.h"
+#include "world.h"
+
+#include "image_corner.h"
+
+#include <Fonts/FreeSans18pt7b.h>
+#include <fontconvert/rle.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern bool stubs_debug;
+
+// Where to write the images, or NULL to write none.
+static const char *output = NULL;
+
+// The checks that found pixels that are wrong.
+static int failures = 0;
+
+/*******************
+ * Local functions *
+ *******************/
+
+// Count a check as failed if it found any wrong pixels, and pass the amount on.
+static int expect_none(int wrong) {
+    if (wrong)
+        failures++;
+    return wrong;
+}
+
+// Report the scene that was just drawn, check it against the original renderer
+// if that could draw it, and start a new frame.
+static void scene_end(const char *name) {
+    framebuffer_print(name);
+
+    for (size_t i = 0; i < sizeof(golden) / sizeof(golden[0]); i++) {
+        if (strcmp(golden[i].scene, name) || (golden[i].field && !GOLDEN_FIELD))
+            continue;
+
+        uint32_t checksum = framebuffer_checksum();
+        printf("%-20s %6s checksum %08x, %08x originally\n", "",
+               checksum == golden[i].checksum ? "same" : "wrong", checksum, golden[i].checksum);
+        expect_none(checksum != golden[i].checksum);
+    }
+
+    if (output) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.ppm", output, name);
+        if (!framebuffer_dump(path))
+            fprintf(stderr, "Couldn't write %s\n", path);
+    }
+    framebuffer_frame();
+}
+
+// Check that the menu on the screen, drawn over the previous one, is what
+// drawing it on an empty screen gives.
+static void check_menu(menu_t *menu) {
+    static uint16_t shown[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT];
+    for (int y = 0; y < FRAMEBUFFER_HEIGHT; y++)
+        for (int x = 0; x < FRAMEBUFFER_WIDTH; x++)
+            shown[y * FRAMEBUFFER_WIDTH + x] = framebuffer_pixel(x, y);
+
+    menu_forget();
+    menu_draw(menu);
+
+    int wrong = 0;
+    for (int y = 0; y < FRAMEBUFFER_HEIGHT; y++)
+        for (int x = 0; x < FRAMEBUFFER_WIDTH; x++)
+            wrong += shown[y * FRAMEBUFFER_WIDTH + x] != framebuffer_pixel(x, y);
+
+    printf("%-20s %6d pixels differ from a full redraw\n", "", expect_none(wrong));
+    framebuffer_frame();
+}
+
+static void draw_menus() {
+    menus_new();
+
+    const char *names[] = { "menu_main", "menu_play", "menu_select_level", "menu_score", "menu_win", "menu_lose" };
+    menu_t *menus[] = { menu_main, menu_play, menu_select_level, menu_score, menu_win, menu_lose };
+    for (int i = 0; i < 6; i++) {
+        menu_draw(menus[i]);
+        scene_end(names[i]);
+        check_menu(menus[i]);
+    }
+
+    menus_free();
+
+    // Labels built at runtime can differ in a single character of the same
+    // length, which has to be drawn all the same.
+    menu_t *before = menu_new("GAME ENDED");
+    menu_t *after = menu_new("GAME ENDED");
+    menu_set_component(before, 2, label_new("Score: 12"));
+    menu_set_component(after, 2, label_new("Score: 21"));
+    menu_draw(before);
+    framebuffer_frame();
+    menu_draw(after);
+    scene_end("menu_label");
+    check_menu(after);
+    menu_free(before);
+    menu_free(after);
+}
+
+// Check that the field on the screen is what a full redraw of the world gives.
+static void check_field(world_t *world) {
+    static uint16_t shown[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT];
+    for (int y = 0; y < FRAMEBUFFER_HEIGHT; y++)
+        for (int x = 0; x < FRAMEBUFFER_WIDTH; x++)
+            shown[y * FRAMEBUFFER_WIDTH + x] = framebuffer_pixel(x, y);
+
+    draw_field(world);
+
+    int wrong = 0;
+    for (int y = 0; y < FRAMEBUFFER_HEIGHT; y++)
+        for (int x = 0; x < FRAMEBUFFER_WIDTH; x++)
+            wrong += shown[y * FRAMEBUFFER_WIDTH + x] != framebuffer_pixel(x, y);
+
+    printf("%-20s %6d pixels differ from a full redraw\n", "", expect_none(wrong));
+    framebuffer_frame();
+}
+
+// Redraw one cell with every tile and every player overlay on it.
+static void draw_cells() {
+    tile_t tiles[] = {
+        EMPTY, BOMB, WALL, BOX, EXPLODING_BOMB, BOMB_EXPLOSION,
+        UPGRADE_EXPLOSION_BOMB_SIZE, UPGRADE_BOMB_SIZE, UPGRADE_BOX_BOMB_SIZE,
+        UPGRADE_EXPLOSION_BOMB_COUNT, UPGRADE_BOMB_COUNT, UPGRADE_BOX_BOMB_COUNT
+    };
+
+    player_t player;
+    memset(&player, 0, sizeof(player));
+
+    // Clearing the screen also brings a scrolled view back to the left.
+    draw_background(ILI9341_BLACK);
+
+    // Every redraw is a frame of its own, so only pixels that one redraw
+    // writes more than once count as overdraw.
+    uint16_t cells = 0;
+    uint32_t bytes = 0, pixels = 0, overdraw = 0;
+    for (uint8_t i = 0; i < sizeof(tiles) / sizeof(tiles[0]); i++) {
+        for (uint8_t overlay = 0; overlay < 5; overlay++) {
+            player.is_main = overlay > 2;
+            player.hit_duration = overlay == 2 || overlay == 4;
+
+            framebuffer_frame();
+            draw_cell(3, 3, tiles[i], overlay ? &player : NULL);
+            render_fence();
+
+            const framebuffer_stats_t *stats = framebuffer_stats();
+            bytes += stats->bytes;
+            pixels += stats->pixels;
+            overdraw += stats->overdraw;
+            cells++;
+        }
+    }
+
+    printf("%-20s %6u cells %8u bytes %7u pixels %7u overdraw, %u pixels per cell\n",
+           "cells", cells, bytes, pixels, overdraw, pixels / cells);
+    framebuffer_frame();
+}
+
+static void draw_game() {
+    const char *names[] = { "world_random", "world_plus", "world_full" };
+    button_mode_t modes[] = { BUTTON_MODE_SINGLEPLAYER_RANDOM, BUTTON_MODE_SINGLEPLAYER_PLUS, BUTTON_MODE_SINGLEPLAYER_FULL };
+
+    world_t *world = NULL;
+    for (int i = 0; i < 3; i++) {
+        world_free(world);
+        world = world_new(1);
+        world_generate(world, 42, modes[i]);
+        render_fence();
+        scene_end(names[i]);
+    }
+
+    // Repaint the whole field through the queue instead of the canvas, after
+    // something else was drawn over it.
+    draw_background(ILI9341_NAVY);
+    framebuffer_frame();
+    for (uint8_t y = 0; y < WORLD_HEIGHT; y++)
+        for (uint8_t x = 0; x < WORLD_WIDTH; x++)
+            world_redraw_tile(world, x, y);
+    world_flush(world);
+    render_fence();
+    scene_end("field_queued");
+    check_field(world);
+
+    // Walk down from the corner, drop a bomb and wait for it to explode.
+    player_t *player = player_new(1, 1, 1);
+    world->players[0] = player;
+    world_redraw_tile(world, player->x, player->y);
+    world_flush(world);
+
+    uint8_t script[] = { 1 << INPUT_JOY_DOWN, 1 << INPUT_BUTTON_C, 1 << INPUT_JOY_UP, 1 << INPUT_JOY_RIGHT };
+    for (int tick = 0; tick < 60; tick++) {
+        world_update(world, tick < 4 ? script[tick] : 0);
+        while (render_update());
+    }
+    scene_end("game_60_ticks");
+    check_field(world);
+    world_free(world);
+
+    // Detonate the biggest bomb in the middle of a field that is empty apart
+    // from the outer walls, and let the explosion clear again.
+    world = world_new(1);
+    for (uint8_t x = 0; x < WORLD_WIDTH; x++) {
+        world_set_tile(world, x, 0, WALL);
+        world_set_tile(world, x, WORLD_HEIGHT - 1, WALL);
+    }
+    for (uint8_t y = 0; y < WORLD_HEIGHT; y++) {
+        world_set_tile(world, 0, y, WALL);
+        world_set_tile(world, WORLD_WIDTH - 1, y, WALL);
+    }
+    draw_field(world);
+    memset(world->dirty, 0, sizeof(world->dirty));
+    framebuffer_frame();
+
+    player = player_new(WORLD_WIDTH / 2, WORLD_HEIGHT / 2, 1);
+    player->bomb_size = MAX_BOMB_SIZE;
+    world->players[0] = player;
+    world_redraw_tile(world, player->x, player->y);
+    world_update(world, 1 << INPUT_BUTTON_C);
+    for (int tick = 0; tick < 40; tick++) {
+        world_update(world, 0);
+        while (render_update());
+    }
+    scene_end("explosion");
+    check_field(world);
+    world_free(world);
+
+    draw_cells();
+}
+
+// Draw every tile nibble next to each other as a legend of the tile table, and
+// check the corner and the center of every tile against its entry.
+static void draw_tiles() {
+    draw_background(ILI9341_NAVY);
+    framebuffer_frame();
+
+    int wrong = 0;
+    for (uint8_t type = 0; type < 16 && type < WORLD_VIEW_WIDTH; type++) {
+        const render_tile_t *tile = &render_tiles::table[type];
+        draw_tile(type, 0, (tile_t)type);
+
+        // Nibbles that are no tile are not drawn at all.
+        bool known = tile->shape != RENDER_SHAPE_UNKNOWN;
+        int left = WORLD_TILE_SIZE * type, center = WORLD_TILE_SIZE / 2;
+        wrong += framebuffer_pixel(left, 0) != (known ? tile->background : ILI9341_NAVY);
+        wrong += framebuffer_pixel(left + center, center) != (known ? tile->overlay : ILI9341_NAVY);
+    }
+    scene_end("tiles");
+    printf("%-20s %6d pixels differ from the tile table\n", "", expect_none(wrong));
+}
+
+// Repaint the view of a field full of boxes through the canvas and through the
+// queue, and print how long the bus takes for it. The display runs at half the
+// 16 MHz clock of the Arduino, so every byte takes a microsecond. This is the
+// bus time only: the time the processor spends per primitive is measured on
+// the board, with a build that has RENDER_PROFILE set (see profile.h).
+static void draw_repaint() {
+    world_t *world = world_new(1);
+    world_generate(world, 42, BUTTON_MODE_SINGLEPLAYER_FULL);
+    render_fence();
+    framebuffer_frame();
+
+    draw_field(world);
+    uint32_t canvas = framebuffer_stats()->bytes;
+
+    draw_background(ILI9341_BLACK);
+    framebuffer_frame();
+    for (uint8_t y = 0; y < WORLD_HEIGHT; y++)
+        for (uint8_t x = 0; x < WORLD_VIEW_WIDTH; x++)
+            world_redraw_tile(world, x, y);
+    world_flush(world);
+    render_fence();
+    uint32_t queued = framebuffer_stats()->bytes;
+    framebuffer_frame();
+
+    printf("%-20s %2u px %2ux%-2u %8u bytes %4u ms canvas %8u bytes %4u ms queued\n",
+           "repaint", WORLD_TILE_SIZE, WORLD_VIEW_WIDTH, WORLD_HEIGHT,
+           canvas, (canvas + 500) / 1000, queued, (queued + 500) / 1000);
+    world_free(world);
+}
+
+#if WORLD_VIEW_WIDTH < WORLD_WIDTH
+// Walk along a world that is wider than the screen, with a box in every third
+// column, and check that the scrolled view stays right.
+static void draw_scroll() {
+    world_t *world = world_new(1);
+    world_generate(world, 42, BUTTON_MODE_SINGLEPLAYER_PLUS);
+    for (uint8_t x = 3; x < WORLD_WIDTH - 1; x += 3)
+        world_set_tile(world, x, 2, BOX);
+    for (uint8_t x = 1; x < WORLD_WIDTH - 1; x++)
+        world_set_tile(world, x, 1, EMPTY);
+    world_flush(world);
+    render_fence();
+    framebuffer_frame();
+
+    player_t *player = player_new(1, 1, 1);
+    world->players[0] = player;
+    world_redraw_tile(world, player->x, player->y);
+    for (int tick = 0; tick < 4 * WORLD_WIDTH && player->x < WORLD_WIDTH - 2; tick++) {
+        world_update(world, 1 << INPUT_JOY_RIGHT);
+        while (render_update());
+    }
+
+    int steps = WORLD_WIDTH - WORLD_VIEW_WIDTH;
+    uint32_t bytes = framebuffer_stats()->bytes;
+    scene_end("scroll");
+    printf("%-20s %6d columns scrolled, %u bytes per column\n", "", steps, bytes / steps);
+    check_field(world);
+    world_free(world);
+}
+#endif
+
+// Count the pixels of an image in the sprite format at the given position
+// that differ from the framebuffer, within the visible part of the screen.
+static int check_image(int x, int y, const uint8_t *image) {
+    const uint8_t *palette = &image[3];
+    const uint8_t *runs = palette + 2 * image[2];
+
+    int wrong = 0;
+    for (int i = 0; i < image[0] * image[1]; runs++) {
+        uint16_t color = palette[2 * (*runs & 0x0F)] | palette[2 * (*runs & 0x0F) + 1] << 8;
+        for (int run = (*runs >> 4) + 1; run; run--, i++) {
+            int px = x + i % image[0], py = y + i / image[0];
+            if (px < FRAMEBUFFER_WIDTH && py < FRAMEBUFFER_HEIGHT)
+                wrong += framebuffer_pixel(px, py) != color;
+        }
+    }
+    return wrong;
+}
+
+// Draw an image from flash (the top left corner of game_60_ticks, converted
+// with tools/spriteconvert) in the middle and across the bottom right corner.
+static void draw_images() {
+    draw_background(ILI9341_BLACK);
+    framebuffer_frame();
+
+    draw_image(100, 80, image_corner);
+    scene_end("image");
+    printf("%-20s %6d pixels differ from the image\n", "", expect_none(check_image(100, 80, image_corner)));
+
+    draw_image(280, 200, image_corner);
+    scene_end("image_clipped");
+    printf("%-20s %6d pixels differ from the image\n", "", expect_none(check_image(280, 200, image_corner)));
+}
+
+// Count the pixels of a 16-bit canvas at the given position that differ from
+// the framebuffer.
+static int check_canvas(GFXcanvas16 *canvas, int x, int y) {
+    int wrong = 0;
+    for (int row = 0; row < canvas->height(); row++)
+        for (int col = 0; col < canvas->width(); col++)
+            wrong += framebuffer_pixel(x + col, y + row) != canvas->getBuffer()[row * canvas->width() + col];
+    return wrong;
+}
+
+// Compose a panel off-screen and push it, then change a few small parts of it
+// and push only those.
+static void draw_canvas() {
+    draw_background(ILI9341_BLACK);
+    framebuffer_frame();
+
+    GFXcanvas16 canvas(120, 80);
+    canvas.fillScreen(ILI9341_NAVY);
+    canvas.fillRect(10, 10, 30, 20, ILI9341_RED);
+    canvas.fillCircle(80, 40, 15, ILI9341_YELLOW);
+    canvas.flush(tft, 100, 80);
+    scene_end("canvas");
+    printf("%-20s %6d pixels differ from the canvas\n", "", expect_none(check_canvas(&canvas, 100, 80)));
+
+    canvas.fillRect(12, 12, 8, 8, ILI9341_GREEN);
+    canvas.drawFastHLine(50, 70, 40, ILI9341_WHITE);
+    canvas.drawPixel(115, 2, ILI9341_WHITE);
+    canvas.flush(tft, 100, 80);
+    scene_end("canvas_changes");
+    printf("%-20s %6d pixels differ from the canvas\n", "", expect_none(check_canvas(&canvas, 100, 80)));
+
+    // More changes than the list holds end up merged, and what lies off the
+    // screen is left out.
+    for (int i = 0; i < 8; i++)
+        canvas.drawPixel(5 + 14 * i, 5 + 9 * i, ILI9341_MAGENTA);
+    canvas.flush(tft, 240, 200);
+    scene_end("canvas_merged");
+}
+
+// Draw a rectangle, a sprite, text and an image that all stick out of the
+// clip rectangle, and check that nothing outside of it was touched.
+static void draw_clip() {
+    draw_background(ILI9341_BLACK);
+    framebuffer_frame();
+
+    const int left = 100, top = 100, width = 40, height = 24;
+    tft.setClipRect(left, top, width, height);
+    draw_rect(90, 90, 60, 20, ILI9341_NAVY);
+    sprite_draw(92, 110, ILI9341_DARKGREY, ILI9341_RED);
+    sprite_draw(130, 92, ILI9341_DARKGREY, ILI9341_YELLOW);
+    tft.setTextSize(2);
+    tft.setTextColor(ILI9341_WHITE, ILI9341_BLACK);
+    tft.setCursor(95, 105);
+    tft.print("clip");
+    draw_image(120, 115, image_corner);
+    tft.resetClipRect();
+
+    const framebuffer_stats_t *stats = framebuffer_stats();
+    int outside = 0;
+    for (int y = 0; y < FRAMEBUFFER_HEIGHT; y++)
+        for (int x = 0; x < FRAMEBUFFER_WIDTH; x++)
+            if (x < left || x >= left + width || y < top || y >= top + height)
+                outside += framebuffer_pixel(x, y) != ILI9341_BLACK;
+
+    uint32_t pixels = stats->pixels;
+    scene_end("clip");
+    printf("%-20s %6d pixels changed outside the clip rectangle, %u pixels written into its %u\n",
+           "", expect_none(outside), pixels, width * height);
+}
+
+// Expand a run-length encoded font to a bit-packed one with the decoder of
+// 'fontconvert -r', so that both draw the same glyphs. The sizes of both
+// bitmaps are returned.
+static GFXfont *font_expand(const GFXfont *font, uint16_t *compressed_size, uint16_t *size) {
+    uint8_t glyphs = font->last - font->first + 1;
+    GFXglyph *glyph = (GFXglyph *)malloc(glyphs * sizeof(GFXglyph));
+    uint8_t *bitmap = (uint8_t *)calloc(glyphs, 255 * 255 / 8 + 1);
+
+    static uint8_t pixels[255 * 255], runs[255 * 255 + 1];
+
+    *compressed_size = 0;
+    *size = 0;
+    for (uint8_t i = 0; i < glyphs; i++) {
+        const GFXglyph *encoded = &font->glyph[i];
+        int count = encoded->width * encoded->height;
+
+        // Every glyph starts on a byte boundary and ends with the nibble that
+        // covers its last pixel.
+        int n = 0;
+        for (int covered = 0; covered < count; n++) {
+            uint8_t bits = font->bitmap[encoded->bitmapOffset + n / 2];
+            runs[n] = n & 1 ? bits & 0x0F : bits >> 4;
+            covered += runs[n];
+        }
+        if (!rle_decode(runs, n, pixels, count))
+            fprintf(stderr, "Couldn't decode glyph 0x%02X\n", font->first + i);
+
+        glyph[i] = *encoded;
+        glyph[i].bitmapOffset = *size;
+        for (int p = 0; p < count; p++)
+            if (pixels[p])
+                bitmap[*size + p / 8] |= 0x80 >> (p & 7);
+        *size += (count + 7) / 8;
+        *compressed_size = encoded->bitmapOffset + (n + 1) / 2;
+    }
+
+    GFXfont *expanded = (GFXfont *)malloc(sizeof(GFXfont));
+    *expanded = *font;
+    expanded->bitmap = bitmap;
+    expanded->glyph = glyph;
+    expanded->compressed = 0;
+    return expanded;
+}
+
+// Draw text in a bundled run-length encoded font at two sizes, then the same
+// text with the font expanded to bit-packed glyphs, and check that both give
+// the same pixels.
+static void draw_fonts() {
+    static uint16_t expected[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT];
+    uint16_t compressed_size, size;
+    GFXfont *expanded = font_expand(&FreeSans18pt7b, &compressed_size, &size);
+    const GFXfont *fonts[] = { expanded, &FreeSans18pt7b };
+
+    int wrong = 0;
+    for (int i = 0; i < 2; i++) {
+        draw_background(ILI9341_BLACK);
+        framebuffer_frame();
+
+        tft.setFont(fonts[i]);
+        tft.setTextColor(ILI9341_WHITE);
+        tft.setTextSize(1);
+        tft.setCursor(4, 40);
+        tft.print("Bomberman 0123");
+        tft.setTextSize(2);
+        tft.setCursor(4, 120);
+        tft.print("@&%gjQW");
+        tft.setFont(NULL);
+
+        for (int y = 0; y < FRAMEBUFFER_HEIGHT; y++) {
+            for (int x = 0; x < FRAMEBUFFER_WIDTH; x++) {
+                if (i)
+                    wrong += expected[y * FRAMEBUFFER_WIDTH + x] != framebuffer_pixel(x, y);
+                else
+                    expected[y * FRAMEBUFFER_WIDTH + x] = framebuffer_pixel(x, y);
+            }
+        }
+        scene_end(i ? "font_rle" : "font");
+    }
+
+    printf("%-20s %6d pixels differ from the bit-packed font, bitmaps %u bytes run-length encoded and %u bit-packed\n",
+           "", expect_none(wrong), compressed_size, size);
+
+    free(expanded->bitmap);
+    free(expanded->glyph);
+    free(expanded);
+}
+
+/************************
+ * Accessible functions *
+ ************************/
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-v"))
+            stubs_debug = true;
+        else
+            output = argv[i];
+    }
+
+    tft.begin();
+    touch_init();
+    framebuffer_frame();
+
+    draw_menus();
+    draw_game();
+    draw_repaint();
+    draw_tiles();
+#if WORLD_VIEW_WIDTH < WORLD_WIDTH
+    draw_scroll();
+#endif
+    draw_images();
+    draw_canvas();
+    draw_clip();
+    draw_fonts();
+
+    if (failures)
+        fprintf(stderr, "%d checks found wrong pixels\n", failures);
+    return failures ? 1 : 0;
+}
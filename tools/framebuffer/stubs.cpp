@@ -0,0 +1,74 @@
+// The parts of the game that talk to hardware other than the display. They do
+// nothing on the host, so the rendering code can be linked without changes.
+
+#include "game.h"
+#include "logger.h"
+#include "network.h"
+#include "packet.h"
+#include "score.h"
+#include "segments.h"
+
+#include <Adafruit_STMPE610.h>
+#include <Wire.h>
+
+#include <stdarg.h>
+#include <time.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+volatile uint8_t DDRC, PORTC;
+
+// Set by the driver to print the debug output of the game.
+bool stubs_debug = false;
+
+// Set by the driver to draw the menus of a multiplayer game.
+bool stubs_multiplayer = false;
+
+/************************
+ * Accessible functions *
+ ************************/
+
+unsigned long micros() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000UL + now.tv_nsec / 1000;
+}
+
+unsigned long millis() {
+    return micros() / 1000;
+}
+
+void debug(const char *fmt, ...) {
+    if (!stubs_debug)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+// The touchscreen is never touched.
+TS_Point::TS_Point() : x(0), y(0), z(0) {}
+TS_Point::TS_Point(int16_t x0, int16_t y0, int16_t z0) : x(x0), y(y0), z(z0) {}
+Adafruit_STMPE610::Adafruit_STMPE610(uint8_t) {}
+boolean Adafruit_STMPE610::begin(uint8_t) { return true; }
+boolean Adafruit_STMPE610::touched() { return false; }
+uint8_t Adafruit_STMPE610::bufferSize() { return 0; }
+TS_Point Adafruit_STMPE610::getPoint() { return TS_Point(); }
+
+void network_enable() {}
+bool network_available() { return false; }
+bool network_update() { return true; }
+packet_t *network_receive() { return NULL; }
+
+void packet_setup(uint16_t) {}
+void packet_send(identifier_t, player_t *) {}
+void packet_send_bomb(uint8_t) {}
+
+bool game_is_multiplayer() { return stubs_multiplayer; }
+
+float score_get() { return 1234; }
+uint16_t eeprom_get(uint16_t addr) { return 300 - 100 * addr; }
+
+void segments_show(uint8_t) {}
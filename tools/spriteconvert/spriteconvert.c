@@ -0,0 +1,183 @@
+/*
+PPM to sprite image converter for sprite_blit() in src/sprite.cpp.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool for preprocessing
+images to be drawn by the game.  Outputs to stdout; redirect to a header
+file, e.g.:
+  ./spriteconvert wall.ppm wall > wall.h
+
+Reads a binary PPM (P6, 8 bits per channel), so convert other formats
+first, e.g. 'convert wall.png wall.ppm' with ImageMagick.  With a
+rectangle after the name, only that part of the image is converted,
+which cuts one tile out of a sheet:
+  ./spriteconvert tiles.ppm box 19 0 19 19 > box.h
+
+Colors are reduced to RGB565, and the image may use at most 16 of them.
+Every image is decoded again and compared against the input, and the
+size against raw RGB565 pixels is reported on stderr.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../src/sprite.h" // Image format
+
+// Skip white space and comments in a PPM header, then read a number.
+int ppm_number(FILE *fp) {
+	int c, value = 0;
+	while((c = fgetc(fp)) != EOF) {
+		if(c == '#') {
+			while(((c = fgetc(fp)) != EOF) && (c != '\n'));
+		} else if((c < '0') || (c > '9')) {
+			continue;
+		} else {
+			break;
+		}
+	}
+	if(c == EOF) return -1;
+	for(; (c >= '0') && (c <= '9'); c = fgetc(fp)) value = value * 10 + c - '0';
+	return value; // One white space character after the number is consumed
+}
+
+// Read a binary PPM into RGB565 pixels.  Returns NULL on error.
+uint16_t *ppm_read(const char *path, int *width, int *height) {
+	FILE     *fp;
+	uint16_t *pixels = NULL;
+	uint8_t   rgb[3];
+	int       i, max;
+
+	if(!(fp = fopen(path, "rb"))) return NULL;
+	if((fgetc(fp) == 'P') && (fgetc(fp) == '6') &&
+	   ((*width = ppm_number(fp)) > 0) && ((*height = ppm_number(fp)) > 0) &&
+	   ((max = ppm_number(fp)) == 255) &&
+	   (pixels = malloc(*width * *height * sizeof(uint16_t)))) {
+		for(i=0; i < *width * *height; i++) {
+			if(fread(rgb, 1, 3, fp) != 3) {
+				free(pixels);
+				pixels = NULL;
+				break;
+			}
+			pixels[i] = ((rgb[0] & 0xF8) << 8) | ((rgb[1] & 0xFC) << 3) |
+			  (rgb[2] >> 3);
+		}
+	}
+	fclose(fp);
+	return pixels;
+}
+
+// Run-length encode 'n' pixels (palette indices) into one byte per run.
+// Returns the number of runs.
+int rle_encode(const uint8_t *pixels, int n, uint8_t *runs) {
+	int i = 0, count = 0, run;
+	while(i < n) {
+		for(run = 1; (i + run < n) && (run < SPRITE_RUN_LENGTH) &&
+		  (pixels[i + run] == pixels[i]); run++);
+		runs[count++] = ((run - 1) << 4) | pixels[i];
+		i += run;
+	}
+	return count;
+}
+
+// Decode runs back into 'n' pixels the same way sprite_blit() does.
+// Returns 0 if the runs don't cover exactly 'n' pixels.
+int rle_decode(const uint8_t *runs, int count, uint8_t *pixels, int n) {
+	int i, j = 0, run;
+	for(i = 0; (i < count) && (j < n); i++) {
+		run = (runs[i] >> 4) + 1;
+		if(j + run > n) return 0;
+		memset(&pixels[j], runs[i] & 0x0F, run);
+		j += run;
+	}
+	return (i == count) && (j == n);
+}
+
+int main(int argc, char *argv[]) {
+	int       i, x, y, width, height, left = 0, top = 0, w, h,
+	          colors = 0, n, count;
+	uint16_t *image, palette[SPRITE_IMAGE_COLORS], color;
+	uint8_t  *pixels, *runs, *check;
+
+	// Parse command line.  Valid syntaxes are:
+	//   spriteconvert [filename] [name]
+	//   spriteconvert [filename] [name] [x] [y] [width] [height]
+
+	if((argc != 3) && (argc != 7)) {
+		fprintf(stderr, "Usage: %s image.ppm name [x y width height]\n",
+		  argv[0]);
+		return 1;
+	}
+
+	if(!(image = ppm_read(argv[1], &width, &height))) {
+		fprintf(stderr, "Can't read %s as a binary PPM\n", argv[1]);
+		return 1;
+	}
+
+	w = width;
+	h = height;
+	if(argc == 7) {
+		left = atoi(argv[3]);
+		top  = atoi(argv[4]);
+		w    = atoi(argv[5]);
+		h    = atoi(argv[6]);
+	}
+	if((left < 0) || (top < 0) || (w < 1) || (h < 1) ||
+	   (left + w > width) || (top + h > height) || (w > 255) || (h > 255)) {
+		fprintf(stderr, "The rectangle has to be within the image and "
+		  "at most 255x255\n");
+		return 1;
+	}
+
+	// One run per pixel at worst
+	count = w * h;
+	if((!(pixels = malloc(count))) ||
+	   (!(runs   = malloc(count))) ||
+	   (!(check  = malloc(count)))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
+	}
+
+	// Build the palette in order of appearance
+	for(y=0; y < h; y++) {
+		for(x=0; x < w; x++) {
+			color = image[(top + y) * width + left + x];
+			for(i=0; (i < colors) && (palette[i] != color); i++);
+			if(i == colors) {
+				if(colors == SPRITE_IMAGE_COLORS) {
+					fprintf(stderr, "More than %d colors\n",
+					  SPRITE_IMAGE_COLORS);
+					return 1;
+				}
+				palette[colors++] = color;
+			}
+			pixels[y * w + x] = i;
+		}
+	}
+
+	n = rle_encode(pixels, count, runs);
+	if(!rle_decode(runs, n, check, count) || memcmp(pixels, check, count)) {
+		fprintf(stderr, "RLE round trip failed\n");
+		return 1;
+	}
+
+	printf("const uint8_t %s[] PROGMEM = {\n", argv[2]);
+	printf("  %d, %d, %d, // Width, height, colors\n", w, h, colors);
+	for(i=0; i < colors; i++) {
+		printf("  0x%02X, 0x%02X, // 0x%04X\n",
+		  palette[i] & 0xFF, palette[i] >> 8, palette[i]);
+	}
+	for(i=0; i < n; i++) {
+		printf("%s0x%02X", (i % 12) ? ", " : "  ", runs[i]);
+		if((i % 12 == 11) || (i == n - 1)) printf(",\n");
+	}
+	printf("};\n");
+
+	fprintf(stderr, "%s: %d bytes, %d as raw RGB565\n", argv[2],
+	  3 + 2 * colors + n, 2 * count);
+
+	free(image);
+	free(pixels);
+	free(runs);
+	free(check);
+	return 0;
+}